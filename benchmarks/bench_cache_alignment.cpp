@@ -13,6 +13,7 @@
 #include <slick/orderbook/orderbook.hpp>
 #include <slick/orderbook/detail/price_level_l3.hpp>
 #include <slick/orderbook/detail/order.hpp>
+#include <slick/orderbook/detail/soa_level_container.hpp>
 #include <benchmark/benchmark.h>
 #include <iostream>
 #include <type_traits>
@@ -244,6 +245,68 @@ static void BM_StructureOfArrays(benchmark::State& state) {
 
 BENCHMARK(BM_StructureOfArrays);
 
+// ============================================================================
+// Benchmark: Level Search, Array of Structures vs Separate Price Column
+// ============================================================================
+
+/// Bid prices to look up: 90% within the best 16 levels, the rest anywhere in the book
+static std::vector<Price> levelSearchPrices(int64_t num_levels) {
+    std::mt19937_64 rng(77);
+    std::vector<Price> prices(4096);
+    for (auto& price : prices) {
+        const auto depth = rng() % 10 == 0 ? rng() % static_cast<uint64_t>(num_levels)
+                                           : rng() % std::min<uint64_t>(16, static_cast<uint64_t>(num_levels));
+        price = 100000 - static_cast<Price>(depth);
+    }
+    return prices;
+}
+
+/// Find a bid level by price (the search every L2 update starts with)
+template<typename Container>
+static void BM_LevelSearch(benchmark::State& state) {
+    const auto num_levels = state.range(0);
+    Container levels;
+    for (int64_t i = 0; i < num_levels; ++i) {
+        levels.insertOrUpdate(100000 - i, 100, 0);
+    }
+    const auto prices = levelSearchPrices(num_levels);
+
+    std::size_t next = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(levels.find(prices[next++ & 4095]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_LevelSearch, LevelContainer<Side::Buy>)->Arg(8)->Arg(16)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_LevelSearch, SoaLevelContainer<Side::Buy>)->Arg(8)->Arg(16)->Arg(64)->Arg(256)->Arg(1024);
+
+/// Update a bid level's quantity, deleting and re-adding one in 8 (search plus the shift of every deeper level)
+template<typename Container>
+static void BM_LevelSearchUpdate(benchmark::State& state) {
+    const auto num_levels = state.range(0);
+    Container levels;
+    for (int64_t i = 0; i < num_levels; ++i) {
+        levels.insertOrUpdate(100000 - i, 100, 0);
+    }
+    const auto prices = levelSearchPrices(num_levels);
+
+    std::size_t next = 0;
+    for (auto _ : state) {
+        const Price price = prices[next & 4095];
+        if ((++next & 7) == 0) {
+            levels.erase(price);
+        }
+        benchmark::DoNotOptimize(levels.insertOrUpdate(price, static_cast<Quantity>(next), 0));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_LevelSearchUpdate, LevelContainer<Side::Buy>)->Arg(16)->Arg(256)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_LevelSearchUpdate, SoaLevelContainer<Side::Buy>)->Arg(16)->Arg(256)->Arg(1024);
+
 // ============================================================================
 // Benchmark: Sequential vs Random Access (Cache Locality)
 // ============================================================================
@@ -0,0 +1,591 @@
+/**
+ * @file bench_feed_profiles.cpp
+ * @brief Feed-driven replay benchmarks with per-operation latency percentiles
+ *
+ * Replays order flow generated from statistical feed profiles and times every operation on its own,
+ * so tails from vector shifts, pool growth and cold caches show up instead of averaging away:
+ * - Add/cancel/modify/execute mix (cancels dominate trades, as on real venues)
+ * - Add distance from the touch: geometric near the touch, a uniform share across the whole depth,
+ *   and a share improving the spread
+ * - Bursts: runs of quote flicker at the touch, or sweeps executing whole touch levels, optionally
+ *   separated by idle gaps that evict the caches
+ * - Resting depth from tens to thousands of levels per side
+ *
+ * The L3 feed is generated against a model book; the L2 feed is its per-level aggregation (what a
+ * venue's depth feed would publish for the same flow). Every profile runs on each L2 level container
+ * and each L3 book policy. Counters report p50, p99 and p99.9 per operation and the worst sample, in
+ * nanoseconds; `clock_ns` is the median cost of an empty timed section, included in every sample.
+ * Iteration time is the sum of the timed operations (book setup and cache eviction are excluded).
+ *
+ * Add a row to kProfiles to try another feed; select runs with --benchmark_filter, e.g.
+ * `--benchmark_filter=FeedL3/deep`.
+ *
+ * GCC 12, -O3 -march=native (AVX-512), header-only, 200k events per profile, single-core sandbox.
+ * Add latency p50 / p99 / p99.9 in ns, clock_ns ~27 included:
+ *
+ *   Book                       active            deep                  sweep
+ *   OrderBookL2                103 / 159 / 223   287 / 703 / 895       79 / 287 / 575
+ *   LadderOrderBookL2          71 / 111 / 143    71 / 95 / 127         63 / 159 / 319
+ *   SoaOrderBookL2             143 / 287 / 479   351 / 1023 / 1279     103 / 415 / 703
+ *   CompactOrderBookL2         103 / 191 / 351   207 / 383 / 511       79 / 255 / 479
+ *   OrderBookL3                87 / 287 / 479    175 / 5631 / 7167     111 / 703 / 1023
+ *   DirectIndexedOrderBookL3   95 / 351 / 703    159 / 6655 / 9215     79 / 639 / 1151
+ *   LadderOrderBookL3          95 / 207 / 319    111 / 223 / 351       103 / 239 / 415
+ *   CompactOrderBookL3         95 / 239 / 383    159 / 3583 / 5119     111 / 479 / 703
+ *
+ * Sorted-vector levels hold their medians but their tails grow with depth (each insert or erase far
+ * from the touch shifts the levels after it; L3 levels are larger, so they shift more bytes). The
+ * ladders keep deep-book tails flat. SoaOrderBookL2 searches faster near the touch but shifts two arrays,
+ * which shows in these tails. Cancels follow the same pattern.
+ */
+
+#include <slick/orderbook/orderbook.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+using namespace slick::orderbook;
+
+// ============================================================================
+// Feed Profiles
+// ============================================================================
+
+struct FeedProfile {
+    const char* name;
+    std::size_t depth;              // Resting levels per side before the replay (one tick apart)
+    std::size_t orders_per_level;   // Resting orders per level before the replay
+    double add_weight;              // Relative frequency of new orders
+    double cancel_weight;           // Relative frequency of full cancels
+    double modify_weight;           // Relative frequency of modifies (quantity cuts, some reprices)
+    double execute_weight;          // Relative frequency of executions at the touch
+    double touch_mean;              // Mean distance from the touch of an add, in ticks (geometric)
+    double deep_fraction;           // Share of adds placed uniformly across the whole depth
+    double improve_fraction;        // Share of adds improving the spread (a new best level)
+    double burst_rate;              // Chance per event that a burst starts
+    double burst_mean;              // Mean burst length in events
+    double sweep_fraction;          // Share of bursts that sweep a side instead of flickering at the touch
+    std::size_t cold_bytes;         // Data touched before each burst to evict the caches (0 = stay warm)
+};
+
+static constexpr std::array kProfiles{
+    // Liquid large-cap: shallow book, flicker at the touch
+    FeedProfile{"quiet", 20, 2, 0.45, 0.40, 0.10, 0.05, 2.0, 0.02, 0.02, 0.001, 8, 0.1, 0},
+    // Busy book with bursts separated by idle gaps
+    FeedProfile{"active", 200, 4, 0.48, 0.44, 0.05, 0.03, 3.0, 0.05, 0.05, 0.01, 32, 0.2, std::size_t{1} << 20},
+    // Thousands of levels, adds spread across the depth (insert position far from the touch)
+    FeedProfile{"deep", 2000, 2, 0.49, 0.46, 0.03, 0.02, 40.0, 0.40, 0.01, 0.002, 16, 0.05, 0},
+    // Fast market: sweeps clear touch levels and new quotes improve the spread
+    FeedProfile{"sweep", 200, 3, 0.45, 0.35, 0.05, 0.15, 2.0, 0.02, 0.15, 0.02, 64, 0.6, std::size_t{4} << 20},
+};
+
+static constexpr std::size_t kFeedEvents = 200000;
+static constexpr Price kMid = 1000000;
+
+enum class FeedOp : uint8_t { Add, Modify, Cancel, Execute, Count };
+
+static constexpr std::array<const char*, static_cast<std::size_t>(FeedOp::Count)> kOpNames{
+    "add", "modify", "cancel", "execute"};
+
+/// One order book operation (L3 feed)
+struct OrderEvent {
+    OrderId order_id;
+    Price price;
+    Quantity quantity;      // Add: quantity; Modify: new quantity; Execute: executed quantity
+    Side side;
+    FeedOp op;
+    bool cold;              // Evict the caches before this event (start of a burst after a gap)
+};
+
+/// One level update (L2 feed): Add creates the level, Modify changes it, Cancel removes it
+struct LevelEvent {
+    Price price;
+    Quantity quantity;
+    Side side;
+    FeedOp op;
+    bool cold;
+};
+
+struct Feed {
+    std::vector<SnapshotOrder> initial_orders;
+    std::vector<detail::PriceLevelL2> initial_bids;
+    std::vector<detail::PriceLevelL2> initial_asks;
+    std::vector<OrderEvent> orders;
+    std::vector<LevelEvent> levels;
+    std::size_t final_orders = 0;
+    std::array<std::size_t, SideCount> final_levels{};
+};
+
+// ============================================================================
+// Feed Generator
+// ============================================================================
+
+/// Generates a feed by running the profile against a model book
+class FeedGenerator {
+public:
+    FeedGenerator(const FeedProfile& profile, uint64_t seed) : profile_(profile), rng_(seed) {}
+
+    Feed generate(std::size_t count) {
+        Feed feed;
+        seed(feed);
+        const std::size_t target = live_.size();
+
+        // Indexed by FeedOp
+        std::discrete_distribution<int> op_dist{profile_.add_weight, profile_.modify_weight, profile_.cancel_weight,
+                                                profile_.execute_weight};
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        std::size_t burst_left = 0;
+        bool sweeping = false;
+        Side burst_side = Side::Buy;
+
+        feed.orders.reserve(count);
+        feed.levels.reserve(count + count / 4);
+        while (feed.orders.size() < count) {
+            bool cold = false;
+            if (burst_left == 0 && unit(rng_) < profile_.burst_rate) {
+                std::geometric_distribution<std::size_t> length(1.0 / profile_.burst_mean);
+                burst_left = length(rng_) + 1;
+                sweeping = unit(rng_) < profile_.sweep_fraction;
+                burst_side = (rng_() & 1) ? Side::Buy : Side::Sell;
+                cold = profile_.cold_bytes > 0;
+            }
+
+            auto op = static_cast<FeedOp>(op_dist(rng_));
+            Side side = (rng_() & 1) ? Side::Buy : Side::Sell;
+            double touch_mean = profile_.touch_mean;
+            if (burst_left > 0) {
+                --burst_left;
+                side = burst_side;
+                if (sweeping) {
+                    op = FeedOp::Execute;
+                } else {
+                    // Quote flicker: add and pull at the touch
+                    op = (rng_() & 1) ? FeedOp::Add : FeedOp::Cancel;
+                    touch_mean = 1.0;
+                }
+            }
+
+            // Keep the book near its starting size
+            if (live_.size() < target * 4 / 5 || live_.empty()) {
+                op = FeedOp::Add;
+            } else if (live_.size() > target * 6 / 5 && op == FeedOp::Add) {
+                op = FeedOp::Cancel;
+            }
+            if (op == FeedOp::Execute && levels_[side].empty()) {
+                op = FeedOp::Add;
+            }
+
+            switch (op) {
+                case FeedOp::Add:
+                    add(feed, side, addPrice(side, touch_mean), cold);
+                    break;
+                case FeedOp::Cancel:
+                    cancel(feed, pickOrder(), cold);
+                    break;
+                case FeedOp::Modify:
+                    modify(feed, pickOrder(), cold);
+                    break;
+                case FeedOp::Execute:
+                    execute(feed, side, sweeping && burst_left > 0, cold);
+                    break;
+                case FeedOp::Count:
+                    break;
+            }
+        }
+
+        feed.final_orders = live_.size();
+        feed.final_levels = {levels_[Side::Buy].size(), levels_[Side::Sell].size()};
+        return feed;
+    }
+
+private:
+    struct ModelOrder {
+        Price price;
+        Quantity quantity;
+        Side side;
+        std::size_t live_index;
+    };
+
+    struct ModelLevel {
+        std::deque<OrderId> queue;
+        Quantity total = 0;
+    };
+
+    void seed(Feed& feed) {
+        std::uniform_int_distribution<Quantity> qty(1, 1000);
+        for (std::size_t i = 0; i < profile_.depth; ++i) {
+            for (const Side side : {Side::Buy, Side::Sell}) {
+                const Price price = side == Side::Buy ? kMid - 1 - static_cast<Price>(i) : kMid + 1 + static_cast<Price>(i);
+                for (std::size_t k = 0; k < profile_.orders_per_level; ++k) {
+                    const OrderId id = next_id_++;
+                    const Quantity quantity = qty(rng_);
+                    insert(id, side, price, quantity);
+                    feed.initial_orders.push_back({id, side, price, quantity, 0, id});
+                }
+                auto& levels = side == Side::Buy ? feed.initial_bids : feed.initial_asks;
+                levels.push_back({price, levels_[side].at(price).total, 0});
+            }
+        }
+    }
+
+    [[nodiscard]] Price best(Side side) const {
+        if (levels_[side].empty()) {
+            const Side other = side == Side::Buy ? Side::Sell : Side::Buy;
+            if (levels_[other].empty()) {
+                return side == Side::Buy ? kMid - 1 : kMid + 1;
+            }
+            return side == Side::Buy ? levels_[other].begin()->first - 1 : levels_[other].rbegin()->first + 1;
+        }
+        return side == Side::Buy ? levels_[side].rbegin()->first : levels_[side].begin()->first;
+    }
+
+    [[nodiscard]] Price addPrice(Side side, double touch_mean) {
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        const Price touch = best(side);
+        const double draw = unit(rng_);
+        if (draw < profile_.improve_fraction) {
+            const Price improved = side == Side::Buy ? touch + 1 : touch - 1;
+            const Price other = best(side == Side::Buy ? Side::Sell : Side::Buy);
+            if (side == Side::Buy ? improved < other : improved > other) {
+                return improved;
+            }
+            return touch;
+        }
+        Price distance;
+        if (draw < profile_.improve_fraction + profile_.deep_fraction) {
+            distance = std::uniform_int_distribution<Price>(0, static_cast<Price>(profile_.depth))(rng_);
+        } else {
+            distance = std::geometric_distribution<Price>(1.0 / (touch_mean + 1.0))(rng_);
+        }
+        return side == Side::Buy ? touch - distance : touch + distance;
+    }
+
+    /// Pick an order to cancel or modify: mostly recent adds, sometimes any resting order
+    [[nodiscard]] OrderId pickOrder() {
+        const std::size_t size = live_.size();
+        const std::size_t recent = std::min<std::size_t>(size, 64);
+        if (rng_() % 5 != 0) {
+            return live_[size - 1 - rng_() % recent];
+        }
+        return live_[rng_() % size];
+    }
+
+    void insert(OrderId id, Side side, Price price, Quantity quantity) {
+        orders_[id] = ModelOrder{price, quantity, side, live_.size()};
+        live_.push_back(id);
+        ModelLevel& level = levels_[side][price];
+        level.queue.push_back(id);
+        level.total += quantity;
+    }
+
+    void erase(OrderId id) {
+        const ModelOrder order = orders_.at(id);
+        live_[order.live_index] = live_.back();
+        orders_.at(live_.back()).live_index = order.live_index;
+        live_.pop_back();
+        ModelLevel& level = levels_[order.side].at(order.price);
+        level.queue.erase(std::find(level.queue.begin(), level.queue.end(), id));
+        level.total -= order.quantity;
+        if (level.queue.empty()) {
+            levels_[order.side].erase(order.price);
+        }
+        orders_.erase(id);
+    }
+
+    /// Emit the L2 update a change to a level produces
+    void emitLevel(Feed& feed, Side side, Price price, bool existed, bool cold) {
+        auto it = levels_[side].find(price);
+        const Quantity total = it == levels_[side].end() ? 0 : it->second.total;
+        const FeedOp op = !existed ? FeedOp::Add : (total == 0 ? FeedOp::Cancel : FeedOp::Modify);
+        feed.levels.push_back({price, total, side, op, cold});
+    }
+
+    void add(Feed& feed, Side side, Price price, bool cold) {
+        const OrderId id = next_id_++;
+        const Quantity quantity = std::uniform_int_distribution<Quantity>(1, 1000)(rng_);
+        const bool existed = levels_[side].contains(price);
+        insert(id, side, price, quantity);
+        feed.orders.push_back({id, price, quantity, side, FeedOp::Add, cold});
+        emitLevel(feed, side, price, existed, cold);
+    }
+
+    void cancel(Feed& feed, OrderId id, bool cold) {
+        const ModelOrder order = orders_.at(id);
+        erase(id);
+        feed.orders.push_back({id, order.price, 0, order.side, FeedOp::Cancel, cold});
+        emitLevel(feed, order.side, order.price, true, cold);
+    }
+
+    void modify(Feed& feed, OrderId id, bool cold) {
+        ModelOrder& order = orders_.at(id);
+        if (order.quantity <= 1) {
+            cancel(feed, id, cold);
+            return;
+        }
+        const Side side = order.side;
+        const Price old_price = order.price;
+        const Quantity quantity = std::uniform_int_distribution<Quantity>(1, order.quantity - 1)(rng_);
+        if (rng_() % 4 == 0) {
+            // Cancel-replace to a new price (loses queue position)
+            const Price price = addPrice(side, profile_.touch_mean);
+            if (price != old_price) {
+                const bool existed = levels_[side].contains(price);
+                erase(id);
+                insert(id, side, price, quantity);
+                feed.orders.push_back({id, price, quantity, side, FeedOp::Modify, cold});
+                emitLevel(feed, side, old_price, true, cold);
+                emitLevel(feed, side, price, existed, cold);
+                return;
+            }
+        }
+        levels_[side].at(old_price).total -= order.quantity - quantity;
+        order.quantity = quantity;
+        feed.orders.push_back({id, old_price, quantity, side, FeedOp::Modify, cold});
+        emitLevel(feed, side, old_price, true, cold);
+    }
+
+    void execute(Feed& feed, Side side, bool full, bool cold) {
+        const Price price = best(side);
+        const OrderId id = levels_[side].at(price).queue.front();
+        ModelOrder& order = orders_.at(id);
+        const Quantity executed = full ? order.quantity
+                                       : std::uniform_int_distribution<Quantity>(1, order.quantity)(rng_);
+        feed.orders.push_back({id, price, executed, side, FeedOp::Execute, cold});
+        if (executed == order.quantity) {
+            erase(id);
+        } else {
+            order.quantity -= executed;
+            levels_[side].at(price).total -= executed;
+        }
+        emitLevel(feed, side, price, true, cold);
+    }
+
+    const FeedProfile& profile_;
+    std::mt19937_64 rng_;
+    OrderId next_id_ = 1;
+    std::unordered_map<OrderId, ModelOrder> orders_;
+    std::vector<OrderId> live_;
+    std::array<std::map<Price, ModelLevel>, SideCount> levels_;
+};
+
+static const Feed& feedFor(std::size_t profile) {
+    static std::array<std::unique_ptr<Feed>, kProfiles.size()> feeds;
+    if (!feeds[profile]) {
+        feeds[profile] = std::make_unique<Feed>(FeedGenerator(kProfiles[profile], 42 + profile).generate(kFeedEvents));
+    }
+    return *feeds[profile];
+}
+
+// ============================================================================
+// Replay
+// ============================================================================
+
+using Clock = std::chrono::steady_clock;
+
+/// Latency histograms of one benchmark run, one per operation
+struct OpLatencies {
+    std::array<LatencyHistogram, static_cast<std::size_t>(FeedOp::Count)> histograms;
+
+    template<typename Fn>
+    uint64_t time(FeedOp op, Fn&& fn) {
+        const auto start = Clock::now();
+        fn();
+        const auto nanos = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+        histograms[static_cast<std::size_t>(op)].record(nanos);
+        return nanos;
+    }
+};
+
+/// Median cost of an empty timed section
+static double clockOverhead() {
+    static const double overhead = [] {
+        OpLatencies latencies;
+        for (int i = 0; i < 100000; ++i) {
+            latencies.time(FeedOp::Add, [] {});
+        }
+        return static_cast<double>(latencies.histograms[0].snapshot().percentile(0.5));
+    }();
+    return overhead;
+}
+
+/// Touch one byte per cache line of a buffer larger than the caches we want to flush
+static void evictCaches(std::size_t bytes) {
+    static std::vector<uint8_t> buffer;
+    if (buffer.size() < bytes) {
+        buffer.resize(bytes);
+    }
+    for (std::size_t i = 0; i < bytes; i += SLICK_CACHE_LINE_SIZE) {
+        buffer[i] = static_cast<uint8_t>(buffer[i] + 1);
+    }
+    benchmark::ClobberMemory();
+}
+
+static void reportLatencies(benchmark::State& state, const OpLatencies& latencies) {
+    uint64_t worst = 0;
+    for (std::size_t op = 0; op < latencies.histograms.size(); ++op) {
+        const LatencySnapshot snapshot = latencies.histograms[op].snapshot();
+        if (snapshot.count == 0) {
+            continue;
+        }
+        const std::string name = kOpNames[op];
+        state.counters[name + "_p50"] = static_cast<double>(snapshot.percentile(0.5));
+        state.counters[name + "_p99"] = static_cast<double>(snapshot.percentile(0.99));
+        state.counters[name + "_p99.9"] = static_cast<double>(snapshot.percentile(0.999));
+        worst = std::max(worst, snapshot.max_nanos);
+    }
+    state.counters["max"] = static_cast<double>(worst);
+    state.counters["clock_ns"] = clockOverhead();
+}
+
+template<typename Book>
+static Book makeL2Book() {
+    if constexpr (std::is_constructible_v<Book, SymbolId, PriceLadderConfig>) {
+        return Book(1, PriceLadderConfig{1, 4096});
+    } else {
+        return Book(1);
+    }
+}
+
+template<typename Book>
+static Book makeL3Book(std::size_t orders) {
+    if constexpr (std::is_constructible_v<Book, SymbolId, PriceLadderConfig, std::size_t, std::size_t>) {
+        return Book(1, PriceLadderConfig{1, 4096}, 10, orders);
+    } else {
+        return Book(1, 10, orders);
+    }
+}
+
+template<typename Book>
+static void BM_FeedL2(benchmark::State& state, std::size_t profile) {
+    const Feed& feed = feedFor(profile);
+    const std::size_t cold_bytes = kProfiles[profile].cold_bytes;
+    OpLatencies latencies;
+    bool checked = false;
+
+    for (auto _ : state) {
+        Book book = makeL2Book<Book>();
+        book.loadSnapshot(feed.initial_bids, feed.initial_asks);
+
+        uint64_t total = 0;
+        Timestamp timestamp = 0;
+        for (const LevelEvent& event : feed.levels) {
+            if (event.cold) {
+                evictCaches(cold_bytes);
+            }
+            total += latencies.time(event.op, [&] {
+                book.updateLevel(event.side, event.price, event.quantity, ++timestamp);
+            });
+        }
+        state.SetIterationTime(static_cast<double>(total) * 1e-9);
+
+        if (!checked) {
+            checked = true;
+            if (book.levelCount(Side::Buy) != feed.final_levels[Side::Buy] ||
+                book.levelCount(Side::Sell) != feed.final_levels[Side::Sell]) {
+                state.SkipWithError("book diverged from the feed model");
+                break;
+            }
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * feed.levels.size()));
+    reportLatencies(state, latencies);
+}
+
+template<typename Book>
+static void BM_FeedL3(benchmark::State& state, std::size_t profile) {
+    const Feed& feed = feedFor(profile);
+    const std::size_t cold_bytes = kProfiles[profile].cold_bytes;
+    OpLatencies latencies;
+    bool checked = false;
+
+    for (auto _ : state) {
+        // Pools start at the resting size so growth during the replay is part of the measurement
+        Book book = makeL3Book<Book>(feed.initial_orders.size());
+        book.loadSnapshot(feed.initial_orders);
+
+        uint64_t total = 0;
+        Timestamp timestamp = 0;
+        for (const OrderEvent& event : feed.orders) {
+            if (event.cold) {
+                evictCaches(cold_bytes);
+            }
+            ++timestamp;
+            total += latencies.time(event.op, [&] {
+                bool ok = false;
+                switch (event.op) {
+                    case FeedOp::Add:
+                        ok = book.addOrder(event.order_id, event.side, event.price, event.quantity, timestamp);
+                        break;
+                    case FeedOp::Modify:
+                        ok = book.modifyOrder(event.order_id, event.price, event.quantity, timestamp);
+                        break;
+                    case FeedOp::Cancel:
+                        ok = book.deleteOrder(event.order_id, timestamp);
+                        break;
+                    case FeedOp::Execute:
+                        ok = book.executeOrder(event.order_id, event.quantity, timestamp);
+                        break;
+                    case FeedOp::Count:
+                        break;
+                }
+                benchmark::DoNotOptimize(ok);
+            });
+        }
+        state.SetIterationTime(static_cast<double>(total) * 1e-9);
+
+        if (!checked) {
+            checked = true;
+            if (book.orderCount() != feed.final_orders || book.levelCount(Side::Buy) != feed.final_levels[Side::Buy] ||
+                book.levelCount(Side::Sell) != feed.final_levels[Side::Sell]) {
+                state.SkipWithError("book diverged from the feed model");
+                break;
+            }
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * feed.orders.size()));
+    reportLatencies(state, latencies);
+}
+
+static void registerFeed(const char* family, const char* book_name,
+                         void (*run)(benchmark::State&, std::size_t)) {
+    for (std::size_t profile = 0; profile < kProfiles.size(); ++profile) {
+        const std::string name = std::string(family) + "/" + kProfiles[profile].name + "/" + book_name;
+        benchmark::RegisterBenchmark(name.c_str(), run, profile)->UseManualTime()->Unit(benchmark::kMillisecond);
+    }
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char** argv) {
+    registerFeed("FeedL2", "OrderBookL2", BM_FeedL2<OrderBookL2>);
+    registerFeed("FeedL2", "LadderOrderBookL2", BM_FeedL2<LadderOrderBookL2>);
+    registerFeed("FeedL2", "SoaOrderBookL2", BM_FeedL2<SoaOrderBookL2>);
+    registerFeed("FeedL2", "CompactOrderBookL2", BM_FeedL2<CompactOrderBookL2>);
+
+    registerFeed("FeedL3", "OrderBookL3", BM_FeedL3<OrderBookL3>);
+    registerFeed("FeedL3", "DirectIndexedOrderBookL3", BM_FeedL3<DirectIndexedOrderBookL3>);
+    registerFeed("FeedL3", "LadderOrderBookL3", BM_FeedL3<LadderOrderBookL3>);
+    registerFeed("FeedL3", "CompactOrderBookL3", BM_FeedL3<CompactOrderBookL3>);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
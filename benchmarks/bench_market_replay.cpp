@@ -10,6 +10,24 @@
  * - Multi-symbol scenarios
  *
  * Provides end-to-end performance measurements
+ *
+ * Multi-symbol replay, OrderBookManager vs OrderBookEngine (GCC 12, -O3, items/s; the engine
+ * numbers are wall time and include the submitting thread). Measured on a single-core sandbox, so the
+ * shards time-slice rather than run in parallel; the gain here comes from the lock-free symbol lookup
+ * and the feed thread only copying messages. Expect shard scaling on a multi-core host.
+ *
+ *   Symbols  Manager   Engine/1 shard  Engine/2 shards  Engine/4 shards
+ *   10       11.7M     8.2M            -                -
+ *   100      6.7M      9.3M            -                -
+ *   1000     4.2M      7.2M            8.6M             9.2M
+ *
+ * Journal replay of 1M L3 events (GCC 12, -O3, header-only): the mapped journal replays at the speed
+ * of the in-memory event vector; scanning the journal alone runs at memory bandwidth.
+ *
+ *   Benchmark              ms      items/s    bytes/s
+ *   JournalReplay/0        1089    0.93M      -          (in-memory events)
+ *   JournalReplay/1        1129    0.89M      48M        (mapped journal)
+ *   JournalReplay/2        3.7     279M       14.5G      (scan only)
  */
 
 #include <slick/orderbook/orderbook.hpp>
@@ -17,6 +35,9 @@
 #include <random>
 #include <vector>
 #include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
 
 using namespace slick::orderbook;
 
@@ -311,6 +332,122 @@ static void BM_L3_MarketReplay_HighFreq(benchmark::State& state) {
 
 BENCHMARK(BM_L3_MarketReplay_HighFreq);
 
+// ============================================================================
+// Benchmark: Journal Replay
+// ============================================================================
+
+// Record generated L3 events as a journal (NewOrder -> addOrder, ModifyOrder -> modifyOrder)
+static bool writeL3Journal(const std::vector<MarketEvent>& events, SymbolId symbol, const std::string& path) {
+    JournalWriter journal;
+    if (!journal.open(path)) {
+        return false;
+    }
+    for (const auto& event : events) {
+        switch (event.type) {
+            case MarketEventType::NewOrder:
+                journal.addOrder(symbol, event.order_id, event.side, event.price, event.quantity,
+                                 event.timestamp, event.priority);
+                break;
+            case MarketEventType::ModifyOrder:
+                journal.modifyOrder(symbol, event.order_id, event.price, event.quantity,
+                                    event.timestamp, event.priority);
+                break;
+            case MarketEventType::DeleteOrder:
+                journal.deleteOrder(symbol, event.order_id, event.timestamp);
+                break;
+            case MarketEventType::ExecuteOrder:
+                journal.executeOrder(symbol, event.order_id, event.quantity, event.timestamp);
+                break;
+            default:
+                break;
+        }
+    }
+    return journal.close();
+}
+
+// Replay 1M L3 events: Arg 0 from the in-memory event vector, Arg 1 from a memory-mapped journal,
+// Arg 2 only scans the journal (reader throughput without the books).
+// Set SLICK_REPLAY_JOURNAL to a recorded journal to replay a captured session instead (Arg 1 and 2;
+// L2 and L3 records are applied to books of their kind)
+static void BM_L3_JournalReplay(benchmark::State& state) {
+    const bool from_journal = state.range(0) != 0;
+    const bool scan_only = state.range(0) == 2;
+    const char* recorded = std::getenv("SLICK_REPLAY_JOURNAL");
+    const std::string path = recorded != nullptr
+        ? std::string(recorded)
+        : (std::filesystem::temp_directory_path() / "slick_bench_replay.jrnl").string();
+
+    MarketDataGenerator gen(24680);
+    std::vector<MarketEvent> events;
+    if (recorded == nullptr || !from_journal) {
+        events = gen.generateL3Events(1000000, 100000, 100100);
+    }
+    if (recorded == nullptr && from_journal && !writeL3Journal(events, 1, path)) {
+        state.SkipWithError("journal write failed");
+        return;
+    }
+
+    JournalReader journal;
+    if (from_journal && !journal.open(path)) {
+        state.SkipWithError("journal open failed");
+        return;
+    }
+
+    std::size_t processed = 0;
+    for (auto _ : state) {
+        if (scan_only) {
+            Quantity total = 0;
+            journal.forEach([&](const JournalRecord& record) { total += record.quantity; });
+            processed = journal.size();
+            benchmark::DoNotOptimize(total);
+        } else if (from_journal) {
+            OrderBookManager<OrderBookL3> l3_books;
+            OrderBookManager<OrderBookL2> l2_books;
+            const JournalReplayStats l3 = journal.replay(l3_books);
+            const JournalReplayStats l2 = journal.replay(l2_books);
+            processed = l3.records + l3.rejected + l2.records + l2.rejected;
+            benchmark::DoNotOptimize(l3_books);
+            benchmark::DoNotOptimize(l2_books);
+        } else {
+            OrderBookL3 book(1);
+            for (const auto& event : events) {
+                switch (event.type) {
+                    case MarketEventType::NewOrder:
+                        book.addOrder(event.order_id, event.side, event.price, event.quantity,
+                                      event.timestamp, event.priority);
+                        break;
+                    case MarketEventType::ModifyOrder:
+                        book.modifyOrder(event.order_id, event.price, event.quantity, event.timestamp,
+                                         event.priority);
+                        break;
+                    case MarketEventType::DeleteOrder:
+                        book.deleteOrder(event.order_id, event.timestamp);
+                        break;
+                    case MarketEventType::ExecuteOrder:
+                        book.executeOrder(event.order_id, event.quantity, event.timestamp);
+                        break;
+                    default:
+                        break;
+                }
+            }
+            processed = events.size();
+            benchmark::DoNotOptimize(book);
+        }
+    }
+
+    const std::size_t journal_records = journal.size();
+    journal.close();
+    if (recorded == nullptr && from_journal) {
+        std::filesystem::remove(path);
+    }
+    state.SetItemsProcessed(state.iterations() * processed);
+    if (from_journal) {
+        state.SetBytesProcessed(state.iterations() * journal_records * sizeof(JournalRecord));
+    }
+}
+
+BENCHMARK(BM_L3_JournalReplay)->Arg(0)->Arg(1)->Arg(2)->Unit(benchmark::kMillisecond);
+
 // ============================================================================
 // Benchmark: Multi-Symbol Market Replay
 // ============================================================================
@@ -368,6 +505,51 @@ static void BM_MultiSymbol_MarketReplay(benchmark::State& state) {
 
 BENCHMARK(BM_MultiSymbol_MarketReplay)->Arg(10)->Arg(100)->Arg(1000);
 
+// Same interleaved stream fed through OrderBookEngine: one feed thread, range(1) worker shards
+static void BM_MultiSymbol_EngineReplay(benchmark::State& state) {
+    const auto num_symbols = state.range(0);
+    const auto num_shards = static_cast<std::size_t>(state.range(1));
+    MarketDataGenerator gen(11111);
+
+    std::vector<std::vector<MarketEvent>> symbol_events;
+    for (auto i = 0; i < num_symbols; ++i) {
+        symbol_events.push_back(gen.generateL2Events(1000, 100000, 100100));
+    }
+
+    // Decode once: the engine consumes ready-made messages
+    std::vector<L2Update> updates;
+    size_t max_events = 0;
+    for (const auto& events : symbol_events) {
+        max_events = std::max(max_events, events.size());
+    }
+    for (size_t event_idx = 0; event_idx < max_events; ++event_idx) {
+        for (auto sym_idx = 0; sym_idx < num_symbols; ++sym_idx) {
+            if (event_idx < symbol_events[sym_idx].size()) {
+                const auto& event = symbol_events[sym_idx][event_idx];
+                const Quantity quantity = event.type == MarketEventType::DeleteLevel ? 0 : event.quantity;
+                updates.push_back(L2Update{.timestamp = event.timestamp, .price = event.price, .quantity = quantity,
+                                           .symbol = static_cast<SymbolId>(sym_idx + 1), .side = event.side});
+            }
+        }
+    }
+
+    for (auto _ : state) {
+        OrderBookEngine<OrderBookL2> engine({.num_shards = num_shards});
+        engine.start();
+        engine.submit(updates);
+        engine.waitIdle();
+        engine.stop();
+        benchmark::DoNotOptimize(engine.manager());
+    }
+
+    state.SetItemsProcessed(state.iterations() * updates.size());
+}
+
+BENCHMARK(BM_MultiSymbol_EngineReplay)
+    ->Args({10, 1})->Args({100, 1})->Args({1000, 1})
+    ->Args({1000, 2})->Args({1000, 4})
+    ->UseRealTime();
+
 // ============================================================================
 // Benchmark: Burst Pattern (Simulating Market Open)
 // ============================================================================
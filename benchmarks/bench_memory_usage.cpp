@@ -109,6 +109,51 @@ BENCHMARK(BM_L3_MemoryFootprint)
     ->Arg(5000)
     ->Arg(10000);
 
+// ============================================================================
+// Benchmark: L3 Order Layout (OrderBookL3 vs CompactOrderBookL3)
+// ============================================================================
+
+template<typename BookT>
+static void BM_L3_OrderLayout(benchmark::State& state) {
+    const auto num_orders = state.range(0);
+    constexpr auto kOrdersPerLevel = 1000;
+
+    std::mt19937_64 rng(12345);
+    std::uniform_int_distribution<Quantity> qty_dist(100, 1000);
+
+    BookT book(1);
+    for (auto i = 0; i < num_orders; ++i) {
+        Price price = 100000 - static_cast<Price>(i / kOrdersPerLevel) * 10;
+        book.addOrder(i + 1, Side::Buy, price, qty_dist(rng), static_cast<Timestamp>(i + 1));
+    }
+
+    // Walk every queue: deep levels are bound by the bytes touched per order
+    for (auto _ : state) {
+        Quantity total = 0;
+        for (const auto& [price, level] : book.getLevelsL3(Side::Buy)) {
+            for (const auto& order : level.orders) {
+                total += order.quantity;
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+
+    using Order = typename BookT::Order;
+    state.SetItemsProcessed(state.iterations() * num_orders);
+    state.counters["order_bytes"] = static_cast<double>(sizeof(Order));
+    state.counters["pool_bytes_per_order"] =
+        static_cast<double>(book.orderPoolCapacity() * sizeof(Order)) / static_cast<double>(num_orders);
+}
+
+BENCHMARK_TEMPLATE(BM_L3_OrderLayout, OrderBookL3)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Arg(1000000);
+BENCHMARK_TEMPLATE(BM_L3_OrderLayout, CompactOrderBookL3)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Arg(1000000);
+
 // ============================================================================
 // Benchmark: Memory Growth Pattern - L2
 // ============================================================================
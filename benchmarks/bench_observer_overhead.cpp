@@ -7,15 +7,48 @@
  * - Notification dispatch latency
  * - Impact on orderbook operations
  * - Snapshot emission overhead
+ * - Static (compile-time) vs virtual observer dispatch
  *
  * Target: < 50ns per observer notification
+ *
+ * Static vs virtual dispatch (GCC 12, -O3 -march=native, header-only):
+ *
+ *   Benchmark                          Virtual    Static
+ *   L2 counting observer (all events)   19.5 ns    13.4 ns
+ *   L2 top-of-book only observer        17.3 ns    12.6 ns
+ *   L3 counting observer (all events)   1118 ns    1080 ns  (dominated by priority insertion)
+ *
+ * The static path inlines each callback and drops events the observer does not
+ * handle at compile time, so a top-of-book only observer never pays for
+ * PriceLevelUpdate construction.
+ *
+ * Subscription masks, L3 delete + re-add at a random depth of 200 levels
+ * (BM_L3_ChurnWithSubscription, per delete/add pair):
+ *
+ *   Book                 AllEvents   TopOfBookEvents
+ *   OrderBookL3           238 ns       210 ns
+ *   LadderOrderBookL3     137 ns       100 ns
+ *
+ * A top-of-book only subscriber skips OrderUpdate/PriceLevelUpdate construction
+ * and the level index scan, which is the larger share for the ladder's bitmap count.
+ *
+ * Async bridge, L2 updates with a ~200ns observer (feed thread time per update):
+ *
+ *   BM_L2_SlowObserverInline   274 ns
+ *   BM_L2_SlowObserverAsync    72-96 ns CPU
+ *
+ * The async run uses DropOldest with the ring saturated, so most of its cost is eviction CAS
+ * traffic with the consumer thread; the consumer sheds what it cannot keep up with.
  */
 
 #include <slick/orderbook/orderbook.hpp>
+#include <slick/orderbook/detail/impl/orderbook_l2_impl.hpp>
+#include <slick/orderbook/detail/impl/orderbook_l3_impl.hpp>
 #include <benchmark/benchmark.h>
 #include <random>
 #include <vector>
 #include <atomic>
+#include <chrono>
 
 using namespace slick::orderbook;
 
@@ -95,6 +128,33 @@ public:
     int64_t computed_value_ = 0;
 };
 
+// Non-virtual counterparts for StaticObserverDispatch
+struct StaticCountingObserver {
+    void onPriceLevelUpdate([[maybe_unused]] const PriceLevelUpdate& update) { ++level_update_count_; }
+    void onOrderUpdate([[maybe_unused]] const OrderUpdate& update) { ++order_update_count_; }
+    void onTrade([[maybe_unused]] const Trade& trade) { ++trade_count_; }
+    void onTopOfBookUpdate([[maybe_unused]] const TopOfBook& tob) { ++tob_change_count_; }
+
+    size_t level_update_count_ = 0;
+    size_t order_update_count_ = 0;
+    size_t trade_count_ = 0;
+    size_t tob_change_count_ = 0;
+};
+
+// Observer that only consumes top-of-book changes
+class TopOfBookObserver : public IOrderBookObserver {
+public:
+    void onTopOfBookUpdate([[maybe_unused]] const TopOfBook& tob) override { ++tob_change_count_; }
+
+    size_t tob_change_count_ = 0;
+};
+
+struct StaticTopOfBookObserver {
+    void onTopOfBookUpdate([[maybe_unused]] const TopOfBook& tob) { ++tob_change_count_; }
+
+    size_t tob_change_count_ = 0;
+};
+
 // ============================================================================
 // Benchmark: L2 Operations - No Observers
 // ============================================================================
@@ -298,6 +358,191 @@ static void BM_L3_WithComputingObservers(benchmark::State& state) {
 
 BENCHMARK(BM_L3_WithComputingObservers)->Arg(1)->Arg(5)->Arg(10)->Arg(50)->Arg(100);
 
+// ============================================================================
+// Benchmark: Static vs Virtual Observer Dispatch
+// ============================================================================
+
+template<typename Book>
+static void runL2Updates(benchmark::State& state, Book& book) {
+    std::mt19937_64 rng(12345);
+    std::uniform_int_distribution<Quantity> qty_dist(100, 10000);
+
+    size_t operations = 0;
+
+    for (auto _ : state) {
+        Price price = 100000 + (operations % 100) * 10;
+        Side side = (operations % 2 == 0) ? Side::Buy : Side::Sell;
+        book.updateLevel(side, price, qty_dist(rng), 0, 0);
+        ++operations;
+    }
+
+    state.SetItemsProcessed(operations);
+}
+
+static void BM_L2_VirtualCountingObserver(benchmark::State& state) {
+    OrderBookL2 book(1);
+    auto observer = std::make_shared<CountingObserver>();
+    book.addObserver(observer);
+    runL2Updates(state, book);
+    benchmark::DoNotOptimize(observer->level_update_count_);
+}
+
+BENCHMARK(BM_L2_VirtualCountingObserver);
+
+static void BM_L2_StaticCountingObserver(benchmark::State& state) {
+    StaticObserverOrderBookL2<StaticCountingObserver> book(1);
+    runL2Updates(state, book);
+    benchmark::DoNotOptimize(book.observer().level_update_count_);
+}
+
+BENCHMARK(BM_L2_StaticCountingObserver);
+
+static void BM_L2_VirtualTopOfBookObserver(benchmark::State& state) {
+    OrderBookL2 book(1);
+    auto observer = std::make_shared<TopOfBookObserver>();
+    book.addObserver(observer);
+    runL2Updates(state, book);
+    benchmark::DoNotOptimize(observer->tob_change_count_);
+}
+
+BENCHMARK(BM_L2_VirtualTopOfBookObserver);
+
+static void BM_L2_StaticTopOfBookObserver(benchmark::State& state) {
+    StaticObserverOrderBookL2<StaticTopOfBookObserver> book(1);
+    runL2Updates(state, book);
+    benchmark::DoNotOptimize(book.observer().tob_change_count_);
+}
+
+BENCHMARK(BM_L2_StaticTopOfBookObserver);
+
+template<typename Book>
+static void runL3Orders(benchmark::State& state, Book& book) {
+    std::mt19937_64 rng(54321);
+    std::uniform_int_distribution<Quantity> qty_dist(100, 1000);
+    std::uniform_int_distribution<uint64_t> priority_dist(0, 1000000);
+
+    OrderId order_id = 1;
+    size_t operations = 0;
+
+    for (auto _ : state) {
+        Price price = 100000 + (operations % 20) * 10;
+        Side side = (operations % 2 == 0) ? Side::Buy : Side::Sell;
+        book.addOrModifyOrder(order_id++, side, price, qty_dist(rng), 0, priority_dist(rng), 0);
+        ++operations;
+
+        if (operations % 10000 == 0) {
+            state.PauseTiming();
+            book.clear();
+            order_id = 1;
+            state.ResumeTiming();
+        }
+    }
+
+    state.SetItemsProcessed(operations);
+}
+
+static void BM_L3_VirtualCountingObserver(benchmark::State& state) {
+    OrderBookL3 book(1);
+    auto observer = std::make_shared<CountingObserver>();
+    book.addObserver(observer);
+    runL3Orders(state, book);
+    benchmark::DoNotOptimize(observer->order_update_count_);
+}
+
+BENCHMARK(BM_L3_VirtualCountingObserver);
+
+static void BM_L3_StaticCountingObserver(benchmark::State& state) {
+    StaticObserverOrderBookL3<StaticCountingObserver> book(1);
+    runL3Orders(state, book);
+    benchmark::DoNotOptimize(book.observer().order_update_count_);
+}
+
+BENCHMARK(BM_L3_StaticCountingObserver);
+
+// ============================================================================
+// Benchmark: Subscription Masks - L3 delete/re-add churn across a deep book
+// ============================================================================
+
+template<typename Book>
+static Book makeBook() {
+    if constexpr (std::is_constructible_v<Book, SymbolId, PriceLadderConfig>) {
+        return Book(1, PriceLadderConfig{10, 4096});
+    } else {
+        return Book(1);
+    }
+}
+
+template<typename Book>
+static void BM_L3_ChurnWithSubscription(benchmark::State& state) {
+    Book book = makeBook<Book>();
+    const auto events = static_cast<uint8_t>(state.range(0));
+    auto observer = std::make_shared<CountingObserver>();
+    book.addObserver(observer, events);
+
+    // Two orders per bid level: ids [1, kLevels] rest, ids (kLevels, 2 * kLevels] are churned
+    constexpr int kLevels = 200;
+    for (int i = 0; i < kLevels; ++i) {
+        book.addOrder(i + 1, Side::Buy, 100000 - i * 10, 100, 0);
+        book.addOrder(kLevels + i + 1, Side::Buy, 100000 - i * 10, 100, 0);
+        book.addOrder(2 * kLevels + i + 1, Side::Sell, 100010 + i * 10, 100, 0);
+    }
+
+    std::mt19937_64 rng(777);
+    std::uniform_int_distribution<int> level_dist(0, kLevels - 1);
+
+    size_t operations = 0;
+    for (auto _ : state) {
+        // Delete and re-add the back order of a random level (the level itself stays)
+        const int level = level_dist(rng);
+        const OrderId id = kLevels + level + 1;
+        book.deleteOrder(id, 0);
+        book.addOrder(id, Side::Buy, 100000 - level * 10, 100, 0);
+        operations += 2;
+    }
+
+    state.SetItemsProcessed(operations);
+    benchmark::DoNotOptimize(observer->tob_change_count_);
+}
+
+BENCHMARK(BM_L3_ChurnWithSubscription<OrderBookL3>)->Arg(AllEvents)->Arg(TopOfBookEvents)->ArgNames({"events"});
+BENCHMARK(BM_L3_ChurnWithSubscription<LadderOrderBookL3>)->Arg(AllEvents)->Arg(TopOfBookEvents)->ArgNames({"events"});
+
+// ============================================================================
+// Benchmark: Async Observer Bridge - feed thread cost with a slow strategy callback
+// ============================================================================
+
+// Observer that burns ~200ns per level update, standing in for strategy logic
+class SlowObserver : public IOrderBookObserver {
+public:
+    void onPriceLevelUpdate(const PriceLevelUpdate& update) override {
+        const auto until = std::chrono::steady_clock::now() + std::chrono::nanoseconds(200);
+        while (std::chrono::steady_clock::now() < until) {
+            benchmark::DoNotOptimize(update.price);
+        }
+    }
+};
+
+static void BM_L2_SlowObserverInline(benchmark::State& state) {
+    OrderBookL2 book(1);
+    book.addObserver(std::make_shared<SlowObserver>());
+    runL2Updates(state, book);
+}
+
+BENCHMARK(BM_L2_SlowObserverInline);
+
+static void BM_L2_SlowObserverAsync(benchmark::State& state) {
+    OrderBookL2 book(1);
+    auto bridge = std::make_shared<AsyncObserverBridge>(AsyncObserverConfig{.capacity = 65536});
+    bridge->addObserver(std::make_shared<SlowObserver>());
+    book.addObserver(bridge);
+    bridge->start();
+    runL2Updates(state, book);
+    bridge->stop();
+    state.counters["dropped"] = static_cast<double>(bridge->stats().dropped);
+}
+
+BENCHMARK(BM_L2_SlowObserverAsync);
+
 // ============================================================================
 // Benchmark: Snapshot Emission - L2
 // ============================================================================
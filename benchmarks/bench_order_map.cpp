@@ -0,0 +1,202 @@
+/**
+ * @file bench_order_map.cpp
+ * @brief Benchmarks for detail::OrderMap (OrderId -> Order* lookup)
+ *
+ * Compares the open-addressing OrderMap against the previous
+ * std::unordered_map<OrderId, Order*> implementation:
+ * - Lookup hit / miss
+ * - Insert into a reserved table
+ * - Erase + re-insert churn (steady-state book)
+ *
+ * Each benchmark runs with sequential ids (typical of ITCH/MBO feeds)
+ * and random 64-bit ids.
+ *
+ * Target: a single cache miss per lookup at 1M resident orders
+ *
+ * GCC 12, -O3 -march=native, mean ns/op (random ids):
+ *
+ *   Benchmark                     OrderMap   unordered_map
+ *   FindHit/100k                      11.5            24.8
+ *   FindHit/1M                        30.5            67.6
+ *   FindMiss/1M                       49.4            78.9
+ *   EraseInsertChurn/100k             85.7             236
+ *   Insert/1M (per order)             32.7             334
+ */
+
+#include <slick/orderbook/detail/order_map.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace slick::orderbook;
+using namespace slick::orderbook::detail;
+
+// ============================================================================
+// Adapters
+// ============================================================================
+
+/// std::unordered_map with the same interface as OrderMap (previous implementation)
+class StdOrderMap {
+public:
+    explicit StdOrderMap(std::size_t initial_capacity) { map_.reserve(initial_capacity); }
+
+    bool insert(Order* order) { return map_.try_emplace(order->order_id, order).second; }
+    bool erase(OrderId order_id) noexcept { return map_.erase(order_id) > 0; }
+    Order* find(OrderId order_id) noexcept {
+        auto it = map_.find(order_id);
+        return (it != map_.end()) ? it->second : nullptr;
+    }
+
+private:
+    std::unordered_map<OrderId, Order*> map_;
+};
+
+// ============================================================================
+// Test Data Generation
+// ============================================================================
+
+enum IdPattern : int64_t { Sequential = 0, Random = 1 };
+
+static std::vector<OrderId> generateIds(std::size_t count, int64_t pattern) {
+    std::vector<OrderId> ids(count);
+    if (pattern == Sequential) {
+        for (std::size_t i = 0; i < count; ++i) {
+            ids[i] = 1'000'000 + i;
+        }
+    } else {
+        std::mt19937_64 rng(42);
+        for (auto& id : ids) {
+            id = rng();
+        }
+    }
+    return ids;
+}
+
+static std::vector<Order> makeOrders(const std::vector<OrderId>& ids) {
+    std::vector<Order> orders;
+    orders.reserve(ids.size());
+    for (OrderId id : ids) {
+        orders.emplace_back(id, 10000, 100, Side::Buy, 0);
+    }
+    return orders;
+}
+
+/// Shuffled probe order, so lookups do not walk the table linearly
+static std::vector<OrderId> shuffled(std::vector<OrderId> ids) {
+    std::mt19937_64 rng(7);
+    std::shuffle(ids.begin(), ids.end(), rng);
+    return ids;
+}
+
+// ============================================================================
+// Benchmarks
+// ============================================================================
+
+template<typename Map>
+static void BM_OrderMap_FindHit(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto ids = generateIds(count, state.range(1));
+    auto orders = makeOrders(ids);
+    const auto probes = shuffled(ids);
+
+    Map map(count);
+    for (auto& order : orders) {
+        map.insert(&order);
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.find(probes[i]));
+        if (++i == probes.size()) i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Map>
+static void BM_OrderMap_FindMiss(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto ids = generateIds(count, state.range(1));
+    auto orders = makeOrders(ids);
+
+    Map map(count);
+    for (auto& order : orders) {
+        map.insert(&order);
+    }
+
+    // Ids guaranteed absent: shifted past the sequential range, high bit set for random
+    auto probes = shuffled(ids);
+    for (auto& id : probes) {
+        id = (id + count) | (1ULL << 63);
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.find(probes[i]));
+        if (++i == probes.size()) i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Map>
+static void BM_OrderMap_Insert(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto ids = generateIds(count, state.range(1));
+    auto orders = makeOrders(ids);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Map map(count);
+        state.ResumeTiming();
+
+        for (auto& order : orders) {
+            map.insert(&order);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+
+template<typename Map>
+static void BM_OrderMap_EraseInsertChurn(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto ids = generateIds(count, state.range(1));
+    auto orders = makeOrders(ids);
+    const auto probes = shuffled(ids);
+
+    Map map(count);
+    for (auto& order : orders) {
+        map.insert(&order);
+    }
+
+    // Erase one resident order, then re-insert it: constant size, exercises deletion path
+    std::vector<Order*> by_probe;
+    by_probe.reserve(count);
+    for (OrderId id : probes) {
+        by_probe.push_back(map.find(id));
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        map.erase(probes[i]);
+        map.insert(by_probe[i]);
+        if (++i == probes.size()) i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+#define SLICK_ORDER_MAP_ARGS \
+    ->ArgsProduct({{1'000, 100'000, 1'000'000}, {Sequential, Random}}) \
+    ->ArgNames({"orders", "random_ids"})
+
+BENCHMARK_TEMPLATE(BM_OrderMap_FindHit, OrderMap) SLICK_ORDER_MAP_ARGS;
+BENCHMARK_TEMPLATE(BM_OrderMap_FindHit, StdOrderMap) SLICK_ORDER_MAP_ARGS;
+BENCHMARK_TEMPLATE(BM_OrderMap_FindMiss, OrderMap) SLICK_ORDER_MAP_ARGS;
+BENCHMARK_TEMPLATE(BM_OrderMap_FindMiss, StdOrderMap) SLICK_ORDER_MAP_ARGS;
+BENCHMARK_TEMPLATE(BM_OrderMap_Insert, OrderMap) SLICK_ORDER_MAP_ARGS->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_OrderMap_Insert, StdOrderMap) SLICK_ORDER_MAP_ARGS->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_OrderMap_EraseInsertChurn, OrderMap) SLICK_ORDER_MAP_ARGS;
+BENCHMARK_TEMPLATE(BM_OrderMap_EraseInsertChurn, StdOrderMap) SLICK_ORDER_MAP_ARGS;
+
+BENCHMARK_MAIN();
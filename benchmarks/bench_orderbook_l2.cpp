@@ -11,11 +11,65 @@
  * - Spread calculations
  *
  * Target: < 100ns p99 latency for all operations
+ *
+ * Side-templated LevelContainer (compile-time comparator vs std::function),
+ * GCC 12, -O3 -march=native, header-only, mean ns/op:
+ *
+ *   Benchmark                     before     after
+ *   AddNewLevel/10                  49.4      13.8
+ *   AddNewLevel/100                 62.9      21.3
+ *   ModifyExistingLevel/10          54.5      18.8
+ *   ModifyExistingLevel/100         71.0      18.4
+ *   DeleteLevel/100                13466      6218
+ *   GetTopOfBook/100                 2.5       2.0
+ *   GetLevels/100                    553       474
+ *   MixedWorkload/10                94.2      66.7
+ *   MixedWorkload/100                126      86.2
+ *
+ * Tick-indexed PriceLadder vs sorted LevelContainer (delete + re-add a level
+ * within 20 ticks of the touch, then getTopOfBook), mean ns/op:
+ *
+ *   Benchmark                  OrderBookL2   LadderOrderBookL2
+ *   LevelChurn/10                     58.5                44.2
+ *   LevelChurn/100                     101                44.3
+ *   LevelChurn/1000                    649                38.1
+ *
+ * Top 10 levels of both sides from a 100-level book, mean ns/op:
+ *
+ *   GetLevelsTop10/100 (two vectors, writer thread only)   32.4
+ *   GetLevelsBufferTop10/100 (caller buffers, writer only)   4.9
+ *   GetLevelsViewTop10/100 (spans in place, writer only)     0.4
+ *   ReadDepthTop10/100 (seqlock block, any thread)           8.8
+ *
+ * Writer cost of keeping a 10-level depth block published (modify best bid):
+ *
+ *   ModifyBestLevelPublished/0                              15.7
+ *   ModifyBestLevelPublished/10                             31.5
+ *
+ * Exchange packet of N quantity changes on the top 10 levels, per-update
+ * updateLevel() vs applyBatch(), mean ns/packet:
+ *
+ *   Packet  Observer               updateLevel   applyBatch
+ *   20      none                           291          237
+ *   50      none                           709          538
+ *   20      AsyncObserverBridge           1697         1216
+ *   50      AsyncObserverBridge           4634         2348
+ *
+ * Sequence checking through SequencedBook, and recovery from one lost update
+ * (buffer N updates, load a 100-level snapshot, drain), mean ns:
+ *
+ *   SequencedUpdate/0 (updateLevel)                         16.7
+ *   SequencedUpdate/1 (SequencedBook::apply)                17.9
+ *   GapRecovery/100                                         5506
+ *   GapRecovery/1000                                       30460
  */
 
 #include <slick/orderbook/orderbook.hpp>
 #include <benchmark/benchmark.h>
+#include <algorithm>
+#include <array>
 #include <random>
+#include <type_traits>
 #include <vector>
 
 using namespace slick::orderbook;
@@ -276,6 +330,165 @@ static void BM_L2_GetLevels(benchmark::State& state) {
 
 BENCHMARK(BM_L2_GetLevels)->Arg(10)->Arg(50)->Arg(100);
 
+// ============================================================================
+// Benchmark: Top-N Depth (getLevels vs seqlock-published depth block)
+// ============================================================================
+
+static void buildBook(OrderBookL2& book, int64_t num_levels) {
+    for (const auto& level : generateRandomLevels(num_levels, 100000, -10)) {
+        book.updateLevel(Side::Buy, level.price, level.quantity, 0, 0);
+    }
+    for (const auto& level : generateRandomLevels(num_levels, 100100, 10)) {
+        book.updateLevel(Side::Sell, level.price, level.quantity, 0, 0);
+    }
+}
+
+/// Top 10 levels of both sides through getLevels() (allocates, writer thread only)
+static void BM_L2_GetLevelsTop10(benchmark::State& state) {
+    OrderBookL2 book(1);
+    buildBook(book, state.range(0));
+
+    for (auto _ : state) {
+        auto bids = book.getLevels(Side::Buy, 10);
+        auto asks = book.getLevels(Side::Sell, 10);
+        benchmark::DoNotOptimize(bids.data());
+        benchmark::DoNotOptimize(asks.data());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_L2_GetLevelsTop10)->Arg(100);
+
+/// Top 10 levels of both sides through getLevelsView() (in place, writer thread only)
+static void BM_L2_GetLevelsViewTop10(benchmark::State& state) {
+    OrderBookL2 book(1);
+    buildBook(book, state.range(0));
+
+    for (auto _ : state) {
+        auto bids = book.getLevelsView(Side::Buy, 10);
+        auto asks = book.getLevelsView(Side::Sell, 10);
+        benchmark::DoNotOptimize(bids.data());
+        benchmark::DoNotOptimize(asks.data());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_L2_GetLevelsViewTop10)->Arg(100);
+
+/// Top 10 levels of both sides copied into caller buffers (no allocation, writer thread only)
+static void BM_L2_GetLevelsBufferTop10(benchmark::State& state) {
+    OrderBookL2 book(1);
+    buildBook(book, state.range(0));
+
+    std::array<detail::PriceLevelL2, 10> bids;
+    std::array<detail::PriceLevelL2, 10> asks;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(book.getLevels(Side::Buy, bids));
+        benchmark::DoNotOptimize(book.getLevels(Side::Sell, asks));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_L2_GetLevelsBufferTop10)->Arg(100);
+
+/// Top 10 levels of both sides through readDepth() (no allocation, safe from any thread)
+static void BM_L2_ReadDepthTop10(benchmark::State& state) {
+    OrderBookL2 book(1);
+    book.setPublishedDepth(10);
+    buildBook(book, state.range(0));
+
+    DepthSnapshot<10> depth;
+    for (auto _ : state) {
+        book.readDepth(depth);
+        benchmark::DoNotOptimize(depth);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_L2_ReadDepthTop10)->Arg(100);
+
+/// Writer cost of publishing: modify the best bid with publication off (0) or 10 levels deep
+static void BM_L2_ModifyBestLevelPublished(benchmark::State& state) {
+    OrderBookL2 book(1);
+    book.setPublishedDepth(static_cast<std::size_t>(state.range(0)));
+    buildBook(book, 100);
+    const Price best_bid = book.getBestBid()->price;
+
+    Quantity quantity = 1;
+    for (auto _ : state) {
+        book.updateLevel(Side::Buy, best_bid, quantity++, 0, 0);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_L2_ModifyBestLevelPublished)->Arg(0)->Arg(10);
+
+/// Modify the bid level at index range(0), then read microprice, 10-level imbalance and the price to
+/// buy 500 by copying the top 10 levels of each side and recomputing
+static void BM_L2_AnalyticsRecompute(benchmark::State& state) {
+    OrderBookL2 book(1);
+    buildBook(book, 100);
+    const Price price = book.getLevels(Side::Buy, static_cast<std::size_t>(state.range(0)) + 1).back().price;
+
+    Quantity quantity = 1;
+    for (auto _ : state) {
+        book.updateLevel(Side::Buy, price, quantity++, 0, 0);
+        const auto bids = book.getLevels(Side::Buy, 10);
+        const auto asks = book.getLevels(Side::Sell, 10);
+
+        const double microprice = (static_cast<double>(bids[0].price) * static_cast<double>(asks[0].quantity) +
+                                   static_cast<double>(asks[0].price) * static_cast<double>(bids[0].quantity)) /
+                                  static_cast<double>(bids[0].quantity + asks[0].quantity);
+        Quantity bid_depth = 0;
+        Quantity ask_depth = 0;
+        for (std::size_t i = 0; i < bids.size(); ++i) {
+            bid_depth += bids[i].quantity;
+        }
+        Price worst = 0;
+        for (std::size_t i = 0; i < asks.size(); ++i) {
+            if (ask_depth < 500) {
+                worst = asks[i].price;
+            }
+            ask_depth += asks[i].quantity;
+        }
+        const double imbalance = static_cast<double>(bid_depth - ask_depth) / static_cast<double>(bid_depth + ask_depth);
+        benchmark::DoNotOptimize(microprice);
+        benchmark::DoNotOptimize(imbalance);
+        benchmark::DoNotOptimize(worst);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_L2_AnalyticsRecompute)->Arg(0)->Arg(5);
+
+/// Same queries as BM_L2_AnalyticsRecompute from the book's incremental analytics (10 levels tracked)
+static void BM_L2_AnalyticsIncremental(benchmark::State& state) {
+    OrderBookL2 book(1);
+    book.setAnalyticsDepth(10);
+    buildBook(book, 100);
+    const Price price = book.getLevels(Side::Buy, static_cast<std::size_t>(state.range(0)) + 1).back().price;
+
+    Quantity quantity = 1;
+    for (auto _ : state) {
+        book.updateLevel(Side::Buy, price, quantity++, 0, 0);
+        const BookAnalytics& analytics = book.analytics();
+        benchmark::DoNotOptimize(analytics.microprice());
+        benchmark::DoNotOptimize(analytics.imbalance(10));
+        benchmark::DoNotOptimize(analytics.priceToFill(Side::Buy, 500));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_L2_AnalyticsIncremental)->Arg(0)->Arg(5);
+
 // ============================================================================
 // Benchmark: Mixed Workload (Realistic)
 // ============================================================================
@@ -336,6 +549,172 @@ static void BM_L2_MixedWorkload(benchmark::State& state) {
 
 BENCHMARK(BM_L2_MixedWorkload)->Arg(10)->Arg(50)->Arg(100);
 
+// ============================================================================
+// Benchmark: Level Churn Near the Touch (sorted vector vs tick-indexed ladder vs 16-byte levels)
+// ============================================================================
+
+template<typename Book>
+static Book makeBook() {
+    if constexpr (std::is_same_v<Book, LadderOrderBookL2>) {
+        return Book(1, PriceLadderConfig{10, 4096});
+    } else {
+        return Book(1);
+    }
+}
+
+/// Delete and re-add a level within 20 ticks of the touch, then read the top of book.
+/// This is the dominant pattern in a live L2 feed, and the worst case for a sorted
+/// vector: every insert/erase shifts the levels behind the touch.
+template<typename Book>
+static void BM_L2_LevelChurn(benchmark::State& state) {
+    Book book = makeBook<Book>();
+    const auto num_levels = state.range(0);
+
+    auto bid_levels = generateRandomLevels(num_levels, 100000, -10);
+    auto ask_levels = generateRandomLevels(num_levels, 100100, 10);
+    for (const auto& level : bid_levels) {
+        book.updateLevel(Side::Buy, level.price, level.quantity, 0, 0);
+    }
+    for (const auto& level : ask_levels) {
+        book.updateLevel(Side::Sell, level.price, level.quantity, 0, 0);
+    }
+
+    std::mt19937_64 rng(4242);
+    std::uniform_int_distribution<size_t> level_dist(0, std::min<size_t>(num_levels, 20) - 1);
+
+    for (auto _ : state) {
+        const Side side = (rng() & 1) ? Side::Buy : Side::Sell;
+        const auto& level = (side == Side::Buy ? bid_levels : ask_levels)[level_dist(rng)];
+
+        book.deleteLevel(side, level.price);
+        book.updateLevel(side, level.price, level.quantity, 0, 0);
+        benchmark::DoNotOptimize(book.getTopOfBook());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_L2_LevelChurn, OrderBookL2)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_L2_LevelChurn, LadderOrderBookL2)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_L2_LevelChurn, CompactOrderBookL2)->Arg(10)->Arg(100)->Arg(1000);
+
+// ============================================================================
+// Benchmark: Exchange Packets (per-update calls vs applyBatch)
+// ============================================================================
+
+/// A packet of range(0) quantity changes on the top 10 levels of both sides
+static std::vector<L2Update> makePacket(const OrderBookL2& book, int64_t size) {
+    const auto bids = book.getLevels(Side::Buy, 10);
+    const auto asks = book.getLevels(Side::Sell, 10);
+    std::mt19937_64 rng(777);
+    std::vector<L2Update> packet;
+    for (int64_t i = 0; i < size; ++i) {
+        const Side side = (rng() & 1) ? Side::Buy : Side::Sell;
+        const auto& level = (side == Side::Buy ? bids : asks)[rng() % 10];
+        packet.push_back({.timestamp = static_cast<Timestamp>(i), .price = level.price,
+                          .quantity = static_cast<Quantity>(100 + rng() % 1000), .side = side});
+    }
+    return packet;
+}
+
+/// range(1) = 0: no observer; 1: AsyncObserverBridge (a realistic per-event fan-out cost)
+static void addPacketObserver(OrderBookL2& book, int64_t kind) {
+    if (kind == 1) {
+        book.addObserver(std::make_shared<AsyncObserverBridge>(AsyncObserverConfig{.capacity = 1024}));
+    }
+}
+
+/// Packet applied with one updateLevel() per update (is_last_in_batch on the last one)
+static void BM_L2_PacketUpdateLevel(benchmark::State& state) {
+    OrderBookL2 book(1);
+    buildBook(book, 100);
+    addPacketObserver(book, state.range(1));
+    const auto packet = makePacket(book, state.range(0));
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < packet.size(); ++i) {
+            const auto& update = packet[i];
+            book.updateLevel(update.side, update.price, update.quantity, update.timestamp, 0, i + 1 == packet.size());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * packet.size());
+}
+
+BENCHMARK(BM_L2_PacketUpdateLevel)->Args({20, 0})->Args({50, 0})->Args({20, 1})->Args({50, 1});
+
+/// Same packet through applyBatch() (coalesced notifications)
+static void BM_L2_PacketApplyBatch(benchmark::State& state) {
+    OrderBookL2 book(1);
+    buildBook(book, 100);
+    addPacketObserver(book, state.range(1));
+    const auto packet = makePacket(book, state.range(0));
+
+    for (auto _ : state) {
+        book.applyBatch(packet);
+    }
+
+    state.SetItemsProcessed(state.iterations() * packet.size());
+}
+
+BENCHMARK(BM_L2_PacketApplyBatch)->Args({20, 0})->Args({50, 0})->Args({20, 1})->Args({50, 1});
+
+// ============================================================================
+// Benchmark: Sequence Gap Recovery
+// ============================================================================
+
+/// Sequenced quantity changes on the top 10 levels: range(0) = 0 straight to updateLevel(), 1 through SequencedBook
+static void BM_L2_SequencedUpdate(benchmark::State& state) {
+    OrderBookL2 book(1);
+    buildBook(book, 100);
+    SequencedBook sequenced(book);
+    const auto packet = makePacket(book, 64);
+    const bool checked = state.range(0) != 0;
+
+    uint64_t seq_num = 1;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        L2Update update = packet[i++ & 63];
+        update.seq_num = seq_num++;
+        if (checked) {
+            benchmark::DoNotOptimize(sequenced.apply(update));
+        } else {
+            book.updateLevel(update.side, update.price, update.quantity, update.timestamp, update.seq_num);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_L2_SequencedUpdate)->Arg(0)->Arg(1);
+
+/// One lost update on a 100-level book: buffer range(0) updates, load a snapshot, drain the buffer
+static void BM_L2_GapRecovery(benchmark::State& state) {
+    OrderBookL2 book(1);
+    buildBook(book, 100);
+    const auto bids = book.getLevels(Side::Buy);
+    const auto asks = book.getLevels(Side::Sell);
+    const auto packet = makePacket(book, 64);
+    const auto buffered = static_cast<std::size_t>(state.range(0));
+    SequencedBook sequenced(book, buffered);
+
+    uint64_t seq_num = 1;
+    for (auto _ : state) {
+        const uint64_t lost = seq_num++;
+        for (std::size_t i = 0; i < buffered; ++i) {
+            L2Update update = packet[i & 63];
+            update.seq_num = seq_num++;
+            sequenced.apply(update);
+        }
+        benchmark::DoNotOptimize(sequenced.loadSnapshot(bids, asks, lost, 0));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["recovery_ns"] = sequenced.stats().meanRecoveryNs();
+}
+
+BENCHMARK(BM_L2_GapRecovery)->Arg(100)->Arg(1000);
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -7,15 +7,85 @@
  * - addOrModifyOrder (order modification)
  * - deleteOrder
  * - executeOrder
+ * - submitOrder (matching incoming orders)
+ * - submitStopOrder (stop triggering and cascades)
  * - L2 aggregation from L3
  * - Order lookup and iteration
  *
  * Target: < 200ns p99 latency for all operations
+ *
+ * Side-templated LevelContainerL3 (sorted vector, compile-time comparator) vs
+ * FlatMap with std::function comparator (std::map fallback without <flat_map>),
+ * GCC 12, -O3 -march=native, header-only, mean ns/op:
+ *
+ *   Benchmark                     before     after
+ *   AddNewOrder/100                  143       114
+ *   AddNewOrder/1000                 666       660
+ *   AddNewOrder/5000                6709     12175   (one level per order: O(n) vector insert)
+ *   ModifyExistingOrder/100         97.9      61.3
+ *   ModifyExistingOrder/1000         133      49.1
+ *   DeleteOrder/1000              345951    147847
+ *   ExecuteOrderPartial/100          191      69.2
+ *   ExecuteOrderComplete/1000     264851    184877
+ *   GetLevelsL2/100                  150      75.3
+ *   GetLevelsL3/100                  273       121
+ *   MixedWorkload/100               6036      5697
+ *
+ * Order lookup policy, dense sequential ids, mean ns/op:
+ *
+ *   Benchmark                     OrderBookL3   DirectIndexedOrderBookL3
+ *   FindOrderSequential/10000            5.59                       1.37
+ *   FindOrderSequential/50000            5.33                       1.83
+ *   AddDeleteSequential/1000              300                        199
+ *   AddDeleteSequential/10000             335                        264
+ *
+ * Snapshot recovery, random order, ~n/4 levels per side, ms per snapshot:
+ *
+ *   Orders      addOrder replay   loadSnapshot
+ *   10000                  6.93           1.88
+ *   100000                  592           37.2
+ *
+ * Order pool placement, quantity modify of a random resting order (order map stays on 4K pages;
+ * no reserved huge pages on the test host, so MAP_HUGETLB fell back to THP), mean ns/op:
+ *
+ *   Orders      heap    PageSize::Transparent   PageSize::Huge
+ *   1048576      228                      218                -
+ *   4194304      243                      214              216
+ *
+ * Sweep of n orders at one price (rest in one batch, execute in a second), AsyncObserverBridge
+ * subscribed to level and top-of-book events, ns per iteration (bridge events per iteration):
+ *
+ *   Orders      immediate     setConflateLevelUpdates(true)
+ *   10          2337 (22)       838 (4)
+ *   40          9326 (82)      2981 (4)
+ *
+ * Aggressive buy crossing n resting sells at one price (resting included), submitOrder() vs walking
+ * getBestAsk() with executeOrder(), ns per iteration:
+ *
+ *   Orders      executeOrder   submitOrder
+ *   1                   70.4          63.4
+ *   10                   547           275
+ *   100                 5263          2873
+ *
+ * Random flow (SubmitOrderFlow, 0.8 trades per order, one cancel per order): 134 ns per order, 7.5M orders/s
+ *
+ * Crossing IOC order with n pending stops far from the market (SubmitWithPendingStops), ns per order:
+ * 59.4 (0), 64.0 (1000), 60.2 (100000). Looking pending stop ids up in submitOrder() cost 140 and 291 ns.
+ *
+ * Stop cascade, n buy stops each lifting the next 1-lot ask (StopTriggerCascade), ns per triggered stop:
+ *
+ *   Stops       OrderBookL3   LadderOrderBookL3
+ *   10                  140                 118
+ *   100                 271                  74
+ *   1000               2275                  91   (vector layout: front erase per emptied level)
  */
 
 #include <slick/orderbook/orderbook.hpp>
 #include <benchmark/benchmark.h>
+#include <algorithm>
+#include <array>
 #include <random>
+#include <type_traits>
 #include <vector>
 
 using namespace slick::orderbook;
@@ -296,6 +366,63 @@ static void BM_L3_GetLevelsL2(benchmark::State& state) {
 
 BENCHMARK(BM_L3_GetLevelsL2)->Arg(100)->Arg(500)->Arg(1000)->Arg(5000);
 
+/// Top 10 aggregated levels of both sides: getLevelsL2() vector (0) vs caller buffer (1)
+static void BM_L3_GetLevelsL2Top10(benchmark::State& state) {
+    OrderBookL3 book(1);
+    for (const auto& order : generateRandomOrders(1000, 100000, -10, 1)) {
+        book.addOrModifyOrder(order.order_id, Side::Buy, order.price, order.quantity, 0, order.priority, 0);
+    }
+    for (const auto& order : generateRandomOrders(1000, 100100, 10, 1001)) {
+        book.addOrModifyOrder(order.order_id, Side::Sell, order.price, order.quantity, 0, order.priority, 0);
+    }
+
+    std::array<detail::PriceLevelL2, 10> bids;
+    std::array<detail::PriceLevelL2, 10> asks;
+    for (auto _ : state) {
+        if (state.range(0) == 0) {
+            auto l2_bids = book.getLevelsL2(Side::Buy, 10);
+            auto l2_asks = book.getLevelsL2(Side::Sell, 10);
+            benchmark::DoNotOptimize(l2_bids.data());
+            benchmark::DoNotOptimize(l2_asks.data());
+        } else {
+            benchmark::DoNotOptimize(book.getLevelsL2(Side::Buy, bids));
+            benchmark::DoNotOptimize(book.getLevelsL2(Side::Sell, asks));
+            benchmark::ClobberMemory();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_L3_GetLevelsL2Top10)->Arg(0)->Arg(1);
+
+/// Full L2 read after a change at the worst of N bid levels: getLevelsL2() (0) vs cached getLevelsL2View() (1)
+static void BM_L3_GetLevelsL2ViewAfterDeepChange(benchmark::State& state) {
+    OrderBookL3 book(1);
+    const auto levels = static_cast<OrderId>(state.range(1));
+    for (OrderId i = 0; i < levels; ++i) {
+        book.addOrder(i + 1, Side::Buy, 100000 - static_cast<Price>(i), 100, 1);
+    }
+    const Price worst_price = 100000 - static_cast<Price>(levels - 1);
+
+    Timestamp ts = 1;
+    for (auto _ : state) {
+        ++ts;
+        book.modifyOrder(levels, worst_price, 100 + static_cast<Quantity>(ts % 2), ts);
+        if (state.range(0) == 0) {
+            auto l2_bids = book.getLevelsL2(Side::Buy);
+            benchmark::DoNotOptimize(l2_bids.data());
+        } else {
+            auto l2_bids = book.getLevelsL2View(Side::Buy);
+            benchmark::DoNotOptimize(l2_bids.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_L3_GetLevelsL2ViewAfterDeepChange)->Args({0, 100})->Args({1, 100})->Args({0, 1000})->Args({1, 1000});
+
 // ============================================================================
 // Benchmark: L3 Order Iteration
 // ============================================================================
@@ -416,6 +543,476 @@ static void BM_L3_MixedWorkload(benchmark::State& state) {
 
 BENCHMARK(BM_L3_MixedWorkload)->Arg(100)->Arg(500)->Arg(1000);
 
+// ============================================================================
+// Benchmark: Order Lookup Policy (dense sequential order ids)
+// ============================================================================
+
+/// Price for a sequential id, spread over 1000 bid levels to keep per-level queues short
+static Price sequentialPrice(OrderId order_id) {
+    return 100000 - static_cast<Price>(order_id % 1000);
+}
+
+/// Build a book holding num_orders resting orders with sequential ids starting at 1
+template<typename Book>
+static void fillSequential(Book& book, int64_t num_orders) {
+    for (OrderId id = 1; id <= static_cast<OrderId>(num_orders); ++id) {
+        book.addOrder(id, Side::Buy, sequentialPrice(id), 100, id);
+    }
+}
+
+template<typename Book>
+static void BM_L3_FindOrderSequential(benchmark::State& state) {
+    const auto num_orders = state.range(0);
+    Book book(1, 10, num_orders);
+    fillSequential(book, num_orders);
+
+    std::mt19937_64 rng(7);
+    std::vector<OrderId> probes(4096);
+    for (auto& id : probes) {
+        id = 1 + rng() % num_orders;
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(book.findOrder(probes[i]));
+        i = (i + 1) & (probes.size() - 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_L3_FindOrderSequential, OrderBookL3)->Arg(1000)->Arg(10000)->Arg(50000);
+BENCHMARK_TEMPLATE(BM_L3_FindOrderSequential, DirectIndexedOrderBookL3)->Arg(1000)->Arg(10000)->Arg(50000);
+
+/// Steady-state feed: each step adds the next sequential id and deletes the oldest resting order
+template<typename Book>
+static void BM_L3_AddDeleteSequential(benchmark::State& state) {
+    const auto num_orders = state.range(0);
+    Book book(1, 10, num_orders);
+    fillSequential(book, num_orders);
+
+    OrderId next_id = num_orders + 1;
+    OrderId oldest_id = 1;
+    for (auto _ : state) {
+        book.addOrder(next_id, Side::Buy, sequentialPrice(next_id), 100, next_id);
+        ++next_id;
+        benchmark::DoNotOptimize(book.deleteOrder(oldest_id++, 0));
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+BENCHMARK_TEMPLATE(BM_L3_AddDeleteSequential, OrderBookL3)->Arg(1000)->Arg(10000)->Arg(50000);
+BENCHMARK_TEMPLATE(BM_L3_AddDeleteSequential, DirectIndexedOrderBookL3)->Arg(1000)->Arg(10000)->Arg(50000);
+
+// ============================================================================
+// Benchmark: Snapshot Recovery (per-order replay vs bulk load)
+// ============================================================================
+
+/// Snapshot with num_orders resting orders, in exchange (random) order, on ~num_orders/4 levels per side
+static std::vector<SnapshotOrder> generateSnapshot(int64_t num_orders) {
+    std::mt19937_64 rng(2024);
+    const auto num_levels = static_cast<uint64_t>(std::max<int64_t>(num_orders / 4, 1));
+    std::vector<SnapshotOrder> orders;
+    orders.reserve(static_cast<std::size_t>(num_orders));
+    for (OrderId id = 1; id <= static_cast<OrderId>(num_orders); ++id) {
+        const Side side = (rng() & 1) ? Side::Buy : Side::Sell;
+        const auto offset = static_cast<Price>(rng() % num_levels);
+        orders.push_back({id, side, side == Side::Buy ? 100000 - offset : 100001 + offset,
+                          static_cast<Quantity>(100 + rng() % 900), id});
+    }
+    return orders;
+}
+
+static void BM_L3_SnapshotReplay(benchmark::State& state) {
+    const auto orders = generateSnapshot(state.range(0));
+    OrderBookL3 book(1, 10, orders.size());
+    for (auto _ : state) {
+        book.clear();
+        for (const auto& order : orders) {
+            book.addOrder(order.order_id, order.side, order.price, order.quantity, order.timestamp);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_L3_SnapshotReplay)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_L3_LoadSnapshot(benchmark::State& state) {
+    const auto orders = generateSnapshot(state.range(0));
+    OrderBookL3 book(1, 10, orders.size());
+    for (auto _ : state) {
+        book.loadSnapshot(orders);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_L3_LoadSnapshot)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Benchmark: Order pool memory placement
+// ============================================================================
+
+/// Quantity modifies of random resting orders in a book of range(0) orders spread over 100 levels per side.
+/// range(1) = 0: heap order pool; 1: transparent huge pages; 2: MAP_HUGETLB (falls back to transparent)
+static void BM_L3_RandomModifyResting(benchmark::State& state) {
+    const auto num_orders = static_cast<std::size_t>(state.range(0));
+    const PageSize page_sizes[] = {PageSize::Default, PageSize::Transparent, PageSize::Huge};
+    OrderBookL3 book(1, MemoryConfig{.page_size = page_sizes[state.range(1)], .prefault = true}, 10, num_orders);
+    std::vector<SnapshotOrder> orders;
+    orders.reserve(num_orders);
+    for (OrderId id = 1; id <= num_orders; ++id) {
+        const Side side = (id & 1) ? Side::Buy : Side::Sell;
+        const auto offset = static_cast<Price>(id % 100);
+        orders.push_back({id, side, side == Side::Buy ? 100000 - offset : 100001 + offset, 100, id});
+    }
+    book.loadSnapshot(orders);
+
+    std::vector<OrderId> ids(num_orders);
+    std::mt19937_64 rng(777);
+    for (auto& id : ids) {
+        id = 1 + rng() % num_orders;
+    }
+    std::size_t i = 0;
+    Quantity quantity = 100;
+    for (auto _ : state) {
+        const OrderId id = ids[i];
+        const detail::Order* order = book.findOrder(id);
+        benchmark::DoNotOptimize(book.modifyOrder(id, order->price, ++quantity % 1000 + 1, order->timestamp,
+                                                  order->priority));
+        i = i + 1 == ids.size() ? 0 : i + 1;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_L3_RandomModifyResting)->Args({1 << 20, 0})->Args({1 << 20, 1})->Args({1 << 22, 0})->Args({1 << 22, 1})
+    ->Args({1 << 22, 2});
+
+/// Partial executions of random resting orders in a book of range(0) orders spread over 100 levels per side.
+/// range(1) = 0: one executeOrder() per update; otherwise applyBatch() packets of range(1) updates
+static void BM_L3_RandomPartialExecute(benchmark::State& state) {
+    const auto num_orders = static_cast<std::size_t>(state.range(0));
+    const auto packet_size = static_cast<std::size_t>(state.range(1));
+    OrderBookL3 book(1, 10, num_orders);
+    std::vector<SnapshotOrder> orders;
+    orders.reserve(num_orders);
+    for (OrderId id = 1; id <= num_orders; ++id) {
+        const Side side = (id & 1) ? Side::Buy : Side::Sell;
+        const auto offset = static_cast<Price>(id % 100);
+        orders.push_back({id, side, side == Side::Buy ? 100000 - offset : 100001 + offset, 1'000'000'000, id});
+    }
+    book.loadSnapshot(orders);
+
+    std::vector<L3Update> updates(num_orders);
+    std::mt19937_64 rng(39);
+    for (auto& update : updates) {
+        update = L3Update{.timestamp = 0, .order_id = 1 + rng() % num_orders, .quantity = 1, .symbol = 1,
+                          .type = L3UpdateType::Execute};
+    }
+    const std::size_t step = std::max<std::size_t>(packet_size, 1);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        if (packet_size == 0) {
+            benchmark::DoNotOptimize(book.executeOrder(updates[i].order_id, 1, updates[i].timestamp));
+        } else {
+            benchmark::DoNotOptimize(book.applyBatch(std::span(updates).subspan(i, step)));
+        }
+        i = i + 2 * step > updates.size() ? 0 : i + step;
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(step));
+}
+
+BENCHMARK(BM_L3_RandomPartialExecute)->Args({1 << 20, 0})->Args({1 << 20, 32})->Args({1 << 22, 0})->Args({1 << 22, 32});
+
+// ============================================================================
+// Benchmark: Conflated level updates
+// ============================================================================
+
+/// An aggressive order sweeping range(0) resting orders at the best ask, with an L2 consumer behind an
+/// AsyncObserverBridge (level and top-of-book events only). range(1) = 1 conflates level updates.
+/// Each iteration rests the orders in one batch and executes them in a second batch.
+static void BM_L3_SweepLevel(benchmark::State& state) {
+    const auto sweep = static_cast<OrderId>(state.range(0));
+    OrderBookL3 book(1);
+    book.setConflateLevelUpdates(state.range(1) != 0);
+    book.addOrder(1000000, Side::Buy, 9999, 100, 0);
+    book.addOrder(1000001, Side::Sell, 10001, 100, 0);
+    auto bridge = std::make_shared<AsyncObserverBridge>(AsyncObserverConfig{.capacity = 1024});
+    book.addObserver(bridge, PriceLevelEvents | TopOfBookEvents);
+
+    for (auto _ : state) {
+        for (OrderId id = 1; id <= sweep; ++id) {
+            book.addOrder(id, Side::Sell, 10000, 10, 1, 0, 0, id == sweep);
+        }
+        for (OrderId id = 1; id <= sweep; ++id) {
+            book.executeOrder(id, 10, 2, 0, id == sweep);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * sweep * 2);
+    state.counters["events_per_iteration"] = benchmark::Counter(
+        static_cast<double>(bridge->stats().enqueued) / static_cast<double>(state.iterations()));
+}
+
+BENCHMARK(BM_L3_SweepLevel)->Args({10, 0})->Args({40, 0})->Args({10, 1})->Args({40, 1});
+
+// ============================================================================
+// Benchmark: Inserts into a deep level
+// ============================================================================
+
+/// Add and delete an order at a level holding range(0) resting orders.
+/// range(1) = 0: the order joins the tail (largest priority); 1: random priority inside the queue
+static void BM_L3_DeepLevelInsert(benchmark::State& state) {
+    const auto depth = static_cast<OrderId>(state.range(0));
+    const bool out_of_order = state.range(1) != 0;
+    OrderBookL3 book(1, 10, depth + 1);
+    std::vector<SnapshotOrder> orders;
+    orders.reserve(depth);
+    for (OrderId id = 1; id <= depth; ++id) {
+        orders.push_back({id, Side::Buy, 10000, 100, id * 2});
+    }
+    book.loadSnapshot(orders);
+
+    std::vector<uint64_t> priorities(4096);
+    std::mt19937_64 rng(42);
+    for (auto& priority : priorities) {
+        priority = 2 * (rng() % depth) + 1;  // Odd: between two resting orders
+    }
+    const OrderId id = depth + 1;
+    uint64_t tail_priority = depth * 2;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const uint64_t priority = out_of_order ? priorities[i++ & 4095] : ++tail_priority;
+        book.addOrder(id, Side::Buy, 10000, 100, priority, priority);
+        book.deleteOrder(id, priority);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_L3_DeepLevelInsert)->Args({10000, 0})->Args({10000, 1})->Args({100, 1});
+
+// ============================================================================
+// Benchmark: Queue position under cancel traffic
+// ============================================================================
+
+/// One cancel, one tail add and one queue position query per iteration at a level of range(0) orders.
+/// range(1) = 0: queuePosition(); 1: walk the level from the front; 2: queuePosition() with adds landing
+/// at a random place in the queue instead of the tail
+static void BM_L3_QueuePosition(benchmark::State& state) {
+    const auto depth = static_cast<std::size_t>(state.range(0));
+    const bool walk = state.range(1) == 1;
+    const bool insert_ahead = state.range(1) == 2;
+    OrderBookL3 book(1, 10, depth * 2);
+    std::vector<OrderId> live(depth);
+    for (std::size_t i = 0; i < depth; ++i) {
+        live[i] = i + 1;
+        book.addOrder(live[i], Side::Buy, 10000, 100, live[i]);
+    }
+
+    std::mt19937_64 rng(5);
+    OrderId next_id = depth + 1;
+    Quantity ahead = 0;
+    for (auto _ : state) {
+        const std::size_t cancel = rng() % depth;
+        book.deleteOrder(live[cancel], next_id);
+        live[cancel] = next_id;
+        book.addOrder(next_id, Side::Buy, 10000, 100, next_id, insert_ahead ? 1 + rng() % next_id : 0);
+        ++next_id;
+
+        const OrderId id = live[rng() % depth];
+        if (walk) {
+            const auto* level = book.getLevel(Side::Buy, 10000).first;
+            for (const auto& order : level->orders) {
+                if (order.order_id == id) {
+                    break;
+                }
+                ahead += order.quantity;
+            }
+        } else {
+            ahead += book.queuePosition(id)->quantity_ahead;
+        }
+    }
+    benchmark::DoNotOptimize(ahead);
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_L3_QueuePosition)
+    ->Args({1000, 0})->Args({1000, 1})->Args({1000, 2})
+    ->Args({10000, 0})->Args({10000, 1})->Args({10000, 2});
+
+// ============================================================================
+// Benchmark: Matching incoming orders
+// ============================================================================
+
+/// An aggressive buy crossing range(0) resting sells at one price, rested again in one batch each iteration.
+/// range(1) = 0: submitOrder(); 1: walk getBestAsk() and executeOrder() each resting order
+static void BM_L3_SubmitSweep(benchmark::State& state) {
+    const auto sweep = static_cast<OrderId>(state.range(0));
+    const bool execute = state.range(1) != 0;
+    OrderBookL3 book(1);
+    book.addOrder(1000000, Side::Buy, 9999, 100, 0);
+    book.addOrder(1000001, Side::Sell, 10001, 100, 0);
+
+    OrderId aggressive_id = 2000000;
+    for (auto _ : state) {
+        for (OrderId id = 1; id <= sweep; ++id) {
+            book.addOrder(id, Side::Sell, 10000, 10, 1, 0, 0, id == sweep);
+        }
+        if (execute) {
+            Quantity remaining = static_cast<Quantity>(sweep) * 10;
+            while (remaining > 0) {
+                const auto* order = book.getBestAsk()->getBestOrder();
+                const Quantity fill = std::min(remaining, order->quantity);
+                remaining -= fill;
+                book.executeOrder(order->order_id, fill, 2, 0, remaining == 0);
+            }
+        } else {
+            benchmark::DoNotOptimize(book.submitOrder(++aggressive_id, Side::Buy, 10000,
+                                                      static_cast<Quantity>(sweep) * 10, 2));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * sweep);
+}
+
+BENCHMARK(BM_L3_SubmitSweep)->Args({1, 0})->Args({1, 1})->Args({10, 0})->Args({10, 1})->Args({100, 0})->Args({100, 1});
+
+/// Random order flow around a 20-tick book: 70% Day limit, 15% IOC, 10% market, 5% FOK,
+/// sizes 1-100. Orders still resting 4096 submissions later are cancelled. Items are submitted orders
+static void BM_L3_SubmitOrderFlow(benchmark::State& state) {
+    struct Incoming {
+        Side side;
+        Price price;
+        Quantity quantity;
+        OrderType type;
+        TimeInForce time_in_force;
+    };
+    constexpr std::size_t kFlow = 1 << 16;
+    std::vector<Incoming> flow(kFlow);
+    std::mt19937_64 rng(7);
+    for (auto& incoming : flow) {
+        incoming.side = rng() % 2 == 0 ? Side::Buy : Side::Sell;
+        incoming.price = 10000 + static_cast<Price>(rng() % 21) - 10;
+        incoming.quantity = 1 + static_cast<Quantity>(rng() % 100);
+        const auto kind = rng() % 100;
+        incoming.type = kind < 10 ? OrderType::Market : OrderType::Limit;
+        incoming.time_in_force = kind < 10 ? TimeInForce::Day
+                               : kind < 25 ? TimeInForce::IOC
+                               : kind < 30 ? TimeInForce::FOK
+                                           : TimeInForce::Day;
+    }
+
+    OrderBookL3 book(1, 10, 1 << 16);
+    OrderId id = 0;
+    uint64_t trades = 0;
+    for (auto _ : state) {
+        const Incoming& incoming = flow[id & (kFlow - 1)];
+        ++id;
+        if (id > 4096) {
+            book.deleteOrder(id - 4096, id);
+        }
+        trades += book.submitOrder(id, incoming.side, incoming.price, incoming.quantity, id, incoming.type,
+                                   incoming.time_in_force).trade_count;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["trades_per_order"] = benchmark::Counter(
+        static_cast<double>(trades) / static_cast<double>(state.iterations()));
+    state.counters["resting"] = static_cast<double>(book.orderCount());
+}
+
+BENCHMARK(BM_L3_SubmitOrderFlow);
+
+// ============================================================================
+// Benchmark: Stop orders
+// ============================================================================
+
+/// One crossing IOC order (and the resting order it fills re-added) per iteration, with range(0) stop
+/// orders pending far from the market on each side: the stop check stays one comparison per side
+static void BM_L3_SubmitWithPendingStops(benchmark::State& state) {
+    const auto stops = static_cast<OrderId>(state.range(0));
+    OrderBookL3 book(1);
+    for (OrderId id = 1; id <= stops; ++id) {
+        book.submitStopOrder(1000000 + id, Side::Buy, 20000 + static_cast<Price>(id % 500), 1, 0);
+        book.submitStopOrder(2000000 + id, Side::Sell, 5000 - static_cast<Price>(id % 500), 1, 0);
+    }
+    book.addOrder(1, Side::Buy, 9999, 100, 0);
+    OrderId id = 10;
+    for (auto _ : state) {
+        book.addOrder(++id, Side::Sell, 10000, 10, id);
+        benchmark::DoNotOptimize(book.submitOrder(++id, Side::Buy, 10000, 10, id, OrderType::Limit, TimeInForce::IOC));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_L3_SubmitWithPendingStops)->Arg(0)->Arg(1000)->Arg(100000);
+
+/// A trade triggering range(0) buy stops at consecutive prices, each a 1-lot market order lifting the
+/// next 1-lot ask; the book and stops are rebuilt (untimed) each iteration. Items are triggered stops.
+/// Every stop empties the best ask level, so the vector layout pays its front erase per stop
+template<typename Book>
+static void BM_L3_StopTriggerCascade(benchmark::State& state) {
+    const auto stops = static_cast<OrderId>(state.range(0));
+    Book book = [] {
+        if constexpr (std::is_same_v<Book, LadderOrderBookL3>) {
+            return Book(1, PriceLadderConfig{1, 4096}, 10, 4096);
+        } else {
+            return Book(1, 10, 4096);
+        }
+    }();
+    OrderId id = 0;
+    uint64_t triggered = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        book.clear();
+        for (Price tick = 0; tick <= static_cast<Price>(stops); ++tick) {
+            book.addOrder(++id, Side::Sell, 10000 + tick, 1, id);
+        }
+        for (OrderId i = 0; i < stops; ++i) {
+            book.submitStopOrder(++id, Side::Buy, 10000 + static_cast<Price>(i), 1, id);
+        }
+        state.ResumeTiming();
+        triggered += book.submitOrder(++id, Side::Buy, 10000, 1, id).triggered_stops;
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(triggered));
+}
+
+BENCHMARK(BM_L3_StopTriggerCascade<OrderBookL3>)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BM_L3_StopTriggerCascade<LadderOrderBookL3>)->Arg(10)->Arg(100)->Arg(1000);
+
+// ============================================================================
+// Benchmark: Level churn at the touch
+// ============================================================================
+
+/// Quote stuffing: an order opens a new best bid level and is cancelled, over N resting levels
+/// Each insert and erase shifts every resting level (in place) or its 16-byte index entry (pooled)
+template<typename Book>
+static void BM_L3_TopLevelChurn(benchmark::State& state) {
+    const auto levels = static_cast<OrderId>(state.range(0));
+    Book book(1);
+    for (OrderId i = 0; i < levels; ++i) {
+        book.addOrder(i + 1, Side::Buy, 100000 - static_cast<Price>(i), 100, 1);
+    }
+
+    OrderId id = levels;
+    for (auto _ : state) {
+        ++id;
+        book.addOrder(id, Side::Buy, 100001 + static_cast<Price>(id % 8), 10, id);
+        book.deleteOrder(id, id);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+BENCHMARK(BM_L3_TopLevelChurn<OrderBookL3>)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_L3_TopLevelChurn<PooledLevelOrderBookL3>)->Arg(100)->Arg(1000)->Arg(10000);
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -8,13 +8,47 @@
  * - Symbol lookup overhead
  * - Concurrent access patterns
  * - Symbol churn (add/remove)
+ * - Venue consolidation (ConsolidatedBook)
  *
  * Target: Minimal overhead compared to single-symbol operations
+ *
+ * Symbol lookup, shared-lock FlatMap vs DirectTable (one atomic pointer per
+ * SymbolId), GCC 12, -O3 -march=native, header-only, mean ns/op:
+ *
+ *   Benchmark                         SharedLock   DirectTable
+ *   SymbolLookup/10                         30.1          2.81
+ *   SymbolLookup/1000                       94.1          2.14
+ *   SymbolLookup/10000                       189          2.49
+ *   ConcurrentReadHeavy/threads:1           51.5          3.28
+ *   ConcurrentReadHeavy/threads:16          43.8          2.85
+ *
+ * (Measured on a single core: the threaded rows show per-lookup cost, not
+ * reader-count cache line contention, which only widens the gap.)
+ *
+ * Checkpoint restart of 5000 L3 books (open + restore into a fresh manager):
+ *
+ *   Benchmark                         ms        orders/s
+ *   CheckpointRestore/20             110          0.92M
+ *   CheckpointRestore/200            138          7.3M
+ *
+ * (At 20 orders per book the time is mostly book construction, not loading.)
+ *
+ * One instrument on n venues (one manager each, 100 levels per side), one venue level update per
+ * iteration plus the merged book, ns per update (venue update alone: 80-87 ns):
+ *
+ *   Venues      getLevels() merge of top 10   ConsolidatedBook
+ *   2                                   428               95.0
+ *   4                                   990               95.2
+ *   8                                  1837               94.9
  */
 
 #include <slick/orderbook/orderbook.hpp>
 #include <benchmark/benchmark.h>
+#include <algorithm>
+#include <filesystem>
+#include <memory>
 #include <random>
+#include <string>
 #include <vector>
 #include <thread>
 
@@ -176,8 +210,9 @@ BENCHMARK(BM_Manager_MultiSymbolL3Updates)->Arg(10)->Arg(100)->Arg(1000);
 // Benchmark: Symbol Lookup Overhead
 // ============================================================================
 
+template<typename Manager>
 static void BM_Manager_SymbolLookup(benchmark::State& state) {
-    OrderBookManager<OrderBookL2> manager;
+    Manager manager;
     const auto num_symbols = state.range(0);
     auto symbols = generateSymbolIds(num_symbols);
 
@@ -198,7 +233,8 @@ static void BM_Manager_SymbolLookup(benchmark::State& state) {
     state.SetItemsProcessed(state.iterations());
 }
 
-BENCHMARK(BM_Manager_SymbolLookup)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_Manager_SymbolLookup, OrderBookManager<OrderBookL2>)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_Manager_SymbolLookup, DirectOrderBookManager<OrderBookL2>)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
 
 // ============================================================================
 // Benchmark: Symbol Churn (Add/Remove)
@@ -273,12 +309,82 @@ static void BM_Manager_IterateAllSymbols(benchmark::State& state) {
 
 BENCHMARK(BM_Manager_IterateAllSymbols)->Arg(10)->Arg(100)->Arg(1000);
 
+/// Top-10 depth copy of range(0) books through their sequence locks, spread over range(1) workers
+static void BM_Manager_ParallelSnapshot(benchmark::State& state) {
+    DirectOrderBookManager<OrderBookL2> manager;
+    const auto num_symbols = static_cast<std::size_t>(state.range(0));
+    for (auto symbol_id : generateSymbolIds(num_symbols)) {
+        auto* book = manager.getOrCreateOrderBook(symbol_id);
+        book->setPublishedDepth(10);
+        for (Price offset = 0; offset < 10; ++offset) {
+            book->updateLevel(Side::Buy, 100000 - offset, 1000, 0, 0);
+            book->updateLevel(Side::Sell, 100100 + offset, 1000, 0, 0);
+        }
+    }
+    const SweepPolicy policy{static_cast<std::size_t>(state.range(1))};
+
+    for (auto _ : state) {
+        auto snapshots = manager.parallelSnapshot<10>(policy);
+        benchmark::DoNotOptimize(snapshots.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Manager_ParallelSnapshot)->Args({10000, 1})->Args({10000, 2})->Args({10000, 4})
+    ->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+// ============================================================================
+// Benchmark: Checkpoint Restart
+// ============================================================================
+
+// Restart of 5000 L3 books from a checkpoint: map the file and bulk-load every
+// book into a fresh manager. Arg = orders per book (over 20 levels per side)
+static void BM_Manager_CheckpointRestore(benchmark::State& state) {
+    constexpr SymbolId num_symbols = 5000;
+    const auto orders_per_book = static_cast<OrderId>(state.range(0));
+    const std::string path = (std::filesystem::temp_directory_path() / "slick_bench_restore.ckpt").string();
+
+    {
+        CheckpointWriter writer(path);
+        for (SymbolId symbol = 1; symbol <= num_symbols; ++symbol) {
+            OrderBookL3 source(symbol);
+            for (OrderId id = 1; id <= orders_per_book; ++id) {
+                const Side side = id % 2 == 0 ? Side::Buy : Side::Sell;
+                const Price offset = static_cast<Price>(id % 20);
+                source.addOrder(id, side, side == Side::Buy ? 10000 - offset : 10001 + offset, 100, id, 0, id);
+            }
+            writer.capture(source);
+        }
+        if (!writer.flush()) {
+            state.SkipWithError("checkpoint write failed");
+            return;
+        }
+    }
+
+    std::size_t restored = 0;
+    for (auto _ : state) {
+        Checkpoint checkpoint;
+        OrderBookManager<OrderBookL3> manager;
+        checkpoint.open(path);
+        restored = checkpoint.restore(manager);
+        benchmark::DoNotOptimize(restored);
+    }
+
+    std::filesystem::remove(path);
+    state.counters["books"] = static_cast<double>(restored);
+    state.SetItemsProcessed(state.iterations() * num_symbols * orders_per_book);
+}
+
+BENCHMARK(BM_Manager_CheckpointRestore)->Arg(20)->Arg(200)->Unit(benchmark::kMillisecond);
+
 // ============================================================================
 // Benchmark: Concurrent Symbol Access (Read-Heavy)
 // ============================================================================
 
+template<typename Manager>
 static void BM_Manager_ConcurrentReadHeavy(benchmark::State& state) {
-    static OrderBookManager<OrderBookL2> manager;
+    static Manager manager;
     static std::once_flag init_flag;
 
     // Initialize once across all threads
@@ -311,7 +417,10 @@ static void BM_Manager_ConcurrentReadHeavy(benchmark::State& state) {
     state.SetItemsProcessed(state.iterations());
 }
 
-BENCHMARK(BM_Manager_ConcurrentReadHeavy)->Threads(1)->Threads(2)->Threads(4)->Threads(8);
+BENCHMARK_TEMPLATE(BM_Manager_ConcurrentReadHeavy, OrderBookManager<OrderBookL2>)
+    ->Threads(1)->Threads(2)->Threads(4)->Threads(8)->Threads(16);
+BENCHMARK_TEMPLATE(BM_Manager_ConcurrentReadHeavy, DirectOrderBookManager<OrderBookL2>)
+    ->Threads(1)->Threads(2)->Threads(4)->Threads(8)->Threads(16);
 
 // ============================================================================
 // Benchmark: Comparison - Single Symbol vs Manager Overhead
@@ -358,6 +467,112 @@ static void BM_Manager_SingleSymbol_L2Update(benchmark::State& state) {
 
 BENCHMARK(BM_Manager_SingleSymbol_L2Update);
 
+// ============================================================================
+// Benchmark: Consolidated book across venues
+// ============================================================================
+
+/// range(0) venues, one OrderBookManager each, quoting 100 levels per side of one symbol
+struct VenueBooks {
+    static constexpr SymbolId kSymbol = 1;
+    std::vector<std::unique_ptr<OrderBookManager<OrderBookL2>>> managers;
+    std::vector<OrderBookL2*> books;
+
+    explicit VenueBooks(std::size_t venues) {
+        for (std::size_t venue = 0; venue < venues; ++venue) {
+            managers.push_back(std::make_unique<OrderBookManager<OrderBookL2>>());
+            books.push_back(managers.back()->getOrCreateOrderBook(kSymbol));
+            for (Price tick = 0; tick < 100; ++tick) {
+                books.back()->updateLevel(Side::Buy, 10000 - tick, 100, 0);
+                books.back()->updateLevel(Side::Sell, 10001 + tick, 100, 0);
+            }
+        }
+    }
+};
+
+/// One level update on a random venue within the top 10 levels, then the merged top 10 levels of both
+/// sides rebuilt from every venue's getLevels() (the per-tick merge ConsolidatedBook replaces)
+static void BM_Consolidated_MergeByHand(benchmark::State& state) {
+    VenueBooks venues(static_cast<std::size_t>(state.range(0)));
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<std::size_t> venue_dist(0, venues.books.size() - 1);
+    std::uniform_int_distribution<Price> tick_dist(0, 9);
+    std::uniform_int_distribution<Quantity> qty_dist(1, 200);
+    std::vector<detail::PriceLevelL2> merged;
+    Timestamp ts = 0;
+    for (auto _ : state) {
+        const Side side = (ts & 1) ? Side::Buy : Side::Sell;
+        const Price price = side == Side::Buy ? 10000 - tick_dist(rng) : 10001 + tick_dist(rng);
+        venues.books[venue_dist(rng)]->updateLevel(side, price, qty_dist(rng), ++ts);
+        for (Side s : {Side::Buy, Side::Sell}) {
+            merged.clear();
+            for (OrderBookL2* book : venues.books) {
+                const auto levels = book->getLevels(s, 10);
+                merged.insert(merged.end(), levels.begin(), levels.end());
+            }
+            std::sort(merged.begin(), merged.end(), [s](const auto& a, const auto& b) {
+                return s == Side::Buy ? a.price > b.price : a.price < b.price;
+            });
+            std::size_t out = 0;
+            for (std::size_t i = 0; i < merged.size(); ++i) {
+                if (out > 0 && merged[out - 1].price == merged[i].price) {
+                    merged[out - 1].quantity += merged[i].quantity;
+                } else {
+                    merged[out++] = merged[i];
+                }
+            }
+            merged.resize(std::min<std::size_t>(out, 10));
+            benchmark::DoNotOptimize(merged.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Consolidated_MergeByHand)->Arg(2)->Arg(4)->Arg(8);
+
+/// Same updates with a ConsolidatedBook attached to every venue book, reading the merged top-of-book
+static void BM_Consolidated_Incremental(benchmark::State& state) {
+    VenueBooks venues(static_cast<std::size_t>(state.range(0)));
+    ConsolidatedBook consolidated(VenueBooks::kSymbol, venues.books.size());
+    for (std::size_t venue = 0; venue < venues.books.size(); ++venue) {
+        consolidated.attach(static_cast<VenueId>(venue), *venues.books[venue]);
+    }
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<std::size_t> venue_dist(0, venues.books.size() - 1);
+    std::uniform_int_distribution<Price> tick_dist(0, 9);
+    std::uniform_int_distribution<Quantity> qty_dist(1, 200);
+    Timestamp ts = 0;
+    for (auto _ : state) {
+        const Side side = (ts & 1) ? Side::Buy : Side::Sell;
+        const Price price = side == Side::Buy ? 10000 - tick_dist(rng) : 10001 + tick_dist(rng);
+        venues.books[venue_dist(rng)]->updateLevel(side, price, qty_dist(rng), ++ts);
+        benchmark::DoNotOptimize(consolidated.getTopOfBook());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Consolidated_Incremental)->Arg(2)->Arg(4)->Arg(8);
+
+/// Venue level updates alone (no consolidation), the floor of both benchmarks above
+static void BM_Consolidated_VenueUpdatesOnly(benchmark::State& state) {
+    VenueBooks venues(static_cast<std::size_t>(state.range(0)));
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<std::size_t> venue_dist(0, venues.books.size() - 1);
+    std::uniform_int_distribution<Price> tick_dist(0, 9);
+    std::uniform_int_distribution<Quantity> qty_dist(1, 200);
+    Timestamp ts = 0;
+    for (auto _ : state) {
+        const Side side = (ts & 1) ? Side::Buy : Side::Sell;
+        const Price price = side == Side::Buy ? 10000 - tick_dist(rng) : 10001 + tick_dist(rng);
+        venues.books[venue_dist(rng)]->updateLevel(side, price, qty_dist(rng), ++ts);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Consolidated_VenueUpdatesOnly)->Arg(2)->Arg(4)->Arg(8);
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -0,0 +1,301 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/events.hpp>
+#include <slick/orderbook/observer.hpp>
+#include <slick/orderbook/detail/spsc_ring.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <variant>
+
+SLICK_NAMESPACE_BEGIN
+
+/// What an AsyncObserverBridge does when its ring is full
+enum class AsyncOverflowPolicy : uint8_t {
+    DropOldest,     // Evict the oldest queued event (the feed thread never waits)
+    Block,          // Spin until the consumer frees a slot (a consumer must be running)
+};
+
+/// AsyncObserverBridge configuration
+struct AsyncObserverConfig {
+    std::size_t capacity = 4096;                                // Ring slots (rounded up to a power of two)
+    AsyncOverflowPolicy overflow = AsyncOverflowPolicy::DropOldest;
+    bool conflate_top_of_book = false;                          // Keep only the latest TopOfBook outside the ring
+    bool measure_latency = true;                                // Timestamp events to track queueing latency
+};
+
+/// AsyncObserverBridge counters
+struct AsyncObserverStats {
+    uint64_t enqueued = 0;          // Events written to the ring (or the conflated top-of-book slot)
+    uint64_t delivered = 0;         // Events delivered to the consumer-side observers
+    uint64_t dropped = 0;           // Events evicted by DropOldest
+    uint64_t blocked = 0;           // Events that waited for a free slot under Block
+    uint64_t conflated = 0;         // TopOfBook updates replaced before the consumer saw them
+    uint64_t max_latency_ns = 0;    // Largest enqueue-to-delivery latency
+    uint64_t total_latency_ns = 0;  // Sum of enqueue-to-delivery latencies (mean = total / delivered)
+
+    /// Mean enqueue-to-delivery latency
+    [[nodiscard]] double meanLatencyNs() const noexcept {
+        return delivered ? static_cast<double>(total_latency_ns) / static_cast<double>(delivered) : 0.0;
+    }
+};
+
+/// Moves observer fan-out off the market data thread
+///
+/// Register the bridge with a book like any other observer; it copies each event into a preallocated
+/// SPSC ring and returns. The consumer side drains the ring, either through poll() on a thread the caller
+/// owns or through the thread started by start(), and delivers the events to ordinary IOrderBookObservers
+/// added with addObserver().
+///
+/// Threading: one producer (the thread updating the book) and one consumer. Consumer-side observers
+/// must be added before the consumer starts. Snapshot begin/end markers travel through the ring, so they
+/// stay ordered with the snapshot contents; a conflated TopOfBook is delivered after the queued events
+/// of the same poll().
+class AsyncObserverBridge final : public IOrderBookObserver {
+public:
+    /// Constructor
+    /// @param config Ring capacity, overflow policy and options
+    explicit AsyncObserverBridge(const AsyncObserverConfig& config = {})
+        : config_(config), ring_(config.capacity) {}
+
+    ~AsyncObserverBridge() override {
+        stop();
+    }
+
+    AsyncObserverBridge(const AsyncObserverBridge&) = delete;
+    AsyncObserverBridge& operator=(const AsyncObserverBridge&) = delete;
+
+    /// Add a consumer-side observer (before the consumer starts)
+    /// @param observer Observer to deliver events to
+    /// @param events Bitset of ObserverEvents to deliver (default: all)
+    /// @param depth Only deliver price level and order updates for the top N levels (0 = all levels)
+    void addObserver(std::shared_ptr<IOrderBookObserver> observer, uint8_t events = AllEvents, std::size_t depth = 0) {
+        observers_.addObserver(std::move(observer), events, depth);
+    }
+
+    // Producer side (called by the book)
+
+    void onPriceLevelUpdate(const PriceLevelUpdate& update) override { enqueue(update); }
+    void onOrderUpdate(const OrderUpdate& update) override { enqueue(update); }
+    void onTrade(const Trade& trade) override { enqueue(trade); }
+
+    void onTopOfBookUpdate(const TopOfBook& tob) override {
+        if (config_.conflate_top_of_book) {
+            publishTopOfBook(tob);
+        } else {
+            enqueue(tob);
+        }
+    }
+
+    void onSnapshotBegin(SymbolId symbol, uint64_t seq_num, Timestamp timestamp) override {
+        enqueue(SnapshotMarker{symbol, seq_num, timestamp, true});
+    }
+
+    void onSnapshotEnd(SymbolId symbol, uint64_t seq_num, Timestamp timestamp) override {
+        enqueue(SnapshotMarker{symbol, seq_num, timestamp, false});
+    }
+
+    // Consumer side
+
+    /// Deliver queued events to the consumer-side observers (consumer thread only)
+    /// @param max_events Maximum number of ring events to deliver
+    /// @return Number of events delivered
+    std::size_t poll(std::size_t max_events = SIZE_MAX) {
+        std::size_t count = 0;
+        Event event;
+        while (count < max_events && ring_.tryPop(event)) {
+            std::visit([this](const auto& payload) { deliver(payload); }, event.payload);
+            recordDelivery(event.enqueue_ns);
+            ++count;
+        }
+        if (config_.conflate_top_of_book && tob_pending_.exchange(false, std::memory_order_acquire)) {
+            uint64_t enqueue_ns = 0;
+            const uint64_t seq = readTopOfBook(latest_tob_copy_, enqueue_ns);
+            // A newer value may already have been read by the previous poll()
+            if (seq != delivered_tob_seq_) {
+                delivered_tob_seq_ = seq;
+                observers_.notifyTopOfBookUpdate(latest_tob_copy_);
+                recordDelivery(enqueue_ns);
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    /// Start a consumer thread that polls until stop()
+    void start() {
+        if (!consumer_.joinable()) {
+            consumer_ = std::jthread([this](std::stop_token stop_token) {
+                while (!stop_token.stop_requested()) {
+                    if (poll() == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+                poll();  // Drain what was queued before stop()
+            });
+        }
+    }
+
+    /// Stop the consumer thread started by start(), after delivering the remaining events
+    void stop() {
+        if (consumer_.joinable()) {
+            consumer_.request_stop();
+            consumer_.join();
+        }
+    }
+
+    /// Check if the consumer thread is running
+    [[nodiscard]] bool running() const noexcept {
+        return consumer_.joinable();
+    }
+
+    /// Get number of events waiting in the ring
+    [[nodiscard]] std::size_t pending() const noexcept {
+        return ring_.size();
+    }
+
+    /// Get ring capacity
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return ring_.capacity();
+    }
+
+    /// Get counters (safe to call from any thread)
+    [[nodiscard]] AsyncObserverStats stats() const noexcept {
+        AsyncObserverStats result;
+        result.enqueued = enqueued_.load(std::memory_order_relaxed);
+        result.dropped = dropped_.load(std::memory_order_relaxed);
+        result.blocked = blocked_.load(std::memory_order_relaxed);
+        result.conflated = conflated_.load(std::memory_order_relaxed);
+        result.delivered = delivered_.load(std::memory_order_relaxed);
+        result.max_latency_ns = max_latency_ns_.load(std::memory_order_relaxed);
+        result.total_latency_ns = total_latency_ns_.load(std::memory_order_relaxed);
+        return result;
+    }
+
+private:
+    struct SnapshotMarker {
+        SymbolId symbol;
+        uint64_t seq_num;
+        Timestamp timestamp;
+        bool begin;
+    };
+
+    struct Event {
+        std::variant<PriceLevelUpdate, OrderUpdate, Trade, TopOfBook, SnapshotMarker> payload;
+        uint64_t enqueue_ns = 0;
+    };
+
+    [[nodiscard]] uint64_t now() const noexcept {
+        if (!config_.measure_latency) {
+            return 0;
+        }
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    template<typename Payload>
+    void enqueue(const Payload& payload) {
+        const Event event{payload, now()};
+        if (config_.overflow == AsyncOverflowPolicy::DropOldest) {
+            if (ring_.pushOverwrite(event)) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+            }
+        } else if (!ring_.tryPush(event)) {
+            blocked_.fetch_add(1, std::memory_order_relaxed);
+            while (!ring_.tryPush(event)) {
+                std::this_thread::yield();
+            }
+        }
+        enqueued_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Seqlock write of the conflated top-of-book slot (producer)
+    void publishTopOfBook(const TopOfBook& tob) {
+        const uint64_t seq = tob_seq_.load(std::memory_order_relaxed);
+        tob_seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        latest_tob_ = tob;
+        latest_tob_enqueue_ns_ = now();
+        tob_seq_.store(seq + 2, std::memory_order_release);
+
+        if (tob_pending_.exchange(true, std::memory_order_release)) {
+            conflated_.fetch_add(1, std::memory_order_relaxed);
+        }
+        enqueued_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Seqlock read of the conflated top-of-book slot (consumer)
+    /// @return Sequence number of the value read
+    uint64_t readTopOfBook(TopOfBook& tob, uint64_t& enqueue_ns) const {
+        uint64_t seq1, seq2;
+        do {
+            seq1 = tob_seq_.load(std::memory_order_acquire);
+            while (seq1 & 1) {
+                seq1 = tob_seq_.load(std::memory_order_acquire);
+            }
+            tob = latest_tob_;
+            enqueue_ns = latest_tob_enqueue_ns_;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            seq2 = tob_seq_.load(std::memory_order_relaxed);
+        } while (seq1 != seq2);
+        return seq1;
+    }
+
+    void deliver(const PriceLevelUpdate& update) { observers_.notifyPriceLevelUpdate(update); }
+    void deliver(const OrderUpdate& update) { observers_.notifyOrderUpdate(update); }
+    void deliver(const Trade& trade) { observers_.notifyTrade(trade); }
+    void deliver(const TopOfBook& tob) { observers_.notifyTopOfBookUpdate(tob); }
+
+    void deliver(const SnapshotMarker& marker) {
+        if (marker.begin) {
+            observers_.notifySnapshotBegin(marker.symbol, marker.seq_num, marker.timestamp);
+        } else {
+            observers_.notifySnapshotEnd(marker.symbol, marker.seq_num, marker.timestamp);
+        }
+    }
+
+    void recordDelivery(uint64_t enqueue_ns) noexcept {
+        // Counters are only written by the consumer; atomics make them readable from stats()
+        delivered_.store(delivered_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (enqueue_ns != 0) {
+            const uint64_t latency = now() - enqueue_ns;
+            total_latency_ns_.store(total_latency_ns_.load(std::memory_order_relaxed) + latency, std::memory_order_relaxed);
+            if (latency > max_latency_ns_.load(std::memory_order_relaxed)) {
+                max_latency_ns_.store(latency, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    AsyncObserverConfig config_;                            // Bridge configuration
+    ObserverManager observers_;                             // Consumer-side observers
+    detail::SPSCRing<Event> ring_;                          // Producer -> consumer event queue
+
+    // Producer-written state
+    SLICK_CACHE_ALIGNED std::atomic<uint64_t> enqueued_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> blocked_{0};
+    std::atomic<uint64_t> conflated_{0};
+    std::atomic<uint64_t> tob_seq_{0};                      // Seqlock for latest_tob_ (odd = writing)
+    std::atomic<bool> tob_pending_{false};                  // latest_tob_ not yet delivered
+    TopOfBook latest_tob_;                                  // Conflated top-of-book
+    uint64_t latest_tob_enqueue_ns_ = 0;
+
+    // Consumer-written state
+    SLICK_CACHE_ALIGNED std::atomic<uint64_t> delivered_{0};
+    std::atomic<uint64_t> max_latency_ns_{0};
+    std::atomic<uint64_t> total_latency_ns_{0};
+    TopOfBook latest_tob_copy_;                             // Consumer copy of latest_tob_
+    uint64_t delivered_tob_seq_ = 0;                        // Seqlock value of the last delivered top-of-book
+
+    std::jthread consumer_;                                 // Consumer thread started by start()
+};
+
+SLICK_NAMESPACE_END
@@ -0,0 +1,184 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+SLICK_NAMESPACE_BEGIN
+
+/// Result of BookAnalytics::priceToFill()
+struct FillEstimate {
+    Price worst_price = 0;          // Price of the deepest level touched (0 if nothing to fill against)
+    double average_price = 0.0;     // Volume-weighted price of the filled quantity
+    Quantity filled = 0;            // Quantity fillable within the tracked levels (< requested if too shallow)
+};
+
+/// Running sums over the top levels of a book (see setAnalyticsDepth() on OrderBookL2 / OrderBookL3)
+///
+/// Each side keeps its top depth() levels as contiguous arrays of prices and quantities with prefix sums
+/// of quantity and notional (price * quantity). The book refreshes them at the end of every update batch
+/// that touches a tracked level, on the sides the batch changed and from the shallowest changed level
+/// down; levels above it keep their sums.
+/// Queries read the arrays: cumulative depth, VWAP, microprice, weighted mid and imbalance are O(1),
+/// priceToFill() is a binary search over cumulative quantity, O(log depth()).
+///
+/// Prices are returned in the book's price units. Not thread-safe: read on the book's update thread
+/// (use readDepth() to share depth across threads).
+class BookAnalytics {
+public:
+    /// Constructor
+    /// @param depth Levels tracked per side (0 = disabled, nothing allocated)
+    explicit BookAnalytics(std::size_t depth = 0) : depth_(depth) {
+        for (SideSums& sums : sides_) {
+            sums.prices.resize(depth);
+            sums.quantities.resize(depth);
+            sums.cumulative_quantity.resize(depth);
+            sums.cumulative_notional.resize(depth);
+        }
+    }
+
+    /// Get number of levels tracked per side (0 = disabled)
+    [[nodiscard]] std::size_t depth() const noexcept { return depth_; }
+
+    /// Get number of levels currently tracked on a side (at most depth())
+    [[nodiscard]] std::size_t levelCount(Side side) const noexcept {
+        return sides_[side].count;
+    }
+
+    /// Get total quantity of the best levels of a side
+    /// @param levels Number of levels (clamped to levelCount())
+    [[nodiscard]] Quantity cumulativeQuantity(Side side, std::size_t levels) const noexcept {
+        const SideSums& sums = sides_[side];
+        const std::size_t n = std::min(levels, sums.count);
+        return n == 0 ? 0 : sums.cumulative_quantity[n - 1];
+    }
+
+    /// Get volume-weighted average price of the best levels of a side (0 if the side is empty)
+    /// @param levels Number of levels (clamped to levelCount())
+    [[nodiscard]] double vwap(Side side, std::size_t levels) const noexcept {
+        const SideSums& sums = sides_[side];
+        const std::size_t n = std::min(levels, sums.count);
+        return n == 0 ? 0.0 : sums.cumulative_notional[n - 1] / static_cast<double>(sums.cumulative_quantity[n - 1]);
+    }
+
+    /// Get depth-weighted mid over the best levels of each side:
+    /// (vwap(Buy) * depth(Sell) + vwap(Sell) * depth(Buy)) / (depth(Buy) + depth(Sell))
+    /// @param levels Number of levels per side
+    /// @return Weighted mid, or NaN if a side is empty
+    [[nodiscard]] double weightedMid(std::size_t levels) const noexcept {
+        const Quantity bid_quantity = cumulativeQuantity(Side::Buy, levels);
+        const Quantity ask_quantity = cumulativeQuantity(Side::Sell, levels);
+        if (bid_quantity == 0 || ask_quantity == 0) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        return (vwap(Side::Buy, levels) * static_cast<double>(ask_quantity) +
+                vwap(Side::Sell, levels) * static_cast<double>(bid_quantity)) /
+               static_cast<double>(bid_quantity + ask_quantity);
+    }
+
+    /// Get microprice (weightedMid() of the top level)
+    [[nodiscard]] double microprice() const noexcept {
+        return weightedMid(1);
+    }
+
+    /// Get depth imbalance of the best levels: (depth(Buy) - depth(Sell)) / (depth(Buy) + depth(Sell))
+    /// @param levels Number of levels per side
+    /// @return Imbalance in [-1, 1] (positive = more bid depth), 0 if the book is empty
+    [[nodiscard]] double imbalance(std::size_t levels) const noexcept {
+        const Quantity bid_quantity = cumulativeQuantity(Side::Buy, levels);
+        const Quantity ask_quantity = cumulativeQuantity(Side::Sell, levels);
+        const Quantity total = bid_quantity + ask_quantity;
+        return total == 0 ? 0.0 : static_cast<double>(bid_quantity - ask_quantity) / static_cast<double>(total);
+    }
+
+    /// Estimate an aggressive order sweeping the tracked levels
+    /// @param aggressor Side of the aggressive order (Buy sweeps asks, Sell sweeps bids)
+    /// @param quantity Quantity to fill
+    [[nodiscard]] FillEstimate priceToFill(Side aggressor, Quantity quantity) const noexcept {
+        const SideSums& sums = sides_[aggressor == Side::Buy ? Side::Sell : Side::Buy];
+        FillEstimate estimate;
+        if (sums.count == 0 || quantity <= 0) {
+            return estimate;
+        }
+
+        const auto first = sums.cumulative_quantity.begin();
+        const auto last = first + static_cast<std::ptrdiff_t>(sums.count);
+        const auto it = std::lower_bound(first, last, quantity);
+        if (it == last) {
+            // Not enough tracked depth: the whole book side within depth()
+            estimate.worst_price = sums.prices[sums.count - 1];
+            estimate.filled = sums.cumulative_quantity[sums.count - 1];
+            estimate.average_price = sums.cumulative_notional[sums.count - 1] / static_cast<double>(estimate.filled);
+            return estimate;
+        }
+
+        const auto level = static_cast<std::size_t>(it - first);
+        const Quantity before = level == 0 ? 0 : sums.cumulative_quantity[level - 1];
+        const double notional_before = level == 0 ? 0.0 : sums.cumulative_notional[level - 1];
+        estimate.worst_price = sums.prices[level];
+        estimate.filled = quantity;
+        estimate.average_price = (notional_before + static_cast<double>(quantity - before) * static_cast<double>(sums.prices[level])) /
+                                 static_cast<double>(quantity);
+        return estimate;
+    }
+
+    /// Refresh a side from the shallowest changed level (book update thread only)
+    /// @param side Side to refresh
+    /// @param levels Levels of the side, best first
+    /// @param to_level Converts a container element to a PriceLevelL2
+    /// @param from_level Shallowest level that may have changed (sums above it are kept)
+    template<typename Levels, typename ToLevel>
+    void update(Side side, const Levels& levels, ToLevel&& to_level, std::size_t from_level) noexcept {
+        refresh(sides_[side], levels, to_level, from_level);
+    }
+
+private:
+    /// Structure of arrays per side, depth_ entries each (allocated once)
+    struct SideSums {
+        std::vector<Price> prices;
+        std::vector<Quantity> quantities;
+        std::vector<Quantity> cumulative_quantity;
+        std::vector<double> cumulative_notional;
+        std::size_t count = 0;
+    };
+
+    template<typename Levels, typename ToLevel>
+    void refresh(SideSums& sums, const Levels& levels, ToLevel& to_level, std::size_t from_level) noexcept {
+        const std::size_t from = std::min({from_level, sums.count, static_cast<std::size_t>(levels.size())});
+        const std::size_t depth = depth_;
+        Price* const prices = sums.prices.data();
+        Quantity* const quantities = sums.quantities.data();
+        Quantity* const cumulative = sums.cumulative_quantity.data();
+        double* const notional = sums.cumulative_notional.data();
+
+        // One pass with the running sums in registers (the arrays may alias the counters otherwise)
+        Quantity running_quantity = from == 0 ? 0 : cumulative[from - 1];
+        double running_notional = from == 0 ? 0.0 : notional[from - 1];
+        std::size_t count = from;
+        auto it = levels.begin();
+        std::advance(it, static_cast<std::ptrdiff_t>(from));
+        for (const auto end = levels.end(); it != end && count < depth; ++it, ++count) {
+            const auto level = to_level(*it);
+            running_quantity += level.quantity;
+            running_notional += static_cast<double>(level.price) * static_cast<double>(level.quantity);
+            prices[count] = level.price;
+            quantities[count] = level.quantity;
+            cumulative[count] = running_quantity;
+            notional[count] = running_notional;
+        }
+        sums.count = count;
+    }
+
+    std::size_t depth_;                 // Levels tracked per side
+    std::array<SideSums, 2> sides_;     // Indexed by Side
+};
+
+SLICK_NAMESPACE_END
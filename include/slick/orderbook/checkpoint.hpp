@@ -0,0 +1,810 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/events.hpp>
+#include <slick/orderbook/observer.hpp>
+#include <slick/orderbook/detail/price_level_l2.hpp>
+#include <slick/orderbook/detail/flat_map.hpp>
+#include <slick/orderbook/detail/mapped_file.hpp>
+#include <slick/orderbook/detail/order.hpp>
+#include <slick/orderbook/detail/spsc_ring.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+SLICK_NAMESPACE_BEGIN
+
+/// Kind of book stored in a checkpoint record
+enum class CheckpointBookKind : uint8_t {
+    L2 = 2,     // Aggregated levels (OrderBookL2)
+    L3 = 3,     // Individual orders (OrderBookL3)
+};
+
+SLICK_NAMESPACE_END
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Books whose state a checkpoint stores as orders
+template<typename Book>
+concept CheckpointableL3 = requires(const Book& book, Book& target, std::span<const SnapshotOrder> orders) {
+    book.getLevelsL3(Side::Buy);
+    { book.orderCount(Side::Buy) } -> std::convertible_to<std::size_t>;
+    target.loadSnapshot(orders, uint64_t{}, Timestamp{});
+};
+
+/// Books whose state a checkpoint stores as levels
+template<typename Book>
+concept CheckpointableL2 = !CheckpointableL3<Book> &&
+    requires(const Book& book, Book& target, std::span<PriceLevelL2> out, std::span<const PriceLevelL2> levels) {
+        { book.getLevels(Side::Buy, out) } -> std::convertible_to<std::size_t>;
+        target.loadSnapshot(levels, levels, uint64_t{}, Timestamp{});
+    };
+
+/// Checkpoint file header
+struct CheckpointFileHeader {
+    static constexpr char kMagic[8] = {'S', 'L', 'K', 'C', 'K', 'P', 'T', '\0'};
+    static constexpr uint32_t kVersion = 1;
+
+    char magic[8];          // kMagic
+    uint32_t version;       // kVersion
+    uint32_t book_count;    // Book records that follow, in ascending symbol order
+    uint32_t order_size;    // sizeof(SnapshotOrder) of the writer
+    uint32_t level_size;    // sizeof(PriceLevelL2) of the writer
+    uint64_t file_size;     // Total bytes (detects truncated files)
+};
+
+/// Header of one book record, followed by its orders (L3) or bid then ask levels (L2)
+struct CheckpointBookHeader {
+    SymbolId symbol;
+    CheckpointBookKind kind;
+    uint8_t reserved[5];
+    uint64_t last_seq_num;  // getLastSeqNum() when captured
+    Timestamp timestamp;    // Top-of-book timestamp when captured
+    uint64_t bid_count;     // Bid orders (L3) or levels (L2)
+    uint64_t ask_count;     // Ask orders (L3) or levels (L2)
+};
+
+static_assert(std::is_trivially_copyable_v<SnapshotOrder> && sizeof(SnapshotOrder) % 8 == 0);
+static_assert(std::is_trivially_copyable_v<PriceLevelL2> && sizeof(PriceLevelL2) % 8 == 0);
+static_assert(sizeof(CheckpointFileHeader) % 8 == 0 && sizeof(CheckpointBookHeader) % 8 == 0);
+
+/// Encoded book record (CheckpointBookHeader followed by its entries)
+using CheckpointBuffer = std::shared_ptr<const std::vector<std::byte>>;
+
+/// Books a CheckpointWriter can track through their observer events
+template<typename Book>
+concept CheckpointTrackable = (CheckpointableL3<Book> || CheckpointableL2<Book>) &&
+    requires(Book& book, std::shared_ptr<IOrderBookObserver> observer) { book.addObserver(observer); };
+
+/// Observer keeping a shadow copy of one book for CheckpointWriter::track()
+///
+/// The book's update thread copies each order update (L3) or level update (L2) into an SPSC ring and
+/// returns. The writer drains the ring into the shadow (orders by id, or levels by price) and encodes
+/// the shadow in book order when it writes a file. If the ring fills up, recording stops and the shadow
+/// stays at the last update that fit, a consistent earlier state, until reset() reseeds it.
+class CheckpointRecorder final : public IOrderBookObserver {
+public:
+    /// Constructor
+    /// @param symbol Book symbol
+    /// @param kind L3 (records order updates) or L2 (records level updates)
+    /// @param capacity Ring capacity in updates
+    CheckpointRecorder(SymbolId symbol, CheckpointBookKind kind, std::size_t capacity)
+        : ring_(capacity), symbol_(symbol), kind_(kind) {}
+
+    [[nodiscard]] SymbolId symbol() const noexcept { return symbol_; }
+
+    /// Check whether recording stopped because the ring was full
+    [[nodiscard]] bool stale() const noexcept { return stale_.load(std::memory_order_acquire); }
+
+    /// Ignore all further updates (the writer is gone or no longer tracks the book)
+    void detach() noexcept { detached_.store(true, std::memory_order_release); }
+
+    void onOrderUpdate(const OrderUpdate& update) override {
+        if (kind_ == CheckpointBookKind::L3) {
+            record(update);
+        }
+    }
+
+    void onPriceLevelUpdate(const PriceLevelUpdate& update) override {
+        if (kind_ == CheckpointBookKind::L2) {
+            record(update);
+        }
+    }
+
+    void onSnapshotBegin(SymbolId /*symbol*/, uint64_t seq_num, Timestamp timestamp) override {
+        record(Reset{seq_num, timestamp});  // The book's contents follow as updates
+    }
+
+    /// Replace the shadow with the current contents of the book and resume recording
+    /// Called on the book's update thread; O(orders) or O(levels)
+    template<typename Book>
+    void reset(const Book& book) {
+        std::lock_guard lock(mutex_);
+        Event discarded;
+        while (ring_.tryPop(discarded)) {
+        }
+        clearShadow(book.getLastSeqNum(), book.getTopOfBook().timestamp);
+        if constexpr (CheckpointableL3<Book>) {
+            for (Side side : {Side::Buy, Side::Sell}) {
+                for (const auto& [price, level] : book.getLevelsL3(side)) {
+                    for (const auto& order : level.orders) {
+                        orders_.insert_or_assign(order.order_id, ShadowOrder{
+                            {order.order_id, side, price, order.quantity, timestampOf(order), order.priority},
+                            ++arrival_});
+                    }
+                }
+            }
+        } else {
+            for (Side side : {Side::Buy, Side::Sell}) {
+                std::vector<PriceLevelL2> levels(book.levelCount(side));
+                book.getLevels(side, std::span(levels));
+                for (const PriceLevelL2& level : levels) {
+                    levels_[side].insert_or_assign(level.price, level);
+                }
+            }
+        }
+        stale_.store(false, std::memory_order_release);
+    }
+
+    /// Apply the queued updates to the shadow (writer side)
+    /// @return true if any update was applied
+    bool drain() {
+        std::lock_guard lock(mutex_);
+        Event event;
+        bool applied = false;
+        while (ring_.tryPop(event)) {
+            std::visit([this](const auto& payload) { apply(payload); }, event.payload);
+            applied = true;
+        }
+        changed_ |= applied;
+        return applied;
+    }
+
+    /// Encode the shadow if it changed since the last encode (writer side)
+    /// @return Encoded record, or nullptr if unchanged
+    [[nodiscard]] CheckpointBuffer encode() {
+        std::lock_guard lock(mutex_);
+        if (!changed_) {
+            return nullptr;
+        }
+        changed_ = false;
+
+        CheckpointBookHeader header{};
+        header.symbol = symbol_;
+        header.kind = kind_;
+        header.last_seq_num = last_seq_num_;
+        header.timestamp = timestamp_;
+        auto buffer = std::make_shared<std::vector<std::byte>>();
+        if (kind_ == CheckpointBookKind::L3) {
+            // Book order: bids then asks, best price first, then queue order
+            std::vector<const ShadowOrder*> sorted;
+            sorted.reserve(orders_.size());
+            for (const auto& [order_id, order] : orders_) {
+                sorted.push_back(&order);
+                (order.order.side == Side::Buy ? header.bid_count : header.ask_count) += 1;
+            }
+            std::sort(sorted.begin(), sorted.end(), [](const ShadowOrder* a, const ShadowOrder* b) {
+                if (a->order.side != b->order.side) {
+                    return a->order.side == Side::Buy;
+                }
+                if (a->order.price != b->order.price) {
+                    return (a->order.price < b->order.price) == (a->order.side == Side::Sell);
+                }
+                return a->order.priority != b->order.priority ? a->order.priority < b->order.priority
+                                                              : a->arrival < b->arrival;
+            });
+            buffer->resize(sizeof(header) + sorted.size() * sizeof(SnapshotOrder));
+            std::byte* out = buffer->data();
+            std::memcpy(out, &header, sizeof(header));
+            out += sizeof(header);
+            for (const ShadowOrder* order : sorted) {
+                std::memcpy(out, &order->order, sizeof(SnapshotOrder));
+                out += sizeof(SnapshotOrder);
+            }
+        } else {
+            header.bid_count = levels_[Side::Buy].size();
+            header.ask_count = levels_[Side::Sell].size();
+            buffer->resize(sizeof(header) + (header.bid_count + header.ask_count) * sizeof(PriceLevelL2));
+            std::byte* out = buffer->data();
+            std::memcpy(out, &header, sizeof(header));
+            out += sizeof(header);
+            auto put = [&out](const PriceLevelL2& level) {
+                std::memcpy(out, &level, sizeof(level));
+                out += sizeof(level);
+            };
+            for (auto it = levels_[Side::Buy].rbegin(); it != levels_[Side::Buy].rend(); ++it) {
+                put(it->second);
+            }
+            for (const auto& [price, level] : levels_[Side::Sell]) {
+                put(level);
+            }
+        }
+        return buffer;
+    }
+
+private:
+    struct Reset {
+        uint64_t seq_num;
+        Timestamp timestamp;
+    };
+
+    struct Event {
+        std::variant<OrderUpdate, PriceLevelUpdate, Reset> payload;
+    };
+
+    struct ShadowOrder {
+        SnapshotOrder order;
+        uint64_t arrival;   // Breaks priority ties in queue order
+    };
+
+    template<typename Payload>
+    void record(const Payload& payload) noexcept {
+        if (detached_.load(std::memory_order_relaxed) || stale_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        if (!ring_.tryPush(Event{payload})) {
+            stale_.store(true, std::memory_order_release);
+        }
+    }
+
+    void clearShadow(uint64_t seq_num, Timestamp timestamp) {
+        orders_.clear();
+        levels_[Side::Buy].clear();
+        levels_[Side::Sell].clear();
+        last_seq_num_ = seq_num;
+        timestamp_ = timestamp;
+        changed_ = true;
+    }
+
+    void note(uint64_t seq_num, Timestamp timestamp) noexcept {
+        if (seq_num > 0) {
+            last_seq_num_ = seq_num;
+        }
+        timestamp_ = timestamp;
+    }
+
+    void apply(const OrderUpdate& update) {
+        note(update.seq_num, update.timestamp);
+        if (update.isDelete()) {
+            orders_.erase(update.order_id);
+            return;
+        }
+        auto [it, inserted] = orders_.try_emplace(update.order_id);
+        SnapshotOrder& order = it->second.order;
+        if (inserted || order.price != update.price || order.priority != update.priority) {
+            it->second.arrival = ++arrival_;  // Joined the back of its (new) place in the queue
+        }
+        order = {update.order_id, update.side, update.price, update.quantity, update.timestamp, update.priority};
+    }
+
+    void apply(const PriceLevelUpdate& update) {
+        note(update.seq_num, update.timestamp);
+        if (update.isDelete()) {
+            levels_[update.side].erase(update.price);
+        } else {
+            levels_[update.side].insert_or_assign(update.price, PriceLevelL2{update.price, update.quantity, update.timestamp});
+        }
+    }
+
+    void apply(const Reset& reset) {
+        clearShadow(reset.seq_num, reset.timestamp);
+    }
+
+    SPSCRing<Event> ring_;                              // Updates from the book's thread
+    SymbolId symbol_;
+    CheckpointBookKind kind_;
+    std::atomic<bool> stale_{false};                    // Ring overflowed; recording stopped
+    std::atomic<bool> detached_{false};
+
+    std::mutex mutex_;                                  // Consumer side: shadow and ring pops
+    std::unordered_map<OrderId, ShadowOrder> orders_;   // L3 shadow
+    std::map<Price, PriceLevelL2> levels_[SideCount];   // L2 shadow (ascending price)
+    uint64_t arrival_ = 0;
+    uint64_t last_seq_num_ = 0;
+    Timestamp timestamp_ = 0;
+    bool changed_ = false;                              // Shadow changed since the last encode
+};
+
+SLICK_DETAIL_NAMESPACE_END
+
+SLICK_NAMESPACE_BEGIN
+
+/// One book of a Checkpoint (views into the checkpoint's memory)
+struct CheckpointBook {
+    SymbolId symbol = 0;
+    CheckpointBookKind kind = CheckpointBookKind::L3;
+    uint64_t last_seq_num = 0;                      // Sequence number to resume the feed from
+    Timestamp timestamp = 0;                        // Top-of-book timestamp when captured
+    std::span<const SnapshotOrder> orders;          // L3: bids then asks, best price first, in queue order
+    std::span<const detail::PriceLevelL2> bids;     // L2: bid levels, best first
+    std::span<const detail::PriceLevelL2> asks;     // L2: ask levels, best first
+};
+
+/// Read-only view of a checkpoint file, for restarting books without replaying the feed
+///
+/// open() maps the file (heap copy on non-Linux platforms) and validates its structure. Orders and levels
+/// are stored in the in-memory layout of SnapshotOrder and PriceLevelL2, so restoring a book passes
+/// spans of the mapping straight to loadSnapshot(); orders are already in book order, which lets
+/// OrderBookL3::loadSnapshot() skip its sort. Files are only portable between builds with the same
+/// byte order and struct layout (checked through the header).
+///
+/// Usage:
+/// @code
+/// Checkpoint checkpoint;
+/// if (checkpoint.open("books.ckpt")) {
+///     checkpoint.restore(manager);   // Every book, then resume each feed after getLastSeqNum()
+/// }
+/// @endcode
+class Checkpoint {
+public:
+    /// Open a checkpoint file
+    /// @param path File written by CheckpointWriter
+    /// @return true if the file exists and is a well-formed checkpoint
+    bool open(const std::string& path) {
+        close();
+        if (!file_.open(path, true) || !index()) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    /// Release the file
+    void close() noexcept {
+        file_.close();
+        books_.clear();
+    }
+
+    /// Check if a checkpoint is open
+    [[nodiscard]] bool isOpen() const noexcept { return file_.isOpen(); }
+
+    /// Get the books in ascending symbol order
+    [[nodiscard]] std::span<const CheckpointBook> books() const noexcept { return books_; }
+
+    /// Find the book of a symbol
+    /// @return Book, or nullptr if the checkpoint has none for symbol
+    [[nodiscard]] const CheckpointBook* find(SymbolId symbol) const noexcept {
+        auto it = std::lower_bound(books_.begin(), books_.end(), symbol,
+                                   [](const CheckpointBook& book, SymbolId s) { return book.symbol < s; });
+        return it != books_.end() && it->symbol == symbol ? &*it : nullptr;
+    }
+
+    /// Load a checkpointed book into a book (replaces its contents, sets its last sequence number)
+    /// @return false if the kinds differ (L2 record into an L3 book or vice versa)
+    template<typename Book>
+        requires detail::CheckpointableL3<Book> || detail::CheckpointableL2<Book>
+    static bool load(const CheckpointBook& record, Book& book) {
+        if constexpr (detail::CheckpointableL3<Book>) {
+            if (record.kind != CheckpointBookKind::L3) {
+                return false;
+            }
+            book.loadSnapshot(record.orders, record.last_seq_num, record.timestamp);
+        } else {
+            if (record.kind != CheckpointBookKind::L2) {
+                return false;
+            }
+            book.loadSnapshot(record.bids, record.asks, record.last_seq_num, record.timestamp);
+        }
+        return true;
+    }
+
+    /// Restore one symbol into a book
+    /// @return false if the checkpoint has no book of that kind for symbol
+    template<typename Book>
+    bool restore(SymbolId symbol, Book& book) const {
+        const CheckpointBook* record = find(symbol);
+        return record != nullptr && load(*record, book);
+    }
+
+    /// Restore every book into a manager, creating books as needed (not thread-safe against feed threads)
+    /// @return Number of books restored (records of the other kind are skipped)
+    template<typename Manager>
+        requires requires(Manager& manager, SymbolId symbol) { manager.getOrCreateOrderBook(symbol); }
+    std::size_t restore(Manager& manager) const {
+        std::size_t restored = 0;
+        for (const CheckpointBook& record : books_) {
+            restored += load(record, *manager.getOrCreateOrderBook(record.symbol)) ? 1 : 0;
+        }
+        return restored;
+    }
+
+private:
+    bool index() {
+        const std::byte* data = file_.data();
+        const std::size_t size = file_.size();
+        detail::CheckpointFileHeader header;
+        if (size < sizeof(header)) {
+            return false;
+        }
+        std::memcpy(&header, data, sizeof(header));
+        if (std::memcmp(header.magic, detail::CheckpointFileHeader::kMagic, sizeof(header.magic)) != 0 ||
+            header.version != detail::CheckpointFileHeader::kVersion ||
+            header.order_size != sizeof(SnapshotOrder) || header.level_size != sizeof(detail::PriceLevelL2) ||
+            header.file_size != size) {
+            return false;
+        }
+
+        books_.reserve(header.book_count);
+        std::size_t offset = sizeof(header);
+        for (uint32_t i = 0; i < header.book_count; ++i) {
+            detail::CheckpointBookHeader book;
+            if (size - offset < sizeof(book)) {
+                return false;
+            }
+            std::memcpy(&book, data + offset, sizeof(book));
+            offset += sizeof(book);
+
+            const std::size_t entry_size = book.kind == CheckpointBookKind::L3 ? sizeof(SnapshotOrder)
+                                                                               : sizeof(detail::PriceLevelL2);
+            if ((book.kind != CheckpointBookKind::L2 && book.kind != CheckpointBookKind::L3) ||
+                book.bid_count > (size - offset) / entry_size ||
+                book.ask_count > (size - offset) / entry_size - book.bid_count ||
+                (!books_.empty() && books_.back().symbol >= book.symbol)) {
+                return false;
+            }
+
+            CheckpointBook record;
+            record.symbol = book.symbol;
+            record.kind = book.kind;
+            record.last_seq_num = book.last_seq_num;
+            record.timestamp = book.timestamp;
+            const std::byte* entries = data + offset;
+            if (book.kind == CheckpointBookKind::L3) {
+                record.orders = {reinterpret_cast<const SnapshotOrder*>(entries), book.bid_count + book.ask_count};
+            } else {
+                const auto* levels = reinterpret_cast<const detail::PriceLevelL2*>(entries);
+                record.bids = {levels, book.bid_count};
+                record.asks = {levels + book.bid_count, book.ask_count};
+            }
+            books_.push_back(record);
+            offset += (book.bid_count + book.ask_count) * entry_size;
+        }
+        return offset == size;
+    }
+
+    detail::MappedFile file_;               // Checkpoint file contents
+    std::vector<CheckpointBook> books_;     // Index of the book records
+};
+
+/// Incremental checkpoint writer
+///
+/// Books get into a checkpoint in one of two ways:
+/// - track(book) registers an observer that copies each order (L3) or level (L2) update into a ring,
+///   O(1) per update on the book's thread. The writer applies the updates to a shadow copy of the book
+///   and encodes the shadow when it writes, so the update thread never walks the book again.
+/// - capture(book) encodes the book on the calling thread (O(orders), no I/O) and swaps the buffer in
+///   under a short lock. Books can be captured at different times, e.g. round-robin.
+///
+/// flush() writes the latest state of every book to `<path>.tmp`, syncs it and renames it over path, so
+/// a crash leaves the previous checkpoint intact; the writer thread started by start() drains the
+/// tracking rings continuously and writes whenever books changed since the last write. Neither path
+/// waits for file I/O.
+///
+/// Each book restores to the state and sequence number of its last capture or recorded update; resume
+/// its feed after getLastSeqNum() once restored (see Checkpoint).
+class CheckpointWriter {
+public:
+    /// Constructor
+    /// @param path Checkpoint file
+    explicit CheckpointWriter(std::string path) : path_(std::move(path)) {}
+
+    /// Destructor - stops the writer thread (without a final write, see stop()) and stops recording
+    ~CheckpointWriter() {
+        stop(false);
+        std::lock_guard lock(mutex_);
+        for (const auto& [symbol, recorder] : recorders_) {
+            recorder->detach();
+        }
+    }
+
+    CheckpointWriter(const CheckpointWriter&) = delete;
+    CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+    /// Get checkpoint file path
+    [[nodiscard]] const std::string& path() const noexcept { return path_; }
+
+    /// Keep a book's checkpoint up to date from its observer events (on the book's update thread)
+    /// Seeds the shadow from the book once (O(orders)); afterwards every update costs one ring push.
+    /// Updates that notify no observer (clear()) need a capture() to resync. Call once per book.
+    /// @param book Book to track (must outlive the writer or be remove()d first)
+    /// @param capacity Ring capacity in updates; if the writer falls this far behind, the book's
+    ///                 checkpoint stays at the last recorded state until the next capture()
+    template<typename Book>
+        requires detail::CheckpointTrackable<Book>
+    void track(Book& book, std::size_t capacity = kDefaultTrackCapacity) {
+        constexpr auto kind = detail::CheckpointableL3<Book> ? CheckpointBookKind::L3 : CheckpointBookKind::L2;
+        auto recorder = std::make_shared<detail::CheckpointRecorder>(book.symbol(), kind, capacity);
+        recorder->reset(book);
+        book.addObserver(recorder);
+        std::lock_guard lock(mutex_);
+        if (auto it = recorders_.find(book.symbol()); it != recorders_.end()) {
+            it->second->detach();
+        }
+        recorders_.insert_or_assign(book.symbol(), std::move(recorder));
+        dirty_ = true;
+    }
+
+    /// Capture the current state of a book (on the book's update thread)
+    /// O(orders). For a tracked book this reseeds its shadow instead, resuming recording if it stopped.
+    template<typename Book>
+        requires detail::CheckpointableL3<Book> || detail::CheckpointableL2<Book>
+    void capture(const Book& book) {
+        if (auto recorder = findRecorder(book.symbol())) {
+            recorder->reset(book);
+            std::lock_guard lock(mutex_);
+            dirty_ = true;
+            return;
+        }
+        BufferPtr buffer = encode(book);
+        std::lock_guard lock(mutex_);
+        books_.insert_or_assign(book.symbol(), std::move(buffer));
+        dirty_ = true;
+    }
+
+    /// Drop a book from later checkpoints (e.g. after OrderBookManager::removeOrderBook())
+    /// A tracked book stops recording; its observer stays registered with the book and ignores updates.
+    void remove(SymbolId symbol) {
+        std::lock_guard lock(mutex_);
+        if (auto it = recorders_.find(symbol); it != recorders_.end()) {
+            it->second->detach();
+            recorders_.erase(it);
+        }
+        dirty_ |= books_.erase(symbol) > 0;
+    }
+
+    /// Check whether a tracked book stopped recording because its ring filled up (see track())
+    [[nodiscard]] bool stale(SymbolId symbol) const {
+        auto recorder = findRecorder(symbol);
+        return recorder && recorder->stale();
+    }
+
+    /// Get number of books captured or tracked
+    [[nodiscard]] std::size_t bookCount() const {
+        std::lock_guard lock(mutex_);
+        std::size_t count = books_.size();
+        for (const auto& [symbol, recorder] : recorders_) {
+            count += books_.contains(symbol) ? 0 : 1;
+        }
+        return count;
+    }
+
+    /// Write the latest captures to the checkpoint file now (any thread)
+    /// @return true if the file was written (or nothing changed since the last write)
+    bool flush() {
+        std::lock_guard io_lock(io_mutex_);
+        for (const auto& recorder : trackedRecorders()) {
+            recorder->drain();
+            if (BufferPtr buffer = recorder->encode()) {
+                std::lock_guard lock(mutex_);
+                books_.insert_or_assign(recorder->symbol(), std::move(buffer));
+                dirty_ = true;
+            }
+        }
+
+        std::vector<BufferPtr> buffers;
+        {
+            std::lock_guard lock(mutex_);
+            if (!dirty_ && written_ > 0) {
+                return true;
+            }
+            buffers.reserve(books_.size());
+            for (const auto& [symbol, buffer] : books_) {
+                buffers.push_back(buffer);
+            }
+            dirty_ = false;
+        }
+        if (!writeFile(buffers)) {
+            std::lock_guard lock(mutex_);
+            dirty_ = true;
+            ++failures_;
+            return false;
+        }
+        ++written_;
+        return true;
+    }
+
+    /// Start the writer thread
+    /// Drains the rings of tracked books every millisecond (or interval, if shorter)
+    /// @param interval Time between checks for new captures
+    void start(std::chrono::milliseconds interval) {
+        stop(false);
+        {
+            std::lock_guard lock(mutex_);
+            stopping_ = false;
+        }
+        thread_ = std::thread([this, interval] {
+            const auto tick = std::min(interval, kDrainInterval);
+            auto next_write = std::chrono::steady_clock::now() + interval;
+            std::unique_lock lock(mutex_);
+            while (!stopping_) {
+                wake_.wait_for(lock, tick, [this] { return stopping_; });
+                if (stopping_) {
+                    break;
+                }
+                lock.unlock();
+                bool changed = false;
+                for (const auto& recorder : trackedRecorders()) {
+                    changed |= recorder->drain();
+                }
+                lock.lock();
+                dirty_ |= changed;
+                if (dirty_ && std::chrono::steady_clock::now() >= next_write) {
+                    lock.unlock();
+                    flush();
+                    lock.lock();
+                    next_write = std::chrono::steady_clock::now() + interval;
+                }
+            }
+        });
+    }
+
+    /// Stop the writer thread
+    /// @param final_flush Write pending captures before returning
+    void stop(bool final_flush = true) {
+        if (thread_.joinable()) {
+            {
+                std::lock_guard lock(mutex_);
+                stopping_ = true;
+            }
+            wake_.notify_all();
+            thread_.join();
+        }
+        if (final_flush) {
+            flush();
+        }
+    }
+
+    /// Get number of checkpoint files written
+    [[nodiscard]] uint64_t writeCount() const noexcept { return written_; }
+
+    /// Get number of failed writes (the previous file is kept)
+    [[nodiscard]] uint64_t failedWrites() const {
+        std::lock_guard lock(mutex_);
+        return failures_;
+    }
+
+    /// Default ring capacity of track()
+    static constexpr std::size_t kDefaultTrackCapacity = std::size_t{1} << 14;
+
+private:
+    using Buffer = std::vector<std::byte>;
+    using BufferPtr = detail::CheckpointBuffer;
+    using RecorderPtr = std::shared_ptr<detail::CheckpointRecorder>;
+
+    static constexpr std::chrono::milliseconds kDrainInterval{1};
+
+    [[nodiscard]] RecorderPtr findRecorder(SymbolId symbol) const {
+        std::lock_guard lock(mutex_);
+        auto it = recorders_.find(symbol);
+        return it != recorders_.end() ? it->second : nullptr;
+    }
+
+    [[nodiscard]] std::vector<RecorderPtr> trackedRecorders() const {
+        std::lock_guard lock(mutex_);
+        std::vector<RecorderPtr> recorders;
+        recorders.reserve(recorders_.size());
+        for (const auto& [symbol, recorder] : recorders_) {
+            recorders.push_back(recorder);
+        }
+        return recorders;
+    }
+
+    template<typename T>
+    static std::byte* put(std::byte* out, const T& value) noexcept {
+        std::memcpy(out, &value, sizeof(T));
+        return out + sizeof(T);
+    }
+
+    template<typename Book>
+    static BufferPtr encode(const Book& book) {
+        detail::CheckpointBookHeader header{};
+        header.symbol = book.symbol();
+        header.last_seq_num = book.getLastSeqNum();
+        header.timestamp = book.getTopOfBook().timestamp;
+
+        auto buffer = std::make_shared<Buffer>();
+        if constexpr (detail::CheckpointableL3<Book>) {
+            header.kind = CheckpointBookKind::L3;
+            header.bid_count = book.orderCount(Side::Buy);
+            header.ask_count = book.orderCount(Side::Sell);
+            buffer->resize(sizeof(header) + (header.bid_count + header.ask_count) * sizeof(SnapshotOrder));
+            std::byte* out = put(buffer->data(), header);
+            for (Side side : {Side::Buy, Side::Sell}) {
+                for (const auto& [price, level] : book.getLevelsL3(side)) {
+                    for (const auto& order : level.orders) {
+                        SnapshotOrder entry{};
+                        entry.order_id = order.order_id;
+                        entry.side = side;
+                        entry.price = price;
+                        entry.quantity = order.quantity;
+                        entry.timestamp = detail::timestampOf(order);
+                        entry.priority = order.priority;
+                        out = put(out, entry);
+                    }
+                }
+            }
+        } else {
+            header.kind = CheckpointBookKind::L2;
+            header.bid_count = book.levelCount(Side::Buy);
+            header.ask_count = book.levelCount(Side::Sell);
+            std::vector<detail::PriceLevelL2> levels(header.bid_count + header.ask_count);
+            book.getLevels(Side::Buy, std::span(levels).first(header.bid_count));
+            book.getLevels(Side::Sell, std::span(levels).subspan(header.bid_count));
+            buffer->resize(sizeof(header) + levels.size() * sizeof(detail::PriceLevelL2));
+            std::byte* out = put(buffer->data(), header);
+            std::memcpy(out, levels.data(), levels.size() * sizeof(detail::PriceLevelL2));
+        }
+        return buffer;
+    }
+
+    bool writeFile(const std::vector<BufferPtr>& buffers) const {
+        detail::CheckpointFileHeader header{};
+        std::memcpy(header.magic, detail::CheckpointFileHeader::kMagic, sizeof(header.magic));
+        header.version = detail::CheckpointFileHeader::kVersion;
+        header.book_count = static_cast<uint32_t>(buffers.size());
+        header.order_size = sizeof(SnapshotOrder);
+        header.level_size = sizeof(detail::PriceLevelL2);
+        header.file_size = sizeof(header);
+        for (const BufferPtr& buffer : buffers) {
+            header.file_size += buffer->size();
+        }
+
+        const std::string tmp_path = path_ + ".tmp";
+        std::FILE* file = std::fopen(tmp_path.c_str(), "wb");
+        if (file == nullptr) {
+            return false;
+        }
+        bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+        for (const BufferPtr& buffer : buffers) {
+            ok = ok && std::fwrite(buffer->data(), 1, buffer->size(), file) == buffer->size();
+        }
+        ok = std::fflush(file) == 0 && ok;
+#if defined(__linux__)
+        ok = ok && ::fsync(::fileno(file)) == 0;
+#endif
+        ok = std::fclose(file) == 0 && ok;
+        if (!ok || std::rename(tmp_path.c_str(), path_.c_str()) != 0) {
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    std::string path_;                                  // Checkpoint file
+    mutable std::mutex mutex_;                          // Protects books_, recorders_, dirty_, stopping_ and failures_
+    std::mutex io_mutex_;                               // Serializes flush()
+    std::condition_variable wake_;                      // Wakes the writer thread to stop
+    detail::FlatMap<SymbolId, BufferPtr> books_;        // Latest capture per symbol (header + entries)
+    detail::FlatMap<SymbolId, RecorderPtr> recorders_;  // Tracked books
+    bool dirty_ = false;                                // Captures since the last write
+    bool stopping_ = false;                             // Writer thread stop request
+    uint64_t failures_ = 0;                             // Failed writes
+    std::atomic<uint64_t> written_{0};                  // Files written
+    std::thread thread_;                                // Background writer
+};
+
+SLICK_NAMESPACE_END
@@ -30,6 +30,35 @@ concept OrderBookObserver = requires(T observer,
     { observer.onTopOfBookUpdate(tob) } -> std::same_as<void>;
 };
 
+/// Per-callback observer concepts, used for static dispatch
+/// An observer type may implement any subset of the callbacks; missing ones compile away
+
+template<typename T>
+concept ObservesPriceLevelUpdates = requires(T& observer, const PriceLevelUpdate& update) {
+    observer.onPriceLevelUpdate(update);
+};
+
+template<typename T>
+concept ObservesOrderUpdates = requires(T& observer, const OrderUpdate& update) {
+    observer.onOrderUpdate(update);
+};
+
+template<typename T>
+concept ObservesTrades = requires(T& observer, const Trade& trade) {
+    observer.onTrade(trade);
+};
+
+template<typename T>
+concept ObservesTopOfBook = requires(T& observer, const TopOfBook& tob) {
+    observer.onTopOfBookUpdate(tob);
+};
+
+template<typename T>
+concept ObservesSnapshots = requires(T& observer, SymbolId symbol, uint64_t seq_num, Timestamp timestamp) {
+    observer.onSnapshotBegin(symbol, seq_num, timestamp);
+    observer.onSnapshotEnd(symbol, seq_num, timestamp);
+};
+
 /// Concept for price-like types
 template<typename T>
 concept PriceLike = std::is_arithmetic_v<T> && std::totally_ordered<T>;
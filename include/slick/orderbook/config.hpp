@@ -71,6 +71,13 @@
     #define SLICK_UNLIKELY(x) (x)
 #endif
 
+// Read prefetch hint (no-op where unsupported)
+#if defined(__GNUC__) || defined(__clang__)
+    #define SLICK_PREFETCH(addr) __builtin_prefetch((addr), 0, 3)
+#else
+    #define SLICK_PREFETCH(addr) ((void)(addr))
+#endif
+
 // Cache line size (platform-specific)
 #if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
     #define SLICK_CACHE_LINE_SIZE 64
@@ -98,6 +105,28 @@
     #define SLICK_NO_INLINE
 #endif
 
+// SIMD instruction sets used by price searches (define SLICK_ORDERBOOK_NO_SIMD for scalar code only)
+#if !defined(SLICK_ORDERBOOK_NO_SIMD) && defined(__AVX512F__)
+    #define SLICK_SIMD_AVX512 1
+#else
+    #define SLICK_SIMD_AVX512 0
+#endif
+#if !defined(SLICK_ORDERBOOK_NO_SIMD) && defined(__AVX2__)
+    #define SLICK_SIMD_AVX2 1
+#else
+    #define SLICK_SIMD_AVX2 0
+#endif
+#if !defined(SLICK_ORDERBOOK_NO_SIMD) && defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    #define SLICK_SIMD_NEON 1
+#else
+    #define SLICK_SIMD_NEON 0
+#endif
+
+// Hot-path latency histograms and counters (see metrics.hpp); 0 compiles every hook out
+#ifndef SLICK_ORDERBOOK_METRICS
+    #define SLICK_ORDERBOOK_METRICS 0
+#endif
+
 // Alignment macros
 #define SLICK_ALIGNAS(n) alignas(n)
 #define SLICK_CACHE_ALIGNED SLICK_ALIGNAS(SLICK_CACHE_LINE_SIZE)
@@ -0,0 +1,404 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/events.hpp>
+#include <slick/orderbook/observer.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+SLICK_NAMESPACE_BEGIN
+
+/// Venue identifier in a ConsolidatedBook (0 .. maxVenues() - 1)
+using VenueId = uint8_t;
+
+/// Merged price level of a ConsolidatedBook
+struct ConsolidatedLevel {
+    Price price = 0;            // Price level
+    Quantity quantity = 0;      // Total quantity across venues
+    uint32_t venues = 0;        // Bitset of venues quoting this price (bit v = VenueId v)
+};
+
+/// Merged top-of-book of a ConsolidatedBook (see ConsolidatedBook::getTopOfBook())
+struct ConsolidatedTopOfBook {
+    TopOfBook top;              // Best bid/ask across venues and their total quantity
+    uint32_t bid_venues = 0;    // Bitset of venues quoting the best bid
+    uint32_t ask_venues = 0;    // Bitset of venues quoting the best ask
+};
+
+/// Venue-merged price ladder of one instrument traded on several venues
+///
+/// attach() subscribes to an OrderBookL2 or OrderBookL3 per venue (level, top-of-book and snapshot
+/// events) and seeds the merge from the book's current levels. Each PriceLevelUpdate then adjusts one
+/// merged level: a binary search for the price finds the level and its row of per-venue quantities, and
+/// the merged quantity moves by the difference from the venue's previous quantity. Nothing is rebuilt
+/// per event. A venue snapshot replaces only that venue's quantities, re-read from its book at
+/// onSnapshotEnd() (L3 snapshots report orders, not levels).
+///
+/// The merged top-of-book is published under a sequence lock, like OrderBookL2::getTopOfBook(), at the
+/// end of each venue batch (the venue's onTopOfBookUpdate() or a LastInBatch level update) if it changed.
+/// Quotes of different venues may cross; the merge keeps them (TopOfBook::isCrossed()).
+///
+/// Threading: all attached books must be updated from one thread, which owns the consolidated book.
+/// getTopOfBook() is safe to call from other threads; other queries are writer-thread only.
+/// Attached books must outlive their attachment (detach() or destroy the consolidated book first).
+/// L3 books only report levels within their interested_num_levels; construct them with 0 (all levels)
+/// for a complete merged ladder.
+///
+/// Usage:
+/// @code
+/// OrderBookManager<OrderBookL2> venue_a, venue_b;
+/// ConsolidatedBook consolidated(symbol_id);
+/// consolidated.attach(0, *venue_a.getOrCreateOrderBook(symbol_id));
+/// consolidated.attach(1, *venue_b.getOrCreateOrderBook(symbol_id));
+/// auto tob = consolidated.getTopOfBook();   // Any thread
+/// @endcode
+class ConsolidatedBook {
+public:
+    static constexpr std::size_t kMaxVenues = 32;   // Width of the venue bitsets
+
+    /// Constructor
+    /// @param symbol Symbol identifier reported in the merged top-of-book
+    /// @param max_venues Venue ids accepted (clamped to kMaxVenues); sizes each level's venue row
+    /// @param initial_level_capacity Initial capacity for merged levels per side
+    explicit ConsolidatedBook(SymbolId symbol, std::size_t max_venues = 8, std::size_t initial_level_capacity = 256)
+        : symbol_(symbol),
+          max_venues_(std::clamp<std::size_t>(max_venues, 1, kMaxVenues)) {
+        for (SideLadder& ladder : sides_) {
+            ladder.levels.reserve(initial_level_capacity);
+            ladder.rows.reserve(initial_level_capacity);
+        }
+        venue_quantities_.reserve(2 * initial_level_capacity * max_venues_);
+        cached_.top.symbol = symbol_;
+    }
+
+    ~ConsolidatedBook() {
+        for (std::size_t venue = 0; venue < kMaxVenues; ++venue) {
+            if (feeds_[venue]) {
+                feeds_[venue]->unsubscribe(feeds_[venue]);
+            }
+        }
+    }
+
+    // The attached books hold observers pointing at this object
+    ConsolidatedBook(const ConsolidatedBook&) = delete;
+    ConsolidatedBook& operator=(const ConsolidatedBook&) = delete;
+
+    /// Subscribe to a venue's book and merge its current levels
+    /// @param venue Venue id (< maxVenues())
+    /// @param book OrderBookL2 or OrderBookL3 of the venue
+    /// @return false if the venue id is out of range or already attached
+    template<typename Book>
+    bool attach(VenueId venue, Book& book) {
+        if (venue >= max_venues_ || feeds_[venue]) {
+            return false;
+        }
+        auto feed = std::make_shared<BookFeed<Book>>(*this, venue, book);
+        book.addObserver(feed, PriceLevelEvents | TopOfBookEvents | SnapshotEvents);
+        feeds_[venue] = feed;
+        feed->reload(cached_.top.timestamp);
+        return true;
+    }
+
+    /// Unsubscribe from a venue's book and remove its quantities from the merge
+    /// @return false if the venue is not attached
+    bool detach(VenueId venue) {
+        if (venue >= max_venues_ || !feeds_[venue]) {
+            return false;
+        }
+        feeds_[venue]->unsubscribe(feeds_[venue]);
+        feeds_[venue].reset();
+        clearVenue(venue, cached_.top.timestamp);
+        return true;
+    }
+
+    /// Check if a venue's book is attached
+    [[nodiscard]] bool isAttached(VenueId venue) const noexcept {
+        return venue < max_venues_ && feeds_[venue] != nullptr;
+    }
+
+    /// Set one venue's quantity at a price (what attached books feed in)
+    /// Also usable directly for venues without a book; do not mix with an attached venue.
+    /// @param venue Venue id (< maxVenues())
+    /// @param side Buy or Sell
+    /// @param price Price level
+    /// @param quantity Venue's total quantity at the price (0 = venue left the level)
+    /// @param timestamp Update timestamp
+    /// @param is_last_in_batch Publish the merged top-of-book if it changed
+    void updateLevel(VenueId venue, Side side, Price price, Quantity quantity, Timestamp timestamp,
+                     bool is_last_in_batch = true) {
+        SLICK_ASSERT(venue < max_venues_ && side < SideCount);
+        SideLadder& ladder = sides_[side];
+        const std::size_t index = lowerBound(side, price);
+        const uint32_t bit = 1u << venue;
+        if (index < ladder.levels.size() && ladder.levels[index].price == price) {
+            ConsolidatedLevel& level = ladder.levels[index];
+            Quantity& own = rowQuantity(ladder.rows[index], venue);
+            level.quantity += quantity - own;
+            own = quantity;
+            if (quantity > 0) {
+                level.venues |= bit;
+            } else if ((level.venues &= ~bit) == 0) {
+                free_rows_.push_back(ladder.rows[index]);
+                ladder.levels.erase(ladder.levels.begin() + static_cast<std::ptrdiff_t>(index));
+                ladder.rows.erase(ladder.rows.begin() + static_cast<std::ptrdiff_t>(index));
+            }
+        } else if (quantity > 0) {
+            const uint32_t row = acquireRow();
+            rowQuantity(row, venue) = quantity;
+            ladder.levels.insert(ladder.levels.begin() + static_cast<std::ptrdiff_t>(index),
+                                 ConsolidatedLevel{price, quantity, bit});
+            ladder.rows.insert(ladder.rows.begin() + static_cast<std::ptrdiff_t>(index), row);
+        }
+        if (is_last_in_batch) {
+            publishTopOfBook(timestamp);
+        }
+    }
+
+    /// Remove all of a venue's quantities from the merge
+    /// @param venue Venue id (< maxVenues())
+    /// @param timestamp Timestamp of the published top-of-book if it changed
+    void clearVenue(VenueId venue, Timestamp timestamp) {
+        SLICK_ASSERT(venue < max_venues_);
+        const uint32_t bit = 1u << venue;
+        for (SideLadder& ladder : sides_) {
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < ladder.levels.size(); ++i) {
+                ConsolidatedLevel level = ladder.levels[i];
+                const uint32_t row = ladder.rows[i];
+                if (level.venues & bit) {
+                    Quantity& own = rowQuantity(row, venue);
+                    level.quantity -= own;
+                    own = 0;
+                    level.venues &= ~bit;
+                    if (level.venues == 0) {
+                        free_rows_.push_back(row);
+                        continue;
+                    }
+                }
+                ladder.levels[kept] = level;
+                ladder.rows[kept] = row;
+                ++kept;
+            }
+            ladder.levels.resize(kept);
+            ladder.rows.resize(kept);
+        }
+        publishTopOfBook(timestamp);
+    }
+
+    /// Get merged top-of-book (thread-safe read)
+    [[nodiscard]] ConsolidatedTopOfBook getTopOfBook() const noexcept {
+        ConsolidatedTopOfBook tob;
+        uint64_t seq1, seq2;
+        do {
+            seq1 = tob_seq_.load(std::memory_order_acquire);
+            // If seq1 is odd, writer is in progress, spin
+            while (seq1 & 1) {
+                seq1 = tob_seq_.load(std::memory_order_acquire);
+            }
+            tob = cached_;
+            // Reads complete before re-checking the sequence
+            std::atomic_thread_fence(std::memory_order_acquire);
+            seq2 = tob_seq_.load(std::memory_order_relaxed);
+        } while (seq1 != seq2);
+        return tob;
+    }
+
+    /// Get best merged level of a side (writer thread)
+    /// @return Pointer to the level, or nullptr if the side is empty
+    [[nodiscard]] const ConsolidatedLevel* best(Side side) const noexcept {
+        const auto& levels = sides_[side].levels;
+        return levels.empty() ? nullptr : &levels.front();
+    }
+
+    /// View merged levels of a side, best first (writer thread; invalidated by the next update)
+    [[nodiscard]] std::span<const ConsolidatedLevel> levels(Side side) const noexcept {
+        return sides_[side].levels;
+    }
+
+    /// Get merged levels of a side, best first (writer thread)
+    /// @param depth Maximum number of levels (0 = all)
+    [[nodiscard]] std::vector<ConsolidatedLevel> getLevels(Side side, std::size_t depth = 0) const {
+        const auto& levels = sides_[side].levels;
+        const std::size_t count = depth == 0 ? levels.size() : std::min(depth, levels.size());
+        return {levels.begin(), levels.begin() + static_cast<std::ptrdiff_t>(count)};
+    }
+
+    /// Get number of merged levels on a side
+    [[nodiscard]] std::size_t levelCount(Side side) const noexcept {
+        return sides_[side].levels.size();
+    }
+
+    /// Get one venue's quantity at a price (writer thread)
+    [[nodiscard]] Quantity venueQuantity(VenueId venue, Side side, Price price) const noexcept {
+        if (venue >= max_venues_) {
+            return 0;
+        }
+        const SideLadder& ladder = sides_[side];
+        const std::size_t index = lowerBound(side, price);
+        if (index == ladder.levels.size() || ladder.levels[index].price != price) {
+            return 0;
+        }
+        return venue_quantities_[ladder.rows[index] * max_venues_ + venue];
+    }
+
+    /// Get symbol identifier
+    [[nodiscard]] SymbolId symbol() const noexcept { return symbol_; }
+
+    /// Get number of venue ids accepted
+    [[nodiscard]] std::size_t maxVenues() const noexcept { return max_venues_; }
+
+private:
+    /// Observer registered with a venue's book
+    class VenueFeed : public IOrderBookObserver {
+    public:
+        VenueFeed(ConsolidatedBook& owner, VenueId venue) : owner_(owner), venue_(venue) {}
+
+        /// Replace the venue's quantities with the book's current levels
+        virtual void reload(Timestamp timestamp) = 0;
+
+        /// Remove this observer from the book
+        virtual void unsubscribe(const std::shared_ptr<VenueFeed>& self) = 0;
+
+        void onPriceLevelUpdate(const PriceLevelUpdate& update) override {
+            if (!in_snapshot_) {
+                owner_.updateLevel(venue_, update.side, update.price, update.quantity, update.timestamp,
+                                   (update.change_flags & LastInBatch) != 0);
+            }
+        }
+
+        void onTopOfBookUpdate(const TopOfBook& tob) override {
+            owner_.publishTopOfBook(tob.timestamp);
+        }
+
+        void onSnapshotBegin(SymbolId, uint64_t, Timestamp) override {
+            in_snapshot_ = true;
+        }
+
+        void onSnapshotEnd(SymbolId, uint64_t, Timestamp timestamp) override {
+            in_snapshot_ = false;
+            reload(timestamp);
+        }
+
+    protected:
+        ConsolidatedBook& owner_;
+        VenueId venue_;
+        bool in_snapshot_ = false;      // Level updates between snapshot markers are re-read at the end
+    };
+
+    template<typename Book>
+    class BookFeed final : public VenueFeed {
+    public:
+        BookFeed(ConsolidatedBook& owner, VenueId venue, Book& book) : VenueFeed(owner, venue), book_(book) {}
+
+        void reload(Timestamp timestamp) override {
+            this->owner_.clearVenue(this->venue_, timestamp);
+            for (Side side : {Side::Buy, Side::Sell}) {
+                const auto levels = [this, side] {
+                    if constexpr (requires(Book& b) { b.getLevelsL2(Side::Buy); }) {
+                        return book_.getLevelsL2(side);
+                    } else {
+                        return book_.getLevels(side);
+                    }
+                }();
+                for (const auto& level : levels) {
+                    this->owner_.updateLevel(this->venue_, side, level.price, level.quantity, timestamp, false);
+                }
+            }
+            this->owner_.publishTopOfBook(timestamp);
+        }
+
+        void unsubscribe(const std::shared_ptr<VenueFeed>& self) override {
+            book_.removeObserver(self);
+        }
+
+    private:
+        Book& book_;
+    };
+
+    struct SideLadder {
+        std::vector<ConsolidatedLevel> levels;  // Best first
+        std::vector<uint32_t> rows;             // Venue quantity row of each level
+    };
+
+    /// Index of the first level of side at or behind price
+    [[nodiscard]] std::size_t lowerBound(Side side, Price price) const noexcept {
+        const auto& levels = sides_[side].levels;
+        auto it = side == Side::Buy
+            ? std::lower_bound(levels.begin(), levels.end(), price,
+                               [](const ConsolidatedLevel& level, Price p) { return level.price > p; })
+            : std::lower_bound(levels.begin(), levels.end(), price,
+                               [](const ConsolidatedLevel& level, Price p) { return level.price < p; });
+        return static_cast<std::size_t>(it - levels.begin());
+    }
+
+    [[nodiscard]] Quantity& rowQuantity(uint32_t row, VenueId venue) noexcept {
+        return venue_quantities_[row * max_venues_ + venue];
+    }
+
+    /// Take a zeroed venue quantity row
+    uint32_t acquireRow() {
+        if (!free_rows_.empty()) {
+            const uint32_t row = free_rows_.back();
+            free_rows_.pop_back();
+            return row;
+        }
+        const auto row = static_cast<uint32_t>(venue_quantities_.size() / max_venues_);
+        venue_quantities_.resize(venue_quantities_.size() + max_venues_, 0);
+        return row;
+    }
+
+    /// Publish the merged top-of-book if it changed (odd = writing, even = readable)
+    void publishTopOfBook(Timestamp timestamp) noexcept {
+        const ConsolidatedLevel empty;
+        const ConsolidatedLevel* bid = best(Side::Buy);
+        const ConsolidatedLevel* ask = best(Side::Sell);
+        bid = bid ? bid : &empty;
+        ask = ask ? ask : &empty;
+
+        uint8_t bid_change_flags = 0;
+        uint8_t ask_change_flags = 0;
+        bid_change_flags += cached_.top.best_bid != bid->price ? ChangeFlag::PriceChanged : 0;
+        bid_change_flags += cached_.top.bid_quantity != bid->quantity || cached_.bid_venues != bid->venues
+            ? ChangeFlag::QuantityChanged : 0;
+        ask_change_flags += cached_.top.best_ask != ask->price ? ChangeFlag::PriceChanged : 0;
+        ask_change_flags += cached_.top.ask_quantity != ask->quantity || cached_.ask_venues != ask->venues
+            ? ChangeFlag::QuantityChanged : 0;
+        if (!bid_change_flags && !ask_change_flags) {
+            return;
+        }
+
+        const uint64_t seq = tob_seq_.load(std::memory_order_relaxed);
+        tob_seq_.store(seq + 1, std::memory_order_relaxed);     // Mark as writing (odd)
+        std::atomic_thread_fence(std::memory_order_release);    // Odd sequence is visible before the writes
+        cached_.top.best_bid = bid->price;
+        cached_.top.bid_quantity = bid->quantity;
+        cached_.top.best_ask = ask->price;
+        cached_.top.ask_quantity = ask->quantity;
+        cached_.top.timestamp = timestamp;
+        cached_.top.change_flags = {bid_change_flags, ask_change_flags};
+        cached_.bid_venues = bid->venues;
+        cached_.ask_venues = ask->venues;
+        tob_seq_.store(seq + 2, std::memory_order_release);     // Mark as readable (even)
+    }
+
+    SymbolId symbol_;
+    std::size_t max_venues_;
+    std::array<SideLadder, SideCount> sides_;
+    std::vector<Quantity> venue_quantities_;                    // max_venues_ quantities per row
+    std::vector<uint32_t> free_rows_;                           // Zeroed rows of removed levels
+    std::array<std::shared_ptr<VenueFeed>, kMaxVenues> feeds_;  // Attached books by venue
+    ConsolidatedTopOfBook cached_;                              // Published top-of-book
+    SLICK_CACHE_ALIGNED std::atomic<uint64_t> tob_seq_{0};      // Sequence lock for cached_ (odd = writing, even = readable)
+};
+
+SLICK_NAMESPACE_END
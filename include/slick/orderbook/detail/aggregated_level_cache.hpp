@@ -0,0 +1,66 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/detail/price_level_l2.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <vector>
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Aggregated L2 copy of one side of an L3 book, refreshed lazily from the first changed level
+///
+/// The book reports every level change with invalidateFrom(level index); entries before the lowest
+/// reported index are still exact, so view() re-aggregates only from there down to the requested
+/// depth. Reads between updates return the cached levels without touching the L3 book.
+class AggregatedLevelCache {
+public:
+    /// Mark levels from index on as stale
+    void invalidateFrom(std::size_t index) noexcept { valid_ = std::min(valid_, index); }
+
+    /// Mark every level as stale
+    void invalidate() noexcept { valid_ = 0; }
+
+    /// Deepest view requested so far (0 = none, SIZE_MAX = all levels)
+    /// Level changes above this depth must be reported with an exact index.
+    [[nodiscard]] std::size_t depth() const noexcept { return depth_; }
+
+    /// Get bytes held by the cached levels
+    [[nodiscard]] std::size_t memoryUsage() const noexcept { return levels_.capacity() * sizeof(PriceLevelL2); }
+
+    /// Get the best levels of a side, re-aggregating only the stale ones
+    /// @param level_map Side's level container (best first)
+    /// @param depth Maximum number of levels (0 = all)
+    /// @param aggregate Converts a (price, level) entry to a PriceLevelL2
+    /// @return Cached levels, valid until the next invalidation
+    template<typename LevelMap, typename Aggregate>
+    [[nodiscard]] std::span<const PriceLevelL2> view(const LevelMap& level_map, std::size_t depth,
+                                                     Aggregate&& aggregate) {
+        depth_ = std::max(depth_, depth == 0 ? std::numeric_limits<std::size_t>::max() : depth);
+        const std::size_t count = depth == 0 ? level_map.size() : std::min(depth, level_map.size());
+        if (valid_ < count) {
+            if (levels_.size() < count) {
+                levels_.resize(count);
+            }
+            auto it = std::next(level_map.begin(), static_cast<std::ptrdiff_t>(valid_));
+            for (std::size_t i = valid_; i < count; ++i, ++it) {
+                levels_[i] = aggregate(*it);
+            }
+            valid_ = count;
+        }
+        return {levels_.data(), count};
+    }
+
+private:
+    std::vector<PriceLevelL2> levels_;      // Aggregated levels, best first; [0, valid_) are current
+    std::size_t valid_ = 0;                 // Number of leading entries still matching the book
+    std::size_t depth_ = 0;                 // Deepest view requested
+};
+
+SLICK_DETAIL_NAMESPACE_END
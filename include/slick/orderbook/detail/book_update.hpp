@@ -0,0 +1,60 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Books updated by price level (BasicOrderBookL2)
+template<typename BookT>
+concept LevelUpdatableBook = requires(BookT& book) {
+    book.updateLevel(Side::Buy, Price{}, Quantity{}, Timestamp{}, uint64_t{}, bool{});
+};
+
+/// Books updated by order (BasicOrderBookL3)
+template<typename BookT>
+concept OrderUpdatableBook = requires(BookT& book) {
+    { book.addOrder(OrderId{}, Side::Buy, Price{}, Quantity{}, Timestamp{}, uint64_t{}, uint64_t{}, bool{}) } -> std::same_as<bool>;
+};
+
+/// Message type accepted by an engine over BookT
+template<typename BookT>
+using EngineUpdateT = std::conditional_t<LevelUpdatableBook<BookT>, L2Update, L3Update>;
+
+/// Apply one decoded message to a book
+/// @return false if the book rejected the message
+template<typename BookT>
+bool applyUpdate(BookT& book, const EngineUpdateT<BookT>& update, bool is_last_in_batch) {
+    if constexpr (LevelUpdatableBook<BookT>) {
+        // updateLevel() drops out-of-order updates silently; detect them here to count rejections
+        if (update.seq_num != 0 && update.seq_num < book.getLastSeqNum()) {
+            return false;
+        }
+        book.updateLevel(update.side, update.price, update.quantity, update.timestamp,
+                         update.seq_num, is_last_in_batch);
+        return true;
+    } else {
+        switch (update.type) {
+            case L3UpdateType::Add:
+                return book.addOrder(update.order_id, update.side, update.price, update.quantity,
+                                     update.timestamp, update.priority, update.seq_num, is_last_in_batch);
+            case L3UpdateType::Modify:
+                return book.modifyOrder(update.order_id, update.price, update.quantity,
+                                        update.timestamp, update.priority, update.seq_num, is_last_in_batch);
+            case L3UpdateType::Delete:
+                return book.deleteOrder(update.order_id, update.timestamp, update.seq_num, is_last_in_batch);
+            case L3UpdateType::Execute:
+                return book.executeOrder(update.order_id, update.quantity, update.timestamp,
+                                         update.seq_num, is_last_in_batch);
+        }
+        return false;
+    }
+}
+
+SLICK_DETAIL_NAMESPACE_END
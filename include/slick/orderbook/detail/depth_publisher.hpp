@@ -0,0 +1,161 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/detail/price_level_l2.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+SLICK_NAMESPACE_BEGIN
+
+/// Reader-side copy of a book's published top-N depth (see setPublishedDepth())
+/// Lives on the reader's stack: filling it never allocates
+/// @tparam N Maximum levels per side copied out
+template<std::size_t N>
+struct DepthSnapshot {
+    std::array<detail::PriceLevelL2, N> bids;   // Best bid first
+    std::array<detail::PriceLevelL2, N> asks;   // Best ask first
+    std::size_t bid_count = 0;                  // Valid entries in bids
+    std::size_t ask_count = 0;                  // Valid entries in asks
+    Timestamp timestamp = 0;                    // Timestamp of the update that published this depth
+    uint64_t seq_num = 0;                       // Book's last processed sequence number at publication
+    uint64_t version = 0;                       // Number of publications so far (0 = nothing published yet)
+};
+
+SLICK_NAMESPACE_END
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Fixed-capacity top-N depth block published under a sequence lock
+///
+/// Single writer (the book's update thread), any number of readers on other threads. The writer
+/// copies the best N levels of each side into a preallocated, cache-aligned block between two
+/// sequence bumps (odd = writing, even = readable); readers copy the block out and retry if the
+/// sequence moved, same protocol as the L2 top-of-book cache.
+class DepthPublisher {
+public:
+    /// Constructor
+    /// @param depth Levels per side to publish (0 = disabled, nothing allocated)
+    explicit DepthPublisher(std::size_t depth = 0)
+        : depth_(depth),
+          levels_(depth > 0 ? allocate(2 * depth) : nullptr) {}
+
+    DepthPublisher(const DepthPublisher&) = delete;
+    DepthPublisher& operator=(const DepthPublisher&) = delete;
+
+    // Movable for the owning book; not safe while readers are active
+    DepthPublisher(DepthPublisher&& other) noexcept
+        : seq_(other.seq_.load(std::memory_order_relaxed)),
+          depth_(std::exchange(other.depth_, 0)),
+          bid_count_(other.bid_count_),
+          ask_count_(other.ask_count_),
+          timestamp_(other.timestamp_),
+          seq_num_(other.seq_num_),
+          levels_(std::move(other.levels_)) {}
+
+    DepthPublisher& operator=(DepthPublisher&& other) noexcept {
+        if (this != &other) {
+            seq_.store(other.seq_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            depth_ = std::exchange(other.depth_, 0);
+            bid_count_ = other.bid_count_;
+            ask_count_ = other.ask_count_;
+            timestamp_ = other.timestamp_;
+            seq_num_ = other.seq_num_;
+            levels_ = std::move(other.levels_);
+        }
+        return *this;
+    }
+
+    /// Get number of levels published per side (0 = disabled)
+    [[nodiscard]] std::size_t depth() const noexcept { return depth_; }
+
+    /// Publish the best depth() levels of each side (writer only)
+    /// @param bids Bid levels, best first
+    /// @param asks Ask levels, best first
+    /// @param to_level Converts a container element to a PriceLevelL2
+    /// @param timestamp Update timestamp
+    /// @param seq_num Book's last processed sequence number
+    template<typename Bids, typename Asks, typename ToLevel>
+    void publish(const Bids& bids, const Asks& asks, ToLevel&& to_level, Timestamp timestamp, uint64_t seq_num) noexcept {
+        const uint64_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);      // Mark as writing (odd)
+        std::atomic_thread_fence(std::memory_order_release);  // Odd sequence is visible before any block write
+
+        bid_count_ = copyLevels(bids, levels_.get(), to_level);
+        ask_count_ = copyLevels(asks, levels_.get() + depth_, to_level);
+        timestamp_ = timestamp;
+        seq_num_ = seq_num;
+
+        seq_.store(seq + 2, std::memory_order_release);      // Mark as readable (even)
+    }
+
+    /// Copy the published depth out (any thread)
+    /// Copies min(N, depth()) levels per side. Spins while a publication is in progress.
+    /// @param out Receives the levels
+    template<std::size_t N>
+    void read(DepthSnapshot<N>& out) const noexcept {
+        const std::size_t capacity = std::min(N, depth_);
+        uint64_t seq1, seq2;
+        do {
+            seq1 = seq_.load(std::memory_order_acquire);
+            // If seq1 is odd, writer is in progress, spin
+            while (seq1 & 1) {
+                seq1 = seq_.load(std::memory_order_acquire);
+            }
+            // Counts may be torn mid-write; clamping keeps the copy in bounds until the retry
+            out.bid_count = std::min(bid_count_, capacity);
+            out.ask_count = std::min(ask_count_, capacity);
+            std::copy_n(levels_.get(), out.bid_count, out.bids.begin());
+            std::copy_n(levels_.get() + depth_, out.ask_count, out.asks.begin());
+            out.timestamp = timestamp_;
+            out.seq_num = seq_num_;
+            // Block reads complete before re-checking the sequence
+            std::atomic_thread_fence(std::memory_order_acquire);
+            seq2 = seq_.load(std::memory_order_relaxed);
+        } while (seq1 != seq2);
+        out.version = seq1 / 2;
+    }
+
+private:
+    struct AlignedDelete {
+        void operator()(PriceLevelL2* levels) const noexcept {
+            ::operator delete(levels, std::align_val_t{SLICK_CACHE_LINE_SIZE});
+        }
+    };
+    using LevelBlock = std::unique_ptr<PriceLevelL2[], AlignedDelete>;
+
+    static LevelBlock allocate(std::size_t count) {
+        void* memory = ::operator new(count * sizeof(PriceLevelL2), std::align_val_t{SLICK_CACHE_LINE_SIZE});
+        auto* levels = static_cast<PriceLevelL2*>(memory);
+        std::uninitialized_default_construct_n(levels, count);
+        return LevelBlock(levels);
+    }
+
+    template<typename Levels, typename ToLevel>
+    std::size_t copyLevels(const Levels& levels, PriceLevelL2* out, ToLevel& to_level) const noexcept {
+        std::size_t count = 0;
+        for (auto it = levels.begin(); it != levels.end() && count < depth_; ++it) {
+            out[count++] = to_level(*it);
+        }
+        return count;
+    }
+
+    SLICK_CACHE_ALIGNED std::atomic<uint64_t> seq_{0};  // Sequence lock (odd = writing, even = readable)
+    std::size_t depth_;                                 // Levels per side in the block
+    std::size_t bid_count_ = 0;                         // Published bid levels
+    std::size_t ask_count_ = 0;                         // Published ask levels
+    Timestamp timestamp_ = 0;                           // Timestamp of the last publication
+    uint64_t seq_num_ = 0;                              // Sequence number of the last publication
+    LevelBlock levels_;                                 // depth_ bids followed by depth_ asks (cache-aligned)
+};
+
+SLICK_DETAIL_NAMESPACE_END
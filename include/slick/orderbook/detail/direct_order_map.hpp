@@ -0,0 +1,201 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/detail/order.hpp>
+#include <slick/orderbook/detail/order_map.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <vector>
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Direct-indexed OrderId -> Order* map for feeds with dense, roughly monotonic order ids
+///
+/// Orders whose id falls in the sliding window [base, base + WindowSize) are stored in a
+/// ring-indexed array at slot (order_id & (WindowSize - 1)), so lookup is a single array load.
+/// Ids outside the window (late or far-ahead outliers) fall back to an open-addressing hash map.
+///
+/// The window slides forward when a new id lands at most one window past its end; resting
+/// orders that drop off the back are migrated to the fallback map. Larger jumps are treated
+/// as outliers unless the window is empty, in which case it re-centers on the new id.
+///
+/// WindowSize should cover the id span between the oldest resting order and the newest
+/// (e.g. 65536 slots = 512 KB per book). Same interface as OrderMap minus iteration.
+///
+/// @tparam WindowSize Number of ring slots (power of two)
+/// @tparam Hash Hash functor for the fallback map
+/// @tparam OrderT Order layout (Order or CompactOrder)
+template<std::size_t WindowSize = 65536, typename Hash = OrderIdHash, typename OrderT = Order>
+class DirectOrderMap {
+    static_assert(std::has_single_bit(WindowSize), "WindowSize must be a power of two");
+
+public:
+    /// Constructor
+    /// @param initial_capacity Expected number of resident orders; sizes the fallback map
+    explicit DirectOrderMap(std::size_t initial_capacity = 1024)
+        : window_(WindowSize, nullptr),
+          fallback_(std::max<std::size_t>(initial_capacity / 8, 64)) {}
+
+    /// Insert order into map
+    /// @param order Pointer to order (must not be null)
+    /// @return true if insertion succeeded, false if OrderId already exists
+    bool insert(OrderT* order) {
+        SLICK_ASSERT(order != nullptr);
+        const OrderId order_id = order->order_id;
+
+        if (SLICK_UNLIKELY(!inWindow(order_id)) && !tryAdvance(order_id)) {
+            return fallback_.insert(order);
+        }
+
+        OrderT*& slot = window_[order_id & kMask];
+        if (slot != nullptr || (!fallback_.empty() && fallback_.contains(order_id))) {
+            return false;
+        }
+        slot = order;
+        ++window_size_;
+        return true;
+    }
+
+    /// Remove order from map
+    /// @param order_id OrderId to remove
+    /// @return true if order was found and removed
+    bool erase(OrderId order_id) noexcept {
+        if (SLICK_LIKELY(inWindow(order_id))) {
+            OrderT*& slot = window_[order_id & kMask];
+            if (slot != nullptr) {
+                slot = nullptr;
+                --window_size_;
+                return true;
+            }
+        }
+        return !fallback_.empty() && fallback_.erase(order_id);
+    }
+
+    /// Find order by OrderId
+    /// @param order_id OrderId to find
+    /// @return Pointer to order, or nullptr if not found
+    [[nodiscard]] OrderT* find(OrderId order_id) noexcept {
+        if (SLICK_LIKELY(inWindow(order_id))) {
+            if (OrderT* order = window_[order_id & kMask]) {
+                return order;
+            }
+        }
+        return fallback_.empty() ? nullptr : fallback_.find(order_id);
+    }
+
+    [[nodiscard]] const OrderT* find(OrderId order_id) const noexcept {
+        return const_cast<DirectOrderMap*>(this)->find(order_id);
+    }
+
+    /// Prefetch the window slot of an OrderId, ahead of its find(), insert() or erase()
+    void prefetch(OrderId order_id) const noexcept {
+        SLICK_PREFETCH(window_.data() + (order_id & kMask));
+    }
+
+    /// Check if order exists
+    [[nodiscard]] bool contains(OrderId order_id) const noexcept {
+        return find(order_id) != nullptr;
+    }
+
+    /// Get number of orders in map
+    [[nodiscard]] std::size_t size() const noexcept {
+        return window_size_ + fallback_.size();
+    }
+
+    /// Check if map is empty
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /// Get number of orders currently stored in the fallback hash map
+    [[nodiscard]] std::size_t fallbackSize() const noexcept {
+        return fallback_.size();
+    }
+
+    /// Get lowest order id covered by the window
+    [[nodiscard]] OrderId windowBase() const noexcept {
+        return base_;
+    }
+
+    /// Get number of ring slots
+    [[nodiscard]] static constexpr std::size_t windowSize() noexcept {
+        return WindowSize;
+    }
+
+    /// Reserve capacity for out-of-window orders
+    void reserve(std::size_t capacity) {
+        fallback_.reserve(capacity);
+    }
+
+    /// Shrink the fallback table to max(fallbackSize(), keep_capacity) out-of-window orders (the window is fixed)
+    /// @param keep_capacity Out-of-window capacity to keep
+    void trim(std::size_t keep_capacity = 0) {
+        fallback_.trim(keep_capacity);
+    }
+
+    /// Shrink the fallback table to the orders it holds
+    void shrink_to_fit() {
+        fallback_.shrink_to_fit();
+    }
+
+    /// Get bytes held by the window and the fallback table
+    [[nodiscard]] std::size_t memoryUsage() const noexcept {
+        return window_.capacity() * sizeof(OrderT*) + fallback_.memoryUsage();
+    }
+
+    /// Clear all orders (window re-centers on the next insert)
+    void clear() noexcept {
+        std::fill(window_.begin(), window_.end(), nullptr);
+        fallback_.clear();
+        window_size_ = 0;
+        initialized_ = false;
+    }
+
+private:
+    static constexpr std::size_t kMask = WindowSize - 1;
+
+    [[nodiscard]] bool inWindow(OrderId order_id) const noexcept {
+        // Unsigned wrap makes ids below base_ compare as out of window
+        return initialized_ && (order_id - base_) < WindowSize;
+    }
+
+    /// Move the window so it covers order_id, if that is cheap enough
+    /// @return true if order_id is now inside the window
+    bool tryAdvance(OrderId order_id) {
+        if (!initialized_ || window_size_ == 0) {
+            // Nothing resident in the window: re-center on this id
+            base_ = order_id;
+            initialized_ = true;
+            return true;
+        }
+        if (order_id < base_ || order_id - base_ >= 2 * WindowSize) {
+            return false;  // Late id or far-ahead outlier
+        }
+
+        // Slide so order_id becomes the newest slot; evict orders that fall off the back
+        const OrderId new_base = order_id - WindowSize + 1;
+        for (OrderId id = base_; id != new_base && window_size_ > 0; ++id) {
+            OrderT*& slot = window_[id & kMask];
+            if (slot != nullptr) {
+                fallback_.insert(slot);
+                slot = nullptr;
+                --window_size_;
+            }
+        }
+        base_ = new_base;
+        return true;
+    }
+
+    std::vector<OrderT*> window_;         // Ring of WindowSize slots, nullptr = empty
+    BasicOrderMap<Hash, OrderT> fallback_; // Orders outside the window
+    OrderId base_ = 0;                    // Lowest id covered by the window
+    std::size_t window_size_ = 0;         // Number of orders stored in window_
+    bool initialized_ = false;            // Window has been positioned
+};
+
+SLICK_DETAIL_NAMESPACE_END
@@ -0,0 +1,142 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Bounded single-producer / single-consumer ring of variable-length byte frames
+///
+/// Frames are stored contiguously as an 8-byte record header (length, flags) followed by the payload
+/// padded to 8 bytes, so the consumer reads each frame in place. A frame that does not fit before the
+/// end of the buffer is preceded by a wrap record covering the remainder. Head and tail are monotonic
+/// byte counters on separate cache lines, as in SPSCRing.
+class FrameRing {
+public:
+    /// Constructor
+    /// @param capacity_bytes Minimum buffer size (rounded up to a power of two, at least 64 bytes)
+    explicit FrameRing(std::size_t capacity_bytes)
+        : capacity_(std::bit_ceil(std::max<std::size_t>(capacity_bytes, 64))),
+          mask_(capacity_ - 1),
+          buffer_(std::make_unique<uint64_t[]>(capacity_ / sizeof(uint64_t))) {}
+
+    // Non-copyable, non-movable (shared between threads)
+    FrameRing(const FrameRing&) = delete;
+    FrameRing& operator=(const FrameRing&) = delete;
+
+    /// Largest frame tryPush() accepts
+    [[nodiscard]] std::size_t maxFrameSize() const noexcept { return capacity_ / 2 - kHeaderSize; }
+
+    /// Copy a frame in (producer only)
+    /// @return false if the ring has no room for it now, or the frame is larger than maxFrameSize()
+    bool tryPush(std::span<const std::byte> frame) noexcept {
+        if (SLICK_UNLIKELY(frame.size() > maxFrameSize())) {
+            return false;
+        }
+        const std::size_t need = recordSize(frame.size());
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        const std::size_t contiguous = capacity_ - (head & mask_);
+        const std::size_t total = need + (contiguous < need ? contiguous : 0);
+        if (SLICK_UNLIKELY(head + total - cached_tail_ > capacity_)) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head + total - cached_tail_ > capacity_) {
+                return false;
+            }
+        }
+        if (contiguous < need) {
+            writeHeader(head, static_cast<uint32_t>(contiguous - kHeaderSize), kWrap);
+            head += contiguous;
+        }
+        writeHeader(head, static_cast<uint32_t>(frame.size()), 0);
+        if (!frame.empty()) {
+            std::memcpy(bytes() + (head & mask_) + kHeaderSize, frame.data(), frame.size());
+        }
+        head_.store(head + need, std::memory_order_release);
+        return true;
+    }
+
+    /// Get the oldest frame without removing it (consumer only)
+    /// The span stays valid until popFront().
+    /// @param out Receives the frame
+    /// @return false if the ring is empty
+    bool front(std::span<const std::byte>& out) noexcept {
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+        while (true) {
+            if (tail == head_.load(std::memory_order_acquire)) {
+                return false;
+            }
+            uint32_t length;
+            uint32_t flags;
+            readHeader(tail, length, flags);
+            if (flags & kWrap) {
+                tail += kHeaderSize + length;
+                tail_.store(tail, std::memory_order_release);
+                continue;
+            }
+            out = {bytes() + (tail & mask_) + kHeaderSize, length};
+            front_size_ = recordSize(length);
+            return true;
+        }
+    }
+
+    /// Remove the frame returned by the last front() (consumer only)
+    void popFront() noexcept {
+        tail_.store(tail_.load(std::memory_order_relaxed) + front_size_, std::memory_order_release);
+        front_size_ = 0;
+    }
+
+    /// Get number of bytes in use, headers and padding included (approximate while both sides are active)
+    [[nodiscard]] std::size_t size() const noexcept {
+        const uint64_t tail = tail_.load(std::memory_order_acquire);
+        const uint64_t head = head_.load(std::memory_order_acquire);
+        return head > tail ? static_cast<std::size_t>(head - tail) : 0;
+    }
+
+    /// Check if ring is empty
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /// Get buffer size in bytes
+    [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+private:
+    static constexpr std::size_t kHeaderSize = 8;
+    static constexpr uint32_t kWrap = 1;        // Record pads the buffer up to its end
+
+    [[nodiscard]] static constexpr std::size_t recordSize(std::size_t length) noexcept {
+        return kHeaderSize + ((length + 7) & ~std::size_t{7});
+    }
+
+    [[nodiscard]] std::byte* bytes() const noexcept { return reinterpret_cast<std::byte*>(buffer_.get()); }
+
+    void writeHeader(uint64_t position, uint32_t length, uint32_t flags) noexcept {
+        std::byte* header = bytes() + (position & mask_);
+        std::memcpy(header, &length, sizeof(length));
+        std::memcpy(header + sizeof(length), &flags, sizeof(flags));
+    }
+
+    void readHeader(uint64_t position, uint32_t& length, uint32_t& flags) const noexcept {
+        const std::byte* header = bytes() + (position & mask_);
+        std::memcpy(&length, header, sizeof(length));
+        std::memcpy(&flags, header + sizeof(length), sizeof(flags));
+    }
+
+    SLICK_CACHE_ALIGNED std::atomic<uint64_t> head_{0};    // Next byte to write (producer)
+    uint64_t cached_tail_ = 0;                              // Producer's last seen tail
+    SLICK_CACHE_ALIGNED std::atomic<uint64_t> tail_{0};    // Next byte to read (consumer)
+    std::size_t front_size_ = 0;                            // Record size of the frame returned by front()
+    SLICK_CACHE_ALIGNED const std::size_t capacity_;       // Buffer size (power of two)
+    const std::size_t mask_;                                // capacity_ - 1
+    std::unique_ptr<uint64_t[]> buffer_;                    // 8-byte aligned storage
+};
+
+SLICK_DETAIL_NAMESPACE_END
@@ -9,136 +9,294 @@
 
 SLICK_NAMESPACE_BEGIN
 
-SLICK_OB_INLINE OrderBookL2::OrderBookL2(SymbolId symbol, std::size_t initial_capacity)
+template<typename Traits>
+SLICK_OB_INLINE BasicOrderBookL2<Traits>::BasicOrderBookL2(SymbolId symbol, std::size_t initial_capacity)
     : symbol_(symbol),
+      bids_(initial_capacity),
+      asks_(initial_capacity),
       tob_seq_(0),
       last_seq_num_(0) {
-    // Initialize level containers
-    // Note: Clang-17 with GCC-14 libstdc++ has issues with aggregate initialization in member init list
-    sides_[Side::Buy] = detail::LevelContainer{Side::Buy, initial_capacity};
-    sides_[Side::Sell] = detail::LevelContainer{Side::Sell, initial_capacity};
+    // Initialize cached top-of-book
+    cached_tob_.symbol = symbol_;
+    metrics_.bind(observers_);
+}
 
+template<typename Traits>
+SLICK_OB_INLINE BasicOrderBookL2<Traits>::BasicOrderBookL2(SymbolId symbol, const PriceLadderConfig& ladder_config)
+    requires std::constructible_from<LevelContainer<Side::Buy>, const PriceLadderConfig&>
+    : symbol_(symbol),
+      bids_(ladder_config),
+      asks_(ladder_config),
+      tob_seq_(0),
+      last_seq_num_(0) {
     // Initialize cached top-of-book
     cached_tob_.symbol = symbol_;
+    metrics_.bind(observers_);
 }
 
 // Move constructor - manually implement due to std::atomic member
-SLICK_OB_INLINE OrderBookL2::OrderBookL2(OrderBookL2&& other) noexcept
+template<typename Traits>
+SLICK_OB_INLINE BasicOrderBookL2<Traits>::BasicOrderBookL2(BasicOrderBookL2&& other) noexcept
     : symbol_(other.symbol_),
-      sides_(std::move(other.sides_)),
+      bids_(std::move(other.bids_)),
+      asks_(std::move(other.asks_)),
       observers_(std::move(other.observers_)),
       cached_tob_(other.cached_tob_),
       cached_best_bid_(other.cached_best_bid_),
       cached_best_ask_(other.cached_best_ask_),
       tob_seq_(other.tob_seq_.load(std::memory_order_relaxed)),
-      last_seq_num_(other.last_seq_num_) {
+      depth_publisher_(std::move(other.depth_publisher_)),
+      analytics_(std::move(other.analytics_)),
+      last_seq_num_(other.last_seq_num_),
+      metrics_(std::move(other.metrics_)) {
 }
 
 // Move assignment - manually implement due to std::atomic member
-SLICK_OB_INLINE OrderBookL2& OrderBookL2::operator=(OrderBookL2&& other) noexcept {
+template<typename Traits>
+SLICK_OB_INLINE BasicOrderBookL2<Traits>& BasicOrderBookL2<Traits>::operator=(BasicOrderBookL2&& other) noexcept {
     if (this != &other) {
         symbol_ = other.symbol_;
-        sides_ = std::move(other.sides_);
+        bids_ = std::move(other.bids_);
+        asks_ = std::move(other.asks_);
         observers_ = std::move(other.observers_);
         cached_tob_ = other.cached_tob_;
         cached_best_bid_ = other.cached_best_bid_;
         cached_best_ask_ = other.cached_best_ask_;
         tob_seq_.store(other.tob_seq_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        depth_publisher_ = std::move(other.depth_publisher_);
+        analytics_ = std::move(other.analytics_);
         last_seq_num_ = other.last_seq_num_;
+        metrics_ = std::move(other.metrics_);
     }
     return *this;
 }
 
-SLICK_OB_INLINE void OrderBookL2::updateLevel(Side side, Price price, Quantity quantity, Timestamp timestamp,
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL2<Traits>::updateLevel(Side side, Price price, Quantity quantity, Timestamp timestamp,
                                                uint64_t seq_num, bool is_last_in_batch) {
     SLICK_ASSERT(side < SideCount);
+    [[maybe_unused]] const auto timer = metrics_.time(BookOperation::UpdateLevel);
 
     // Validate sequence number - reject out-of-order (seq_num < last_seq_num)
     if (seq_num > 0) {
         if (seq_num < last_seq_num_) {
             // Out of order - reject silently
+            metrics_.count(BookCounter::RejectedSeqNum);
             return;
         }
         last_seq_num_ = seq_num;
     }
 
-    if (quantity == 0) {
-        // Find level index before deletion
-        auto it = sides_[side].find(price);
-        if (it != sides_[side].end()) {
-            uint16_t level_idx = static_cast<uint16_t>(std::distance(sides_[side].begin(), it));
+    visitLevels(side, [&](auto& levels) {
+        if (quantity == 0) {
+            // Find level index before deletion
+            auto it = levels.find(price);
+            if (it != levels.end()) {
+                uint16_t level_idx = levelIndexOf(levels, it);
+
+                // track starting index
+                change_starting_index_ = std::min<uint16_t>(change_starting_index_, level_idx);
+                changed_sides_ |= static_cast<uint8_t>(1 << side);
+
+                // Delete the level
+                levels.erase(it);
+                metrics_.count(BookCounter::LevelErased);
+
+                // Deletion: both price and quantity changed
+                uint8_t change_flags = PriceChanged | QuantityChanged;
+                if (is_last_in_batch) {
+                    change_flags |= LastInBatch;
+                }
+
+                // Notify with level_index, flags, and seq_num
+                if (observers_.wantsPriceLevelUpdates()) {
+                    PriceLevelUpdate update{timestamp, symbol_, side, price, 0, 0, level_idx, change_flags, seq_num};
+                    observers_.notifyPriceLevelUpdate(update);
+                }
+            }
+            // Close the batch even if this delete was a no-op, earlier updates may still be pending
+            if (is_last_in_batch) {
+                endBatch(timestamp);
+            }
+        } else {
+            if (SLICK_UNLIKELY(!accepts(levels, price, quantity))) {
+                if (is_last_in_batch) {
+                    endBatch(timestamp);
+                }
+                return;
+            }
+
+            // Insert or update level
+            auto [it, inserted] = levels.insertOrUpdate(price, quantity, timestamp);
+            if (inserted) {
+                metrics_.count(BookCounter::LevelInserted);
+            }
+
+            // Calculate level index
+            uint16_t level_idx = levelIndexOf(levels, it);
 
             // track starting index
             change_starting_index_ = std::min<uint16_t>(change_starting_index_, level_idx);
+            changed_sides_ |= static_cast<uint8_t>(1 << side);
+
+            // Determine change flags based on what actually changed
+            uint8_t change_flags = 0;
+            if (inserted) {
+                // New level: both price and quantity changed
+                change_flags = PriceChanged | QuantityChanged;
+            } else {
+                // Existing level: only quantity changed
+                change_flags = QuantityChanged;
+            }
 
-            // Delete the level
-            sides_[side].erase(it);
-
-            // Deletion: both price and quantity changed
-            uint8_t change_flags = PriceChanged | QuantityChanged;
+            // Add LastInBatch flag if this is the last update
             if (is_last_in_batch) {
                 change_flags |= LastInBatch;
             }
 
-            // Notify with level_index, flags, and seq_num
-            PriceLevelUpdate update{timestamp, symbol_, side, price, 0, 0, level_idx, change_flags, seq_num};
-            observers_.notifyPriceLevelUpdate(update);
-            if (change_starting_index_ == 0 && is_last_in_batch) {
-                notifyTopOfBookIfChanged(timestamp);
-                change_starting_index_ = INVALID_INDEX;
+            // Notify observers
+            if (observers_.wantsPriceLevelUpdates()) {
+                PriceLevelUpdate update{timestamp, symbol_, side, price, quantity, 0, level_idx, change_flags, seq_num};
+                observers_.notifyPriceLevelUpdate(update);
+            }
+            if (is_last_in_batch) {
+                endBatch(timestamp);
             }
         }
-    } else {
-        // Insert or update level
-        auto [it, inserted] = sides_[side].insertOrUpdate(price, quantity, timestamp);
+    });
+}
 
-        // Calculate level index
-        uint16_t level_idx = static_cast<uint16_t>(std::distance(sides_[side].begin(), it));
+template<typename Traits>
+SLICK_OB_INLINE std::size_t BasicOrderBookL2<Traits>::applyBatch(std::span<const L2Update> updates) {
+    if (updates.empty()) {
+        return 0;
+    }
+    [[maybe_unused]] const auto timer = metrics_.time(BookOperation::ApplyBatch);
+
+    // Validate the batch's sequence numbers once: sequenced updates must not go back, neither behind
+    // last_seq_num nor within the batch - otherwise the whole batch is rejected
+    uint64_t seq_num = last_seq_num_;
+    for (const L2Update& update : updates) {
+        if (update.seq_num > 0) {
+            if (update.seq_num < seq_num) {
+                // Out of order - reject silently
+                metrics_.count(BookCounter::RejectedSeqNum);
+                return 0;
+            }
+            seq_num = update.seq_num;
+        }
+    }
+    last_seq_num_ = seq_num;
 
-        // track starting index
-        change_starting_index_ = std::min<uint16_t>(change_starting_index_, level_idx);
+    const bool notify_levels = observers_.wantsPriceLevelUpdates();
+    if (notify_levels) {
+        level_batch_.begin(updates.size());
+    }
 
-        // Determine change flags based on what actually changed
-        uint8_t change_flags = 0;
-        if (inserted) {
-            // New level: both price and quantity changed
-            change_flags = PriceChanged | QuantityChanged;
-        } else {
-            // Existing level: only quantity changed
-            change_flags = QuantityChanged;
-        }
+    std::size_t applied = 0;
+    for (const L2Update& update : updates) {
+        visitLevels(update.side, [&](auto& levels) {
+            if (update.quantity == 0) {
+                ++applied;
+                auto it = levels.find(update.price);
+                if (it == levels.end()) {
+                    return;
+                }
+                change_starting_index_ = std::min<uint16_t>(change_starting_index_, levelIndexOf(levels, it));
+                changed_sides_ |= static_cast<uint8_t>(1 << update.side);
+                levels.erase(it);
+                metrics_.count(BookCounter::LevelErased);
+                if (notify_levels) {
+                    level_batch_.record(update.side, update.price, true, update.timestamp, update.seq_num);
+                }
+            } else {
+                if (SLICK_UNLIKELY(!accepts(levels, update.price, update.quantity))) {
+                    return;
+                }
+                ++applied;
+                auto [it, inserted] = levels.insertOrUpdate(update.price, update.quantity, update.timestamp);
+                if (inserted) {
+                    metrics_.count(BookCounter::LevelInserted);
+                }
+                change_starting_index_ = std::min<uint16_t>(change_starting_index_, levelIndexOf(levels, it));
+                changed_sides_ |= static_cast<uint8_t>(1 << update.side);
+                if (notify_levels) {
+                    level_batch_.record(update.side, update.price, !inserted, update.timestamp, update.seq_num);
+                }
+            }
+        });
+    }
 
-        // Add LastInBatch flag if this is the last update
-        if (is_last_in_batch) {
-            change_flags |= LastInBatch;
-        }
+    if (notify_levels) {
+        flushLevelBatch();
+    }
+    endBatch(updates.back().timestamp);
+    return applied;
+}
 
-        // Notify observers
-        PriceLevelUpdate update{timestamp, symbol_, side, price, quantity, 0, level_idx, change_flags, seq_num};
-        observers_.notifyPriceLevelUpdate(update);
-        if (change_starting_index_ == 0 && is_last_in_batch) {
-            notifyTopOfBookIfChanged(timestamp);
-            change_starting_index_ = INVALID_INDEX;
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL2<Traits>::flushLevelBatch() {
+    // Hold back one update so the last one reported can carry LastInBatch
+    PriceLevelUpdate pending;
+    bool has_pending = false;
+    level_batch_.flush([&](const detail::LevelBatch::Touch& touch) {
+        PriceLevelUpdate update = visitLevels(touch.side, [&](const auto& levels) {
+            auto it = levels.find(touch.price);
+            if (it != levels.end()) {
+                const uint8_t change_flags = touch.existed_before ? QuantityChanged : (PriceChanged | QuantityChanged);
+                return PriceLevelUpdate{touch.timestamp, symbol_, touch.side, touch.price, it->quantity, 0,
+                                        levelIndexOf(levels, it), change_flags, touch.seq_num};
+            }
+            // Removed: report the position the level would occupy
+            const std::size_t limit = levelIndexLimit();
+            const std::size_t index = levels.lowerBoundIndex(touch.price);
+            return PriceLevelUpdate{touch.timestamp, symbol_, touch.side, touch.price, 0, 0,
+                                    index < limit ? static_cast<uint16_t>(index) : INVALID_INDEX,
+                                    static_cast<uint8_t>(PriceChanged | QuantityChanged), touch.seq_num};
+        });
+        if (update.quantity == 0 && !touch.existed_before) {
+            return;  // Added and removed within the batch
         }
+        if (has_pending) {
+            observers_.notifyPriceLevelUpdate(pending);
+        }
+        pending = update;
+        has_pending = true;
+    });
+    if (has_pending) {
+        pending.change_flags |= LastInBatch;
+        observers_.notifyPriceLevelUpdate(pending);
     }
 }
 
-SLICK_OB_INLINE bool OrderBookL2::deleteLevel(Side side, Price price) noexcept {
-    SLICK_ASSERT(side < SideCount);
-    return sides_[side].erase(price);
+template<typename Traits>
+SLICK_OB_INLINE bool BasicOrderBookL2<Traits>::deleteLevel(Side side, Price price) noexcept {
+    const bool erased = visitLevels(side, [price](auto& levels) { return levels.erase(price); });
+    if (erased) {
+        metrics_.count(BookCounter::LevelErased);
+    }
+    return erased;
 }
 
-SLICK_OB_INLINE void OrderBookL2::clearSide(Side side) noexcept {
-    SLICK_ASSERT(side < SideCount);
-    sides_[side].clear();
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL2<Traits>::clearSide(Side side) noexcept {
+    visitLevels(side, [](auto& levels) { levels.clear(); });
+    if (analytics_.depth() > 0) {
+        updateAnalytics(0, kAllSides);
+    }
 }
 
-SLICK_OB_INLINE void OrderBookL2::clear() noexcept {
-    sides_[Side::Buy].clear();
-    sides_[Side::Sell].clear();
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL2<Traits>::clear() noexcept {
+    bids_.clear();
+    asks_.clear();
+    if (analytics_.depth() > 0) {
+        updateAnalytics(0, kAllSides);
+    }
 }
 
-SLICK_OB_INLINE const detail::PriceLevelL2* OrderBookL2::getBestBid() const noexcept {
+template<typename Traits>
+SLICK_OB_INLINE const typename BasicOrderBookL2<Traits>::Level* BasicOrderBookL2<Traits>::getBestBid() const noexcept {
     // Use sequence lock to read cached best bid atomically
     // This is thread-safe for concurrent reads while a writer is updating
     uint64_t seq1, seq2;
@@ -160,7 +318,8 @@ SLICK_OB_INLINE const detail::PriceLevelL2* OrderBookL2::getBestBid() const noex
     return &cached_best_bid_;
 }
 
-SLICK_OB_INLINE const detail::PriceLevelL2* OrderBookL2::getBestAsk() const noexcept {
+template<typename Traits>
+SLICK_OB_INLINE const typename BasicOrderBookL2<Traits>::Level* BasicOrderBookL2<Traits>::getBestAsk() const noexcept {
     // Use sequence lock to read cached best ask atomically
     // This is thread-safe for concurrent reads while a writer is updating
     uint64_t seq1, seq2;
@@ -182,7 +341,8 @@ SLICK_OB_INLINE const detail::PriceLevelL2* OrderBookL2::getBestAsk() const noex
     return &cached_best_ask_;
 }
 
-SLICK_OB_INLINE TopOfBook OrderBookL2::getTopOfBook() const noexcept {
+template<typename Traits>
+SLICK_OB_INLINE TopOfBook BasicOrderBookL2<Traits>::getTopOfBook() const noexcept {
     // Use sequence lock to read cached top-of-book atomically
     TopOfBook tob;
     uint64_t seq1, seq2;
@@ -200,43 +360,52 @@ SLICK_OB_INLINE TopOfBook OrderBookL2::getTopOfBook() const noexcept {
     return tob;
 }
 
-SLICK_OB_INLINE std::vector<detail::PriceLevelL2> OrderBookL2::getLevels(Side side, std::size_t depth) const {
-    SLICK_ASSERT(side < SideCount);
-    return sides_[side].getLevels(depth);
+template<typename Traits>
+SLICK_OB_INLINE std::vector<typename BasicOrderBookL2<Traits>::Level> BasicOrderBookL2<Traits>::getLevels(Side side, std::size_t depth) const {
+    return visitLevels(side, [depth](const auto& levels) { return levels.getLevels(depth); });
 }
 
-SLICK_OB_INLINE const detail::PriceLevelL2* OrderBookL2::getLevel(Side side, Price price) const noexcept {
-    SLICK_ASSERT(side < SideCount);
-    return sides_[side].getLevel(price);
+template<typename Traits>
+SLICK_OB_INLINE std::size_t BasicOrderBookL2<Traits>::getLevels(Side side, std::span<Level> out) const noexcept {
+    return visitLevels(side, [out](const auto& levels) {
+        std::size_t count = 0;
+        for (auto it = levels.begin(); it != levels.end() && count < out.size(); ++it) {
+            out[count++] = *it;
+        }
+        return count;
+    });
 }
 
-SLICK_OB_INLINE const detail::PriceLevelL2* OrderBookL2::getLevelByIndex(Side side, uint16_t index) const noexcept {
-    SLICK_ASSERT(side < SideCount);
-    const auto& container = sides_[side];
-    if (index >= container.size()) {
-        return nullptr;
-    }
-    return &container[index];
+template<typename Traits>
+SLICK_OB_INLINE const typename BasicOrderBookL2<Traits>::Level* BasicOrderBookL2<Traits>::getLevel(Side side, Price price) const noexcept {
+    return visitLevels(side, [price](const auto& levels) { return levels.getLevel(price); });
 }
 
-SLICK_OB_INLINE std::size_t OrderBookL2::levelCount(Side side) const noexcept {
-    SLICK_ASSERT(side < SideCount);
-    return sides_[side].size();
+template<typename Traits>
+SLICK_OB_INLINE const typename BasicOrderBookL2<Traits>::Level* BasicOrderBookL2<Traits>::getLevelByIndex(Side side, uint16_t index) const noexcept {
+    return visitLevels(side, [index](const auto& levels) { return levels.atIndex(index); });
 }
 
-SLICK_OB_INLINE bool OrderBookL2::isEmpty(Side side) const noexcept {
-    SLICK_ASSERT(side < SideCount);
-    return sides_[side].empty();
+template<typename Traits>
+SLICK_OB_INLINE std::size_t BasicOrderBookL2<Traits>::levelCount(Side side) const noexcept {
+    return visitLevels(side, [](const auto& levels) { return levels.size(); });
+}
+
+template<typename Traits>
+SLICK_OB_INLINE bool BasicOrderBookL2<Traits>::isEmpty(Side side) const noexcept {
+    return visitLevels(side, [](const auto& levels) { return levels.empty(); });
 }
 
-SLICK_OB_INLINE bool OrderBookL2::isEmpty() const noexcept {
-    return sides_[Side::Buy].empty() && sides_[Side::Sell].empty();
+template<typename Traits>
+SLICK_OB_INLINE bool BasicOrderBookL2<Traits>::isEmpty() const noexcept {
+    return bids_.empty() && asks_.empty();
 }
 
-SLICK_OB_INLINE void OrderBookL2::notifyTopOfBookIfChanged(Timestamp timestamp) {
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL2<Traits>::notifyTopOfBookIfChanged(Timestamp timestamp) {
     // Compute current top-of-book (direct access, writer-side only)
-    const auto* bid = sides_[Side::Buy].best();
-    const auto* ask = sides_[Side::Sell].best();
+    const auto* bid = bids_.best();
+    const auto* ask = asks_.best();
 
     Price new_best_bid = bid ? bid->price : 0;
     Quantity new_bid_qty = bid ? bid->quantity : 0;
@@ -269,12 +438,12 @@ SLICK_OB_INLINE void OrderBookL2::notifyTopOfBookIfChanged(Timestamp timestamp)
         if (bid) {
             cached_best_bid_ = *bid;
         } else {
-            cached_best_bid_ = detail::PriceLevelL2{};  // Clear
+            cached_best_bid_ = Level{};  // Clear
         }
         if (ask) {
             cached_best_ask_ = *ask;
         } else {
-            cached_best_ask_ = detail::PriceLevelL2{};  // Clear
+            cached_best_ask_ = Level{};  // Clear
         }
 
         tob_seq_.store(seq + 2, std::memory_order_release);  // Mark as readable (even)
@@ -284,13 +453,59 @@ SLICK_OB_INLINE void OrderBookL2::notifyTopOfBookIfChanged(Timestamp timestamp)
     }
 }
 
-SLICK_OB_INLINE void OrderBookL2::emitSnapshot(Timestamp timestamp) {
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL2<Traits>::endBatch(Timestamp timestamp) {
+    if (change_starting_index_ < depth_publisher_.depth()) {
+        publishDepth(timestamp);
+    }
+    if (change_starting_index_ < analytics_.depth()) {
+        updateAnalytics(change_starting_index_, changed_sides_);
+    }
+    if (change_starting_index_ == 0) {
+        notifyTopOfBookIfChanged(timestamp);
+    }
+    change_starting_index_ = INVALID_INDEX;
+    changed_sides_ = 0;
+}
+
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL2<Traits>::publishDepth(Timestamp timestamp) noexcept {
+    depth_publisher_.publish(bids_, asks_, [](const Level& level) { return detail::widenLevel(level); },
+                             timestamp, last_seq_num_);
+}
+
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL2<Traits>::updateAnalytics(std::size_t from_level, uint8_t sides) noexcept {
+    if (sides & (1 << Side::Buy)) {
+        analytics_.update(Side::Buy, bids_, [](const Level& level) { return detail::widenLevel(level); }, from_level);
+    }
+    if (sides & (1 << Side::Sell)) {
+        analytics_.update(Side::Sell, asks_, [](const Level& level) { return detail::widenLevel(level); }, from_level);
+    }
+}
+
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL2<Traits>::setAnalyticsDepth(std::size_t depth) {
+    analytics_ = BookAnalytics(std::min<std::size_t>(depth, INVALID_INDEX));
+    updateAnalytics(0, kAllSides);
+}
+
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL2<Traits>::setPublishedDepth(std::size_t depth) {
+    depth_publisher_ = detail::DepthPublisher(std::min<std::size_t>(depth, INVALID_INDEX));
+    if (depth > 0) {
+        publishDepth(cached_tob_.timestamp);
+    }
+}
+
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL2<Traits>::emitSnapshot(Timestamp timestamp) {
     // Notify snapshot begin
     observers_.notifySnapshotBegin(symbol_, last_seq_num_, timestamp);
 
     // Emit all bid levels
     uint16_t level_idx = 0;
-    for (const auto& level : sides_[Side::Buy]) {
+    for (const auto& level : bids_) {
         PriceLevelUpdate update{
             timestamp,
             symbol_,
@@ -306,7 +521,7 @@ SLICK_OB_INLINE void OrderBookL2::emitSnapshot(Timestamp timestamp) {
 
     // Emit all ask levels
     level_idx = 0;
-    for (const auto& level : sides_[Side::Sell]) {
+    for (const auto& level : asks_) {
         PriceLevelUpdate update{
             timestamp,
             symbol_,
@@ -324,4 +539,51 @@ SLICK_OB_INLINE void OrderBookL2::emitSnapshot(Timestamp timestamp) {
     observers_.notifySnapshotEnd(symbol_, last_seq_num_, timestamp);
 }
 
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL2<Traits>::loadSnapshot(std::span<const detail::PriceLevelL2> bids,
+                                                           std::span<const detail::PriceLevelL2> asks,
+                                                           uint64_t seq_num, Timestamp timestamp) {
+    loadLevels<Side::Buy>(bids_, bids);
+    loadLevels<Side::Sell>(asks_, asks);
+
+    last_seq_num_ = seq_num;
+    change_starting_index_ = INVALID_INDEX;
+    changed_sides_ = 0;
+
+    emitSnapshot(timestamp);
+    if (depth_publisher_.depth() > 0) {
+        publishDepth(timestamp);
+    }
+    if (analytics_.depth() > 0) {
+        updateAnalytics(0, kAllSides);
+    }
+    notifyTopOfBookIfChanged(timestamp);
+}
+
+template<typename Traits>
+template<Side S>
+SLICK_OB_INLINE void BasicOrderBookL2<Traits>::loadLevels(LevelContainer<S>& levels,
+                                                         std::span<const detail::PriceLevelL2> snapshot) {
+    // Inserting best first means every new level lands at the back: no shifting
+    auto build = [&levels](const auto& sorted) {
+        levels.clear();
+        levels.reserve(sorted.size());
+        for (const auto& level : sorted) {
+            if (level.quantity > 0 && accepts(levels, level.price, level.quantity)) {
+                levels.insertOrUpdate(level.price, level.quantity, level.timestamp);
+            }
+        }
+    };
+
+    const detail::SideComparator<S> comparator;
+    if (std::is_sorted(snapshot.begin(), snapshot.end(), comparator)) {
+        build(snapshot);
+    } else {
+        // Stable sort keeps duplicate prices in input order, so the last one wins
+        std::vector<detail::PriceLevelL2> sorted(snapshot.begin(), snapshot.end());
+        std::stable_sort(sorted.begin(), sorted.end(), comparator);
+        build(sorted);
+    }
+}
+
 SLICK_NAMESPACE_END
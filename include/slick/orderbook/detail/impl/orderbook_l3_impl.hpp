@@ -11,58 +11,78 @@
 
 SLICK_NAMESPACE_BEGIN
 
-SLICK_OB_INLINE OrderBookL3::OrderBookL3(SymbolId symbol,
+template<typename Traits>
+SLICK_OB_INLINE BasicOrderBookL3<Traits>::BasicOrderBookL3(SymbolId symbol,
+                         std::size_t interested_num_levels,
+                         std::size_t initial_order_capacity,
+                         std::size_t initial_level_capacity)
+    : BasicOrderBookL3(symbol, MemoryConfig{}, interested_num_levels, initial_order_capacity, initial_level_capacity) {
+}
+
+template<typename Traits>
+SLICK_OB_INLINE BasicOrderBookL3<Traits>::BasicOrderBookL3(SymbolId symbol,
+                         const MemoryConfig& memory,
                          std::size_t interested_num_levels,
                          std::size_t initial_order_capacity,
                          std::size_t initial_level_capacity)
     : symbol_(symbol),
+      bids_(initial_level_capacity),
+      asks_(initial_level_capacity),
       order_map_(initial_order_capacity),
-      order_pool_(initial_order_capacity),
+      order_pool_(initial_order_capacity, memory),
       last_seq_num_(0),
       interested_num_levels_(interested_num_levels) {
-    // Initialize level maps with comparators
-    // Note: Clang-17 with GCC-14 libstdc++ has issues with aggregate initialization
-    // Use constructor syntax instead of brace initialization to avoid C++23 tuple conversion issues
-    levels_[Side::Buy] = PriceLevelMap(PriceComparator(Side::Buy));
-    levels_[Side::Sell] = PriceLevelMap(PriceComparator(Side::Sell));
-
-    // Reserve capacity for price levels (flat_map doesn't have reserve in C++23)
-    // This will be used during insertions to pre-allocate space
-    (void)initial_level_capacity;  // Mark as used
+    // Initialize cached top-of-book
+    cached_tob_.symbol = symbol_;
+    metrics_.bind(observers_);
+}
 
+template<typename Traits>
+SLICK_OB_INLINE BasicOrderBookL3<Traits>::BasicOrderBookL3(SymbolId symbol,
+                                                   const PriceLadderConfig& ladder_config,
+                                                   std::size_t interested_num_levels,
+                                                   std::size_t initial_order_capacity)
+    requires std::constructible_from<PriceLevelMap<Side::Buy>, const PriceLadderConfig&>
+    : symbol_(symbol),
+      bids_(ladder_config),
+      asks_(ladder_config),
+      order_map_(initial_order_capacity),
+      order_pool_(initial_order_capacity),
+      last_seq_num_(0),
+      interested_num_levels_(interested_num_levels) {
     // Initialize cached top-of-book
     cached_tob_.symbol = symbol_;
+    metrics_.bind(observers_);
 }
 
-SLICK_OB_INLINE OrderBookL3::~OrderBookL3() {
+template<typename Traits>
+SLICK_OB_INLINE BasicOrderBookL3<Traits>::~BasicOrderBookL3() {
     // Clean up all orders
     clear();
 }
 
-SLICK_OB_INLINE bool OrderBookL3::addOrModifyOrder(OrderId order_id, Side side, Price price, Quantity quantity,
+template<typename Traits>
+SLICK_OB_INLINE bool BasicOrderBookL3<Traits>::addOrModifyOrder(OrderId order_id, Side side, Price price, Quantity quantity,
                                    Timestamp timestamp, uint64_t priority, uint64_t seq_num, bool is_last_in_batch) {
     SLICK_ASSERT(side < SideCount);
+    [[maybe_unused]] const auto timer = metrics_.time(BookOperation::AddOrder);
 
     // Validate sequence number - reject out-of-order (seq_num < last_seq_num)
-    if (seq_num > 0) {
-        if (seq_num < last_seq_num_) {
-            // Out of order - reject
-            return false;
-        }
-        last_seq_num_ = seq_num;
+    if (!acceptSeqNum(seq_num)) {
+        return false;
     }
 
     // Check if order already exists
-    detail::Order* order = order_map_.find(order_id);
+    Order* order = order_map_.find(order_id);
     if (order) [[unlikely]] {
-        if (order->side != side) {
+        if (detail::sideOf(*order) != side) {
             // Side mismatch implies OrderId reuse - reject.
             SLICK_ASSERT(false);
             return false;
         }
 
         if (SLICK_UNLIKELY(quantity <= 0)) {
-            return (quantity == 0) ? deleteOrder(order_id, timestamp, seq_num, is_last_in_batch) : false;
+            return (quantity == 0) ? deleteFoundOrder(order, timestamp, seq_num, is_last_in_batch) : false;
         }
 
         // Idempotent update - nothing to do.
@@ -70,25 +90,107 @@ SLICK_OB_INLINE bool OrderBookL3::addOrModifyOrder(OrderId order_id, Side side,
             return true;
         }
 
-        // Call modifyOrder with the new parameters
-        return modifyOrder(order_id, price, quantity, timestamp, priority, seq_num, is_last_in_batch);
+        return modifyFoundOrder(order, price, quantity, timestamp, priority, seq_num, is_last_in_batch);
+    }
+
+    return addNewOrder(order_id, side, price, quantity, timestamp, priority, seq_num, is_last_in_batch);
+}
+
+template<typename Traits>
+SLICK_OB_INLINE bool BasicOrderBookL3<Traits>::addOrder(OrderId order_id, Side side, Price price, Quantity quantity,
+                          Timestamp timestamp, uint64_t priority, uint64_t seq_num, bool is_last_in_batch) {
+    SLICK_ASSERT(side < SideCount);
+    [[maybe_unused]] const auto timer = metrics_.time(BookOperation::AddOrder);
+
+    // Validate sequence number - reject out-of-order (seq_num < last_seq_num)
+    if (!acceptSeqNum(seq_num)) {
+        return false;
     }
 
-    if (SLICK_UNLIKELY(quantity <= 0)) {
+    // Strict add - fail if order already exists
+    if (order_map_.contains(order_id)) {
+        return false;
+    }
+    // Use timestamp as priority if not specified
+    uint64_t actual_priority = (priority == 0) ? timestamp : priority;
+    return addNewOrder(order_id, side, price, quantity, timestamp, actual_priority, seq_num, is_last_in_batch);
+}
+
+template<typename Traits>
+SLICK_OB_INLINE bool BasicOrderBookL3<Traits>::modifyOrder(OrderId order_id, Price new_price, Quantity new_quantity,
+                                               Timestamp new_timestamp, uint64_t new_priority,
+                                               uint64_t seq_num, bool is_last_in_batch) {
+    [[maybe_unused]] const auto timer = metrics_.time(BookOperation::ModifyOrder);
+
+    // Validate sequence number - reject out-of-order (seq_num < last_seq_num)
+    if (!acceptSeqNum(seq_num)) {
+        return false;
+    }
+
+    // Find order
+    Order* order = order_map_.find(order_id);
+    if (!order) {
+        metrics_.count(BookCounter::OrderNotFound);
+        return false;
+    }
+    return modifyFoundOrder(order, new_price, new_quantity, new_timestamp, new_priority, seq_num, is_last_in_batch);
+}
+
+template<typename Traits>
+SLICK_OB_INLINE bool BasicOrderBookL3<Traits>::deleteOrder(OrderId order_id, Timestamp timestamp, uint64_t seq_num, bool is_last_in_batch) {
+    [[maybe_unused]] const auto timer = metrics_.time(BookOperation::DeleteOrder);
+
+    // Validate sequence number - reject out-of-order (seq_num < last_seq_num)
+    if (!acceptSeqNum(seq_num)) {
+        return false;
+    }
+
+    // Find order
+    Order* order = order_map_.find(order_id);
+    if (!order) {
+        metrics_.count(BookCounter::OrderNotFound);
+        return false;
+    }
+    return deleteFoundOrder(order, timestamp, seq_num, is_last_in_batch);
+}
+
+template<typename Traits>
+SLICK_OB_INLINE bool BasicOrderBookL3<Traits>::executeOrder(OrderId order_id, Quantity executed_quantity, Timestamp timestamp, uint64_t seq_num, bool is_last_in_batch) {
+    [[maybe_unused]] const auto timer = metrics_.time(BookOperation::ExecuteOrder);
+
+    // Validate sequence number - reject out-of-order (seq_num < last_seq_num)
+    if (!acceptSeqNum(seq_num)) {
+        return false;
+    }
+
+    Order* order = order_map_.find(order_id);
+    if (!order) {
+        metrics_.count(BookCounter::OrderNotFound);
+        return false;
+    }
+    return executeFoundOrder(order, executed_quantity, timestamp, seq_num, is_last_in_batch);
+}
+
+template<typename Traits>
+SLICK_OB_INLINE bool BasicOrderBookL3<Traits>::addNewOrder(OrderId order_id, Side side, Price price, Quantity quantity,
+                                                           Timestamp timestamp, uint64_t priority, uint64_t seq_num,
+                                                           bool is_last_in_batch) {
+    if (SLICK_UNLIKELY(quantity <= 0 || !acceptsPrice(side, price))) {
         return false;
     }
 
     // Allocate order from pool
-    order = order_pool_.construct(order_id, price, quantity, side, timestamp, priority);
+    Order* order = order_pool_.construct(order_id, price, quantity, side, timestamp, priority);
     if (SLICK_UNLIKELY(order == nullptr)) {
         return false;
     }
+    metrics_.notePoolCapacity(order_pool_.capacity());
 
     // Get or create price level
     auto [level, level_idx, is_new] = getOrCreateLevel(side, price);
 
     // track starting index
-    change_starting_index_ = std::min<uint16_t>(change_starting_index_, level_idx);
+    noteLevelChange(side, level_idx);
 
     // Insert order into level (maintains priority order)
     level->insertOrder(order);
@@ -110,67 +212,31 @@ SLICK_OB_INLINE bool OrderBookL3::addOrModifyOrder(OrderId order_id, Side side,
 
     // Notify observers
     notifyOrderUpdate(order, 0, 0, timestamp, level_idx, order_flags, seq_num);
-    notifyPriceLevelUpdate(timestamp, side, price, level->getTotalQuantity(), order_map_.size(),
-        level_idx, level_change_flag, seq_num);
-    if (change_starting_index_ == 0 && is_last_in_batch) {
-        notifyTopOfBookIfChanged(timestamp);
-        change_starting_index_ = INVALID_INDEX;
+    notifyPriceLevelUpdate(timestamp, side, price, level, level_idx, level_change_flag, seq_num);
+    if (is_last_in_batch) {
+        endBatch(timestamp);
     }
 
     return true;
 }
 
-SLICK_OB_INLINE bool OrderBookL3::addOrder(OrderId order_id, Side side, Price price, Quantity quantity,
-                          Timestamp timestamp, uint64_t priority, uint64_t seq_num, bool is_last_in_batch) {
-    // Validate sequence number - reject out-of-order (seq_num < last_seq_num)
-    if (seq_num > 0) {
-        if (seq_num < last_seq_num_) {
-            // Out of order - reject
-            return false;
-        }
-        last_seq_num_ = seq_num;
-    }
-
-    // Strict add - fail if order already exists
-    if (order_map_.contains(order_id)) {
-        return false;
-    }
-    // Use timestamp as priority if not specified
-    uint64_t actual_priority = (priority == 0) ? timestamp : priority;
-    return addOrModifyOrder(order_id, side, price, quantity, timestamp, actual_priority, seq_num, is_last_in_batch);
-}
-
-SLICK_OB_INLINE bool OrderBookL3::modifyOrder(OrderId order_id, Price new_price, Quantity new_quantity,
-                                               Timestamp new_timestamp, uint64_t new_priority,
-                                               uint64_t seq_num, bool is_last_in_batch) {
-    // Validate sequence number - reject out-of-order (seq_num < last_seq_num)
-    if (seq_num > 0) {
-        if (seq_num < last_seq_num_) {
-            // Out of order - reject
-            return false;
-        }
-        last_seq_num_ = seq_num;
-    }
-
-    // Find order
-    detail::Order* order = order_map_.find(order_id);
-    if (!order) {
-        return false;
-    }
-
+template<typename Traits>
+SLICK_OB_INLINE bool BasicOrderBookL3<Traits>::modifyFoundOrder(Order* order, Price new_price, Quantity new_quantity,
+                                                                Timestamp new_timestamp, uint64_t new_priority,
+                                                                uint64_t seq_num, bool is_last_in_batch) {
     if (SLICK_UNLIKELY(new_quantity < 0)) {
         return false;
     }
 
     // Check if this is a delete (quantity = 0)
     if (new_quantity == 0) {
-        return deleteOrder(order_id, new_timestamp, seq_num, is_last_in_batch);
+        return deleteFoundOrder(order, new_timestamp, seq_num, is_last_in_batch);
     }
 
     const Price old_price = order->price;
     const Quantity old_quantity = order->quantity;
     const uint64_t old_priority = order->priority;
-    const Side side = order->side;
+    const Side side = detail::sideOf(*order);
 
     // Calculate effective priority (0 = use timestamp as priority for FIFO ordering)
     const uint64_t effective_new_priority = (new_priority == 0) ? new_timestamp : new_priority;
@@ -184,39 +250,41 @@ SLICK_OB_INLINE bool OrderBookL3::modifyOrder(OrderId order_id, Price new_price,
         // No change
         return true;
     }
+    if (price_changed && SLICK_UNLIKELY(!acceptsPrice(side, new_price))) {
+        return false;
+    }
 
     if (price_changed) {
         // Price changed - remove from old level (if exists) and add to new level
-        auto [old_level, old_level_idx] = getLevel(side, old_price);
-        Quantity old_level_total = 0;
+        auto [old_level, old_level_idx] = findLevel(side, old_price);
 
         if (old_level) {
             // track starting index
-            change_starting_index_ = std::min<uint16_t>(change_starting_index_, old_level_idx);
+            noteLevelChange(side, old_level_idx);
 
             // Remove from old level
             old_level->removeOrder(order);
-            old_level_total = old_level->getTotalQuantity();
 
             uint8_t old_level_change_flags = QuantityChanged;
             if (removeLevelIfEmpty(side, old_price)) {
                 old_level_change_flags |= PriceChanged;
+                old_level = nullptr;
             }
             // Don't add LastInBatch to intermediate old level update
-            notifyPriceLevelUpdate(new_timestamp, side, old_price, old_level_total, order_map_.size(),
-                old_level_idx, old_level_change_flags, seq_num);
+            notifyPriceLevelUpdate(new_timestamp, side, old_price, old_level, old_level_idx,
+                old_level_change_flags, seq_num);
         }
 
         // Update order fields
         order->price = new_price;
         order->quantity = new_quantity;
-        order->timestamp = new_timestamp;
+        detail::setTimestamp(*order, new_timestamp);
         order->priority = effective_new_priority;
 
         // Get or create new level
         auto [new_level, new_level_idx, is_new] = getOrCreateLevel(side, new_price);
 
-        change_starting_index_ = std::min<uint16_t>(change_starting_index_, new_level_idx);
+        noteLevelChange(side, new_level_idx);
 
         // Insert into new level
         new_level->insertOrder(order);
@@ -237,32 +305,27 @@ SLICK_OB_INLINE bool OrderBookL3::modifyOrder(OrderId order_id, Price new_price,
         }
 
         notifyOrderUpdate(order, old_quantity, old_price, new_timestamp, new_level_idx, order_flags, seq_num);
-        notifyPriceLevelUpdate(new_timestamp, side, new_price, new_level->getTotalQuantity(),
-            order_map_.size(), new_level_idx, new_level_change_flags, seq_num);
-        if (change_starting_index_ == 0 && is_last_in_batch) {
-            notifyTopOfBookIfChanged(new_timestamp);
-            change_starting_index_ = INVALID_INDEX;
+        notifyPriceLevelUpdate(new_timestamp, side, new_price, new_level, new_level_idx,
+            new_level_change_flags, seq_num);
+        if (is_last_in_batch) {
+            endBatch(new_timestamp);
         }
 
+    } else if (!priority_changed) {
+        // Only quantity changed - update in place
+        return updateFoundOrderQuantity(order, new_quantity, new_timestamp, seq_num, is_last_in_batch);
     } else {
-        // Only quantity or priority changed (price stays the same)
+        // Priority changed (price stays the same)
         auto [level, level_index, is_new] = getOrCreateLevel(side, old_price);
 
-        change_starting_index_ = std::min<uint16_t>(change_starting_index_, level_index);
+        noteLevelChange(side, level_index);
 
-        if (priority_changed) {
-            // Priority changed - need to re-insert to maintain correct queue position
-            level->removeOrder(order);
-            order->quantity = new_quantity;
-            order->timestamp = new_timestamp;
-            order->priority = effective_new_priority;
-            level->insertOrder(order);
-        } else {
-            // Only quantity changed - update in place
-            level->updateOrderQuantity(old_quantity, new_quantity);
-            order->quantity = new_quantity;
-            order->timestamp = new_timestamp;
-        }
+        // Re-insert to maintain correct queue position
+        level->removeOrder(order);
+        order->quantity = new_quantity;
+        detail::setTimestamp(*order, new_timestamp);
+        order->priority = effective_new_priority;
+        level->insertOrder(order);
 
         // Notify observers (only quantity changed)
         uint8_t order_flags = QuantityChanged;
@@ -277,38 +340,23 @@ SLICK_OB_INLINE bool OrderBookL3::modifyOrder(OrderId order_id, Price new_price,
         }
 
         notifyOrderUpdate(order, old_quantity, old_price, new_timestamp, level_index, order_flags, seq_num);
-        notifyPriceLevelUpdate(new_timestamp, side, old_price, level->getTotalQuantity(), order_map_.size(), level_index, level_change_flags, seq_num);
-        if (change_starting_index_ == 0 && is_last_in_batch) {
-            notifyTopOfBookIfChanged(new_timestamp);
-            change_starting_index_ = INVALID_INDEX;
+        notifyPriceLevelUpdate(new_timestamp, side, old_price, level, level_index, level_change_flags, seq_num);
+        if (is_last_in_batch) {
+            endBatch(new_timestamp);
         }
     }
 
     return true;
 }
 
-SLICK_OB_INLINE bool OrderBookL3::deleteOrder(OrderId order_id, Timestamp timestamp, uint64_t seq_num, bool is_last_in_batch) {
-    // Validate sequence number - reject out-of-order (seq_num < last_seq_num)
-    if (seq_num > 0) {
-        if (seq_num < last_seq_num_) {
-            // Out of order - reject
-            return false;
-        }
-        last_seq_num_ = seq_num;
-    }
-
-    // Find order
-    detail::Order* order = order_map_.find(order_id);
-    if (!order) {
-        return false;
-    }
-
-    order->timestamp = timestamp;  // Update timestamp for deletion event
+template<typename Traits>
+SLICK_OB_INLINE bool BasicOrderBookL3<Traits>::deleteFoundOrder(Order* order, Timestamp timestamp, uint64_t seq_num,
+                                                                bool is_last_in_batch) {
     const Price price = order->price;
-    const Side side = order->side;
+    const Side side = detail::sideOf(*order);
 
     // Get level
-    auto [level, level_idx] = getLevel(side, price);
+    auto [level, level_idx] = findLevel(side, price);
     if (!level) {
         // Level doesn't exist - data structure inconsistency
         // Deletion: both price and quantity changed
@@ -317,26 +365,28 @@ SLICK_OB_INLINE bool OrderBookL3::deleteOrder(OrderId order_id, Timestamp timest
             order_flags |= LastInBatch;
         }
         // Notify deletion, then clean up (use max index since level not found)
+        detail::setTimestamp(*order, timestamp);  // Update timestamp for deletion event
         notifyOrderDelete(order, timestamp, std::numeric_limits<uint16_t>::max(), order_flags, seq_num);
-        order_map_.erase(order_id);
+        order_map_.erase(order->order_id);
         order_pool_.destroy(order);
         return false;
     }
 
-    change_starting_index_ = std::min<uint16_t>(change_starting_index_, level_idx);
+    noteLevelChange(side, level_idx);
 
     // Remove from level
     level->removeOrder(order);
-    const Quantity level_total = level->getTotalQuantity();
+    detail::setTimestamp(*order, timestamp);  // Update timestamp for deletion event (after the level saw the old one)
 
     // Remove from order map
-    order_map_.erase(order_id);
+    order_map_.erase(order->order_id);
 
     // Deletion: both price and quantity changed
     uint8_t order_flags = PriceChanged | QuantityChanged;
     uint8_t level_change_flags = QuantityChanged;
     if (removeLevelIfEmpty(side, price)) {
         level_change_flags |= PriceChanged;
+        level = nullptr;
     }
     // Add LastInBatch flag if this is the last update
     if (is_last_in_batch) {
@@ -346,176 +396,543 @@ SLICK_OB_INLINE bool OrderBookL3::deleteOrder(OrderId order_id, Timestamp timest
 
     // Notify observers (before destroying order)
     notifyOrderDelete(order, timestamp, level_idx, order_flags, seq_num);
-    notifyPriceLevelUpdate(timestamp, side, price, level_total, order_map_.size(), level_idx, level_change_flags, seq_num);
+    notifyPriceLevelUpdate(timestamp, side, price, level, level_idx, level_change_flags, seq_num);
 
     // Destroy order
     order_pool_.destroy(order);
 
     // Notify ToB if changed
-    if (change_starting_index_ == 0 && is_last_in_batch) {
-        notifyTopOfBookIfChanged(timestamp);
-        change_starting_index_ = INVALID_INDEX;
+    if (is_last_in_batch) {
+        endBatch(timestamp);
     }
 
     return true;
 }
 
-SLICK_OB_INLINE bool OrderBookL3::executeOrder(OrderId order_id, Quantity executed_quantity, Timestamp timestamp, uint64_t seq_num, bool is_last_in_batch) {
-    // Validate sequence number - reject out-of-order (seq_num < last_seq_num)
-    if (seq_num > 0) {
-        if (seq_num < last_seq_num_) {
-            // Out of order - reject
-            return false;
-        }
-        last_seq_num_ = seq_num;
-    }
-
-    detail::Order* order = order_map_.find(order_id);
-    if (!order) {
-        return false;
-    }
-
+template<typename Traits>
+SLICK_OB_INLINE bool BasicOrderBookL3<Traits>::executeFoundOrder(Order* order, Quantity executed_quantity,
+                                                                 Timestamp timestamp, uint64_t seq_num,
+                                                                 bool is_last_in_batch) {
     if (SLICK_UNLIKELY(executed_quantity <= 0 || executed_quantity > order->quantity)) {
         SLICK_ASSERT(executed_quantity > 0 && executed_quantity <= order->quantity);
         return false;
     }
 
     const Quantity remaining = order->quantity - executed_quantity;
-    const Price price = order->price;              // Preserve price
-    const uint64_t priority = order->priority;     // Preserve priority
 
     if (remaining == 0) {
         // Fully executed - delete order (pass through timestamp, seq_num and is_last_in_batch)
-        return deleteOrder(order_id, timestamp, seq_num, is_last_in_batch);
+        return deleteFoundOrder(order, timestamp, seq_num, is_last_in_batch);
     } else {
-        // Partial execution - reduce quantity (pass through timestamp, priority, seq_num and is_last_in_batch)
-        return modifyOrder(order_id, price, remaining, timestamp, priority, seq_num, is_last_in_batch);
+        // Partial execution - reduce quantity in place, keeping price and queue position
+        return updateFoundOrderQuantity(order, remaining, timestamp, seq_num, is_last_in_batch);
     }
 }
 
-SLICK_OB_INLINE const detail::Order* OrderBookL3::findOrder(OrderId order_id) const noexcept {
-    return order_map_.find(order_id);
-}
+template<typename Traits>
+SLICK_OB_INLINE bool BasicOrderBookL3<Traits>::updateFoundOrderQuantity(Order* order, Quantity new_quantity,
+                                                                        Timestamp timestamp, uint64_t seq_num,
+                                                                        bool is_last_in_batch) {
+    const Price price = order->price;
+    const Quantity old_quantity = order->quantity;
+    const Side side = detail::sideOf(*order);
 
-SLICK_OB_INLINE const detail::PriceLevelL3* OrderBookL3::getBestBid() const noexcept {
-    const auto& bids = levels_[Side::Buy];
-    if (bids.empty()) {
-        return nullptr;
+    auto [level, level_index] = findLevel(side, price);
+    if (SLICK_UNLIKELY(level == nullptr)) {
+        // Level doesn't exist - data structure inconsistency
+        return false;
     }
-    // FlatMap is sorted by key (Price) in ascending order by default
-    // For Buy side, we want highest price first, so use reverse iterator
-    return &bids.begin()->second;
-}
+    noteLevelChange(side, level_index);
+    level->updateOrder(order, new_quantity, timestamp);
 
-SLICK_OB_INLINE const detail::PriceLevelL3* OrderBookL3::getBestAsk() const noexcept {
-    const auto& asks = levels_[Side::Sell];
-    if (asks.empty()) {
-        return nullptr;
+    const uint8_t last_flag = is_last_in_batch ? LastInBatch : 0;
+    notifyOrderUpdate(order, old_quantity, price, timestamp, level_index, QuantityChanged | last_flag, seq_num);
+    notifyPriceLevelUpdate(timestamp, side, price, level, level_index, QuantityChanged | last_flag, seq_num);
+    if (is_last_in_batch) {
+        endBatch(timestamp);
     }
-    // For Sell side, we want lowest price first (first element)
-    return &asks.begin()->second;
-}
-
-SLICK_OB_INLINE TopOfBook OrderBookL3::getTopOfBook() const noexcept {
-    return cached_tob_;
+    return true;
 }
 
-SLICK_OB_INLINE std::vector<detail::PriceLevelL2> OrderBookL3::getLevelsL2(Side side, std::size_t depth) const {
+template<typename Traits>
+SLICK_OB_INLINE SubmitResult BasicOrderBookL3<Traits>::submitOrder(OrderId order_id, Side side, Price price, Quantity quantity,
+                                                           Timestamp timestamp, OrderType type, TimeInForce time_in_force,
+                                                           uint64_t seq_num, bool is_last_in_batch) {
     SLICK_ASSERT(side < SideCount);
+    [[maybe_unused]] const auto timer = metrics_.time(BookOperation::SubmitOrder);
+    SubmitResult result;
+    result.remaining_quantity = quantity;
+    if (SLICK_UNLIKELY(quantity <= 0 || (type != OrderType::Limit && type != OrderType::Market))) {
+        return result;
+    }
 
-    const auto& level_map = levels_[side];
-    std::vector<detail::PriceLevelL2> result;
+    // Validate sequence number - reject out-of-order (seq_num < last_seq_num)
+    if (!acceptSeqNum(seq_num)) {
+        return result;
+    }
 
-    if (level_map.empty()) {
+    // The order id names the aggressor in trades and the remainder if it rests
+    if (order_map_.contains(order_id)) {
         return result;
     }
 
-    const std::size_t count = (depth == 0) ? level_map.size() : std::min(depth, level_map.size());
-    result.reserve(count);
+    // Matching leaves this side's levels alone, so a remainder that could not rest is rejected up front
+    const bool is_market = type == OrderType::Market;
+    if (!is_market && time_in_force == TimeInForce::Day && SLICK_UNLIKELY(!acceptsPrice(side, price))) {
+        return result;
+    }
+    if (time_in_force == TimeInForce::FOK) {
+        const bool fillable = side == Side::Buy ? canFill<Side::Sell>(asks_, price, is_market, quantity)
+                                                : canFill<Side::Buy>(bids_, price, is_market, quantity);
+        if (!fillable) {
+            return result;
+        }
+    }
 
+    // Market orders never rest
+    const bool rest_remainder = !is_market && time_in_force == TimeInForce::Day;
     if (side == Side::Buy) {
-        // For bids, iterate in reverse (highest price first)
-        auto it = level_map.begin();
-        for (std::size_t i = 0; i < count && it != level_map.end(); ++i, ++it) {
-            const auto& [price, level] = *it;
-            Timestamp latest_timestamp = level.orders.empty() ? 0 : level.orders.front()->timestamp;
-            result.emplace_back(price, level.getTotalQuantity(), latest_timestamp);
-        }
+        matchLevels<Side::Sell>(asks_, order_id, price, is_market, quantity, rest_remainder, timestamp, seq_num,
+                                is_last_in_batch, result);
     } else {
-        // For asks, iterate forward (lowest price first)
-        auto it = level_map.begin();
-        for (std::size_t i = 0; i < count && it != level_map.end(); ++i, ++it) {
-            const auto& [price, level] = *it;
-            Timestamp latest_timestamp = level.orders.empty() ? 0 : level.orders.front()->timestamp;
-            result.emplace_back(price, level.getTotalQuantity(), latest_timestamp);
-        }
+        matchLevels<Side::Buy>(bids_, order_id, price, is_market, quantity, rest_remainder, timestamp, seq_num,
+                               is_last_in_batch, result);
+    }
+    result.remaining_quantity = quantity - result.filled_quantity;
+
+    if (result.remaining_quantity == 0) {
+        result.status = SubmitStatus::Filled;
+    } else if (rest_remainder && addNewOrder(order_id, side, price, result.remaining_quantity, timestamp, timestamp,
+                                             seq_num, is_last_in_batch)) {
+        // addNewOrder() closed the batch
+        result.status = result.filled_quantity > 0 ? SubmitStatus::PartiallyFilled : SubmitStatus::Resting;
+    } else {
+        result.status = SubmitStatus::Cancelled;
+    }
+    if (is_last_in_batch && result.status != SubmitStatus::PartiallyFilled && result.status != SubmitStatus::Resting) {
+        endBatch(timestamp);
     }
 
+    // Stops are only checked when this order traded (a nested submit leaves cascades to the outer loop)
+    if (result.trade_count > 0 && !stops_.empty() && !triggering_stops_) {
+        result.triggered_stops = triggerStops(timestamp);
+    }
     return result;
 }
 
-SLICK_OB_INLINE std::pair<const detail::PriceLevelL3*, uint16_t> OrderBookL3::getLevel(Side side, Price price) const noexcept {
+template<typename Traits>
+SLICK_OB_INLINE SubmitResult BasicOrderBookL3<Traits>::submitStopOrder(OrderId order_id, Side side, Price stop_price,
+                                                               Quantity quantity, Timestamp timestamp, OrderType type,
+                                                               Price limit_price, TimeInForce time_in_force,
+                                                               uint64_t seq_num) {
     SLICK_ASSERT(side < SideCount);
-    const auto& level_map = levels_[side];
-    auto it = level_map.find(price);
-    if (it != level_map.end()) {
-        uint16_t index = static_cast<uint16_t>(std::distance(level_map.begin(), it));
-        return {&it->second, index};
+    [[maybe_unused]] const auto timer = metrics_.time(BookOperation::SubmitOrder);
+    SubmitResult result;
+    result.remaining_quantity = quantity;
+    if (SLICK_UNLIKELY(quantity <= 0 || (type != OrderType::Stop && type != OrderType::StopLimit))) {
+        return result;
+    }
+
+    // Validate sequence number - reject out-of-order (seq_num < last_seq_num)
+    if (!acceptSeqNum(seq_num)) {
+        return result;
+    }
+
+    if (order_map_.contains(order_id) || stops_.contains(order_id)) {
+        return result;
+    }
+
+    const detail::StopOrder stop{order_id, stop_price, limit_price, quantity, timestamp, side, type, time_in_force};
+    if (has_traded_ && detail::StopOrderIndex::reached(side, stop_price, last_trade_price_)) {
+        // Already triggered
+        return submitTriggered(stop, timestamp, seq_num);
+    }
+    if (!stops_.insert(stop)) {
+        return result;
     }
-    return {nullptr, INVALID_INDEX};
+    result.status = SubmitStatus::Pending;
+    return result;
 }
 
-SLICK_OB_INLINE std::pair<detail::PriceLevelL3*, uint16_t> OrderBookL3::getLevel(Side side, Price price) noexcept {
-    SLICK_ASSERT(side < SideCount);
-    auto& level_map = levels_[side];
-    auto it = level_map.find(price);
-    if (it != level_map.end()) {
-        uint16_t index = static_cast<uint16_t>(std::distance(level_map.begin(), it));
-        return {&it->second, index};
+template<typename Traits>
+SLICK_OB_INLINE uint32_t BasicOrderBookL3<Traits>::triggerStops(Timestamp timestamp) {
+    triggering_stops_ = true;
+    uint32_t triggered = 0;
+    for (;;) {
+        // Each triggered order can move the last trade price either way
+        auto stop = stops_.popTriggered(Side::Buy, last_trade_price_);
+        if (!stop) {
+            stop = stops_.popTriggered(Side::Sell, last_trade_price_);
+            if (!stop) {
+                break;
+            }
+        }
+        submitTriggered(*stop, timestamp, 0);
+        ++triggered;
     }
-    return {nullptr, INVALID_INDEX};
+    triggering_stops_ = false;
+    return triggered;
 }
 
-SLICK_OB_INLINE const detail::PriceLevelL3* OrderBookL3::getLevelByIndex(Side side, uint16_t index) const noexcept {
-    SLICK_ASSERT(side < SideCount);
-    const auto& level_map = levels_[side];
-    if (index >= level_map.size()) {
-        return nullptr;
+template<typename Traits>
+SLICK_OB_INLINE SubmitResult BasicOrderBookL3<Traits>::submitTriggered(const detail::StopOrder& stop, Timestamp timestamp,
+                                                               uint64_t seq_num) {
+    const bool is_stop_limit = stop.type == OrderType::StopLimit;
+    return submitOrder(stop.order_id, stop.side, is_stop_limit ? stop.limit_price : 0, stop.quantity, timestamp,
+                       is_stop_limit ? OrderType::Limit : OrderType::Market, stop.time_in_force, seq_num);
+}
+
+template<typename Traits>
+template<Side S>
+SLICK_OB_INLINE bool BasicOrderBookL3<Traits>::canFill(const PriceLevelMap<S>& level_map, Price limit_price,
+                                                       bool is_market, Quantity quantity) const noexcept {
+    for (const auto& [level_price, level] : level_map.view()) {
+        if (!crosses<S>(level_price, limit_price, is_market)) {
+            return false;
+        }
+        quantity -= level.getTotalQuantity();
+        if (quantity <= 0) {
+            return true;
+        }
     }
-    auto it = level_map.begin();
-    std::advance(it, index);
-    return &it->second;
+    return false;
 }
 
-SLICK_OB_INLINE std::size_t OrderBookL3::levelCount(Side side) const noexcept {
-    SLICK_ASSERT(side < SideCount);
-    return levels_[side].size();
+template<typename Traits>
+template<Side S>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::matchLevels(PriceLevelMap<S>& level_map, OrderId aggressive_order_id,
+                                                           Price limit_price, bool is_market, Quantity quantity,
+                                                           bool rest_remainder, Timestamp timestamp, uint64_t seq_num,
+                                                           bool is_last_in_batch, SubmitResult& result) {
+    constexpr Side aggressor_side = S == Side::Buy ? Side::Sell : Side::Buy;
+    const uint8_t last_flag = is_last_in_batch ? LastInBatch : 0;
+    Quantity remaining = quantity;
+    bool done = false;
+
+    while (!done) {
+        auto best = level_map.best();
+        if (best == nullptr || !crosses<S>(best->first, limit_price, is_market)) {
+            break;
+        }
+        const Price level_price = best->first;
+        PriceLevel& level = best->second;
+
+        // Fills always hit the best level (index 0)
+        noteLevelChange(S, 0);
+
+        // LastInBatch goes on the sweep's final events, unless the remainder rests (addOrder() closes the batch)
+        uint8_t closing_flag = 0;
+        do {
+            Order* passive = level.getBestOrder();
+            const Quantity passive_quantity = passive->quantity;
+            const Quantity fill = std::min(remaining, passive_quantity);
+            remaining -= fill;
+            result.filled_quantity += fill;
+            ++result.trade_count;
+
+            if (remaining == 0) {
+                done = true;
+                closing_flag = last_flag;
+            } else if (fill == passive_quantity && level.orderCount() == 1) {
+                // Last order of the level: the sweep ends here unless the next level crosses too
+                const auto next = level_map.atIndex(1);
+                if (next == nullptr || !crosses<S>(next->first, limit_price, is_market)) {
+                    done = true;
+                    closing_flag = rest_remainder ? 0 : last_flag;
+                }
+            }
+
+            notifyTrade(passive->order_id, aggressive_order_id, aggressor_side, level_price, fill, timestamp);
+            if (fill == passive_quantity) {
+                // Fully filled - remove (deletion: both price and quantity changed)
+                level.removeOrder(passive);
+                detail::setTimestamp(*passive, timestamp);
+                order_map_.erase(passive->order_id);
+                notifyOrderDelete(passive, timestamp, 0, PriceChanged | QuantityChanged | closing_flag, seq_num);
+                order_pool_.destroy(passive);
+            } else {
+                // Partially filled - keeps its queue position
+                level.updateOrder(passive, passive_quantity - fill, timestamp);
+                notifyOrderUpdate(passive, passive_quantity, level_price, timestamp, 0, QuantityChanged | closing_flag,
+                                  seq_num);
+            }
+        } while (!done && !level.isEmpty());
+
+        last_trade_price_ = level_price;
+        has_traded_ = true;
+
+        // One level update per swept level
+        uint8_t level_change_flags = QuantityChanged | closing_flag;
+        const PriceLevel* remaining_level = &level;
+        if (removeLevelIfEmpty(S, level_price)) {
+            level_change_flags |= PriceChanged;
+            remaining_level = nullptr;
+        }
+        notifyPriceLevelUpdate(timestamp, S, level_price, remaining_level, 0, level_change_flags, seq_num);
+    }
+}
+
+template<typename Traits>
+SLICK_OB_INLINE std::size_t BasicOrderBookL3<Traits>::applyBatch(std::span<const L3Update> updates) {
+    if (updates.empty()) {
+        return 0;
+    }
+    [[maybe_unused]] const auto timer = metrics_.time(BookOperation::ApplyBatch);
+
+    // Validate the batch's sequence numbers once: sequenced updates must not go back, neither behind
+    // last_seq_num nor within the batch - otherwise the whole batch is rejected
+    uint64_t seq_num = last_seq_num_;
+    for (const L3Update& update : updates) {
+        if (update.seq_num > 0) {
+            if (update.seq_num < seq_num) {
+                // Out of order - reject
+                metrics_.count(BookCounter::RejectedSeqNum);
+                return 0;
+            }
+            seq_num = update.seq_num;
+        }
+    }
+    last_seq_num_ = seq_num;
+
+    // Level notifications and endBatch() are deferred until every operation is applied
+    // (levels left pending by conflated calls before this batch are kept)
+    if (!level_batch_.active()) {
+        level_batch_.begin(updates.size());
+    }
+    applying_batch_ = true;
+    std::size_t applied = 0;
+    for (std::size_t i = 0; i < updates.size(); ++i) {
+        prefetchBatchOrders(updates, i);
+        const L3Update& update = updates[i];
+        const bool is_last_in_batch = i + 1 == updates.size();
+        bool ok = false;
+        if (update.type == L3UpdateType::Add) {
+            ok = !order_map_.contains(update.order_id) &&
+                 addNewOrder(update.order_id, update.side, update.price, update.quantity, update.timestamp,
+                             update.priority == 0 ? update.timestamp : update.priority, update.seq_num,
+                             is_last_in_batch);
+        } else if (Order* order = order_map_.find(update.order_id)) {
+            switch (update.type) {
+                case L3UpdateType::Modify:
+                    ok = modifyFoundOrder(order, update.price, update.quantity, update.timestamp, update.priority,
+                                          update.seq_num, is_last_in_batch);
+                    break;
+                case L3UpdateType::Delete:
+                    ok = deleteFoundOrder(order, update.timestamp, update.seq_num, is_last_in_batch);
+                    break;
+                case L3UpdateType::Execute:
+                    ok = executeFoundOrder(order, update.quantity, update.timestamp, update.seq_num,
+                                           is_last_in_batch);
+                    break;
+                case L3UpdateType::Add:
+                    break;
+            }
+        } else {
+            metrics_.count(BookCounter::OrderNotFound);
+        }
+        applied += ok ? 1 : 0;
+    }
+
+    applying_batch_ = false;
+    endBatch(updates.back().timestamp);
+    return applied;
+}
+
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::flushLevelBatch() {
+    // Hold back one update so the last one reported can carry LastInBatch
+    PriceLevelUpdate pending;
+    bool has_pending = false;
+    level_batch_.flush([&](const detail::LevelBatch::Touch& touch) {
+        LevelSummary summary;
+        uint16_t level_index = INVALID_INDEX;
+        uint8_t change_flags = PriceChanged | QuantityChanged;
+        if (auto [level, index] = findLevel(touch.side, touch.price); level) {
+            summary = level->summary();
+            level_index = index;
+            change_flags = touch.existed_before ? static_cast<uint8_t>(QuantityChanged) : change_flags;
+        } else if (!touch.existed_before) {
+            return;  // Added and removed within the batch
+        } else {
+            // Removed: report the position the level would occupy
+            const std::size_t index = calculateLevelIndex(touch.side, touch.price);
+            level_index = index < updateLevelIndexLimit() ? static_cast<uint16_t>(index) : INVALID_INDEX;
+        }
+        if (interested_num_levels_ > 0 && level_index >= interested_num_levels_) {
+            return;
+        }
+        if (has_pending) {
+            observers_.notifyPriceLevelUpdate(pending);
+        }
+        pending = PriceLevelUpdate{touch.timestamp, symbol_, touch.side, touch.price, summary, level_index,
+                                   change_flags, touch.seq_num};
+        has_pending = true;
+    });
+    if (has_pending) {
+        pending.change_flags |= LastInBatch;
+        observers_.notifyPriceLevelUpdate(pending);
+    }
 }
 
-SLICK_OB_INLINE std::size_t OrderBookL3::orderCount(Side side) const noexcept {
+template<typename Traits>
+SLICK_OB_INLINE auto BasicOrderBookL3<Traits>::findOrder(OrderId order_id) const noexcept -> const Order* {
+    return order_map_.find(order_id);
+}
+
+template<typename Traits>
+SLICK_OB_INLINE std::optional<QueuePosition> BasicOrderBookL3<Traits>::queuePosition(OrderId order_id) const {
+    const Order* order = order_map_.find(order_id);
+    if (!order) {
+        return std::nullopt;
+    }
+    return visitLevels(detail::sideOf(*order), [order](const auto& level_map) {
+        auto it = level_map.find(order->price);
+        SLICK_ASSERT(it != level_map.end());
+        return it->second.queuePosition(order);
+    });
+}
+
+template<typename Traits>
+SLICK_OB_INLINE std::optional<LevelSummary> BasicOrderBookL3<Traits>::getLevelSummary(Side side, Price price) const {
     SLICK_ASSERT(side < SideCount);
+    return visitLevels(side, [price](const auto& level_map) -> std::optional<LevelSummary> {
+        auto it = level_map.find(price);
+        if (it == level_map.end()) {
+            return std::nullopt;
+        }
+        return it->second.summary();
+    });
+}
+
+template<typename Traits>
+SLICK_OB_INLINE auto BasicOrderBookL3<Traits>::getBestBid() const noexcept -> const PriceLevel* {
+    // Bids are stored best first, so the highest price is the first element
+    const auto best = bids_.best();
+    return best ? &best->second : nullptr;
+}
+
+template<typename Traits>
+SLICK_OB_INLINE auto BasicOrderBookL3<Traits>::getBestAsk() const noexcept -> const PriceLevel* {
+    // Asks are stored best first, so the lowest price is the first element
+    const auto best = asks_.best();
+    return best ? &best->second : nullptr;
+}
+
+template<typename Traits>
+SLICK_OB_INLINE TopOfBook BasicOrderBookL3<Traits>::getTopOfBook() const noexcept {
+    return cached_tob_;
+}
+
+template<typename Traits>
+SLICK_OB_INLINE std::vector<detail::PriceLevelL2> BasicOrderBookL3<Traits>::getLevelsL2(Side side, std::size_t depth) const {
+    const std::size_t size = levelCount(side);
+    std::vector<detail::PriceLevelL2> result((depth == 0) ? size : std::min(depth, size));
+    getLevelsL2(side, result);
+    return result;
+}
+
+template<typename Traits>
+SLICK_OB_INLINE std::size_t BasicOrderBookL3<Traits>::getLevelsL2(Side side, std::span<detail::PriceLevelL2> out) const noexcept {
+    return visitLevels(side, [out](const auto& level_map) {
+        // Levels are stored best-first for both sides
+        std::size_t count = 0;
+        for (auto it = level_map.begin(); it != level_map.end() && count < out.size(); ++it) {
+            out[count++] = aggregateLevel(*it);
+        }
+        return count;
+    });
+}
+
+template<typename Traits>
+SLICK_OB_INLINE auto BasicOrderBookL3<Traits>::getLevel(Side side, Price price) const noexcept
+    -> std::pair<const PriceLevel*, uint16_t> {
+    return visitLevels(side, [this, price](const auto& level_map) -> std::pair<const PriceLevel*, uint16_t> {
+        auto it = level_map.find(price);
+        if (it != level_map.end()) {
+            uint16_t index = levelIndexOf(level_map, it, level_index_limit_);
+            return {&it->second, index};
+        }
+        return {nullptr, INVALID_INDEX};
+    });
+}
+
+template<typename Traits>
+SLICK_OB_INLINE auto BasicOrderBookL3<Traits>::getLevel(Side side, Price price) noexcept
+    -> std::pair<PriceLevel*, uint16_t> {
+    return visitLevels(side, [this, price](auto& level_map) -> std::pair<PriceLevel*, uint16_t> {
+        auto it = level_map.find(price);
+        if (it != level_map.end()) {
+            uint16_t index = levelIndexOf(level_map, it, level_index_limit_);
+            return {&it->second, index};
+        }
+        return {nullptr, INVALID_INDEX};
+    });
+}
+
+template<typename Traits>
+SLICK_OB_INLINE auto BasicOrderBookL3<Traits>::findLevel(Side side, Price price) noexcept
+    -> std::pair<PriceLevel*, uint16_t> {
+    const std::size_t limit = updateLevelIndexLimit();
+    return visitLevels(side, [price, limit](auto& level_map) -> std::pair<PriceLevel*, uint16_t> {
+        // Executions and most cancels hit the touch: no search or index count for the best level
+        if (auto best = level_map.best(); best != nullptr && best->first == price) {
+            return {&best->second, 0};
+        }
+        auto it = level_map.find(price);
+        if (it != level_map.end()) {
+            return {&it->second, levelIndexOf(level_map, it, limit)};
+        }
+        return {nullptr, INVALID_INDEX};
+    });
+}
+
+template<typename Traits>
+SLICK_OB_INLINE auto BasicOrderBookL3<Traits>::getLevelByIndex(Side side, uint16_t index) const noexcept
+    -> const PriceLevel* {
+    return visitLevels(side, [index](const auto& level_map) -> const PriceLevel* {
+        const auto entry = level_map.atIndex(index);
+        return entry ? &entry->second : nullptr;
+    });
+}
+
+template<typename Traits>
+SLICK_OB_INLINE std::size_t BasicOrderBookL3<Traits>::levelCount(Side side) const noexcept {
+    return visitLevels(side, [](const auto& level_map) { return level_map.size(); });
+}
+
+template<typename Traits>
+SLICK_OB_INLINE std::size_t BasicOrderBookL3<Traits>::orderCount(Side side) const noexcept {
     std::size_t count = 0;
-    for (const auto& [price, level] : levels_[side]) {
+    for (const auto& [price, level] : getLevelsL3(side)) {
         count += level.orderCount();
     }
     return count;
 }
 
-SLICK_OB_INLINE bool OrderBookL3::isEmpty(Side side) const noexcept {
-    SLICK_ASSERT(side < SideCount);
-    return levels_[side].empty();
+template<typename Traits>
+SLICK_OB_INLINE bool BasicOrderBookL3<Traits>::isEmpty(Side side) const noexcept {
+    return visitLevels(side, [](const auto& level_map) { return level_map.empty(); });
 }
 
-SLICK_OB_INLINE bool OrderBookL3::isEmpty() const noexcept {
-    return levels_[Side::Buy].empty() && levels_[Side::Sell].empty();
+template<typename Traits>
+SLICK_OB_INLINE bool BasicOrderBookL3<Traits>::isEmpty() const noexcept {
+    return bids_.empty() && asks_.empty();
 }
 
-SLICK_OB_INLINE void OrderBookL3::clearSide(Side side) noexcept {
-    SLICK_ASSERT(side < SideCount);
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::clearSide(Side side) noexcept {
+    visitLevels(side, [this](auto& level_map) { clearLevels(level_map); });
+    l2_cache_[side].invalidate();
+    if (analytics_.depth() > 0) {
+        updateAnalytics(0, kAllSides);
+    }
+}
 
+template<typename Traits>
+template<typename LevelMap>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::clearLevels(LevelMap& level_map) noexcept {
     // Delete all orders on this side
-    auto& level_map = levels_[side];
-    for (auto& [price, level] : level_map) {
+    for (auto&& [price, level] : level_map) {
         for (auto it = level.orders.begin(); it != level.orders.end(); ) {
             auto* order = &(*it);
             ++it;  // Advance before unlinking/destroying.
@@ -529,70 +946,71 @@ SLICK_OB_INLINE void OrderBookL3::clearSide(Side side) noexcept {
     level_map.clear();
 }
 
-SLICK_OB_INLINE void OrderBookL3::clear() noexcept {
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::clear() noexcept {
     clearSide(Side::Buy);
     clearSide(Side::Sell);
+    stops_.clear();
+    has_traded_ = false;
 }
 
-SLICK_OB_INLINE std::tuple<detail::PriceLevelL3*, uint16_t, bool> OrderBookL3::getOrCreateLevel(Side side, Price price) {
-    SLICK_ASSERT(side < SideCount);
-
-    auto& level_map = levels_[side];
-    auto it = level_map.find(price);
-
-    if (it != level_map.end()) {
-        uint16_t index = static_cast<uint16_t>(std::distance(level_map.begin(), it));
-        return {&it->second, index, false};
+template<typename Traits>
+SLICK_OB_INLINE auto BasicOrderBookL3<Traits>::getOrCreateLevel(Side side, Price price)
+    -> std::tuple<PriceLevel*, uint16_t, bool> {
+    const std::size_t limit = updateLevelIndexLimit();
+    auto result = visitLevels(side, [price, limit](auto& level_map) -> std::tuple<PriceLevel*, uint16_t, bool> {
+        // Find existing level or create a new one at its sorted position
+        auto [it, inserted] = level_map.findOrInsert(price);
+        uint16_t index = levelIndexOf(level_map, it, limit);
+        return {&it->second, index, inserted};
+    });
+    if (std::get<2>(result)) {
+        metrics_.count(BookCounter::LevelInserted);
     }
-
-    // Create new level
-    auto [new_it, inserted] = level_map.emplace(price, detail::PriceLevelL3{price});
-    SLICK_ASSERT(inserted);
-    uint16_t index = static_cast<uint16_t>(std::distance(level_map.begin(), new_it));
-    return {&new_it->second, index, true};
+    return result;
 }
 
-SLICK_OB_INLINE bool OrderBookL3::removeLevelIfEmpty(Side side, Price price) noexcept {
-    SLICK_ASSERT(side < SideCount);
+template<typename Traits>
+SLICK_OB_INLINE bool BasicOrderBookL3<Traits>::removeLevelIfEmpty(Side side, Price price) noexcept {
+    const bool removed = visitLevels(side, [price](auto& level_map) {
+        auto it = level_map.find(price);
 
-    auto& level_map = levels_[side];
-    auto it = level_map.find(price);
-
-    if (it != level_map.end() && it->second.isEmpty()) {
-        level_map.erase(it);
-        return true;
+        if (it != level_map.end() && it->second.isEmpty()) {
+            level_map.erase(it);
+            return true;
+        }
+        return false;
+    });
+    if (removed) {
+        metrics_.count(BookCounter::LevelErased);
     }
-    return false;
+    return removed;
 }
 
-SLICK_OB_INLINE uint16_t OrderBookL3::calculateLevelIndex(Side side, Price price) const noexcept {
-    SLICK_ASSERT(side < SideCount);
-    const auto& level_map = levels_[side];
-
-    // Find the price level using lower_bound
-    auto it = level_map.lower_bound(price);
-
-    // If exact match, calculate its index
-    if (it != level_map.end() && it->first == price) {
-        return static_cast<uint16_t>(std::distance(level_map.begin(), it));
-    }
-
-    // Price not found - return the index where it would be inserted
-    return static_cast<uint16_t>(std::distance(level_map.begin(), it));
+template<typename Traits>
+SLICK_OB_INLINE uint16_t BasicOrderBookL3<Traits>::calculateLevelIndex(Side side, Price price) const noexcept {
+    return visitLevels(side, [price](const auto& level_map) {
+        // Index of the matching level, or the index where it would be inserted if not found
+        return static_cast<uint16_t>(level_map.lowerBoundIndex(price));
+    });
 }
 
-SLICK_OB_INLINE void OrderBookL3::notifyOrderUpdate(
-    const detail::Order* order,
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::notifyOrderUpdate(
+    const Order* order,
     Quantity old_quantity,
     Price old_price,
     Timestamp timestamp,
     uint16_t level_index,
     uint8_t change_flags,
     uint64_t seq_num) const {
+    if (!observers_.wantsOrderUpdates()) {
+        return;
+    }
     OrderUpdate update{
         symbol_,
         order->order_id,
-        order->side,
+        detail::sideOf(*order),
         order->price,
         order->quantity,
         old_price,
@@ -606,16 +1024,20 @@ SLICK_OB_INLINE void OrderBookL3::notifyOrderUpdate(
     observers_.notifyOrderUpdate(update);
 }
 
-SLICK_OB_INLINE void OrderBookL3::notifyOrderDelete(
-    const detail::Order* order,
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::notifyOrderDelete(
+    const Order* order,
     Timestamp timestamp,
     uint16_t level_index,
     uint8_t change_flags,
     uint64_t seq_num) const {
+    if (!observers_.wantsOrderUpdates()) {
+        return;
+    }
     OrderUpdate update{
         symbol_,
         order->order_id,
-        order->side,
+        detail::sideOf(*order),
         order->price,
         0,  // quantity = 0 means delete
         order->price,
@@ -629,13 +1051,17 @@ SLICK_OB_INLINE void OrderBookL3::notifyOrderDelete(
     observers_.notifyOrderUpdate(update);
 }
 
-SLICK_OB_INLINE void OrderBookL3::notifyTrade(
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::notifyTrade(
     OrderId passive_order_id,
     OrderId aggressive_order_id,
     Side aggressor_side,
     Price price,
     Quantity quantity,
     Timestamp timestamp) const {
+    if (!observers_.wantsTrades()) {
+        return;
+    }
     Trade trade{
         symbol_,
         price,
@@ -648,34 +1074,40 @@ SLICK_OB_INLINE void OrderBookL3::notifyTrade(
     observers_.notifyTrade(trade);
 }
 
-SLICK_OB_INLINE void OrderBookL3::notifyPriceLevelUpdate(
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::notifyPriceLevelUpdate(
     Timestamp timestamp,
     Side side,
     Price price,
-    Quantity total_quantity,
-    size_t order_count,
+    const PriceLevel* level,
     uint16_t level_index,
     uint8_t change_flags,
-    uint64_t seq_num) const {
+    uint64_t seq_num) {
+    if (!observers_.wantsPriceLevelUpdates()) {
+        return;
+    }
+    if (conflate_level_updates_ && !level_batch_.active() && !(change_flags & LastInBatch)) {
+        // First level touched by a conflated batch (a batch of one is notified directly)
+        level_batch_.begin(16);
+    }
+    if (level_batch_.active()) {
+        // A level created by this operation did not exist before it; a removed one did
+        const bool existed_before = !(change_flags & PriceChanged) || level == nullptr;
+        level_batch_.record(side, price, existed_before, timestamp, seq_num);
+        return;
+    }
     if (interested_num_levels_ > 0 && level_index >= interested_num_levels_) {
         // Skip notifications for levels beyond the interested range
         return;
     }
-    PriceLevelUpdate update{
-        timestamp,
-        symbol_,
-        side,
-        price,
-        total_quantity,
-        static_cast<uint16_t>(order_count),
-        level_index,
-        change_flags,
-        seq_num
-    };
+    // Summarized only now, once the update is known to reach an observer
+    const LevelSummary summary = level != nullptr ? level->summary() : LevelSummary{};
+    PriceLevelUpdate update{timestamp, symbol_, side, price, summary, level_index, change_flags, seq_num};
     observers_.notifyPriceLevelUpdate(update);
 }
 
-SLICK_OB_INLINE void OrderBookL3::notifyTopOfBookIfChanged(Timestamp timestamp) {
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::notifyTopOfBookIfChanged(Timestamp timestamp) {
     // Compute current top-of-book
     const auto* bid = getBestBid();
     const auto* ask = getBestAsk();
@@ -708,18 +1140,70 @@ SLICK_OB_INLINE void OrderBookL3::notifyTopOfBookIfChanged(Timestamp timestamp)
     }
 }
 
-SLICK_OB_INLINE void OrderBookL3::emitSnapshot(Timestamp timestamp) {
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::endBatch(Timestamp timestamp) {
+    if (applying_batch_) {
+        return;
+    }
+    if (level_batch_.active()) {
+        flushLevelBatch();
+    }
+    if (change_starting_index_ < depth_publisher_.depth()) {
+        publishDepth(timestamp);
+    }
+    if (change_starting_index_ < analytics_.depth()) {
+        updateAnalytics(change_starting_index_, changed_sides_);
+    }
+    if (change_starting_index_ == 0) {
+        notifyTopOfBookIfChanged(timestamp);
+    }
+    change_starting_index_ = INVALID_INDEX;
+    changed_sides_ = 0;
+}
+
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::publishDepth(Timestamp timestamp) noexcept {
+    auto to_level = [](const auto& entry) { return aggregateLevel(entry); };
+    depth_publisher_.publish(bids_, asks_, to_level, timestamp, last_seq_num_);
+}
+
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::updateAnalytics(std::size_t from_level, uint8_t sides) noexcept {
+    if (sides & (1 << Side::Buy)) {
+        analytics_.update(Side::Buy, bids_, [](const auto& entry) { return aggregateLevel(entry); }, from_level);
+    }
+    if (sides & (1 << Side::Sell)) {
+        analytics_.update(Side::Sell, asks_, [](const auto& entry) { return aggregateLevel(entry); }, from_level);
+    }
+}
+
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::setAnalyticsDepth(std::size_t depth) {
+    analytics_ = BookAnalytics(std::min<std::size_t>(depth, INVALID_INDEX));
+    updateAnalytics(0, kAllSides);
+}
+
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::setPublishedDepth(std::size_t depth) {
+    depth_publisher_ = detail::DepthPublisher(std::min<std::size_t>(depth, INVALID_INDEX));
+    if (depth > 0) {
+        publishDepth(cached_tob_.timestamp);
+    }
+}
+
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::emitSnapshot(Timestamp timestamp) {
     observers_.notifySnapshotBegin(symbol_, last_seq_num_, timestamp);
 
     // Bids: highest price first (best = index 0)
     uint16_t level_idx = 0;
-    for (auto it = levels_[Side::Buy].begin(); it != levels_[Side::Buy].end(); ++it, ++level_idx) {
+    for (auto it = bids_.begin(); it != bids_.end(); ++it, ++level_idx) {
         const auto& level = it->second;
         for (const auto& order : level.orders) {
             OrderUpdate update{
                 symbol_,
                 order.order_id,
-                order.side,
+                detail::sideOf(order),
                 order.price,
                 order.quantity,
                 order.price,
@@ -735,13 +1219,13 @@ SLICK_OB_INLINE void OrderBookL3::emitSnapshot(Timestamp timestamp) {
 
     // Asks: lowest price first (best = index 0)
     level_idx = 0;
-    for (auto it = levels_[Side::Sell].begin(); it != levels_[Side::Sell].end(); ++it, ++level_idx) {
+    for (auto it = asks_.begin(); it != asks_.end(); ++it, ++level_idx) {
         const auto& level = it->second;
         for (const auto& order : level.orders) {
             OrderUpdate update{
                 symbol_,
                 order.order_id,
-                order.side,
+                detail::sideOf(order),
                 order.price,
                 order.quantity,
                 order.price,
@@ -758,4 +1242,94 @@ SLICK_OB_INLINE void OrderBookL3::emitSnapshot(Timestamp timestamp) {
     observers_.notifySnapshotEnd(symbol_, last_seq_num_, timestamp);
 }
 
+template<typename Traits>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::loadSnapshot(std::span<const SnapshotOrder> orders,
+                                                           uint64_t seq_num, Timestamp timestamp) {
+    // Exchange snapshots carry resting orders only: keep pending stops and the last trade price
+    clearSide(Side::Buy);
+    clearSide(Side::Sell);
+    order_pool_.reserve(orders.size());
+    order_map_.reserve(orders.size());
+
+    // Sort pointers rather than copies: bids first, then best price first, then queue priority.
+    // Stable sort keeps equal priorities in input (FIFO) order, like insertOrder
+    std::vector<const SnapshotOrder*> sorted;
+    sorted.reserve(orders.size());
+    for (const SnapshotOrder& order : orders) {
+        if (order.quantity > 0) {
+            sorted.push_back(&order);
+        }
+    }
+    auto priority_of = [](const SnapshotOrder* order) {
+        return order->priority == 0 ? order->timestamp : order->priority;
+    };
+    auto book_order = [&](const SnapshotOrder* a, const SnapshotOrder* b) {
+        if (a->side != b->side) {
+            return a->side == Side::Buy;
+        }
+        if (a->price != b->price) {
+            return a->side == Side::Buy ? a->price > b->price : a->price < b->price;
+        }
+        return priority_of(a) < priority_of(b);
+    };
+    // Snapshots taken from a book (e.g. checkpoints) are already in book order
+    if (!std::is_sorted(sorted.begin(), sorted.end(), book_order)) {
+        std::stable_sort(sorted.begin(), sorted.end(), book_order);
+    }
+
+    const auto first_ask = std::find_if(sorted.begin(), sorted.end(),
+        [](const SnapshotOrder* order) { return order->side != Side::Buy; });
+    const auto bid_count = static_cast<std::size_t>(first_ask - sorted.begin());
+    const std::span<const SnapshotOrder* const> all(sorted);
+    loadLevels<Side::Buy>(bids_, all.first(bid_count));
+    loadLevels<Side::Sell>(asks_, all.subspan(bid_count));
+
+    last_seq_num_ = seq_num;
+    change_starting_index_ = INVALID_INDEX;
+    changed_sides_ = 0;
+
+    emitSnapshot(timestamp);
+    if (depth_publisher_.depth() > 0) {
+        publishDepth(timestamp);
+    }
+    if (analytics_.depth() > 0) {
+        updateAnalytics(0, kAllSides);
+    }
+    notifyTopOfBookIfChanged(timestamp);
+}
+
+template<typename Traits>
+template<Side S>
+SLICK_OB_INLINE void BasicOrderBookL3<Traits>::loadLevels(PriceLevelMap<S>& level_map,
+                                                         std::span<const SnapshotOrder* const> orders) {
+    std::size_t level_count = 0;
+    for (std::size_t i = 0; i < orders.size(); ++i) {
+        level_count += (i == 0 || orders[i]->price != orders[i - 1]->price) ? 1 : 0;
+    }
+    level_map.reserve(level_count);
+
+    PriceLevel* level = nullptr;
+    for (const SnapshotOrder* snapshot : orders) {
+        if (SLICK_UNLIKELY((level == nullptr || level->price != snapshot->price) && !level_map.accepts(snapshot->price))) {
+            continue;
+        }
+        const uint64_t priority = snapshot->priority == 0 ? snapshot->timestamp : snapshot->priority;
+        Order* order = order_pool_.construct(snapshot->order_id, snapshot->price, snapshot->quantity,
+                                                     snapshot->side, snapshot->timestamp, priority);
+        if (SLICK_UNLIKELY(order == nullptr)) {
+            continue;
+        }
+        if (SLICK_UNLIKELY(!order_map_.insert(order))) {
+            order_pool_.destroy(order);  // Duplicate order id
+            continue;
+        }
+
+        // Levels arrive best first, so each new level is appended at the back
+        if (level == nullptr || level->price != order->price) {
+            level = &level_map.findOrInsert(order->price).first->second;
+        }
+        level->appendOrder(order);
+    }
+}
+
 SLICK_NAMESPACE_END
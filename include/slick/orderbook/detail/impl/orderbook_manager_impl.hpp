@@ -5,8 +5,8 @@
 
 SLICK_NAMESPACE_BEGIN
 
-template<typename OrderBookT>
-OrderBookManager<OrderBookT>::OrderBookManager(std::size_t initial_symbol_capacity)
+template<typename OrderBookT, SymbolLookup Lookup>
+OrderBookManager<OrderBookT, Lookup>::OrderBookManager(std::size_t initial_symbol_capacity)
     : symbol_map_() {
     // Reserve capacity to avoid rehashing during initial symbol registration
     // Note: reserve() is not available in std::map, only in vector-based containers
@@ -14,12 +14,26 @@ OrderBookManager<OrderBookT>::OrderBookManager(std::size_t initial_symbol_capaci
     if constexpr (requires { symbol_map_.reserve(initial_symbol_capacity); }) {
         symbol_map_.reserve(initial_symbol_capacity);
     }
+    if constexpr (Lookup == SymbolLookup::DirectTable) {
+        // Value-initialized: every slot starts as nullptr
+        direct_table_ = std::make_unique<BookSlot[]>(kTableSize);
+    }
+}
+
+template<typename OrderBookT, SymbolLookup Lookup>
+OrderBookT* OrderBookManager<OrderBookT, Lookup>::getOrCreateOrderBook(SymbolId symbol) {
+    return getOrCreateOrderBook(symbol, MemoryConfig{});
 }
 
-template<typename OrderBookT>
-OrderBookT* OrderBookManager<OrderBookT>::getOrCreateOrderBook(SymbolId symbol) {
-    // First, try read-only access (shared lock) - common case
-    {
+template<typename OrderBookT, SymbolLookup Lookup>
+OrderBookT* OrderBookManager<OrderBookT, Lookup>::getOrCreateOrderBook(SymbolId symbol, const MemoryConfig& memory) {
+    if constexpr (Lookup == SymbolLookup::DirectTable) {
+        // Lock-free hit path
+        if (OrderBookT* book = loadBook(symbol)) [[likely]] {
+            return book;
+        }
+    } else {
+        // First, try read-only access (shared lock) - common case
         std::shared_lock lock(mutex_);
         auto it = symbol_map_.find(symbol);
         if (it != symbol_map_.end()) [[likely]] {
@@ -37,41 +51,86 @@ OrderBookT* OrderBookManager<OrderBookT>::getOrCreateOrderBook(SymbolId symbol)
     }
 
     // Create new orderbook
-    auto orderbook = std::make_unique<OrderBookT>(symbol);
+    OrderBookPtr orderbook;
+    if constexpr (std::constructible_from<OrderBookT, SymbolId, const MemoryConfig&>) {
+        orderbook = std::make_unique<OrderBookT>(symbol, memory);
+    } else {
+        (void)memory;
+        orderbook = std::make_unique<OrderBookT>(symbol);
+    }
     OrderBookT* ptr = orderbook.get();
     symbol_map_.emplace(symbol, std::move(orderbook));
 
+    if constexpr (Lookup == SymbolLookup::DirectTable) {
+        // Publish after construction: readers that see the pointer see a fully built book
+        direct_table_[symbol].store(ptr, std::memory_order_release);
+    }
+
     return ptr;
 }
 
-template<typename OrderBookT>
-const OrderBookT* OrderBookManager<OrderBookT>::getOrderBook(SymbolId symbol) const {
-    std::shared_lock lock(mutex_);
-    auto it = symbol_map_.find(symbol);
-    return (it != symbol_map_.end()) ? it->second.get() : nullptr;
+template<typename OrderBookT, SymbolLookup Lookup>
+const OrderBookT* OrderBookManager<OrderBookT, Lookup>::getOrderBook(SymbolId symbol) const {
+    if constexpr (Lookup == SymbolLookup::DirectTable) {
+        return loadBook(symbol);
+    } else {
+        std::shared_lock lock(mutex_);
+        auto it = symbol_map_.find(symbol);
+        return (it != symbol_map_.end()) ? it->second.get() : nullptr;
+    }
 }
 
-template<typename OrderBookT>
-OrderBookT* OrderBookManager<OrderBookT>::getOrderBook(SymbolId symbol) {
-    std::shared_lock lock(mutex_);
-    auto it = symbol_map_.find(symbol);
-    return (it != symbol_map_.end()) ? it->second.get() : nullptr;
+template<typename OrderBookT, SymbolLookup Lookup>
+OrderBookT* OrderBookManager<OrderBookT, Lookup>::getOrderBook(SymbolId symbol) {
+    if constexpr (Lookup == SymbolLookup::DirectTable) {
+        return loadBook(symbol);
+    } else {
+        std::shared_lock lock(mutex_);
+        auto it = symbol_map_.find(symbol);
+        return (it != symbol_map_.end()) ? it->second.get() : nullptr;
+    }
 }
 
-template<typename OrderBookT>
-bool OrderBookManager<OrderBookT>::hasSymbol(SymbolId symbol) const {
-    std::shared_lock lock(mutex_);
-    return symbol_map_.contains(symbol);
+template<typename OrderBookT, SymbolLookup Lookup>
+bool OrderBookManager<OrderBookT, Lookup>::hasSymbol(SymbolId symbol) const {
+    if constexpr (Lookup == SymbolLookup::DirectTable) {
+        return loadBook(symbol) != nullptr;
+    } else {
+        std::shared_lock lock(mutex_);
+        return symbol_map_.contains(symbol);
+    }
 }
 
-template<typename OrderBookT>
-bool OrderBookManager<OrderBookT>::removeOrderBook(SymbolId symbol) {
+template<typename OrderBookT, SymbolLookup Lookup>
+bool OrderBookManager<OrderBookT, Lookup>::removeOrderBook(SymbolId symbol) {
     std::unique_lock lock(mutex_);
-    return symbol_map_.erase(symbol) > 0;
+    if constexpr (Lookup == SymbolLookup::DirectTable) {
+        auto it = symbol_map_.find(symbol);
+        if (it == symbol_map_.end()) {
+            return false;
+        }
+        // Unpublish first; lock-free readers may still hold the pointer, so retire instead of destroying
+        direct_table_[symbol].store(nullptr, std::memory_order_release);
+        retired_books_.push_back(std::move(it->second));
+        symbol_map_.erase(it);
+        return true;
+    } else {
+#if SLICK_ORDERBOOK_METRICS
+        auto it = symbol_map_.find(symbol);
+        if (it == symbol_map_.end()) {
+            return false;
+        }
+        keepMetrics(*it->second);
+        symbol_map_.erase(it);
+        return true;
+#else
+        return symbol_map_.erase(symbol) > 0;
+#endif
+    }
 }
 
-template<typename OrderBookT>
-std::vector<SymbolId> OrderBookManager<OrderBookT>::getSymbols() const {
+template<typename OrderBookT, SymbolLookup Lookup>
+std::vector<SymbolId> OrderBookManager<OrderBookT, Lookup>::getSymbols() const {
     std::shared_lock lock(mutex_);
     std::vector<SymbolId> symbols;
     symbols.reserve(symbol_map_.size());
@@ -83,25 +142,87 @@ std::vector<SymbolId> OrderBookManager<OrderBookT>::getSymbols() const {
     return symbols;
 }
 
-template<typename OrderBookT>
-std::size_t OrderBookManager<OrderBookT>::symbolCount() const {
+template<typename OrderBookT, SymbolLookup Lookup>
+std::size_t OrderBookManager<OrderBookT, Lookup>::symbolCount() const {
     std::shared_lock lock(mutex_);
     return symbol_map_.size();
 }
 
-template<typename OrderBookT>
-void OrderBookManager<OrderBookT>::clear() {
+template<typename OrderBookT, SymbolLookup Lookup>
+void OrderBookManager<OrderBookT, Lookup>::clear() {
     std::unique_lock lock(mutex_);
+    if constexpr (Lookup == SymbolLookup::DirectTable) {
+        for (auto& [symbol_id, book] : symbol_map_) {
+            direct_table_[symbol_id].store(nullptr, std::memory_order_release);
+            retired_books_.push_back(std::move(book));
+        }
+    }
+#if SLICK_ORDERBOOK_METRICS
+    if constexpr (Lookup != SymbolLookup::DirectTable) {
+        for (const auto& [symbol_id, book] : symbol_map_) {
+            keepMetrics(*book);
+        }
+    }
+#endif
     symbol_map_.clear();
 }
 
-template<typename OrderBookT>
-void OrderBookManager<OrderBookT>::reserve(std::size_t capacity) {
+template<typename OrderBookT, SymbolLookup Lookup>
+void OrderBookManager<OrderBookT, Lookup>::reserve(std::size_t capacity) {
     // No lock needed - should be called before concurrent access
     if constexpr (requires { symbol_map_.reserve(capacity); }) {
         symbol_map_.reserve(capacity);
     }
 }
 
+template<typename OrderBookT, SymbolLookup Lookup>
+std::size_t OrderBookManager<OrderBookT, Lookup>::reclaimRetired()
+    requires (Lookup == SymbolLookup::DirectTable) {
+    std::unique_lock lock(mutex_);
+    const std::size_t count = retired_books_.size();
+#if SLICK_ORDERBOOK_METRICS
+    for (const auto& book : retired_books_) {
+        keepMetrics(*book);
+    }
+#endif
+    retired_books_.clear();
+    return count;
+}
+
+template<typename OrderBookT, SymbolLookup Lookup>
+std::size_t OrderBookManager<OrderBookT, Lookup>::retiredCount() const
+    requires (Lookup == SymbolLookup::DirectTable) {
+    std::shared_lock lock(mutex_);
+    return retired_books_.size();
+}
+
+template<typename OrderBookT, SymbolLookup Lookup>
+std::vector<SymbolMemoryUsage> OrderBookManager<OrderBookT, Lookup>::memoryUsage() const
+    requires requires(const OrderBookT& book) { book.memoryUsage(); } {
+    std::shared_lock lock(mutex_);
+    std::vector<SymbolMemoryUsage> usage;
+    usage.reserve(symbol_map_.size());
+    for (const auto& [symbol_id, book] : symbol_map_) {
+        usage.push_back({symbol_id, book->memoryUsage()});
+    }
+    return usage;
+}
+
+#if SLICK_ORDERBOOK_METRICS
+template<typename OrderBookT, SymbolLookup Lookup>
+BookMetricsSnapshot OrderBookManager<OrderBookT, Lookup>::metricsSnapshot() const
+    requires requires(const OrderBookT& book) { book.metrics(); } {
+    std::shared_lock lock(mutex_);
+    BookMetricsSnapshot total = removed_metrics_;
+    for (const auto& [symbol_id, book] : symbol_map_) {
+        total.merge(book->metrics().snapshot());
+    }
+    for (const auto& book : retired_books_) {
+        total.merge(book->metrics().snapshot());
+    }
+    return total;
+}
+#endif
+
 
 SLICK_NAMESPACE_END
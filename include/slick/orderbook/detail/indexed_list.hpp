@@ -0,0 +1,286 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/detail/indexed_pool.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Intrusive doubly-linked list with 32-bit index links
+///
+/// Same interface as IntrusiveList, for elements allocated from an IndexedObjectPool.
+/// Elements link to their neighbours by pool index (`prev` and `next` members, which may be
+/// bit-fields), halving the link overhead of IntrusiveList; the list itself keeps head and tail
+/// pointers. Following a link costs a chunk table lookup (see IndexedObjectPool::resolve()).
+///
+/// @tparam T Element type (must have `prev` and `next` pool index members)
+/// @tparam Pool Pool the elements are allocated from
+template<typename T, typename Pool = IndexedObjectPool<T>>
+class IndexedList {
+public:
+    using value_type = T;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+    using size_type = std::size_t;
+
+    /// Get next element, or nullptr at the tail
+    [[nodiscard]] static T* nextOf(const T* node) noexcept {
+        const uint32_t next = node->next;
+        return next == kNullPoolIndex ? nullptr : Pool::resolve(node, next);
+    }
+
+    /// Get previous element, or nullptr at the head
+    [[nodiscard]] static T* prevOf(const T* node) noexcept {
+        const uint32_t prev = node->prev;
+        return prev == kNullPoolIndex ? nullptr : Pool::resolve(node, prev);
+    }
+
+    /// Bidirectional iterator (stores the list's tail to handle decrement from end())
+    template<bool Const>
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        constexpr Iterator() noexcept : current_(nullptr), tail_(nullptr) {}
+        constexpr Iterator(T* node, T* tail) noexcept : current_(node), tail_(tail) {}
+
+        /// Allow iterator -> const_iterator conversion
+        constexpr operator Iterator<true>() const noexcept requires (!Const) {
+            return Iterator<true>(current_, tail_);
+        }
+
+        [[nodiscard]] constexpr reference operator*() const noexcept { return *current_; }
+        [[nodiscard]] constexpr pointer operator->() const noexcept { return current_; }
+
+        Iterator& operator++() noexcept {
+            current_ = nextOf(current_);
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        Iterator& operator--() noexcept {
+            current_ = current_ == nullptr ? tail_ : prevOf(current_);
+            return *this;
+        }
+
+        Iterator operator--(int) noexcept {
+            Iterator tmp = *this;
+            --(*this);
+            return tmp;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const Iterator& other) const noexcept {
+            return current_ == other.current_;
+        }
+
+    private:
+        T* current_;
+        T* tail_;  // Needed to handle decrement from end() (nullptr)
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    /// Constructor
+    constexpr IndexedList() noexcept : head_(nullptr), tail_(nullptr), size_(0) {}
+
+    /// Destructor - does not delete elements (intrusive design)
+    ~IndexedList() noexcept = default;
+
+    // Non-copyable (elements can only be in one list)
+    IndexedList(const IndexedList&) = delete;
+    IndexedList& operator=(const IndexedList&) = delete;
+
+    // Movable
+    constexpr IndexedList(IndexedList&& other) noexcept
+        : head_(other.head_), tail_(other.tail_), size_(other.size_) {
+        other.head_ = nullptr;
+        other.tail_ = nullptr;
+        other.size_ = 0;
+    }
+
+    constexpr IndexedList& operator=(IndexedList&& other) noexcept {
+        if (this != &other) {
+            head_ = other.head_;
+            tail_ = other.tail_;
+            size_ = other.size_;
+            other.head_ = nullptr;
+            other.tail_ = nullptr;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    /// Check if list is empty
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    /// Get number of elements
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return size_;
+    }
+
+    /// Get front element
+    [[nodiscard]] constexpr pointer front() noexcept { return head_; }
+    [[nodiscard]] constexpr const_pointer front() const noexcept { return head_; }
+
+    /// Get back element
+    [[nodiscard]] constexpr pointer back() noexcept { return tail_; }
+    [[nodiscard]] constexpr const_pointer back() const noexcept { return tail_; }
+
+    /// Add element to front
+    void push_front(T* node) noexcept {
+        node->prev = kNullPoolIndex;
+        if (head_ != nullptr) {
+            node->next = Pool::indexOf(head_);
+            head_->prev = Pool::indexOf(node);
+        } else {
+            node->next = kNullPoolIndex;
+            tail_ = node;
+        }
+        head_ = node;
+        ++size_;
+    }
+
+    /// Add element to back (FIFO time priority)
+    void push_back(T* node) noexcept {
+        node->next = kNullPoolIndex;
+        if (tail_ != nullptr) {
+            node->prev = Pool::indexOf(tail_);
+            tail_->next = Pool::indexOf(node);
+        } else {
+            node->prev = kNullPoolIndex;
+            head_ = node;
+        }
+        tail_ = node;
+        ++size_;
+    }
+
+    /// Remove front element
+    pointer pop_front() noexcept {
+        T* node = head_;
+        erase(node);
+        return node;
+    }
+
+    /// Remove back element
+    pointer pop_back() noexcept {
+        T* node = tail_;
+        erase(node);
+        return node;
+    }
+
+    /// Remove specific element from list
+    /// O(1) operation - no search required
+    void erase(T* node) noexcept {
+        if (node == nullptr) {
+            return;
+        }
+
+        T* prev = prevOf(node);
+        T* next = nextOf(node);
+
+        if (prev != nullptr) {
+            prev->next = node->next;
+        } else {
+            head_ = next;
+        }
+
+        if (next != nullptr) {
+            next->prev = node->prev;
+        } else {
+            tail_ = prev;
+        }
+
+        node->next = kNullPoolIndex;
+        node->prev = kNullPoolIndex;
+        --size_;
+    }
+
+    /// Insert element before given position
+    /// O(1) operation
+    void insert_before(T* pos, T* node) noexcept {
+        if (pos == nullptr) {
+            push_back(node);
+            return;
+        }
+        if (pos == head_) {
+            push_front(node);
+            return;
+        }
+
+        const uint32_t node_index = Pool::indexOf(node);
+        node->prev = pos->prev;
+        node->next = Pool::indexOf(pos);
+        Pool::resolve(pos, pos->prev)->next = node_index;
+        pos->prev = node_index;
+        ++size_;
+    }
+
+    /// Insert element after given position
+    /// O(1) operation
+    void insert_after(T* pos, T* node) noexcept {
+        if (pos == nullptr) {
+            push_front(node);
+            return;
+        }
+        if (pos == tail_) {
+            push_back(node);
+            return;
+        }
+
+        const uint32_t node_index = Pool::indexOf(node);
+        node->next = pos->next;
+        node->prev = Pool::indexOf(pos);
+        Pool::resolve(pos, pos->next)->prev = node_index;
+        pos->next = node_index;
+        ++size_;
+    }
+
+    /// Clear list (does not delete elements)
+    void clear() noexcept {
+        T* current = head_;
+        while (current != nullptr) {
+            T* next = nextOf(current);
+            current->next = kNullPoolIndex;
+            current->prev = kNullPoolIndex;
+            current = next;
+        }
+        head_ = nullptr;
+        tail_ = nullptr;
+        size_ = 0;
+    }
+
+    /// Iterators
+    [[nodiscard]] constexpr iterator begin() noexcept { return iterator(head_, tail_); }
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return const_iterator(head_, tail_); }
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return const_iterator(head_, tail_); }
+    [[nodiscard]] constexpr iterator end() noexcept { return iterator(nullptr, tail_); }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return const_iterator(nullptr, tail_); }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept { return const_iterator(nullptr, tail_); }
+
+private:
+    T* head_;
+    T* tail_;
+    size_type size_;
+};
+
+SLICK_DETAIL_NAMESPACE_END
@@ -0,0 +1,377 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/detail/page_allocator.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Null value of a 31-bit pool index (see IndexedObjectPool)
+inline constexpr uint32_t kNullPoolIndex = (uint32_t{1} << 31) - 1;
+
+/// Object pool addressing its objects by 31-bit index as well as by pointer
+///
+/// Objects live in 64 KiB chunks aligned to their size. Each chunk starts with a header naming the
+/// pool's chunk table and the chunk's number, so both directions are O(1) from any pooled object:
+/// - indexOf(object): mask the address down to its chunk header, (chunk << kSlotBits) | slot
+/// - resolve(object, index): same chunk as object, or look the chunk up in the table named by its header
+///
+/// This lets index-linked structures (IndexedList) keep 4-byte links without holding a pool pointer.
+/// Chunks are carved from slabs taken from a PageAllocator, so MemoryConfig placement (huge pages,
+/// NUMA binding, prefaulting) applies as it does for ObjectPool. Same interface as ObjectPool.
+///
+/// @tparam T Object type (at least pointer sized, alignment at most 64)
+template<typename T>
+class IndexedObjectPool {
+public:
+    static_assert(std::is_nothrow_destructible_v<T>,
+                  "IndexedObjectPool requires nothrow destructible types");
+    static_assert(alignof(T) <= SLICK_CACHE_LINE_SIZE,
+                  "IndexedObjectPool supports alignment up to a cache line");
+
+    static constexpr std::size_t kChunkBytes = 64 * 1024;
+    static constexpr std::size_t kFirstSlotOffset = SLICK_CACHE_LINE_SIZE;  // Chunk header line
+    static constexpr std::size_t kSlotsPerChunk = (kChunkBytes - kFirstSlotOffset) / sizeof(T);
+    static constexpr uint32_t kSlotBits = static_cast<uint32_t>(std::bit_width(kSlotsPerChunk - 1));
+    static constexpr uint32_t kSlotMask = (uint32_t{1} << kSlotBits) - 1;
+    static constexpr std::size_t kMaxChunks = kNullPoolIndex >> kSlotBits;  // Keeps every index below kNullPoolIndex
+
+    /// Constructor - pre-allocates initial capacity
+    /// @param initial_capacity Number of objects to pre-allocate
+    /// @param memory Placement of pool slabs (default: heap)
+    explicit IndexedObjectPool(std::size_t initial_capacity = 1024, const MemoryConfig& memory = {})
+        : allocator_(memory) {
+        if (initial_capacity > 0) {
+            reserve(initial_capacity);
+        }
+    }
+
+    /// Destructor - frees all slabs
+    ~IndexedObjectPool() noexcept {
+        releaseSlabs();
+    }
+
+    // Non-copyable
+    IndexedObjectPool(const IndexedObjectPool&) = delete;
+    IndexedObjectPool& operator=(const IndexedObjectPool&) = delete;
+
+    // Movable (chunk headers point at the chunk table's storage, which moves with the pool)
+    IndexedObjectPool(IndexedObjectPool&& other) noexcept
+        : allocator_(other.allocator_),
+          slabs_(std::move(other.slabs_)),
+          chunks_(std::move(other.chunks_)),
+          capacity_(std::exchange(other.capacity_, 0)),
+          size_(std::exchange(other.size_, 0)),
+          free_list_(std::exchange(other.free_list_, nullptr)) {
+    }
+
+    IndexedObjectPool& operator=(IndexedObjectPool&& other) noexcept {
+        if (this != &other) {
+            releaseSlabs();
+            allocator_ = other.allocator_;
+            slabs_ = std::move(other.slabs_);
+            chunks_ = std::move(other.chunks_);
+            capacity_ = std::exchange(other.capacity_, 0);
+            size_ = std::exchange(other.size_, 0);
+            free_list_ = std::exchange(other.free_list_, nullptr);
+        }
+        return *this;
+    }
+
+    /// Allocate an object (does not call constructor)
+    /// @return Pointer to allocated memory, or nullptr if allocation fails
+    [[nodiscard]] T* allocate() {
+        if (free_list_ == nullptr && !grow()) {
+            return nullptr;
+        }
+        FreeNode* node = free_list_;
+        free_list_ = node->next;
+        ++size_;
+        return reinterpret_cast<T*>(node);
+    }
+
+    /// Construct an object in-place with arguments
+    /// @param args Constructor arguments
+    /// @return Pointer to constructed object, or nullptr if allocation fails
+    template<typename... Args>
+    [[nodiscard]] T* construct(Args&&... args) {
+        T* ptr = allocate();
+        if (ptr != nullptr) {
+            try {
+                new (ptr) T(std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(ptr);
+                throw;
+            }
+        }
+        return ptr;
+    }
+
+    /// Deallocate an object (does not call destructor)
+    void deallocate(T* ptr) noexcept {
+        if (ptr == nullptr) {
+            return;
+        }
+        FreeNode* node = reinterpret_cast<FreeNode*>(ptr);
+        node->next = free_list_;
+        free_list_ = node;
+        --size_;
+    }
+
+    /// Destroy and deallocate an object
+    void destroy(T* ptr) noexcept {
+        if (ptr != nullptr) {
+            ptr->~T();
+            deallocate(ptr);
+        }
+    }
+
+    /// Reserve capacity for at least n objects
+    /// @return true if successful, false otherwise
+    bool reserve(std::size_t n) {
+        if (n <= capacity_) {
+            return true;
+        }
+        return grow(n - capacity_);
+    }
+
+    /// Get index of a pooled object
+    [[nodiscard]] static uint32_t indexOf(const T* object) noexcept {
+        const ChunkHeader* header = headerOf(object);
+        const auto* first = reinterpret_cast<const T*>(reinterpret_cast<const std::byte*>(header) + kFirstSlotOffset);
+        return (header->chunk << kSlotBits) | static_cast<uint32_t>(object - first);
+    }
+
+    /// Get object at index, looked up in the pool that owns object
+    /// @param object Any object of the pool
+    /// @param index Index of the wanted object (not kNullPoolIndex)
+    [[nodiscard]] static T* resolve(const T* object, uint32_t index) noexcept {
+        SLICK_ASSERT(index != kNullPoolIndex);
+        const ChunkHeader* header = headerOf(object);
+        const uint32_t chunk = index >> kSlotBits;
+        T* first = SLICK_LIKELY(chunk == header->chunk)
+            ? reinterpret_cast<T*>(reinterpret_cast<std::uintptr_t>(header) + kFirstSlotOffset)
+            : header->chunks[chunk];
+        return first + (index & kSlotMask);
+    }
+
+    /// Get object at index
+    [[nodiscard]] T* at(uint32_t index) const noexcept {
+        SLICK_ASSERT(index != kNullPoolIndex);
+        return chunks_[index >> kSlotBits] + (index & kSlotMask);
+    }
+
+    /// Get current capacity (total objects that can be stored)
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    /// Get current size (objects currently allocated)
+    [[nodiscard]] std::size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Get number of available objects in free list
+    [[nodiscard]] std::size_t available() const noexcept {
+        return capacity_ - size_;
+    }
+
+    /// Check if pool is empty
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    /// Get slab allocator (memory placement and its fallback counters)
+    [[nodiscard]] const PageAllocator& allocator() const noexcept {
+        return allocator_;
+    }
+
+    /// Clear all allocated objects
+    /// Warning: This assumes all objects have been properly destroyed
+    void clear() noexcept {
+        free_list_ = nullptr;
+        for (std::size_t chunk = chunks_.size(); chunk-- > 0; ) {
+            pushChunk(chunks_[chunk]);
+        }
+        size_ = 0;
+    }
+
+    /// Return wholly free slabs at the end of the chunk table to the allocator, keeping at least keep_capacity
+    /// Only trailing slabs can go, since indexes of live objects name their chunk. Not for the hot path:
+    /// walks the free list and rebuilds it without the released chunks.
+    /// @param keep_capacity Capacity to keep (e.g. the expected high watermark)
+    /// @return Number of objects of capacity released
+    std::size_t trim(std::size_t keep_capacity = 0) {
+        if (free_list_ == nullptr || capacity_ <= keep_capacity) {
+            return 0;
+        }
+        std::vector<std::size_t> free_count(chunks_.size(), 0);
+        for (const FreeNode* node = free_list_; node != nullptr; node = node->next) {
+            ++free_count[headerOf(reinterpret_cast<const T*>(node))->chunk];
+        }
+
+        std::size_t chunk_count = chunks_.size();
+        std::size_t slab_count = slabs_.size();
+        while (slab_count > 0) {
+            const std::size_t slab_chunks = slabs_[slab_count - 1].bytes / kChunkBytes;
+            const std::size_t slab_capacity = slab_chunks * kSlotsPerChunk;
+            const bool all_free = std::all_of(free_count.begin() + static_cast<std::ptrdiff_t>(chunk_count - slab_chunks),
+                                              free_count.begin() + static_cast<std::ptrdiff_t>(chunk_count),
+                                              [](std::size_t count) { return count == kSlotsPerChunk; });
+            if (!all_free || capacity_ - slab_capacity < keep_capacity) {
+                break;
+            }
+            capacity_ -= slab_capacity;
+            chunk_count -= slab_chunks;
+            --slab_count;
+        }
+        if (slab_count == slabs_.size()) {
+            return 0;
+        }
+
+        // Unlink the released chunks' slots, keeping the order of the rest
+        FreeNode** link = &free_list_;
+        while (*link != nullptr) {
+            if (headerOf(reinterpret_cast<const T*>(*link))->chunk >= chunk_count) {
+                *link = (*link)->next;
+            } else {
+                link = &(*link)->next;
+            }
+        }
+        const std::size_t released = (chunks_.size() - chunk_count) * kSlotsPerChunk;
+        for (std::size_t slab = slab_count; slab < slabs_.size(); ++slab) {
+            allocator_.deallocate(slabs_[slab].memory, slabs_[slab].bytes, kChunkBytes);
+        }
+        slabs_.resize(slab_count);
+        chunks_.resize(chunk_count);
+        return released;
+    }
+
+    /// Return every wholly free trailing slab to the allocator
+    /// @return Number of objects of capacity released
+    std::size_t shrink_to_fit() {
+        return trim(0);
+    }
+
+    /// Get bytes held in pool slabs
+    [[nodiscard]] std::size_t memoryUsage() const noexcept {
+        std::size_t bytes = 0;
+        for (const Slab& slab : slabs_) {
+            bytes += slab.bytes;
+        }
+        return bytes;
+    }
+
+private:
+    /// Free list node (overlays object memory when object is free)
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    static_assert(sizeof(FreeNode) <= sizeof(T),
+                  "IndexedObjectPool requires sizeof(T) >= sizeof(void*)");
+
+    /// First line of every chunk
+    struct ChunkHeader {
+        T* const* chunks;  // Chunk table of the owning pool (updated when the table reallocates)
+        uint32_t chunk;    // Number of this chunk in the table
+    };
+
+    static_assert(sizeof(ChunkHeader) <= kFirstSlotOffset);
+
+    /// Slab of consecutive chunks taken from the allocator
+    struct Slab {
+        void* memory;       // Slab memory (kChunkBytes aligned)
+        std::size_t bytes;  // Slab size
+    };
+
+    [[nodiscard]] static const ChunkHeader* headerOf(const T* object) noexcept {
+        return reinterpret_cast<const ChunkHeader*>(reinterpret_cast<std::uintptr_t>(object) & ~(kChunkBytes - 1));
+    }
+
+    [[nodiscard]] static ChunkHeader* headerOfChunk(T* first) noexcept {
+        return reinterpret_cast<ChunkHeader*>(reinterpret_cast<std::byte*>(first) - kFirstSlotOffset);
+    }
+
+    /// Grow the pool by allocating a new slab
+    /// Slabs double from one chunk up to 32 chunks (2 MiB), and are at least one allocator page
+    /// @param min_count Minimum number of objects to add
+    bool grow(std::size_t min_count = 0) {
+        constexpr std::size_t kMaxSlabChunks = 32;
+        std::size_t chunk_count = slabs_.empty() ? 1 : std::min(slabs_.back().bytes / kChunkBytes * 2, kMaxSlabChunks);
+        chunk_count = std::max(chunk_count, (min_count + kSlotsPerChunk - 1) / kSlotsPerChunk);
+        const std::size_t granularity = allocator_.granularity();
+        if (granularity > kChunkBytes) {
+            chunk_count = (chunk_count * kChunkBytes + granularity - 1) / granularity * granularity / kChunkBytes;
+        }
+        if (SLICK_UNLIKELY(chunks_.size() + chunk_count > kMaxChunks)) {
+            return false;
+        }
+
+        const std::size_t bytes = chunk_count * kChunkBytes;
+        void* memory = allocator_.allocate(bytes, kChunkBytes);
+        if (memory == nullptr) {
+            return false;
+        }
+        slabs_.push_back({memory, bytes});
+
+        // Repoint existing chunk headers if the table moves
+        const std::size_t first_chunk = chunks_.size();
+        T* const* old_table = chunks_.data();
+        chunks_.reserve(std::max(first_chunk + chunk_count, first_chunk * 2));
+        if (chunks_.data() != old_table) {
+            for (T* first : chunks_) {
+                headerOfChunk(first)->chunks = chunks_.data();
+            }
+        }
+
+        // Push chunks in reverse so the free list hands out ascending addresses
+        std::byte* const base = static_cast<std::byte*>(memory);
+        for (std::size_t i = 0; i < chunk_count; ++i) {
+            auto* header = new (base + i * kChunkBytes) ChunkHeader{chunks_.data(), static_cast<uint32_t>(first_chunk + i)};
+            chunks_.push_back(reinterpret_cast<T*>(reinterpret_cast<std::byte*>(header) + kFirstSlotOffset));
+        }
+        for (std::size_t i = chunk_count; i-- > 0; ) {
+            pushChunk(chunks_[first_chunk + i]);
+        }
+        capacity_ += chunk_count * kSlotsPerChunk;
+        return true;
+    }
+
+    /// Add every slot of a chunk to the free list
+    void pushChunk(T* first) noexcept {
+        for (std::size_t slot = kSlotsPerChunk; slot-- > 0; ) {
+            FreeNode* node = reinterpret_cast<FreeNode*>(first + slot);
+            node->next = free_list_;
+            free_list_ = node;
+        }
+    }
+
+    /// Return all slabs to the allocator
+    void releaseSlabs() noexcept {
+        for (Slab& slab : slabs_) {
+            allocator_.deallocate(slab.memory, slab.bytes, kChunkBytes);
+        }
+        slabs_.clear();
+        chunks_.clear();
+    }
+
+    PageAllocator allocator_;                   // Slab placement (heap, huge pages, NUMA node)
+    std::vector<Slab> slabs_;                   // Allocated slabs
+    std::vector<T*> chunks_;                    // First slot of each chunk, by chunk number
+    std::size_t capacity_ = 0;                  // Total capacity across all chunks
+    std::size_t size_ = 0;                      // Number of currently allocated objects
+    FreeNode* free_list_ = nullptr;             // Head of free list
+};
+
+SLICK_DETAIL_NAMESPACE_END
@@ -45,6 +45,16 @@ public:
     using const_reference = const T&;
     using size_type = std::size_t;
 
+    /// Get next element, or nullptr at the tail
+    [[nodiscard]] static constexpr T* nextOf(const T* node) noexcept {
+        return node->*NextPtr;
+    }
+
+    /// Get previous element, or nullptr at the head
+    [[nodiscard]] static constexpr T* prevOf(const T* node) noexcept {
+        return node->*PrevPtr;
+    }
+
     /// Forward iterator for intrusive list
     /// We store a pointer to the list's tail to handle decrement from end()
     class Iterator {
@@ -0,0 +1,105 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Price levels touched by an applyBatch() call, coalesced into one notification per level
+///
+/// Each mutation records the level and whether it existed just before that mutation. Records for the
+/// same level are merged on the fly through a small open-addressing index (no sorting): a level keeps
+/// existed_before of its first mutation and timestamp and seq_num of its last. flush() visits the
+/// levels in the order they were first touched; the book then reads each level's final state to build
+/// the notification. Storage is reused across batches.
+class LevelBatch {
+public:
+    struct Touch {
+        Price price;
+        Timestamp timestamp;    // Of the last mutation
+        uint64_t seq_num;       // Of the last mutation
+        Side side;
+        bool existed_before;    // Level existed before its first mutation in the batch
+    };
+
+    /// Check if a batch is being recorded
+    [[nodiscard]] bool active() const noexcept { return active_; }
+
+    /// Start recording (storage from the previous batch is reused)
+    void begin(std::size_t expected_touches) {
+        touches_.clear();
+        const std::size_t slots = std::bit_ceil(std::max<std::size_t>(2 * expected_touches, 16));
+        if (slots > index_.size()) {
+            index_.resize(slots);
+        }
+        std::fill(index_.begin(), index_.end(), 0u);
+        active_ = true;
+    }
+
+    /// Record one mutation of a level
+    void record(Side side, Price price, bool existed_before, Timestamp timestamp, uint64_t seq_num) {
+        if (SLICK_UNLIKELY(2 * (touches_.size() + 1) > index_.size())) {
+            grow();
+        }
+        const std::size_t mask = index_.size() - 1;
+        for (std::size_t slot = hash(side, price) & mask;; slot = (slot + 1) & mask) {
+            const uint32_t entry = index_[slot];
+            if (entry == 0) {
+                touches_.push_back(Touch{price, timestamp, seq_num, side, existed_before});
+                index_[slot] = static_cast<uint32_t>(touches_.size());
+                return;
+            }
+            Touch& touch = touches_[entry - 1];
+            if (touch.price == price && touch.side == side) {
+                touch.timestamp = timestamp;
+                touch.seq_num = seq_num;
+                return;
+            }
+        }
+    }
+
+    /// Stop recording and visit each touched level once, in first-touch order
+    /// @param fn Called as fn(const Touch&) with the coalesced touch of each level
+    template<typename Fn>
+    void flush(Fn&& fn) {
+        active_ = false;
+        for (const Touch& touch : touches_) {
+            fn(touch);
+        }
+        touches_.clear();
+    }
+
+private:
+    [[nodiscard]] static std::size_t hash(Side side, Price price) noexcept {
+        // Fibonacci hashing; the high bits are the best mixed
+        const uint64_t key = static_cast<uint64_t>(price) * 2 + side;
+        return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 32);
+    }
+
+    /// Double the index (more touches than begin() expected) and re-insert the recorded levels
+    void grow() {
+        index_.assign(index_.size() * 2, 0u);
+        const std::size_t mask = index_.size() - 1;
+        for (std::size_t i = 0; i < touches_.size(); ++i) {
+            std::size_t slot = hash(touches_[i].side, touches_[i].price) & mask;
+            while (index_[slot] != 0) {
+                slot = (slot + 1) & mask;
+            }
+            index_[slot] = static_cast<uint32_t>(i + 1);
+        }
+    }
+
+    std::vector<Touch> touches_;    // One entry per touched level, in first-touch order
+    std::vector<uint32_t> index_;   // (side, price) -> touches_ index + 1 (0 = empty), power-of-two size
+    bool active_ = false;           // Level notifications are being deferred
+};
+
+SLICK_DETAIL_NAMESPACE_END
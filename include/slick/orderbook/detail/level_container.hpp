@@ -6,42 +6,38 @@
 #include <slick/orderbook/config.hpp>
 #include <slick/orderbook/types.hpp>
 #include <slick/orderbook/detail/price_level_l2.hpp>
+#include <slick/orderbook/detail/vector_capacity.hpp>
 #include <vector>
 #include <algorithm>
-#include <functional>
+#include <span>
 
 SLICK_DETAIL_NAMESPACE_BEGIN
 
 /// Container for storing sorted price levels
 /// Uses a sorted vector for cache-friendly storage (optimal for < 100 levels)
 ///
-/// The container is configured at construction time to sort either as bids (descending)
-/// or asks (ascending), allowing use in std::array for O(1) side indexing.
+/// The sort order is fixed at compile time by the side (bids descending, asks ascending),
+/// so the comparator is a stateless functor that the compiler inlines into every search.
+///
+/// @tparam S Side (Buy = bids/descending, Sell = asks/ascending)
+/// @tparam Level Stored level type (BasicPriceLevelL2 of the book's FixedPoint widths)
+template<Side S, typename Level = PriceLevelL2>
 class LevelContainer {
 public:
-    using value_type = PriceLevelL2;
-    using iterator = typename std::vector<PriceLevelL2>::iterator;
-    using const_iterator = typename std::vector<PriceLevelL2>::const_iterator;
-    using Comparator = std::function<bool(const PriceLevelL2&, const PriceLevelL2&)>;
-
-    /// Default constructor (for array initialization on MSVC)
-    LevelContainer() : side_(Side::Buy), compare_(BidComparator{}) {}
+    using value_type = Level;
+    using iterator = typename std::vector<Level>::iterator;
+    using const_iterator = typename std::vector<Level>::const_iterator;
+    using Comparator = SideComparator<S>;
 
-    /// Constructor with side and initial capacity
-    /// @param side Side (Buy = bids/descending, Sell = asks/ascending)
+    /// Constructor with initial capacity
     /// @param initial_capacity Initial capacity for levels
-    explicit LevelContainer(Side side, std::size_t initial_capacity = 32)
-        : side_(side),
-          compare_(side == Side::Buy ?
-                   Comparator{BidComparator{}} :    // Bids: descending
-                   Comparator{AskComparator{}})     // Asks: ascending
-    {
+    explicit LevelContainer(std::size_t initial_capacity = 32) {
         levels_.reserve(initial_capacity);
     }
 
     /// Get Side
-    [[nodiscard]] Side side() const noexcept {
-        return side_;
+    [[nodiscard]] static constexpr Side side() noexcept {
+        return S;
     }
 
     /// Get number of levels
@@ -55,25 +51,45 @@ public:
     }
 
     /// Get level at index (no bounds checking)
-    [[nodiscard]] const PriceLevelL2& operator[](std::size_t index) const noexcept {
+    [[nodiscard]] const Level& operator[](std::size_t index) const noexcept {
         return levels_[index];
     }
 
     /// Get level at index with bounds checking
-    [[nodiscard]] const PriceLevelL2& at(std::size_t index) const {
+    [[nodiscard]] const Level& at(std::size_t index) const {
         return levels_.at(index);
     }
 
     /// Get best level (first element)
-    [[nodiscard]] const PriceLevelL2* best() const noexcept {
+    [[nodiscard]] const Level* best() const noexcept {
         return levels_.empty() ? nullptr : &levels_.front();
     }
 
+    /// Get level at index (0 = best), or nullptr if out of range
+    [[nodiscard]] const Level* atIndex(std::size_t index) const noexcept {
+        return index < levels_.size() ? &levels_[index] : nullptr;
+    }
+
+    /// Get index of a level (0 = best)
+    [[nodiscard]] std::size_t indexOf(const_iterator it) const noexcept {
+        return static_cast<std::size_t>(it - levels_.begin());
+    }
+
+    /// Get index of a level, saturated at limit (returns limit if the level is limit or more deep)
+    [[nodiscard]] std::size_t indexOf(const_iterator it, std::size_t limit) const noexcept {
+        return std::min(indexOf(it), limit);
+    }
+
+    /// Number of levels strictly better than price (index the price has or would have)
+    [[nodiscard]] std::size_t lowerBoundIndex(Price price) const noexcept {
+        return static_cast<std::size_t>(
+            std::lower_bound(levels_.begin(), levels_.end(), price, Comparator{}) - levels_.begin());
+    }
+
     /// Find level by price (binary search)
     /// Returns iterator to level with matching price, or end() if not found
     [[nodiscard]] iterator find(Price price) noexcept {
-        PriceLevelL2 key{price, 0, 0};
-        auto it = std::lower_bound(levels_.begin(), levels_.end(), key, compare_);
+        auto it = std::lower_bound(levels_.begin(), levels_.end(), price, Comparator{});
         if (it != levels_.end() && it->price == price) {
             return it;
         }
@@ -82,8 +98,7 @@ public:
 
     /// Find level by price (binary search, const version)
     [[nodiscard]] const_iterator find(Price price) const noexcept {
-        PriceLevelL2 key{price, 0, 0};
-        auto it = std::lower_bound(levels_.begin(), levels_.end(), key, compare_);
+        auto it = std::lower_bound(levels_.begin(), levels_.end(), price, Comparator{});
         if (it != levels_.end() && it->price == price) {
             return it;
         }
@@ -91,7 +106,7 @@ public:
     }
 
     /// Get level by price (returns pointer or nullptr)
-    [[nodiscard]] const PriceLevelL2* getLevel(Price price) const noexcept {
+    [[nodiscard]] const Level* getLevel(Price price) const noexcept {
         auto it = find(price);
         return (it != levels_.end()) ? &(*it) : nullptr;
     }
@@ -101,19 +116,18 @@ public:
     /// Returns iterator to the level and whether insertion occurred
     std::pair<iterator, bool> insertOrUpdate(Price price, Quantity quantity, Timestamp timestamp) {
         // Binary search for insertion position
-        PriceLevelL2 key{price, 0, 0};
-        auto it = std::lower_bound(levels_.begin(), levels_.end(), key, compare_);
+        auto it = std::lower_bound(levels_.begin(), levels_.end(), price, Comparator{});
 
         // Check if price already exists
         if (it != levels_.end() && it->price == price) {
             // Update existing level
-            it->quantity = quantity;
+            it->quantity = static_cast<typename Level::quantity_type>(quantity);
             it->timestamp = timestamp;
             return {it, false};
         }
 
         // Insert new level
-        it = levels_.insert(it, PriceLevelL2{price, quantity, timestamp});
+        it = levels_.insert(it, Level{price, quantity, timestamp});
         return {it, true};
     }
 
@@ -143,18 +157,44 @@ public:
         levels_.reserve(capacity);
     }
 
+    /// Check whether a level at price can be inserted (any price can)
+    [[nodiscard]] static constexpr bool accepts(Price) noexcept {
+        return true;
+    }
+
     /// Get capacity
     [[nodiscard]] std::size_t capacity() const noexcept {
         return levels_.capacity();
     }
 
+    /// Shrink capacity to max(size(), keep_capacity) levels
+    void trim(std::size_t keep_capacity = 0) {
+        trimCapacity(levels_, keep_capacity);
+    }
+
+    /// Shrink capacity to the levels held
+    void shrink_to_fit() {
+        trim(0);
+    }
+
+    /// Get bytes held by the level storage
+    [[nodiscard]] std::size_t memoryUsage() const noexcept {
+        return levels_.capacity() * sizeof(Level);
+    }
+
     /// Get all levels up to depth
     /// @param depth Maximum number of levels to return (0 = all)
-    [[nodiscard]] std::vector<PriceLevelL2> getLevels(std::size_t depth = 0) const {
-        if (depth == 0 || depth >= levels_.size()) {
-            return levels_;
-        }
-        return std::vector<PriceLevelL2>(levels_.begin(), levels_.begin() + depth);
+    [[nodiscard]] std::vector<Level> getLevels(std::size_t depth = 0) const {
+        const std::span<const Level> levels = getLevelsView(depth);
+        return std::vector<Level>(levels.begin(), levels.end());
+    }
+
+    /// View the levels up to depth in place (best first, no copy)
+    /// Invalidated by the next insert or erase
+    /// @param depth Maximum number of levels to view (0 = all)
+    [[nodiscard]] std::span<const Level> getLevelsView(std::size_t depth = 0) const noexcept {
+        const std::span<const Level> levels(levels_);
+        return depth == 0 || depth >= levels.size() ? levels : levels.first(depth);
     }
 
     /// Iterators
@@ -166,9 +206,7 @@ public:
     [[nodiscard]] const_iterator cend() const noexcept { return levels_.cend(); }
 
 private:
-    Side side_;                          // Side (Buy or Sell)
-    Comparator compare_;                 // Comparison function for sorting
-    std::vector<PriceLevelL2> levels_;  // Sorted vector of price levels
+    std::vector<Level> levels_;  // Sorted vector of price levels
 };
 
 SLICK_DETAIL_NAMESPACE_END
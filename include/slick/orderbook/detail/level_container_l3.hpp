@@ -0,0 +1,181 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/detail/price_level_l3.hpp>
+#include <slick/orderbook/detail/vector_capacity.hpp>
+#include <algorithm>
+#include <span>
+#include <utility>
+#include <vector>
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Container for storing sorted L3 price levels
+/// Sorted vector of (price, level) pairs, mirroring LevelContainer for L2
+///
+/// The sort order is fixed at compile time by the side, so searches inline the comparison.
+/// Both sides share the same value_type, which lets the orderbook expose a single
+/// std::span view type regardless of side.
+///
+/// @tparam S Side (Buy = bids/descending, Sell = asks/ascending)
+/// @tparam Level Price level type (PriceLevelL3 or CompactPriceLevelL3)
+template<Side S, typename Level = PriceLevelL3>
+class LevelContainerL3 {
+public:
+    using value_type = std::pair<Price, Level>;
+    using iterator = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+    using view_type = std::span<const value_type>;
+    using Comparator = SideComparatorL3<S>;
+
+    /// Constructor with initial capacity
+    /// @param initial_capacity Initial capacity for levels
+    explicit LevelContainerL3(std::size_t initial_capacity = 32) {
+        levels_.reserve(initial_capacity);
+    }
+
+    /// Get Side
+    [[nodiscard]] static constexpr Side side() noexcept {
+        return S;
+    }
+
+    /// Get number of levels
+    [[nodiscard]] std::size_t size() const noexcept {
+        return levels_.size();
+    }
+
+    /// Check if empty
+    [[nodiscard]] bool empty() const noexcept {
+        return levels_.empty();
+    }
+
+    /// Get best level (first element)
+    [[nodiscard]] value_type* best() noexcept {
+        return levels_.empty() ? nullptr : &levels_.front();
+    }
+
+    [[nodiscard]] const value_type* best() const noexcept {
+        return levels_.empty() ? nullptr : &levels_.front();
+    }
+
+    /// Find first level that does not sort before price (binary search)
+    [[nodiscard]] iterator lower_bound(Price price) noexcept {
+        return std::lower_bound(levels_.begin(), levels_.end(), price, KeyCompare{});
+    }
+
+    [[nodiscard]] const_iterator lower_bound(Price price) const noexcept {
+        return std::lower_bound(levels_.begin(), levels_.end(), price, KeyCompare{});
+    }
+
+    /// Find level by price (binary search)
+    /// Returns iterator to level with matching price, or end() if not found
+    [[nodiscard]] iterator find(Price price) noexcept {
+        auto it = lower_bound(price);
+        return (it != levels_.end() && it->first == price) ? it : levels_.end();
+    }
+
+    [[nodiscard]] const_iterator find(Price price) const noexcept {
+        auto it = lower_bound(price);
+        return (it != levels_.end() && it->first == price) ? it : levels_.end();
+    }
+
+    /// Get level at index (0 = best), or nullptr if out of range
+    [[nodiscard]] const value_type* atIndex(std::size_t index) const noexcept {
+        return index < levels_.size() ? &levels_[index] : nullptr;
+    }
+
+    /// Get index of a level (0 = best)
+    [[nodiscard]] std::size_t indexOf(const_iterator it) const noexcept {
+        return static_cast<std::size_t>(it - levels_.begin());
+    }
+
+    /// Get index of a level, saturated at limit (returns limit if the level is limit or more deep)
+    [[nodiscard]] std::size_t indexOf(const_iterator it, std::size_t limit) const noexcept {
+        return std::min(indexOf(it), limit);
+    }
+
+    /// Number of levels strictly better than price (index the price has or would have)
+    [[nodiscard]] std::size_t lowerBoundIndex(Price price) const noexcept {
+        return indexOf(lower_bound(price));
+    }
+
+    /// Find level by price, creating an empty level if it does not exist
+    /// Returns iterator to the level and whether insertion occurred
+    std::pair<iterator, bool> findOrInsert(Price price) {
+        auto it = lower_bound(price);
+        if (it != levels_.end() && it->first == price) {
+            return {it, false};
+        }
+        it = levels_.emplace(it, price, Level{price});
+        return {it, true};
+    }
+
+    /// Remove level by iterator
+    iterator erase(iterator it) noexcept {
+        return levels_.erase(it);
+    }
+
+    /// Clear all levels
+    void clear() noexcept {
+        levels_.clear();
+    }
+
+    /// Reserve capacity
+    void reserve(std::size_t capacity) {
+        levels_.reserve(capacity);
+    }
+
+    /// Check whether a level at price can be inserted (any price can)
+    [[nodiscard]] static constexpr bool accepts(Price) noexcept {
+        return true;
+    }
+
+    /// Get capacity
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return levels_.capacity();
+    }
+
+    /// Shrink capacity to max(size(), keep_capacity) levels
+    void trim(std::size_t keep_capacity = 0) {
+        trimCapacity(levels_, keep_capacity);
+    }
+
+    /// Shrink capacity to the levels held
+    void shrink_to_fit() {
+        trim(0);
+    }
+
+    /// Get bytes held by the level storage (orders are pooled by the book)
+    [[nodiscard]] std::size_t memoryUsage() const noexcept {
+        return levels_.capacity() * sizeof(value_type);
+    }
+
+    /// Zero-copy view of all levels in sorted order (best first)
+    [[nodiscard]] view_type view() const noexcept {
+        return view_type(levels_.data(), levels_.size());
+    }
+
+    /// Iterators
+    [[nodiscard]] iterator begin() noexcept { return levels_.begin(); }
+    [[nodiscard]] iterator end() noexcept { return levels_.end(); }
+    [[nodiscard]] const_iterator begin() const noexcept { return levels_.begin(); }
+    [[nodiscard]] const_iterator end() const noexcept { return levels_.end(); }
+    [[nodiscard]] const_iterator cbegin() const noexcept { return levels_.cbegin(); }
+    [[nodiscard]] const_iterator cend() const noexcept { return levels_.cend(); }
+
+private:
+    /// Heterogeneous comparison of a stored (price, level) pair against a price key
+    struct KeyCompare {
+        [[nodiscard]] constexpr bool operator()(const value_type& a, Price b) const noexcept {
+            return Comparator{}(a.first, b);
+        }
+    };
+
+    std::vector<value_type> levels_;  // Sorted vector of (price, level) pairs
+};
+
+SLICK_DETAIL_NAMESPACE_END
@@ -0,0 +1,137 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <utility>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Read-only view of a whole file
+///
+/// Memory-mapped on Linux; other platforms read the file into an 8-byte aligned heap buffer, so
+/// callers can reinterpret records the same way on both. Empty files fail to open.
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          mapped_(std::exchange(other.mapped_, false)),
+          heap_(std::move(other.heap_)) {}
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            close();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            mapped_ = std::exchange(other.mapped_, false);
+            heap_ = std::move(other.heap_);
+        }
+        return *this;
+    }
+
+    /// Open a file
+    /// @param path File to open
+    /// @param populate Fault the whole file in now (small files read in full); otherwise pages are read
+    ///                 ahead on first access, suited to one sequential pass over large files
+    /// @return true if the file exists, is not empty and could be mapped or read
+    bool open(const std::string& path, bool populate = false) {
+        close();
+#if defined(__linux__)
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+        const auto size = static_cast<std::size_t>(st.st_size);
+        void* memory = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE | (populate ? MAP_POPULATE : 0), fd, 0);
+        ::close(fd);
+        if (memory == MAP_FAILED) {
+            return false;
+        }
+        if (!populate) {
+            ::madvise(memory, size, MADV_SEQUENTIAL);
+        }
+        data_ = static_cast<const std::byte*>(memory);
+        size_ = size;
+        mapped_ = true;
+        return true;
+#else
+        (void)populate;
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        if (file == nullptr) {
+            return false;
+        }
+        std::fseek(file, 0, SEEK_END);
+        const long size = std::ftell(file);
+        std::fseek(file, 0, SEEK_SET);
+        if (size <= 0) {
+            std::fclose(file);
+            return false;
+        }
+        heap_ = std::make_unique<uint64_t[]>((static_cast<std::size_t>(size) + 7) / 8);
+        const bool ok = std::fread(heap_.get(), 1, static_cast<std::size_t>(size), file) == static_cast<std::size_t>(size);
+        std::fclose(file);
+        if (!ok) {
+            heap_.reset();
+            return false;
+        }
+        data_ = reinterpret_cast<const std::byte*>(heap_.get());
+        size_ = static_cast<std::size_t>(size);
+        return true;
+#endif
+    }
+
+    /// Release the file
+    void close() noexcept {
+#if defined(__linux__)
+        if (mapped_) {
+            ::munmap(const_cast<std::byte*>(data_), size_);
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+        mapped_ = false;
+        heap_.reset();
+    }
+
+    /// Check if a file is open
+    [[nodiscard]] bool isOpen() const noexcept { return data_ != nullptr; }
+
+    /// Get file contents
+    [[nodiscard]] const std::byte* data() const noexcept { return data_; }
+
+    /// Get file size in bytes
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+private:
+    const std::byte* data_ = nullptr;       // File contents
+    std::size_t size_ = 0;                  // File size
+    bool mapped_ = false;                   // data_ is a mapping (else heap_)
+    std::unique_ptr<uint64_t[]> heap_;      // File contents when not mapped
+};
+
+SLICK_DETAIL_NAMESPACE_END
@@ -4,8 +4,12 @@
 #pragma once
 
 #include <slick/orderbook/config.hpp>
+#include <slick/orderbook/detail/page_allocator.hpp>
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <iterator>
 #include <memory>
 #include <new>
 #include <type_traits>
@@ -20,6 +24,7 @@ SLICK_DETAIL_NAMESPACE_BEGIN
 /// - Cache-friendly memory layout (objects allocated in contiguous blocks)
 /// - Fast allocation/deallocation (free-list based, O(1))
 /// - Automatic memory management with RAII
+/// - Optional huge page / NUMA placement of blocks (see MemoryConfig and PageAllocator)
 ///
 /// Usage:
 /// @code
@@ -36,12 +41,13 @@ public:
     static_assert(std::is_nothrow_destructible_v<T>,
                   "ObjectPool requires nothrow destructible types");
     // Note: ObjectPool supports over-aligned types via std::align_val_t
-    // (see operator delete calls with std::align_val_t{alignof(T)})
+    // (see PageAllocator::allocate() calls with alignof(T))
 
     /// Constructor - pre-allocates initial capacity
     /// @param initial_capacity Number of objects to pre-allocate
-    explicit ObjectPool(std::size_t initial_capacity = 1024)
-        : capacity_(0), size_(0), free_list_(nullptr) {
+    /// @param memory Placement of pool blocks (default: heap)
+    explicit ObjectPool(std::size_t initial_capacity = 1024, const MemoryConfig& memory = {})
+        : allocator_(memory), capacity_(0), size_(0), free_list_(nullptr) {
         if (initial_capacity > 0) {
             reserve(initial_capacity);
         }
@@ -50,9 +56,7 @@ public:
     /// Destructor - frees all memory blocks
     ~ObjectPool() noexcept {
         clear();
-        for (Block& block : blocks_) {
-            ::operator delete(block.memory, std::align_val_t{alignof(T)});
-        }
+        releaseBlocks();
     }
 
     // Non-copyable
@@ -61,7 +65,8 @@ public:
 
     // Movable
     ObjectPool(ObjectPool&& other) noexcept
-        : blocks_(std::move(other.blocks_)),
+        : allocator_(other.allocator_),
+          blocks_(std::move(other.blocks_)),
           capacity_(other.capacity_),
           size_(other.size_),
           free_list_(other.free_list_) {
@@ -73,9 +78,8 @@ public:
     ObjectPool& operator=(ObjectPool&& other) noexcept {
         if (this != &other) {
             clear();
-            for (Block& block : blocks_) {
-                ::operator delete(block.memory, std::align_val_t{alignof(T)});
-            }
+            releaseBlocks();
+            allocator_ = other.allocator_;
             blocks_ = std::move(other.blocks_);
             capacity_ = other.capacity_;
             size_ = other.size_;
@@ -187,6 +191,11 @@ public:
         return size_ == 0;
     }
 
+    /// Get block allocator (memory placement and its fallback counters)
+    [[nodiscard]] const PageAllocator& allocator() const noexcept {
+        return allocator_;
+    }
+
     /// Clear all allocated objects (calls destructors if any are alive)
     /// Warning: This assumes all objects have been properly destroyed
     void clear() noexcept {
@@ -204,6 +213,79 @@ public:
         size_ = 0;
     }
 
+    /// Return wholly free blocks to the allocator, newest (largest) first, keeping at least keep_capacity
+    /// Not for the hot path: walks the free list and rebuilds it without the released blocks.
+    /// Objects in use never move.
+    /// @param keep_capacity Capacity to keep (e.g. the expected high watermark)
+    /// @return Number of objects of capacity released
+    std::size_t trim(std::size_t keep_capacity = 0) {
+        if (free_list_ == nullptr || capacity_ <= keep_capacity) {
+            return 0;
+        }
+
+        // Count the free objects of each block, locating blocks by address
+        std::vector<std::size_t> by_address(blocks_.size());
+        for (std::size_t i = 0; i < by_address.size(); ++i) {
+            by_address[i] = i;
+        }
+        std::sort(by_address.begin(), by_address.end(), [this](std::size_t a, std::size_t b) {
+            return std::less<>{}(blocks_[a].memory, blocks_[b].memory);
+        });
+        auto block_of = [&](const FreeNode* node) {
+            const auto it = std::upper_bound(by_address.begin(), by_address.end(), static_cast<const void*>(node),
+                [this](const void* address, std::size_t block) { return std::less<>{}(address, blocks_[block].memory); });
+            return *std::prev(it);
+        };
+        std::vector<std::size_t> free_count(blocks_.size(), 0);
+        for (const FreeNode* node = free_list_; node != nullptr; node = node->next) {
+            ++free_count[block_of(node)];
+        }
+
+        std::vector<bool> release(blocks_.size(), false);
+        std::size_t released = 0;
+        for (std::size_t i = blocks_.size(); i-- > 0; ) {
+            if (free_count[i] == blocks_[i].count && capacity_ - blocks_[i].count >= keep_capacity) {
+                release[i] = true;
+                capacity_ -= blocks_[i].count;
+                released += blocks_[i].count;
+            }
+        }
+        if (released == 0) {
+            return 0;
+        }
+
+        // Unlink the released blocks' objects, keeping the order of the rest
+        FreeNode** link = &free_list_;
+        while (*link != nullptr) {
+            if (release[block_of(*link)]) {
+                *link = (*link)->next;
+            } else {
+                link = &(*link)->next;
+            }
+        }
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < blocks_.size(); ++i) {
+            if (release[i]) {
+                allocator_.deallocate(blocks_[i].memory, blocks_[i].count * sizeof(T), alignof(T));
+            } else {
+                blocks_[kept++] = blocks_[i];
+            }
+        }
+        blocks_.resize(kept);
+        return released;
+    }
+
+    /// Return every wholly free block to the allocator
+    /// @return Number of objects of capacity released
+    std::size_t shrink_to_fit() {
+        return trim(0);
+    }
+
+    /// Get bytes held in pool blocks
+    [[nodiscard]] std::size_t memoryUsage() const noexcept {
+        return capacity_ * sizeof(T);
+    }
+
 private:
     /// Free list node (overlays object memory when object is free)
     struct FreeNode {
@@ -238,10 +320,15 @@ private:
             block_size = min_count;
         }
 
+        // Mapped blocks use every object that fits in their whole pages
+        const std::size_t granularity = allocator_.granularity();
+        if (granularity > 1) {
+            const std::size_t bytes = (block_size * sizeof(T) + granularity - 1) / granularity * granularity;
+            block_size = bytes / sizeof(T);
+        }
+
         // Allocate new block
-        void* memory = ::operator new(block_size * sizeof(T),
-                                      std::align_val_t{alignof(T)},
-                                      std::nothrow);
+        void* memory = allocator_.allocate(block_size * sizeof(T), alignof(T));
         if (memory == nullptr) {
             return false;
         }
@@ -262,6 +349,15 @@ private:
         return true;
     }
 
+    /// Return all blocks to the allocator
+    void releaseBlocks() noexcept {
+        for (Block& block : blocks_) {
+            allocator_.deallocate(block.memory, block.count * sizeof(T), alignof(T));
+        }
+        blocks_.clear();
+    }
+
+    PageAllocator allocator_;       // Block placement (heap, huge pages, NUMA node)
     std::vector<Block> blocks_;     // List of allocated memory blocks
     std::size_t capacity_;           // Total capacity across all blocks
     std::size_t size_;               // Number of currently allocated objects
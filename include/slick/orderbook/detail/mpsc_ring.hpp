@@ -0,0 +1,118 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Bounded multi-producer / single-consumer ring buffer
+///
+/// Preallocated power-of-two slot array; each slot carries its own sequence number (Vyukov's bounded
+/// queue). Producers claim a position with a CAS on head, write the slot and release it by bumping the
+/// slot's sequence, so a slow producer never blocks the others from claiming. The single consumer
+/// reads slots in order and hands them back to producers one lap ahead.
+///
+/// @tparam T Element type (trivially copyable)
+template<typename T>
+class MPSCRing {
+    static_assert(std::is_trivially_copyable_v<T>, "MPSCRing elements must be trivially copyable");
+
+public:
+    /// Constructor
+    /// @param capacity Minimum number of slots (rounded up to a power of two)
+    explicit MPSCRing(std::size_t capacity)
+        : capacity_(std::bit_ceil(std::max<std::size_t>(capacity, 2))),
+          mask_(capacity_ - 1),
+          slots_(std::make_unique<Slot[]>(capacity_)) {
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Non-copyable, non-movable (shared between threads)
+    MPSCRing(const MPSCRing&) = delete;
+    MPSCRing& operator=(const MPSCRing&) = delete;
+
+    /// Append an element (any thread)
+    /// @return false if the ring is full
+    bool tryPush(const T& value) noexcept {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots_[head & mask_];
+            const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<int64_t>(sequence - head);
+            if (diff == 0) {
+                // Slot is free for this lap: claim it (on failure head is reloaded)
+                if (head_.compare_exchange_weak(head, head + 1, std::memory_order_relaxed)) {
+                    slot.value = value;
+                    slot.sequence.store(head + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Consumer has not freed this slot yet: full
+            } else {
+                head = head_.load(std::memory_order_relaxed);  // Another producer claimed it
+            }
+        }
+    }
+
+    /// Remove the oldest element (consumer only)
+    /// @param out Receives the element
+    /// @return false if the ring is empty (or the oldest claimed slot is still being written)
+    bool tryPop(T& out) noexcept {
+        const uint64_t tail = tail_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[tail & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != tail + 1) {
+            return false;
+        }
+        out = slot.value;
+        slot.sequence.store(tail + capacity_, std::memory_order_release);  // Free for the next lap
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Get total number of positions claimed by producers
+    [[nodiscard]] uint64_t pushed() const noexcept {
+        return head_.load(std::memory_order_acquire);
+    }
+
+    /// Get number of elements currently queued (approximate while both sides are active)
+    [[nodiscard]] std::size_t size() const noexcept {
+        const uint64_t tail = tail_.load(std::memory_order_acquire);
+        const uint64_t head = head_.load(std::memory_order_acquire);
+        return head > tail ? static_cast<std::size_t>(head - tail) : 0;
+    }
+
+    /// Check if ring is empty
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /// Get number of slots
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> sequence;   // == position: free; == position + 1: written
+        T value;
+    };
+
+    SLICK_CACHE_ALIGNED std::atomic<uint64_t> head_{0};    // Next position to claim (producers)
+    SLICK_CACHE_ALIGNED std::atomic<uint64_t> tail_{0};    // Next position to read (consumer)
+    SLICK_CACHE_ALIGNED const std::size_t capacity_;       // Number of slots (power of two)
+    const std::size_t mask_;                                // capacity_ - 1
+    std::unique_ptr<Slot[]> slots_;                         // Slot storage
+};
+
+SLICK_DETAIL_NAMESPACE_END
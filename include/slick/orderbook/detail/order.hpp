@@ -5,6 +5,7 @@
 
 #include <slick/orderbook/config.hpp>
 #include <slick/orderbook/types.hpp>
+#include <slick/orderbook/detail/indexed_pool.hpp>
 
 SLICK_DETAIL_NAMESPACE_BEGIN
 
@@ -16,6 +17,7 @@ struct SLICK_CACHE_ALIGNED Order {
     Price price;                // Order price
     Quantity quantity;          // Order quantity
     Side side;                  // Buy or Sell
+    uint32_t queue_slot;        // Slot in the level's QueuePositionIndex (fills padding)
     Timestamp timestamp;        // Order timestamp
     uint64_t priority;          // Priority for sorting at same price level (lower = higher priority)
 
@@ -29,6 +31,7 @@ struct SLICK_CACHE_ALIGNED Order {
           price(p),
           quantity(qty),
           side(s),
+          queue_slot(0),
           timestamp(ts),
           priority(prio),
           prev(nullptr),
@@ -46,6 +49,7 @@ struct SLICK_CACHE_ALIGNED Order {
           price(0),
           quantity(0),
           side(Side::Buy),
+          queue_slot(0),
           timestamp(0),
           priority(0),
           prev(nullptr),
@@ -63,4 +67,74 @@ struct SLICK_CACHE_ALIGNED Order {
     }
 };
 
+static_assert(sizeof(Order) == SLICK_CACHE_LINE_SIZE, "Order should stay one cache line");
+
+/// Compact order structure for Level 3 orderbooks with deep queues (48 bytes instead of 64)
+/// Allocated from an IndexedObjectPool and queued in an IndexedList:
+/// - Neighbours are linked by 31-bit pool index instead of pointer
+/// - The side is packed next to the prev link
+/// Every field of Order is kept, so timestamp and priority stay independent. 32 bytes is out of
+/// reach without dropping one: id, timestamp, priority and the links alone take 32.
+/// Price stays in the order: deletes and executions arrive by OrderId alone and must find their level.
+struct CompactOrder {
+    OrderId order_id;           // Unique order identifier
+    Price price;                // Order price
+    Quantity quantity;          // Order quantity
+    Timestamp timestamp;        // Order timestamp
+    uint64_t priority;          // Priority for sorting at same price level (lower = higher priority)
+
+    // Intrusive list links (pool indices, managed by IndexedList)
+    uint32_t prev : 31;
+    uint32_t sell : 1;          // Side (0 = Buy, 1 = Sell)
+    uint32_t next;
+
+    /// Constructor with all fields
+    CompactOrder(OrderId id, Price p, Quantity qty, Side s, Timestamp ts, uint64_t prio) noexcept
+        : order_id(id),
+          price(p),
+          quantity(qty),
+          timestamp(ts),
+          priority(prio),
+          prev(kNullPoolIndex),
+          sell(s == Side::Sell ? 1u : 0u),
+          next(kNullPoolIndex) {
+    }
+
+    /// Constructor with timestamp as priority (common case)
+    CompactOrder(OrderId id, Price p, Quantity qty, Side s, Timestamp ts) noexcept
+        : CompactOrder(id, p, qty, s, ts, ts) {
+    }
+
+    /// Default constructor (for pool allocation)
+    CompactOrder() noexcept
+        : CompactOrder(0, 0, 0, Side::Buy, 0, 0) {
+    }
+
+    /// Get side
+    [[nodiscard]] Side side() const noexcept {
+        return sell ? Side::Sell : Side::Buy;
+    }
+
+    [[nodiscard]] bool operator<(const CompactOrder& other) const noexcept {
+        return priority < other.priority;
+    }
+
+    [[nodiscard]] bool operator>(const CompactOrder& other) const noexcept {
+        return priority > other.priority;
+    }
+};
+
+static_assert(sizeof(CompactOrder) == 48, "CompactOrder should stay 48 bytes");
+
+/// Layout-independent access to the fields CompactOrder packs
+
+[[nodiscard]] inline Side sideOf(const Order& order) noexcept { return order.side; }
+[[nodiscard]] inline Side sideOf(const CompactOrder& order) noexcept { return order.side(); }
+
+[[nodiscard]] inline Timestamp timestampOf(const Order& order) noexcept { return order.timestamp; }
+[[nodiscard]] inline Timestamp timestampOf(const CompactOrder& order) noexcept { return order.timestamp; }
+
+inline void setTimestamp(Order& order, Timestamp timestamp) noexcept { order.timestamp = timestamp; }
+inline void setTimestamp(CompactOrder& order, Timestamp timestamp) noexcept { order.timestamp = timestamp; }
+
 SLICK_DETAIL_NAMESPACE_END
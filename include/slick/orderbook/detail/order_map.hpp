@@ -6,89 +6,304 @@
 #include <slick/orderbook/config.hpp>
 #include <slick/orderbook/types.hpp>
 #include <slick/orderbook/detail/order.hpp>
-#include <unordered_map>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 SLICK_DETAIL_NAMESPACE_BEGIN
 
-/// Hash table for fast OrderId -> Order* lookup
-/// Uses std::unordered_map for simplicity and performance
-/// Provides O(1) average-case lookup, insertion, and deletion
-class OrderMap {
+/// Default OrderId hash (64-bit finalizer from MurmurHash3)
+/// Exchange order ids are often sequential or strided, so the bits are mixed
+/// before masking to keep linear-probe clusters short
+struct OrderIdHash {
+    [[nodiscard]] constexpr std::size_t operator()(OrderId id) const noexcept {
+        uint64_t x = id;
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return static_cast<std::size_t>(x);
+    }
+};
+
+/// Open-addressing hash table for fast OrderId -> Order* lookup
+///
+/// Flat array of (OrderId, Order*) slots with power-of-two capacity and linear probing.
+/// A slot is empty when its Order* is null, so no sentinel OrderId is reserved.
+/// Deletion uses backward shift instead of tombstones, keeping probe sequences short
+/// under heavy add/delete churn.
+///
+/// Never allocates once reserved: the table only grows when size exceeds 3/4 of capacity.
+///
+/// @tparam Hash Hash functor for OrderId
+/// @tparam OrderT Order layout (Order or CompactOrder)
+template<typename Hash = OrderIdHash, typename OrderT = Order>
+class BasicOrderMap {
 public:
-    using MapType = std::unordered_map<OrderId, Order*>;
-    using iterator = MapType::iterator;
-    using const_iterator = MapType::const_iterator;
+    using value_type = std::pair<OrderId, OrderT*>;
+    using hasher = Hash;
+
+    template<bool Const>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = BasicOrderMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+        constexpr Iterator() noexcept : current_(nullptr), end_(nullptr) {}
+        constexpr Iterator(pointer current, pointer end) noexcept : current_(current), end_(end) {
+            skipEmpty();
+        }
+
+        /// Allow iterator -> const_iterator conversion
+        constexpr operator Iterator<true>() const noexcept requires (!Const) {
+            return Iterator<true>(current_, end_);
+        }
+
+        [[nodiscard]] constexpr reference operator*() const noexcept { return *current_; }
+        [[nodiscard]] constexpr pointer operator->() const noexcept { return current_; }
+
+        constexpr Iterator& operator++() noexcept {
+            ++current_;
+            skipEmpty();
+            return *this;
+        }
+
+        constexpr Iterator operator++(int) noexcept {
+            Iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const Iterator& other) const noexcept {
+            return current_ == other.current_;
+        }
+
+    private:
+        constexpr void skipEmpty() noexcept {
+            while (current_ != end_ && current_->second == nullptr) {
+                ++current_;
+            }
+        }
+
+        pointer current_;
+        pointer end_;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
 
     /// Constructor with initial capacity
-    explicit OrderMap(std::size_t initial_capacity = 1024) {
-        map_.reserve(initial_capacity);
+    /// @param initial_capacity Number of orders that can be stored without rehashing
+    explicit BasicOrderMap(std::size_t initial_capacity = 1024, const Hash& hash = Hash{})
+        : hash_(hash) {
+        rehash(slotCountFor(initial_capacity));
     }
 
     /// Insert order into map
     /// @param order Pointer to order (must not be null)
     /// @return true if insertion succeeded, false if OrderId already exists
-    bool insert(Order* order) noexcept {
+    bool insert(OrderT* order) {
         SLICK_ASSERT(order != nullptr);
-        // Avoid structured bindings to work around C++23 tuple conversion issues with Clang 17 + GCC 14 libstdc++
-        auto result = map_.try_emplace(order->order_id, order);
-        return result.second;
+        if (SLICK_UNLIKELY(size_ >= max_size_)) {
+            rehash(slots_.size() * 2);
+        }
+
+        const OrderId order_id = order->order_id;
+        for (std::size_t i = homeSlot(order_id);; i = (i + 1) & mask_) {
+            value_type& slot = slots_[i];
+            if (slot.second == nullptr) {
+                slot.first = order_id;
+                slot.second = order;
+                ++size_;
+                return true;
+            }
+            if (slot.first == order_id) {
+                return false;
+            }
+        }
     }
 
     /// Remove order from map
     /// @param order_id OrderId to remove
     /// @return true if order was found and removed
     bool erase(OrderId order_id) noexcept {
-        return map_.erase(order_id) > 0;
+        const std::size_t index = findSlot(order_id);
+        if (index == npos) {
+            return false;
+        }
+        eraseSlot(index);
+        return true;
     }
 
     /// Find order by OrderId
     /// @param order_id OrderId to find
     /// @return Pointer to order, or nullptr if not found
-    [[nodiscard]] Order* find(OrderId order_id) noexcept {
-        auto it = map_.find(order_id);
-        return (it != map_.end()) ? it->second : nullptr;
+    [[nodiscard]] OrderT* find(OrderId order_id) noexcept {
+        const std::size_t index = findSlot(order_id);
+        return (index != npos) ? slots_[index].second : nullptr;
+    }
+
+    [[nodiscard]] const OrderT* find(OrderId order_id) const noexcept {
+        const std::size_t index = findSlot(order_id);
+        return (index != npos) ? slots_[index].second : nullptr;
     }
 
-    [[nodiscard]] const Order* find(OrderId order_id) const noexcept {
-        auto it = map_.find(order_id);
-        return (it != map_.end()) ? it->second : nullptr;
+    /// Prefetch the slot an OrderId hashes to, ahead of its find(), insert() or erase()
+    void prefetch(OrderId order_id) const noexcept {
+        SLICK_PREFETCH(slots_.data() + homeSlot(order_id));
     }
 
     /// Check if order exists
     [[nodiscard]] bool contains(OrderId order_id) const noexcept {
-        return map_.contains(order_id);
+        return findSlot(order_id) != npos;
     }
 
     /// Get number of orders in map
     [[nodiscard]] std::size_t size() const noexcept {
-        return map_.size();
+        return size_;
     }
 
     /// Check if map is empty
     [[nodiscard]] bool empty() const noexcept {
-        return map_.empty();
+        return size_ == 0;
+    }
+
+    /// Get number of orders that can be stored without rehashing
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return max_size_;
+    }
+
+    /// Get number of slots in the table (always a power of two)
+    [[nodiscard]] std::size_t slotCount() const noexcept {
+        return slots_.size();
     }
 
     /// Reserve capacity for orders
     void reserve(std::size_t capacity) {
-        map_.reserve(capacity);
+        const std::size_t slot_count = slotCountFor(capacity);
+        if (slot_count > slots_.size()) {
+            rehash(slot_count);
+        }
     }
 
-    /// Clear all orders
+    /// Clear all orders (keeps capacity)
     void clear() noexcept {
-        map_.clear();
+        std::fill(slots_.begin(), slots_.end(), value_type{0, nullptr});
+        size_ = 0;
     }
 
-    /// Iterators
-    [[nodiscard]] iterator begin() noexcept { return map_.begin(); }
-    [[nodiscard]] iterator end() noexcept { return map_.end(); }
-    [[nodiscard]] const_iterator begin() const noexcept { return map_.begin(); }
-    [[nodiscard]] const_iterator end() const noexcept { return map_.end(); }
-    [[nodiscard]] const_iterator cbegin() const noexcept { return map_.cbegin(); }
-    [[nodiscard]] const_iterator cend() const noexcept { return map_.cend(); }
+    /// Shrink the table to the smallest slot count holding max(size(), keep_capacity) orders
+    /// Rehashes every entry: not for the hot path
+    /// @param keep_capacity Capacity to keep (e.g. the expected high watermark)
+    void trim(std::size_t keep_capacity = 0) {
+        const std::size_t slot_count = slotCountFor(std::max(size_, keep_capacity));
+        if (slot_count < slots_.size()) {
+            rehash(slot_count);
+        }
+    }
+
+    /// Shrink the table to the smallest slot count holding the current orders
+    void shrink_to_fit() {
+        trim(0);
+    }
+
+    /// Get bytes held by the slot table
+    [[nodiscard]] std::size_t memoryUsage() const noexcept {
+        return slots_.capacity() * sizeof(value_type);
+    }
+
+    /// Iterators (unordered)
+    [[nodiscard]] iterator begin() noexcept { return iterator(slots_.data(), slots_.data() + slots_.size()); }
+    [[nodiscard]] iterator end() noexcept { return iterator(slots_.data() + slots_.size(), slots_.data() + slots_.size()); }
+    [[nodiscard]] const_iterator begin() const noexcept { return cbegin(); }
+    [[nodiscard]] const_iterator end() const noexcept { return cend(); }
+    [[nodiscard]] const_iterator cbegin() const noexcept { return const_iterator(slots_.data(), slots_.data() + slots_.size()); }
+    [[nodiscard]] const_iterator cend() const noexcept { return const_iterator(slots_.data() + slots_.size(), slots_.data() + slots_.size()); }
 
 private:
-    MapType map_;  // OrderId -> Order* mapping
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+    static constexpr std::size_t kMinSlots = 16;
+
+    /// Smallest power-of-two slot count that holds capacity orders at <= 3/4 load
+    [[nodiscard]] static std::size_t slotCountFor(std::size_t capacity) noexcept {
+        return std::bit_ceil(std::max(kMinSlots, capacity + capacity / 3 + 1));
+    }
+
+    [[nodiscard]] std::size_t homeSlot(OrderId order_id) const noexcept {
+        return hash_(order_id) & mask_;
+    }
+
+    /// Linear probe until the key or an empty slot is found
+    [[nodiscard]] std::size_t findSlot(OrderId order_id) const noexcept {
+        for (std::size_t i = homeSlot(order_id);; i = (i + 1) & mask_) {
+            const value_type& slot = slots_[i];
+            if (slot.second == nullptr) {
+                return npos;
+            }
+            if (slot.first == order_id) {
+                return i;
+            }
+        }
+    }
+
+    /// Backward-shift deletion: pull later entries of the probe chain into the hole
+    /// so lookups never need tombstones
+    void eraseSlot(std::size_t hole) noexcept {
+        for (std::size_t i = (hole + 1) & mask_;; i = (i + 1) & mask_) {
+            value_type& slot = slots_[i];
+            if (slot.second == nullptr) {
+                break;
+            }
+            // Entry may move into the hole only if its home slot is not in the range (hole, i]
+            const std::size_t home = homeSlot(slot.first);
+            if (((i - home) & mask_) >= ((i - hole) & mask_)) {
+                slots_[hole] = slot;
+                hole = i;
+            }
+        }
+        slots_[hole] = value_type{0, nullptr};
+        --size_;
+    }
+
+    /// Resize table to slot_count slots (power of two) and reinsert all entries
+    void rehash(std::size_t slot_count) {
+        SLICK_ASSERT(std::has_single_bit(slot_count));
+        std::vector<value_type> old_slots(slot_count, value_type{0, nullptr});
+        old_slots.swap(slots_);
+        mask_ = slot_count - 1;
+        max_size_ = slot_count - slot_count / 4;
+
+        for (const value_type& entry : old_slots) {
+            if (entry.second == nullptr) {
+                continue;
+            }
+            std::size_t i = homeSlot(entry.first);
+            while (slots_[i].second != nullptr) {
+                i = (i + 1) & mask_;
+            }
+            slots_[i] = entry;
+        }
+    }
+
+    std::vector<value_type> slots_;     // (OrderId, Order*) slots, Order* == nullptr means empty
+    std::size_t mask_ = 0;              // slots_.size() - 1
+    std::size_t size_ = 0;              // Number of occupied slots
+    std::size_t max_size_ = 0;          // Grow threshold (3/4 of slot count)
+    [[no_unique_address]] Hash hash_;
 };
 
+/// Default OrderId -> Order* map used by OrderBookL3
+using OrderMap = BasicOrderMap<>;
+
+/// OrderId -> CompactOrder* map used by compact L3 books
+using CompactOrderMap = BasicOrderMap<OrderIdHash, CompactOrder>;
+
 SLICK_DETAIL_NAMESPACE_END
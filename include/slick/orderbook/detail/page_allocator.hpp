@@ -0,0 +1,177 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Block allocator behind ObjectPool, placing memory as a MemoryConfig asks
+///
+/// The default config allocates from the heap. Otherwise blocks are anonymous mmap regions rounded up
+/// to whole pages: MAP_HUGETLB for PageSize::Huge (falling back to transparent huge pages when the
+/// reserved pool is empty), 2 MiB aligned and madvise(MADV_HUGEPAGE) for PageSize::Transparent, bound
+/// to a NUMA node with mbind (raw syscall, no libnuma dependency) and optionally prefaulted after
+/// binding, so pages are placed by the binding rather than by the first thread to touch them.
+/// Binding is best effort: a failed mbind leaves the block unbound and is counted.
+/// Non-Linux platforms always use the heap.
+class PageAllocator {
+public:
+    static constexpr std::size_t kPageSize = 4096;
+    static constexpr std::size_t kHugePageSize = 2 * 1024 * 1024;
+
+    /// Constructor
+    /// @param config Page backing, NUMA node and prefaulting of blocks
+    explicit PageAllocator(const MemoryConfig& config = {}) noexcept
+        : config_(config) {}
+
+    /// Get memory placement configuration
+    [[nodiscard]] const MemoryConfig& config() const noexcept { return config_; }
+
+    /// Check if blocks are mapped with mmap rather than taken from the heap
+    [[nodiscard]] bool mapped() const noexcept {
+#if defined(__linux__)
+        return config_.page_size != PageSize::Default || config_.numa_node >= 0 || config_.prefault;
+#else
+        return false;
+#endif
+    }
+
+    /// Get size blocks are rounded up to (1 for heap blocks)
+    [[nodiscard]] std::size_t granularity() const noexcept {
+        if (!mapped()) {
+            return 1;
+        }
+        return config_.page_size == PageSize::Default ? kPageSize : kHugePageSize;
+    }
+
+    /// Allocate a block
+    /// @param bytes Block size (mapped blocks are rounded up to granularity())
+    /// @param alignment Block alignment (at most kHugePageSize for mapped blocks)
+    /// @return Block memory, or nullptr if allocation fails
+    [[nodiscard]] void* allocate(std::size_t bytes, std::size_t alignment) noexcept {
+        if (!mapped()) {
+            return ::operator new(bytes, std::align_val_t{alignment}, std::nothrow);
+        }
+        SLICK_ASSERT(alignment <= kHugePageSize);
+#if defined(__linux__)
+        const std::size_t length = roundUp(bytes);
+        void* memory = MAP_FAILED;
+        if (config_.page_size == PageSize::Huge) {
+            memory = ::mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            huge_fallbacks_ += memory == MAP_FAILED ? 1 : 0;
+        }
+        if (memory == MAP_FAILED) {
+            const std::size_t page_alignment = config_.page_size == PageSize::Default ? kPageSize : kHugePageSize;
+            memory = mapAligned(length, std::max(page_alignment, alignment));
+            if (memory == nullptr) {
+                return nullptr;
+            }
+            if (config_.page_size != PageSize::Default) {
+                ::madvise(memory, length, MADV_HUGEPAGE);
+            }
+        }
+        if (config_.numa_node >= 0) {
+            bind_failures_ += bind(memory, length, config_.numa_node) ? 0 : 1;
+        }
+        if (config_.prefault) {
+            prefault(memory, length);
+        }
+        return memory;
+#else
+        return nullptr;
+#endif
+    }
+
+    /// Free a block
+    /// @param memory Block returned by allocate()
+    /// @param bytes Size passed to allocate()
+    /// @param alignment Alignment passed to allocate()
+    void deallocate(void* memory, std::size_t bytes, std::size_t alignment) noexcept {
+        if (!mapped()) {
+            ::operator delete(memory, std::align_val_t{alignment});
+            return;
+        }
+#if defined(__linux__)
+        ::munmap(memory, roundUp(bytes));
+#endif
+    }
+
+    /// Get number of PageSize::Huge blocks that fell back to transparent huge pages
+    [[nodiscard]] uint64_t hugePageFallbacks() const noexcept { return huge_fallbacks_; }
+
+    /// Get number of blocks whose NUMA binding failed
+    [[nodiscard]] uint64_t bindFailures() const noexcept { return bind_failures_; }
+
+private:
+    [[nodiscard]] std::size_t roundUp(std::size_t bytes) const noexcept {
+        const std::size_t unit = granularity();
+        return (bytes + unit - 1) / unit * unit;
+    }
+
+#if defined(__linux__)
+    /// Map length bytes aligned to alignment (a multiple of kPageSize), trimming the excess
+    [[nodiscard]] static void* mapAligned(std::size_t length, std::size_t alignment) noexcept {
+        const std::size_t padded = length + alignment - kPageSize;
+        void* raw = ::mmap(nullptr, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+            return nullptr;
+        }
+        const auto start = reinterpret_cast<std::uintptr_t>(raw);
+        const std::uintptr_t aligned = (start + alignment - 1) / alignment * alignment;
+        if (aligned > start) {
+            ::munmap(raw, aligned - start);
+        }
+        const std::size_t tail = start + padded - (aligned + length);
+        if (tail > 0) {
+            ::munmap(reinterpret_cast<void*>(aligned + length), tail);
+        }
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    /// Fault a mapped range in under its memory policy
+    /// MADV_POPULATE_WRITE (Linux 5.14) populates it in one call; older kernels get one write per page
+    static void prefault(void* memory, std::size_t length) noexcept {
+        constexpr int kMadvPopulateWrite = 23;
+        if (::madvise(memory, length, kMadvPopulateWrite) == 0) {
+            return;
+        }
+        auto* bytes = static_cast<volatile char*>(memory);
+        for (std::size_t offset = 0; offset < length; offset += kPageSize) {
+            bytes[offset] = 0;
+        }
+    }
+
+    /// Bind a mapped range to a NUMA node (MPOL_BIND)
+    [[nodiscard]] static bool bind(void* memory, std::size_t length, int node) noexcept {
+        constexpr int kMpolBind = 2;
+        constexpr std::size_t kMaskBits = 1024;
+        constexpr std::size_t kWordBits = sizeof(unsigned long) * 8;
+        if (static_cast<std::size_t>(node) >= kMaskBits) {
+            return false;
+        }
+        unsigned long mask[kMaskBits / kWordBits] = {};
+        mask[static_cast<std::size_t>(node) / kWordBits] = 1ul << (static_cast<std::size_t>(node) % kWordBits);
+        return ::syscall(SYS_mbind, memory, length, kMpolBind, mask, kMaskBits, 0) == 0;
+    }
+#endif
+
+    MemoryConfig config_;           // Page backing, NUMA node and prefaulting
+    uint64_t huge_fallbacks_ = 0;   // MAP_HUGETLB failures served with transparent huge pages
+    uint64_t bind_failures_ = 0;    // Blocks left unbound
+};
+
+SLICK_DETAIL_NAMESPACE_END
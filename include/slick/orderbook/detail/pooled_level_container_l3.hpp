@@ -0,0 +1,351 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/detail/price_level_l3.hpp>
+#include <slick/orderbook/detail/memory_pool.hpp>
+#include <slick/orderbook/detail/vector_capacity.hpp>
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Sorted index entry of PooledLevelContainerL3 (16 bytes)
+template<typename Level>
+struct PooledLevelEntry {
+    Price price;    // Level price
+    Level* level;   // Level in the container's pool
+};
+
+/// (price, level) pair handed out by PooledLevelContainerL3
+/// Same member names as LevelContainerL3's std::pair, so range-for with structured bindings,
+/// it->first and it->second read the same for both containers.
+template<typename Level>
+struct PooledLevelRef {
+    Price first;        // Level price
+    Level& second;      // Pooled level
+};
+
+/// operator-> result for PooledLevelRef-yielding iterators and pointers
+template<typename Ref>
+struct PooledLevelArrow {
+    Ref ref;
+
+    [[nodiscard]] constexpr const Ref* operator->() const noexcept { return &ref; }
+};
+
+/// Random access iterator over a PooledLevelContainerL3, best first
+template<typename Level, bool Const>
+class PooledLevelIterator {
+public:
+    using Entry = std::conditional_t<Const, const PooledLevelEntry<Level>, PooledLevelEntry<Level>>;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = PooledLevelRef<std::conditional_t<Const, const Level, Level>>;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type;
+    using pointer = PooledLevelArrow<reference>;
+
+    constexpr PooledLevelIterator() noexcept = default;
+    constexpr explicit PooledLevelIterator(Entry* entry) noexcept : entry_(entry) {}
+
+    /// iterator -> const_iterator
+    template<bool C = Const>
+        requires C
+    constexpr PooledLevelIterator(const PooledLevelIterator<Level, false>& other) noexcept : entry_(other.entry()) {}
+
+    [[nodiscard]] constexpr reference operator*() const noexcept { return {entry_->price, *entry_->level}; }
+    [[nodiscard]] constexpr pointer operator->() const noexcept { return {**this}; }
+    [[nodiscard]] constexpr reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+    constexpr PooledLevelIterator& operator++() noexcept { ++entry_; return *this; }
+    constexpr PooledLevelIterator operator++(int) noexcept { auto copy = *this; ++entry_; return copy; }
+    constexpr PooledLevelIterator& operator--() noexcept { --entry_; return *this; }
+    constexpr PooledLevelIterator operator--(int) noexcept { auto copy = *this; --entry_; return copy; }
+    constexpr PooledLevelIterator& operator+=(difference_type n) noexcept { entry_ += n; return *this; }
+    constexpr PooledLevelIterator& operator-=(difference_type n) noexcept { entry_ -= n; return *this; }
+
+    [[nodiscard]] friend constexpr PooledLevelIterator operator+(PooledLevelIterator it, difference_type n) noexcept {
+        return it += n;
+    }
+    [[nodiscard]] friend constexpr PooledLevelIterator operator+(difference_type n, PooledLevelIterator it) noexcept {
+        return it += n;
+    }
+    [[nodiscard]] friend constexpr PooledLevelIterator operator-(PooledLevelIterator it, difference_type n) noexcept {
+        return it -= n;
+    }
+    [[nodiscard]] friend constexpr difference_type operator-(PooledLevelIterator a, PooledLevelIterator b) noexcept {
+        return a.entry_ - b.entry_;
+    }
+    [[nodiscard]] friend constexpr bool operator==(PooledLevelIterator a, PooledLevelIterator b) noexcept = default;
+    [[nodiscard]] friend constexpr auto operator<=>(PooledLevelIterator a, PooledLevelIterator b) noexcept = default;
+
+    /// Get the index entry the iterator points at
+    [[nodiscard]] constexpr Entry* entry() const noexcept { return entry_; }
+
+private:
+    Entry* entry_ = nullptr;
+};
+
+/// Nullable pointer to one (price, level) pair of a PooledLevelContainerL3 (best(), atIndex())
+template<typename Level, bool Const>
+class PooledLevelPointer {
+public:
+    using Entry = std::conditional_t<Const, const PooledLevelEntry<Level>, PooledLevelEntry<Level>>;
+    using reference = PooledLevelRef<std::conditional_t<Const, const Level, Level>>;
+
+    constexpr explicit PooledLevelPointer(Entry* entry) noexcept : entry_(entry) {}
+
+    [[nodiscard]] constexpr reference operator*() const noexcept { return {entry_->price, *entry_->level}; }
+    [[nodiscard]] constexpr PooledLevelArrow<reference> operator->() const noexcept { return {**this}; }
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return entry_ != nullptr; }
+    [[nodiscard]] friend constexpr bool operator==(PooledLevelPointer p, std::nullptr_t) noexcept {
+        return p.entry_ == nullptr;
+    }
+
+private:
+    Entry* entry_;
+};
+
+/// Read-only view of a PooledLevelContainerL3 (OrderBookL3::getLevelsL3())
+template<typename Level>
+class PooledLevelView {
+public:
+    using value_type = PooledLevelRef<const Level>;
+    using iterator = PooledLevelIterator<Level, true>;
+    using const_iterator = iterator;
+
+    constexpr PooledLevelView() noexcept = default;
+    constexpr PooledLevelView(const PooledLevelEntry<Level>* entries, std::size_t size) noexcept
+        : entries_(entries), size_(size) {}
+
+    [[nodiscard]] constexpr iterator begin() const noexcept { return iterator(entries_); }
+    [[nodiscard]] constexpr iterator end() const noexcept { return iterator(entries_ + size_); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] constexpr value_type operator[](std::size_t index) const noexcept {
+        return {entries_[index].price, *entries_[index].level};
+    }
+    [[nodiscard]] constexpr value_type front() const noexcept { return (*this)[0]; }
+
+private:
+    const PooledLevelEntry<Level>* entries_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+/// Container for storing sorted L3 price levels out of line, in a pool
+///
+/// Same interface as LevelContainerL3, but the sorted vector holds only 16-byte (price, level pointer)
+/// entries and the levels themselves live in an ObjectPool. Creating or removing a level near the top
+/// shifts 16 bytes per deeper level instead of whole levels, level addresses stay stable, and once the
+/// pool has grown to the book's level count, new levels reuse freed slots without calling the global
+/// allocator. The cost is a pointer hop on every level read.
+///
+/// @tparam S Side (Buy = bids/descending, Sell = asks/ascending)
+/// @tparam Level Price level type (PriceLevelL3 or CompactPriceLevelL3)
+template<Side S, typename Level = PriceLevelL3>
+class PooledLevelContainerL3 {
+public:
+    using Entry = PooledLevelEntry<Level>;
+    using value_type = PooledLevelRef<Level>;
+    using iterator = PooledLevelIterator<Level, false>;
+    using const_iterator = PooledLevelIterator<Level, true>;
+    using view_type = PooledLevelView<Level>;
+    using Comparator = SideComparatorL3<S>;
+
+    /// Constructor with initial capacity
+    /// @param initial_capacity Initial capacity for levels (index entries and pooled levels)
+    explicit PooledLevelContainerL3(std::size_t initial_capacity = 32)
+        : pool_(initial_capacity) {
+        index_.reserve(initial_capacity);
+    }
+
+    ~PooledLevelContainerL3() {
+        clear();
+    }
+
+    PooledLevelContainerL3(const PooledLevelContainerL3&) = delete;
+    PooledLevelContainerL3& operator=(const PooledLevelContainerL3&) = delete;
+
+    // Levels keep their addresses: the pool's blocks move with it
+    PooledLevelContainerL3(PooledLevelContainerL3&& other) noexcept
+        : index_(std::exchange(other.index_, {})),
+          pool_(std::move(other.pool_)) {}
+
+    PooledLevelContainerL3& operator=(PooledLevelContainerL3&& other) noexcept {
+        if (this != &other) {
+            clear();
+            index_ = std::exchange(other.index_, {});
+            pool_ = std::move(other.pool_);
+        }
+        return *this;
+    }
+
+    /// Get Side
+    [[nodiscard]] static constexpr Side side() noexcept {
+        return S;
+    }
+
+    /// Get number of levels
+    [[nodiscard]] std::size_t size() const noexcept {
+        return index_.size();
+    }
+
+    /// Check if empty
+    [[nodiscard]] bool empty() const noexcept {
+        return index_.empty();
+    }
+
+    /// Get best level (first element), null if empty
+    [[nodiscard]] PooledLevelPointer<Level, false> best() noexcept {
+        return PooledLevelPointer<Level, false>(index_.empty() ? nullptr : index_.data());
+    }
+
+    [[nodiscard]] PooledLevelPointer<Level, true> best() const noexcept {
+        return PooledLevelPointer<Level, true>(index_.empty() ? nullptr : index_.data());
+    }
+
+    /// Find first level that does not sort before price (binary search over the index)
+    [[nodiscard]] iterator lower_bound(Price price) noexcept {
+        return iterator(index_.data() + lowerBoundIndex(price));
+    }
+
+    [[nodiscard]] const_iterator lower_bound(Price price) const noexcept {
+        return const_iterator(index_.data() + lowerBoundIndex(price));
+    }
+
+    /// Find level by price (binary search)
+    /// Returns iterator to level with matching price, or end() if not found
+    [[nodiscard]] iterator find(Price price) noexcept {
+        auto it = lower_bound(price);
+        return (it != end() && it.entry()->price == price) ? it : end();
+    }
+
+    [[nodiscard]] const_iterator find(Price price) const noexcept {
+        auto it = lower_bound(price);
+        return (it != end() && it.entry()->price == price) ? it : end();
+    }
+
+    /// Get level at index (0 = best), null if out of range
+    [[nodiscard]] PooledLevelPointer<Level, true> atIndex(std::size_t index) const noexcept {
+        return PooledLevelPointer<Level, true>(index < index_.size() ? &index_[index] : nullptr);
+    }
+
+    /// Get index of a level (0 = best)
+    [[nodiscard]] std::size_t indexOf(const_iterator it) const noexcept {
+        return static_cast<std::size_t>(it.entry() - index_.data());
+    }
+
+    /// Get index of a level, saturated at limit (returns limit if the level is limit or more deep)
+    [[nodiscard]] std::size_t indexOf(const_iterator it, std::size_t limit) const noexcept {
+        return std::min(indexOf(it), limit);
+    }
+
+    /// Number of levels strictly better than price (index the price has or would have)
+    [[nodiscard]] std::size_t lowerBoundIndex(Price price) const noexcept {
+        const auto it = std::lower_bound(index_.begin(), index_.end(), price,
+            [](const Entry& entry, Price key) { return Comparator{}(entry.price, key); });
+        return static_cast<std::size_t>(it - index_.begin());
+    }
+
+    /// Find level by price, creating an empty level if it does not exist
+    /// Returns iterator to the level and whether insertion occurred
+    std::pair<iterator, bool> findOrInsert(Price price) {
+        const std::size_t index = lowerBoundIndex(price);
+        if (index < index_.size() && index_[index].price == price) {
+            return {iterator(index_.data() + index), false};
+        }
+        Level* level = pool_.construct(price);
+        if (SLICK_UNLIKELY(level == nullptr)) {
+            throw std::bad_alloc();
+        }
+        try {
+            index_.insert(index_.begin() + static_cast<std::ptrdiff_t>(index), Entry{price, level});
+        } catch (...) {
+            pool_.destroy(level);
+            throw;
+        }
+        return {iterator(index_.data() + index), true};
+    }
+
+    /// Remove level by iterator, returning its slot to the pool
+    iterator erase(iterator it) noexcept {
+        const auto index = it.entry() - index_.data();
+        Level* level = it.entry()->level;
+        index_.erase(index_.begin() + index);
+        pool_.destroy(level);
+        return iterator(index_.data() + index);
+    }
+
+    /// Clear all levels (pooled slots are kept for reuse)
+    void clear() noexcept {
+        for (const Entry& entry : index_) {
+            pool_.destroy(entry.level);
+        }
+        index_.clear();
+    }
+
+    /// Reserve capacity for index entries and pooled levels
+    void reserve(std::size_t capacity) {
+        index_.reserve(capacity);
+        pool_.reserve(capacity);
+    }
+
+    /// Check whether a level at price can be inserted (any price can)
+    [[nodiscard]] static constexpr bool accepts(Price) noexcept {
+        return true;
+    }
+
+    /// Get capacity
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return index_.capacity();
+    }
+
+    /// Get number of levels the pool holds without growing
+    [[nodiscard]] std::size_t poolCapacity() const noexcept {
+        return pool_.capacity();
+    }
+
+    /// Shrink the index and the level pool to max(size(), keep_capacity) levels (pooled levels never move)
+    void trim(std::size_t keep_capacity = 0) {
+        trimCapacity(index_, keep_capacity);
+        pool_.trim(std::max(index_.size(), keep_capacity));
+    }
+
+    /// Shrink the index and the level pool to the levels held
+    void shrink_to_fit() {
+        trim(0);
+    }
+
+    /// Get bytes held by the index and the level pool
+    [[nodiscard]] std::size_t memoryUsage() const noexcept {
+        return index_.capacity() * sizeof(Entry) + pool_.memoryUsage();
+    }
+
+    /// Zero-copy view of all levels in sorted order (best first)
+    [[nodiscard]] view_type view() const noexcept {
+        return view_type(index_.data(), index_.size());
+    }
+
+    /// Iterators
+    [[nodiscard]] iterator begin() noexcept { return iterator(index_.data()); }
+    [[nodiscard]] iterator end() noexcept { return iterator(index_.data() + index_.size()); }
+    [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(index_.data()); }
+    [[nodiscard]] const_iterator end() const noexcept { return const_iterator(index_.data() + index_.size()); }
+    [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+private:
+    std::vector<Entry> index_;      // Sorted (price, level) entries, best first
+    ObjectPool<Level> pool_;        // Level storage
+};
+
+SLICK_DETAIL_NAMESPACE_END
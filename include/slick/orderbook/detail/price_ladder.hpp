@@ -0,0 +1,581 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/detail/price_level_l2.hpp>
+#include <slick/orderbook/detail/price_level_l3.hpp>
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Per-value hooks used by BasicPriceLadder to create an empty level and read its price
+template<typename Value>
+struct LadderValueTraits;
+
+template<typename P, typename Q>
+struct LadderValueTraits<BasicPriceLevelL2<P, Q>> {
+    using Value = BasicPriceLevelL2<P, Q>;
+    [[nodiscard]] static Value make(Price price) noexcept { return Value{price, 0, 0}; }
+    [[nodiscard]] static Price price(const Value& level) noexcept { return level.price; }
+};
+
+template<typename OrderT>
+struct LadderValueTraits<std::pair<Price, BasicPriceLevelL3<OrderT>>> {
+    using Value = std::pair<Price, BasicPriceLevelL3<OrderT>>;
+    [[nodiscard]] static Value make(Price price) noexcept { return {price, BasicPriceLevelL3<OrderT>{price}}; }
+    [[nodiscard]] static Price price(const Value& level) noexcept { return level.first; }
+};
+
+/// Index of the first set bit at or after from, or num_slots if none
+[[nodiscard]] inline std::size_t ladderNextSet(const uint64_t* bits, std::size_t num_slots, std::size_t from) noexcept {
+    if (from >= num_slots) {
+        return num_slots;
+    }
+    std::size_t word = from >> 6;
+    uint64_t w = bits[word] & (~uint64_t{0} << (from & 63));
+    const std::size_t num_words = num_slots >> 6;
+    while (w == 0) {
+        if (++word == num_words) {
+            return num_slots;
+        }
+        w = bits[word];
+    }
+    return (word << 6) + static_cast<std::size_t>(std::countr_zero(w));
+}
+
+/// Index of the last set bit at or before from, or num_slots if none
+[[nodiscard]] inline std::size_t ladderPrevSet(const uint64_t* bits, std::size_t num_slots, std::size_t from) noexcept {
+    std::size_t word = from >> 6;
+    uint64_t w = bits[word] & (~uint64_t{0} >> (63 - (from & 63)));
+    while (w == 0) {
+        if (word-- == 0) {
+            return num_slots;
+        }
+        w = bits[word];
+    }
+    return (word << 6) + 63 - static_cast<std::size_t>(std::countl_zero(w));
+}
+
+/// Number of set bits in slots [from, to)
+[[nodiscard]] inline std::size_t ladderCount(const uint64_t* bits, std::size_t from, std::size_t to) noexcept {
+    if (from >= to) {
+        return 0;
+    }
+    std::size_t first_word = from >> 6;
+    const std::size_t last_word = (to - 1) >> 6;
+    const uint64_t head_mask = ~uint64_t{0} << (from & 63);
+    const uint64_t tail_mask = ~uint64_t{0} >> (63 - ((to - 1) & 63));
+    if (first_word == last_word) {
+        return static_cast<std::size_t>(std::popcount(bits[first_word] & head_mask & tail_mask));
+    }
+    std::size_t count = static_cast<std::size_t>(std::popcount(bits[first_word] & head_mask));
+    for (++first_word; first_word < last_word; ++first_word) {
+        count += static_cast<std::size_t>(std::popcount(bits[first_word]));
+    }
+    return count + static_cast<std::size_t>(std::popcount(bits[last_word] & tail_mask));
+}
+
+/// Number of set bits in slots [from, to), saturated at limit
+/// Stops scanning once limit bits were counted, so the cost is bounded by the limit-th level
+[[nodiscard]] inline std::size_t ladderCountUpTo(const uint64_t* bits, std::size_t from, std::size_t to,
+                                                 std::size_t limit) noexcept {
+    std::size_t count = 0;
+    while (from < to && count < limit) {
+        const std::size_t word = from >> 6;
+        const std::size_t word_end = std::min(to, (word + 1) << 6);
+        uint64_t mask = ~uint64_t{0} << (from & 63);
+        if (word_end & 63) {
+            mask &= ~(~uint64_t{0} << (word_end & 63));
+        }
+        count += static_cast<std::size_t>(std::popcount(bits[word] & mask));
+        from = word_end;
+    }
+    return std::min(count, limit);
+}
+
+/// Forward iterator over the occupied slots of a price ladder (best first)
+template<typename Value, bool Const>
+class LadderIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const Value*, Value*>;
+    using reference = std::conditional_t<Const, const Value&, Value&>;
+
+    constexpr LadderIterator() noexcept = default;
+    constexpr LadderIterator(pointer slots, const uint64_t* bits, std::size_t num_slots, std::size_t slot) noexcept
+        : slots_(slots), bits_(bits), num_slots_(num_slots), slot_(slot) {}
+
+    /// Allow iterator -> const_iterator conversion
+    constexpr operator LadderIterator<Value, true>() const noexcept requires (!Const) {
+        return LadderIterator<Value, true>(slots_, bits_, num_slots_, slot_);
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept { return slots_[slot_]; }
+    [[nodiscard]] constexpr pointer operator->() const noexcept { return slots_ + slot_; }
+
+    LadderIterator& operator++() noexcept {
+        slot_ = ladderNextSet(bits_, num_slots_, slot_ + 1);
+        return *this;
+    }
+
+    LadderIterator operator++(int) noexcept {
+        LadderIterator tmp = *this;
+        ++(*this);
+        return tmp;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const LadderIterator& other) const noexcept {
+        return slot_ == other.slot_;
+    }
+
+    /// Ladder slot index of the current level
+    [[nodiscard]] constexpr std::size_t slot() const noexcept { return slot_; }
+
+private:
+    pointer slots_ = nullptr;
+    const uint64_t* bits_ = nullptr;
+    std::size_t num_slots_ = 0;
+    std::size_t slot_ = 0;
+};
+
+/// Read-only range over the occupied levels of a price ladder (best first)
+/// Side-independent, so bid and ask ladders share one view type
+template<typename Value>
+class LadderView {
+public:
+    using value_type = Value;
+    using iterator = LadderIterator<Value, true>;
+    using const_iterator = iterator;
+
+    constexpr LadderView() noexcept = default;
+    constexpr LadderView(const Value* slots, const uint64_t* bits, std::size_t num_slots,
+                         std::size_t first, std::size_t count) noexcept
+        : slots_(slots), bits_(bits), num_slots_(num_slots), first_(first), count_(count) {}
+
+    [[nodiscard]] iterator begin() const noexcept { return iterator(slots_, bits_, num_slots_, first_); }
+    [[nodiscard]] iterator end() const noexcept { return iterator(slots_, bits_, num_slots_, num_slots_); }
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+    [[nodiscard]] const Value& front() const noexcept { return slots_[first_]; }
+
+private:
+    const Value* slots_ = nullptr;
+    const uint64_t* bits_ = nullptr;
+    std::size_t num_slots_ = 0;
+    std::size_t first_ = 0;
+    std::size_t count_ = 0;
+};
+
+/// Tick-indexed price ladder for instruments whose prices stay within a bounded band
+///
+/// Levels live in a flat array indexed by (price - base) / tick_size, with an occupancy
+/// bitmap over the slots. Bids are stored mirrored (highest price in the lowest slot), so
+/// for both sides slot order is best first:
+/// - find / insert / erase are O(1) (one division and a bit flip)
+/// - the next best level after removing the best is a countr_zero scan of the bitmap
+/// - level index is a popcount over the words between the best slot and the level
+///
+/// A price outside the ladder re-centers it (moving resting levels), doubling the width
+/// when the occupied band no longer fits, up to max_ticks. Memory is num_ticks * sizeof(Value)
+/// per side, at most max_ticks * sizeof(Value).
+///
+/// Prices must lie on the tick grid of the resting levels (a multiple of tick_size away from
+/// them) and keep the occupied band within max_ticks. Books check accepts() before inserting
+/// and reject other prices; find() and friends treat them as absent.
+///
+/// @tparam S Side (Buy = bids, Sell = asks)
+/// @tparam Value Stored level type (BasicPriceLevelL2, or std::pair<Price, PriceLevelL3>)
+template<Side S, typename Value>
+class BasicPriceLadder {
+    using ValueTraits = LadderValueTraits<Value>;
+
+public:
+    using value_type = Value;
+    using iterator = LadderIterator<Value, false>;
+    using const_iterator = LadderIterator<Value, true>;
+    using view_type = LadderView<Value>;
+
+    /// Constructor with default ladder configuration
+    /// @param initial_capacity Unused; the ladder is sized in ticks (see PriceLadderConfig)
+    explicit BasicPriceLadder(std::size_t initial_capacity = 32)
+        : BasicPriceLadder(PriceLadderConfig{}) {
+        (void)initial_capacity;
+    }
+
+    /// Constructor with explicit tick size and width
+    explicit BasicPriceLadder(const PriceLadderConfig& config)
+        : tick_size_(config.tick_size) {
+        SLICK_ASSERT(config.tick_size > 0);
+        allocate(roundSlots(config.num_ticks));
+        max_slots_ = std::max(slots_.size(), roundSlots(config.max_ticks));
+    }
+
+    /// Get Side
+    [[nodiscard]] static constexpr Side side() noexcept {
+        return S;
+    }
+
+    /// Get number of levels
+    [[nodiscard]] std::size_t size() const noexcept {
+        return count_;
+    }
+
+    /// Check if empty
+    [[nodiscard]] bool empty() const noexcept {
+        return count_ == 0;
+    }
+
+    /// Get tick size
+    [[nodiscard]] Price tickSize() const noexcept {
+        return tick_size_;
+    }
+
+    /// Get number of slots (ladder width in ticks)
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return slots_.size();
+    }
+
+    /// Get widest the ladder may grow to, in ticks
+    [[nodiscard]] std::size_t maxCapacity() const noexcept {
+        return max_slots_;
+    }
+
+    /// Ladder is sized in ticks; level reservation is a no-op
+    void reserve(std::size_t) noexcept {}
+
+    /// Ladder is sized in ticks; trimming is a no-op (the width follows the resting price range)
+    void trim(std::size_t = 0) noexcept {}
+
+    /// Ladder is sized in ticks; trimming is a no-op
+    void shrink_to_fit() noexcept {}
+
+    /// Get bytes held by the slots and the occupancy bitmap
+    [[nodiscard]] std::size_t memoryUsage() const noexcept {
+        return slots_.capacity() * sizeof(Value) + bits_.capacity() * sizeof(uint64_t);
+    }
+
+    /// Check whether a level at price can be inserted
+    /// False if the price is off the tick grid of the resting levels, or if the levels and price
+    /// would span more than maxCapacity() ticks. Always true when the ladder is empty.
+    [[nodiscard]] bool accepts(Price price) const noexcept {
+        if (count_ == 0 || slotOf(price) != npos) {
+            return true;
+        }
+        if (!onGrid(price)) {
+            return false;
+        }
+        return spanWith(keyOf(price)) <= max_slots_;
+    }
+
+    /// Get best level
+    [[nodiscard]] Value* best() noexcept {
+        return count_ ? &slots_[best_] : nullptr;
+    }
+
+    [[nodiscard]] const Value* best() const noexcept {
+        return count_ ? &slots_[best_] : nullptr;
+    }
+
+    /// Find level by price
+    /// Returns iterator to level with matching price, or end() if not found
+    [[nodiscard]] iterator find(Price price) noexcept {
+        const std::size_t slot = slotOf(price);
+        return (slot != npos && test(slot)) ? makeIterator(slot) : end();
+    }
+
+    [[nodiscard]] const_iterator find(Price price) const noexcept {
+        const std::size_t slot = slotOf(price);
+        return (slot != npos && test(slot)) ? makeIterator(slot) : end();
+    }
+
+    /// Get level by price (returns pointer or nullptr)
+    [[nodiscard]] const Value* getLevel(Price price) const noexcept {
+        const std::size_t slot = slotOf(price);
+        return (slot != npos && test(slot)) ? &slots_[slot] : nullptr;
+    }
+
+    /// Find level by price, creating an empty level if it does not exist
+    /// Returns iterator to the level and whether insertion occurred, or end() if !accepts(price)
+    std::pair<iterator, bool> findOrInsert(Price price) {
+        std::size_t slot = slotOf(price);
+        if (SLICK_UNLIKELY(slot == npos)) {
+            if (!accepts(price)) {
+                return {end(), false};
+            }
+            recenter(price);
+            slot = slotOf(price);
+            SLICK_ASSERT(slot != npos);
+        }
+        if (test(slot)) {
+            return {makeIterator(slot), false};
+        }
+        bits_[slot >> 6] |= uint64_t{1} << (slot & 63);
+        slots_[slot] = ValueTraits::make(price);
+        ++count_;
+        if (slot < best_) {
+            best_ = slot;
+        }
+        return {makeIterator(slot), true};
+    }
+
+    /// Insert or update a level (L2 levels)
+    /// If price exists, updates quantity; otherwise inserts new level
+    /// Returns iterator to the level and whether insertion occurred, or end() if !accepts(price)
+    std::pair<iterator, bool> insertOrUpdate(Price price, Quantity quantity, Timestamp timestamp)
+        requires IsPriceLevelL2<Value> {
+        auto result = findOrInsert(price);
+        if (SLICK_UNLIKELY(result.first == end())) {
+            return result;
+        }
+        result.first->quantity = static_cast<typename Value::quantity_type>(quantity);
+        result.first->timestamp = timestamp;
+        return result;
+    }
+
+    /// Remove level by iterator
+    /// Returns iterator to the next level
+    iterator erase(const_iterator it) noexcept {
+        const std::size_t slot = it.slot();
+        SLICK_ASSERT(slot < slots_.size() && test(slot));
+        bits_[slot >> 6] &= ~(uint64_t{1} << (slot & 63));
+        slots_[slot] = ValueTraits::make(0);
+        --count_;
+        const std::size_t next = ladderNextSet(bits_.data(), slots_.size(), slot + 1);
+        if (slot == best_) {
+            best_ = next;
+        }
+        return makeIterator(next);
+    }
+
+    /// Remove level by price
+    /// Returns true if level was found and removed
+    bool erase(Price price) noexcept {
+        auto it = find(price);
+        if (it != end()) {
+            erase(it);
+            return true;
+        }
+        return false;
+    }
+
+    /// Clear all levels (the ladder re-centers on the next insert)
+    void clear() noexcept {
+        for (std::size_t slot = best_; slot < slots_.size(); slot = ladderNextSet(bits_.data(), slots_.size(), slot + 1)) {
+            slots_[slot] = ValueTraits::make(0);
+        }
+        std::fill(bits_.begin(), bits_.end(), 0);
+        count_ = 0;
+        best_ = slots_.size();
+        anchored_ = false;
+    }
+
+    /// Get index of a level (0 = best)
+    [[nodiscard]] std::size_t indexOf(const_iterator it) const noexcept {
+        return ladderCount(bits_.data(), best_, it.slot());
+    }
+
+    /// Get index of a level, saturated at limit (returns limit if the level is limit or more deep)
+    /// Only scans the bitmap up to the limit-th level
+    [[nodiscard]] std::size_t indexOf(const_iterator it, std::size_t limit) const noexcept {
+        return ladderCountUpTo(bits_.data(), best_, it.slot(), limit);
+    }
+
+    /// Number of levels strictly better than price (index the price has or would have)
+    [[nodiscard]] std::size_t lowerBoundIndex(Price price) const noexcept {
+        if (count_ == 0) {
+            return 0;
+        }
+        // Round off-grid prices towards worse ones: the levels better than price are the same
+        const Price delta = keyOf(price) - base_key_;
+        const Price offset = delta / tick_size_ + (delta > 0 && delta % tick_size_ != 0 ? 1 : 0);
+        if (offset < 0) {
+            return 0;
+        }
+        if (offset >= static_cast<Price>(slots_.size())) {
+            return count_;
+        }
+        return ladderCount(bits_.data(), best_, static_cast<std::size_t>(offset));
+    }
+
+    /// Get level at index (0 = best), or nullptr if out of range
+    [[nodiscard]] const Value* atIndex(std::size_t index) const noexcept {
+        if (index >= count_) {
+            return nullptr;
+        }
+        std::size_t word = best_ >> 6;
+        uint64_t w = bits_[word] & (~uint64_t{0} << (best_ & 63));
+        for (;;) {
+            const auto n = static_cast<std::size_t>(std::popcount(w));
+            if (index < n) {
+                break;
+            }
+            index -= n;
+            w = bits_[++word];
+        }
+        // Clear the lowest index set bits, then the next one is the level
+        for (; index > 0; --index) {
+            w &= w - 1;
+        }
+        return &slots_[(word << 6) + static_cast<std::size_t>(std::countr_zero(w))];
+    }
+
+    /// Get all levels up to depth (L2 levels)
+    /// @param depth Maximum number of levels to return (0 = all)
+    [[nodiscard]] std::vector<Value> getLevels(std::size_t depth = 0) const
+        requires std::copy_constructible<Value> {
+        const std::size_t count = (depth == 0) ? count_ : std::min(depth, count_);
+        std::vector<Value> result;
+        result.reserve(count);
+        for (auto it = begin(); result.size() < count; ++it) {
+            result.push_back(*it);
+        }
+        return result;
+    }
+
+    /// Read-only view of all levels (best first)
+    [[nodiscard]] view_type view() const noexcept {
+        return view_type(slots_.data(), bits_.data(), slots_.size(), best_, count_);
+    }
+
+    /// Iterators (best first)
+    [[nodiscard]] iterator begin() noexcept { return makeIterator(best_); }
+    [[nodiscard]] iterator end() noexcept { return makeIterator(slots_.size()); }
+    [[nodiscard]] const_iterator begin() const noexcept { return makeIterator(best_); }
+    [[nodiscard]] const_iterator end() const noexcept { return makeIterator(slots_.size()); }
+    [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+private:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+    static constexpr std::size_t kMinSlots = 64;
+
+    [[nodiscard]] static std::size_t roundSlots(std::size_t num_ticks) noexcept {
+        return std::max(kMinSlots, (num_ticks + 63) & ~std::size_t{63});
+    }
+
+    /// Sort key: negated for bids so that slot order is best first on both sides
+    [[nodiscard]] static constexpr Price keyOf(Price price) noexcept {
+        if constexpr (S == Side::Buy) {
+            return -price;
+        } else {
+            return price;
+        }
+    }
+
+    [[nodiscard]] bool onGrid(Price price) const noexcept {
+        return tick_size_ == 1 || (keyOf(price) - base_key_) % tick_size_ == 0;
+    }
+
+    /// Slot for price, or npos if outside the ladder or off the tick grid
+    [[nodiscard]] std::size_t slotOf(Price price) const noexcept {
+        if (SLICK_UNLIKELY(!anchored_)) {
+            return npos;
+        }
+        const Price delta = keyOf(price) - base_key_;
+        if (tick_size_ == 1) {
+            return (delta >= 0 && delta < static_cast<Price>(slots_.size())) ? static_cast<std::size_t>(delta) : npos;
+        }
+        const Price offset = delta / tick_size_;
+        return (delta >= 0 && delta % tick_size_ == 0 && offset < static_cast<Price>(slots_.size()))
+            ? static_cast<std::size_t>(offset) : npos;
+    }
+
+    /// Number of ticks from the best to the worst of the resting levels and key (ladder not empty)
+    [[nodiscard]] std::size_t spanWith(Price key) const noexcept {
+        const std::size_t worst = ladderPrevSet(bits_.data(), slots_.size(), slots_.size() - 1);
+        const Price min_key = std::min(key, base_key_ + static_cast<Price>(best_) * tick_size_);
+        const Price max_key = std::max(key, base_key_ + static_cast<Price>(worst) * tick_size_);
+        return static_cast<std::size_t>((max_key - min_key) / tick_size_) + 1;
+    }
+
+    [[nodiscard]] bool test(std::size_t slot) const noexcept {
+        return (bits_[slot >> 6] >> (slot & 63)) & 1;
+    }
+
+    [[nodiscard]] iterator makeIterator(std::size_t slot) noexcept {
+        return iterator(slots_.data(), bits_.data(), slots_.size(), slot);
+    }
+
+    [[nodiscard]] const_iterator makeIterator(std::size_t slot) const noexcept {
+        return const_iterator(slots_.data(), bits_.data(), slots_.size(), slot);
+    }
+
+    void allocate(std::size_t num_slots) {
+        slots_.clear();
+        slots_.reserve(num_slots);
+        for (std::size_t i = 0; i < num_slots; ++i) {
+            slots_.push_back(ValueTraits::make(0));
+        }
+        bits_.assign(num_slots >> 6, 0);
+        best_ = num_slots;
+    }
+
+    /// Move the ladder so that price fits, growing it if the occupied band is too wide
+    /// Precondition: accepts(price)
+    void recenter(Price price) {
+        const Price key = keyOf(price);
+        if (count_ == 0) {
+            // Leave a quarter of the ladder for better prices, the rest for worse ones
+            base_key_ = key - static_cast<Price>(slots_.size() / 4) * tick_size_;
+            anchored_ = true;
+            return;
+        }
+
+        const Price min_key = std::min(key, base_key_ + static_cast<Price>(best_) * tick_size_);
+        const std::size_t span = spanWith(key);
+        SLICK_ASSERT(span <= max_slots_);
+
+        // Keep at least a quarter of the ladder free after re-centering, within the width limit
+        std::size_t num_slots = slots_.size();
+        while (span > num_slots - num_slots / 4 && num_slots < max_slots_) {
+            num_slots = std::min(num_slots * 2, max_slots_);
+        }
+        const Price new_base = min_key - static_cast<Price>((num_slots - span) / 2) * tick_size_;
+
+        std::vector<Value> old_slots = std::move(slots_);
+        std::vector<uint64_t> old_bits = std::move(bits_);
+        const Price old_base = base_key_;
+        allocate(num_slots);
+        base_key_ = new_base;
+
+        for (std::size_t slot = ladderNextSet(old_bits.data(), old_slots.size(), 0); slot < old_slots.size();
+             slot = ladderNextSet(old_bits.data(), old_slots.size(), slot + 1)) {
+            const auto new_slot = static_cast<std::size_t>((old_base + static_cast<Price>(slot) * tick_size_ - new_base) / tick_size_);
+            slots_[new_slot] = std::move(old_slots[slot]);
+            bits_[new_slot >> 6] |= uint64_t{1} << (new_slot & 63);
+            best_ = std::min(best_, new_slot);
+        }
+    }
+
+    std::vector<Value> slots_;          // Level per tick, best first
+    std::vector<uint64_t> bits_;        // Occupancy bitmap over slots_
+    Price base_key_ = 0;                // Sort key of slot 0
+    Price tick_size_ = 1;               // Price increment between slots
+    std::size_t max_slots_ = 0;         // Width limit in slots
+    std::size_t count_ = 0;             // Number of occupied slots
+    std::size_t best_ = 0;              // Slot of best level (slots_.size() when empty)
+    bool anchored_ = false;             // base_key_ has been positioned
+};
+
+/// Tick-indexed ladder for L2 price levels
+template<Side S>
+using PriceLadder = BasicPriceLadder<S, PriceLevelL2>;
+
+/// Tick-indexed ladder for L3 price levels
+/// @tparam Level Price level type (PriceLevelL3 or CompactPriceLevelL3)
+template<Side S, typename Level = PriceLevelL3>
+using PriceLadderL3 = BasicPriceLadder<S, std::pair<Price, Level>>;
+
+SLICK_DETAIL_NAMESPACE_END
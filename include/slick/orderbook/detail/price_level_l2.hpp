@@ -5,21 +5,29 @@
 
 #include <slick/orderbook/config.hpp>
 #include <slick/orderbook/types.hpp>
+#include <type_traits>
 
 SLICK_DETAIL_NAMESPACE_BEGIN
 
 /// Price level for Level 2 orderbook (aggregated)
 /// Stores total quantity at a specific price point
-struct PriceLevelL2 {
-    Price price;          // Price level
-    Quantity quantity;    // Total quantity at this price
+/// @tparam P Stored price type (see FixedPoint; 64-bit by default)
+/// @tparam Q Stored quantity type
+template<typename P = Price, typename Q = Quantity>
+struct BasicPriceLevelL2 {
+    using price_type = P;
+    using quantity_type = Q;
+
+    P price;              // Price level
+    Q quantity;           // Total quantity at this price
     Timestamp timestamp;  // Last update timestamp
 
-    constexpr PriceLevelL2() noexcept
+    constexpr BasicPriceLevelL2() noexcept
         : price(0), quantity(0), timestamp(0) {}
 
-    constexpr PriceLevelL2(Price p, Quantity q, Timestamp ts) noexcept
-        : price(p), quantity(q), timestamp(ts) {}
+    /// Callers keep price and quantity within the range of P and Q
+    constexpr BasicPriceLevelL2(Price p, Quantity q, Timestamp ts) noexcept
+        : price(static_cast<P>(p)), quantity(static_cast<Q>(q)), timestamp(ts) {}
 
     /// Check if this level is empty
     [[nodiscard]] constexpr bool isEmpty() const noexcept {
@@ -27,67 +35,75 @@ struct PriceLevelL2 {
     }
 
     /// Comparison operators for sorting
-    [[nodiscard]] constexpr bool operator==(const PriceLevelL2& other) const noexcept {
+    [[nodiscard]] constexpr bool operator==(const BasicPriceLevelL2& other) const noexcept {
         return price == other.price;
     }
 
-    [[nodiscard]] constexpr bool operator!=(const PriceLevelL2& other) const noexcept {
+    [[nodiscard]] constexpr bool operator!=(const BasicPriceLevelL2& other) const noexcept {
         return price != other.price;
     }
 
-    [[nodiscard]] constexpr bool operator<(const PriceLevelL2& other) const noexcept {
+    [[nodiscard]] constexpr bool operator<(const BasicPriceLevelL2& other) const noexcept {
         return price < other.price;
     }
 
-    [[nodiscard]] constexpr bool operator>(const PriceLevelL2& other) const noexcept {
+    [[nodiscard]] constexpr bool operator>(const BasicPriceLevelL2& other) const noexcept {
         return price > other.price;
     }
 
-    [[nodiscard]] constexpr bool operator<=(const PriceLevelL2& other) const noexcept {
+    [[nodiscard]] constexpr bool operator<=(const BasicPriceLevelL2& other) const noexcept {
         return price <= other.price;
     }
 
-    [[nodiscard]] constexpr bool operator>=(const PriceLevelL2& other) const noexcept {
+    [[nodiscard]] constexpr bool operator>=(const BasicPriceLevelL2& other) const noexcept {
         return price >= other.price;
     }
 };
 
-/// Comparator for sorting bid levels (descending price)
-struct BidComparator {
-    [[nodiscard]] constexpr bool operator()(const PriceLevelL2& a, const PriceLevelL2& b) const noexcept {
-        return a.price > b.price;  // Descending: highest bid first
-    }
+/// Price level with 64-bit price and quantity (the default)
+using PriceLevelL2 = BasicPriceLevelL2<>;
 
-    [[nodiscard]] constexpr bool operator()(Price a, const PriceLevelL2& b) const noexcept {
-        return a > b.price;
-    }
+static_assert(sizeof(PriceLevelL2) == 24);
+static_assert(sizeof(BasicPriceLevelL2<int32_t, int32_t>) == 16);
 
-    [[nodiscard]] constexpr bool operator()(const PriceLevelL2& a, Price b) const noexcept {
-        return a.price > b;
-    }
+/// Check if a type is a BasicPriceLevelL2 of any width
+template<typename T>
+inline constexpr bool IsPriceLevelL2 = false;
 
-    [[nodiscard]] constexpr bool operator()(Price a, Price b) const noexcept {
-        return a > b;
-    }
-};
+template<typename P, typename Q>
+inline constexpr bool IsPriceLevelL2<BasicPriceLevelL2<P, Q>> = true;
 
-/// Comparator for sorting ask levels (ascending price)
-struct AskComparator {
-    [[nodiscard]] constexpr bool operator()(const PriceLevelL2& a, const PriceLevelL2& b) const noexcept {
-        return a.price < b.price;  // Ascending: lowest ask first
-    }
+/// Copy a level of any width into a 64-bit PriceLevelL2 (what depth snapshots and analytics read)
+template<typename P, typename Q>
+[[nodiscard]] constexpr PriceLevelL2 widenLevel(const BasicPriceLevelL2<P, Q>& level) noexcept {
+    return PriceLevelL2{level.price, level.quantity, level.timestamp};
+}
 
-    [[nodiscard]] constexpr bool operator()(Price a, const PriceLevelL2& b) const noexcept {
-        return a < b.price;
-    }
+/// Sort key of a level or a bare price
+template<typename P, typename Q>
+[[nodiscard]] constexpr Price levelKey(const BasicPriceLevelL2<P, Q>& level) noexcept { return level.price; }
+[[nodiscard]] constexpr Price levelKey(Price price) noexcept { return price; }
 
-    [[nodiscard]] constexpr bool operator()(const PriceLevelL2& a, Price b) const noexcept {
-        return a.price < b;
+/// Comparator for sorting bid levels (descending price)
+/// Compares levels of any width with each other and with bare prices
+struct BidComparator {
+    template<typename A, typename B>
+    [[nodiscard]] constexpr bool operator()(const A& a, const B& b) const noexcept {
+        return levelKey(a) > levelKey(b);  // Descending: highest bid first
     }
+};
 
-    [[nodiscard]] constexpr bool operator()(Price a, Price b) const noexcept {
-        return a < b;
+/// Comparator for sorting ask levels (ascending price)
+struct AskComparator {
+    template<typename A, typename B>
+    [[nodiscard]] constexpr bool operator()(const A& a, const B& b) const noexcept {
+        return levelKey(a) < levelKey(b);  // Ascending: lowest ask first
     }
 };
 
+/// Compile-time comparator selection for a side (Buy = descending, Sell = ascending)
+/// Stateless, so every probe of a binary search is inlined instead of an indirect call
+template<Side S>
+using SideComparator = std::conditional_t<S == Side::Buy, BidComparator, AskComparator>;
+
 SLICK_DETAIL_NAMESPACE_END
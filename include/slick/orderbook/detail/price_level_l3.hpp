@@ -6,19 +6,55 @@
 #include <slick/orderbook/config.hpp>
 #include <slick/orderbook/types.hpp>
 #include <slick/orderbook/detail/intrusive_list.hpp>
+#include <slick/orderbook/detail/indexed_list.hpp>
+#include <slick/orderbook/detail/indexed_pool.hpp>
+#include <slick/orderbook/detail/memory_pool.hpp>
 #include <slick/orderbook/detail/order.hpp>
+#include <slick/orderbook/detail/queue_position_index.hpp>
+#include <slick/orderbook/detail/queue_skip_index.hpp>
+#include <algorithm>
+#include <memory>
+#include <type_traits>
 
 SLICK_DETAIL_NAMESPACE_BEGIN
 
+/// Queue and pool types for an order layout
+/// Order is pointer-linked and pooled in an ObjectPool; CompactOrder is index-linked and pooled in an IndexedObjectPool
+template<typename OrderT>
+struct OrderStorage {
+    using List = IntrusiveList<OrderT>;
+    using Pool = ObjectPool<OrderT>;
+};
+
+template<>
+struct OrderStorage<CompactOrder> {
+    using List = IndexedList<CompactOrder>;
+    using Pool = IndexedObjectPool<CompactOrder>;
+};
+
+/// Placeholder for the queue position index of layouts without a `queue_slot`
+struct NoQueuePositionIndex {};
+
 /// Price level for Level 3 orderbook (order-by-order)
 /// Maintains a queue of individual orders at this price level
-struct PriceLevelL3 {
+/// @tparam OrderT Order layout (Order or CompactOrder)
+template<typename OrderT>
+struct BasicPriceLevelL3 {
+    using order_type = OrderT;
+    using OrderList = typename OrderStorage<OrderT>::List;
+
     Price price;                    // Price level
-    IntrusiveList<Order> orders;    // Orders at this price (sorted by priority)
+    OrderList orders;               // Orders at this price (sorted by priority)
     Quantity total_quantity;        // Cached total quantity for fast L2 aggregation
+    QueueSkipIndex<OrderT> skip_index;  // Checkpoints for out-of-order inserts into deep queues
 
-    explicit PriceLevelL3(Price p) noexcept
-        : price(p), orders(), total_quantity(0) {}
+    /// Orders and quantity ahead of each order, built by the first queuePosition() query
+    using PositionIndex = std::conditional_t<HasQueueSlot<OrderT>,
+                                             std::unique_ptr<QueuePositionIndex<OrderT>>, NoQueuePositionIndex>;
+    [[no_unique_address]] mutable PositionIndex positions;
+
+    explicit BasicPriceLevelL3(Price p) noexcept
+        : price(p), orders(), total_quantity(0), skip_index(), positions() {}
 
     /// Get total quantity at this level
     [[nodiscard]] Quantity getTotalQuantity() const noexcept {
@@ -30,77 +66,282 @@ struct PriceLevelL3 {
         return orders.size();
     }
 
+    /// Get quantity of the largest order at this level (0 if empty)
+    [[nodiscard]] Quantity maxOrderQuantity() const noexcept {
+        refreshExtremes();
+        return max_order_quantity_;
+    }
+
+    /// Get earliest timestamp of an order at this level (0 if empty)
+    [[nodiscard]] Timestamp oldestTimestamp() const noexcept {
+        if (timestamps_ordered_) {
+            return orders.empty() ? 0 : orders.front()->timestamp;
+        }
+        refreshExtremes();
+        return oldest_timestamp_;
+    }
+
+    /// Get total quantity, order count, largest order and oldest timestamp of this level
+    /// O(1) in the common case: while the queue is also in timestamp order the oldest order is its head,
+    /// and the largest quantity is kept with the number of orders holding it. The level is rescanned,
+    /// once, on the next read only after the last order holding an extreme leaves or shrinks.
+    [[nodiscard]] LevelSummary summary() const noexcept {
+        return {total_quantity, static_cast<uint32_t>(orders.size()), maxOrderQuantity(), oldestTimestamp()};
+    }
+
     /// Check if this level is empty
     [[nodiscard]] bool isEmpty() const noexcept {
         return orders.empty();
     }
 
     /// Get best order (first in queue)
-    [[nodiscard]] Order* getBestOrder() noexcept {
+    [[nodiscard]] OrderT* getBestOrder() noexcept {
         return orders.empty() ? nullptr : orders.front();
     }
 
-    [[nodiscard]] const Order* getBestOrder() const noexcept {
+    [[nodiscard]] const OrderT* getBestOrder() const noexcept {
         return orders.empty() ? nullptr : orders.front();
     }
 
-    /// Insert order maintaining priority order
-    void insertOrder(Order* order) noexcept {
-        // Insert in priority order (lower priority value = higher priority)
-        auto it = orders.begin();
-        while (it != orders.end() && it->priority <= order->priority) {
-            ++it;
-        }
-
-        if (it == orders.end()) {
+    /// Insert order maintaining priority order (lower priority value = higher priority)
+    /// O(1) when the order belongs at the tail (the common case) or head, otherwise
+    /// O(log n) through the skip index
+    void insertOrder(OrderT* order) {
+        const uint64_t priority = order->priority;
+        if (orders.empty() || orders.back()->priority <= priority) {
             orders.push_back(order);
+        } else if (priority < orders.front()->priority) {
+            orders.push_front(order);
         } else {
-            orders.insert_before(&(*it), order);
+            orders.insert_before(skip_index.findSuccessor(orders, priority), order);
         }
+        trackInserted(order);
+        noteInserted(order);
+
+        total_quantity += order->quantity;
+    }
 
+    /// Append order at the back of the queue
+    /// Caller guarantees no resting order has a lower priority (e.g. when loading a sorted snapshot)
+    void appendOrder(OrderT* order) noexcept {
+        SLICK_ASSERT(orders.empty() || orders.back()->priority <= order->priority);
+        orders.push_back(order);
+        trackInserted(order);
+        noteInserted(order);
         total_quantity += order->quantity;
     }
 
     /// Remove order from the level
-    void removeOrder(Order* order) noexcept {
+    void removeOrder(OrderT* order) noexcept {
         total_quantity -= order->quantity;
+        noteRemoved(order);
+        if constexpr (HasQueueSlot<OrderT>) {
+            if (positions) {
+                positions->remove(order);
+            }
+        }
+        skip_index.erase(order, OrderList::nextOf(order));
         orders.erase(order);
+        if (orders.empty()) {
+            max_order_quantity_ = 0;
+            max_order_holders_ = 0;
+            oldest_timestamp_ = 0;
+            timestamps_ordered_ = true;
+            extremes_stale_ = false;
+        }
+    }
+
+    /// Update order quantity in place (for modify operations that keep the queue position)
+    void updateOrderQuantity(OrderT* order, Quantity new_quantity) noexcept {
+        const Quantity delta = new_quantity - order->quantity;
+        total_quantity += delta;
+        if (SLICK_UNLIKELY(std::max(order->quantity, new_quantity) >= max_order_quantity_)) {
+            // Only a change to or from the largest quantity moves it
+            if (order->quantity == max_order_quantity_) {
+                --max_order_holders_;
+            }
+            noteQuantity(new_quantity);
+        }
+        if constexpr (HasQueueSlot<OrderT>) {
+            if (positions) {
+                positions->updateQuantity(order, delta);
+            }
+        }
+        order->quantity = new_quantity;
     }
 
-    /// Update order quantity (for modify operations)
-    void updateOrderQuantity(Quantity old_quantity, Quantity new_quantity) noexcept {
-        total_quantity = total_quantity - old_quantity + new_quantity;
+    /// Update order quantity and timestamp in place (modify or partial fill keeping the queue position)
+    void updateOrder(OrderT* order, Quantity new_quantity, Timestamp new_timestamp) noexcept {
+        updateOrderQuantity(order, new_quantity);
+        if (new_timestamp == order->timestamp) {
+            return;
+        }
+        if (timestamps_ordered_) {
+            // Only the tail (the usual case in a single-order level) can move forward without breaking the order
+            if (OrderList::nextOf(order) != nullptr || (new_timestamp < order->timestamp && orders.size() > 1)) {
+                breakTimestampOrder(order, new_timestamp);
+            }
+        } else if (new_timestamp < oldest_timestamp_) {
+            oldest_timestamp_ = new_timestamp;
+        } else if (order->timestamp == oldest_timestamp_) {
+            extremes_stale_ = true;
+        }
+        setTimestamp(*order, new_timestamp);
+    }
+
+    /// Get number and total quantity of orders ahead of an order at this level
+    /// O(log n) for layouts with a queue slot (Order): the first query builds the level's position
+    /// index in O(n), which is then maintained in O(log n) by every change at the level.
+    /// O(n) walk for layouts without one (CompactOrder).
+    [[nodiscard]] QueuePosition queuePosition(const OrderT* order) const {
+        if constexpr (HasQueueSlot<OrderT>) {
+            if (!positions) {
+                positions = std::make_unique<QueuePositionIndex<OrderT>>();
+                positions->build(const_cast<OrderList&>(orders));  // Only writes queue slots
+            }
+            return positions->ahead(order);
+        } else {
+            QueuePosition position;
+            for (const OrderT* it = orders.front(); it != order; it = OrderList::nextOf(it)) {
+                ++position.orders_ahead;
+                position.quantity_ahead += it->quantity;
+            }
+            return position;
+        }
     }
 
     /// Comparison operators for sorting by price
-    [[nodiscard]] constexpr bool operator==(const PriceLevelL3& other) const noexcept {
+    [[nodiscard]] constexpr bool operator==(const BasicPriceLevelL3& other) const noexcept {
         return price == other.price;
     }
 
-    [[nodiscard]] constexpr bool operator!=(const PriceLevelL3& other) const noexcept {
+    [[nodiscard]] constexpr bool operator!=(const BasicPriceLevelL3& other) const noexcept {
         return price != other.price;
     }
 
-    [[nodiscard]] constexpr bool operator<(const PriceLevelL3& other) const noexcept {
+    [[nodiscard]] constexpr bool operator<(const BasicPriceLevelL3& other) const noexcept {
         return price < other.price;
     }
 
-    [[nodiscard]] constexpr bool operator>(const PriceLevelL3& other) const noexcept {
+    [[nodiscard]] constexpr bool operator>(const BasicPriceLevelL3& other) const noexcept {
         return price > other.price;
     }
+
+private:
+    void noteInserted(const OrderT* order) noexcept {
+        if (orders.size() == 1) {
+            max_order_quantity_ = order->quantity;
+            max_order_holders_ = 1;
+            oldest_timestamp_ = order->timestamp;
+            timestamps_ordered_ = true;
+            extremes_stale_ = false;
+            return;
+        }
+        noteQuantity(order->quantity);
+        const Timestamp timestamp = order->timestamp;
+        if (!timestamps_ordered_) {
+            oldest_timestamp_ = std::min(oldest_timestamp_, timestamp);
+            return;
+        }
+        const OrderT* prev = OrderList::prevOf(order);
+        const OrderT* next = OrderList::nextOf(order);
+        if ((prev != nullptr && timestamp < prev->timestamp) || (next != nullptr && next->timestamp < timestamp)) {
+            breakTimestampOrder(order, timestamp);
+        }
+    }
+
+    void noteRemoved(const OrderT* order) noexcept {
+        if (order->quantity == max_order_quantity_ && --max_order_holders_ == 0) {
+            extremes_stale_ = true;
+        }
+        if (!timestamps_ordered_ && order->timestamp == oldest_timestamp_) {
+            extremes_stale_ = true;
+        }
+    }
+
+    /// Account for an order (re)entering the level with a quantity
+    void noteQuantity(Quantity quantity) noexcept {
+        if (quantity > max_order_quantity_) {
+            max_order_quantity_ = quantity;
+            max_order_holders_ = 1;
+        } else if (quantity == max_order_quantity_) {
+            ++max_order_holders_;
+        } else if (max_order_holders_ == 0) {
+            extremes_stale_ = true;
+        }
+    }
+
+    /// Fall back to tracking the oldest timestamp once an order stamped with timestamp may be out of queue
+    /// order; the other orders still are in order, so the first of them is the oldest of the rest
+    void breakTimestampOrder(const OrderT* order, Timestamp timestamp) noexcept {
+        const OrderT* first_other = order != orders.front() ? orders.front() : OrderList::nextOf(order);
+        timestamps_ordered_ = false;
+        oldest_timestamp_ = first_other != nullptr ? std::min(first_other->timestamp, timestamp) : timestamp;
+    }
+
+    /// Rescan the level after the last order holding the largest quantity or oldest timestamp changed
+    void refreshExtremes() const noexcept {
+        if (SLICK_LIKELY(!extremes_stale_)) {
+            return;
+        }
+        extremes_stale_ = false;
+        max_order_quantity_ = 0;
+        max_order_holders_ = 0;
+        oldest_timestamp_ = 0;
+        timestamps_ordered_ = true;
+        if (orders.empty()) {
+            return;
+        }
+        oldest_timestamp_ = orders.front()->timestamp;
+        Timestamp previous = oldest_timestamp_;
+        for (const OrderT* it = orders.front(); it != nullptr; it = OrderList::nextOf(it)) {
+            if (it->quantity > max_order_quantity_) {
+                max_order_quantity_ = it->quantity;
+                max_order_holders_ = 1;
+            } else if (it->quantity == max_order_quantity_) {
+                ++max_order_holders_;
+            }
+            timestamps_ordered_ = timestamps_ordered_ && previous <= it->timestamp;
+            previous = it->timestamp;
+            oldest_timestamp_ = std::min(oldest_timestamp_, it->timestamp);
+        }
+    }
+
+    mutable Quantity max_order_quantity_ = 0;   // Largest resting order (exact unless extremes_stale_)
+    mutable Timestamp oldest_timestamp_ = 0;    // Earliest resting timestamp, kept while !timestamps_ordered_
+    mutable uint32_t max_order_holders_ = 0;    // Orders resting with max_order_quantity_
+    mutable bool timestamps_ordered_ = true;    // Queue order is also timestamp order: the head is the oldest
+    mutable bool extremes_stale_ = false;       // The last holder of an extreme left; rescan on the next read
+
+    void trackInserted(OrderT* order) {
+        if constexpr (HasQueueSlot<OrderT>) {
+            if (positions) {
+                positions->insert(order, OrderList::prevOf(order));
+            }
+        }
+    }
 };
 
+/// Price level of the default order layout
+using PriceLevelL3 = BasicPriceLevelL3<Order>;
+
+/// Price level of the compact order layout
+using CompactPriceLevelL3 = BasicPriceLevelL3<CompactOrder>;
+
 /// Comparator for sorting bid levels (descending price)
 struct BidComparatorL3 {
-    [[nodiscard]] constexpr bool operator()(const PriceLevelL3& a, const PriceLevelL3& b) const noexcept {
+    template<typename OrderT>
+    [[nodiscard]] constexpr bool operator()(const BasicPriceLevelL3<OrderT>& a, const BasicPriceLevelL3<OrderT>& b) const noexcept {
         return a.price > b.price;   // Descending: highest bid first
     }
 
-    [[nodiscard]] constexpr bool operator()(Price a, const PriceLevelL3& b) const noexcept {
+    template<typename OrderT>
+    [[nodiscard]] constexpr bool operator()(Price a, const BasicPriceLevelL3<OrderT>& b) const noexcept {
         return a > b.price;
     }
 
-    [[nodiscard]] constexpr bool operator()(const PriceLevelL3& a, Price b) const noexcept {
+    template<typename OrderT>
+    [[nodiscard]] constexpr bool operator()(const BasicPriceLevelL3<OrderT>& a, Price b) const noexcept {
         return a.price > b;
     }
 
@@ -111,15 +352,18 @@ struct BidComparatorL3 {
 
 /// Comparator for sorting ask levels (ascending price)
 struct AskComparatorL3 {
-    [[nodiscard]] constexpr bool operator()(const PriceLevelL3& a, const PriceLevelL3& b) const noexcept {
+    template<typename OrderT>
+    [[nodiscard]] constexpr bool operator()(const BasicPriceLevelL3<OrderT>& a, const BasicPriceLevelL3<OrderT>& b) const noexcept {
         return a.price < b.price;  // Ascending: lowest ask first
     }
 
-    [[nodiscard]] constexpr bool operator()(Price a, const PriceLevelL3& b) const noexcept {
+    template<typename OrderT>
+    [[nodiscard]] constexpr bool operator()(Price a, const BasicPriceLevelL3<OrderT>& b) const noexcept {
         return a < b.price;
     }
 
-    [[nodiscard]] constexpr bool operator()(const PriceLevelL3& a, Price b) const noexcept {
+    template<typename OrderT>
+    [[nodiscard]] constexpr bool operator()(const BasicPriceLevelL3<OrderT>& a, Price b) const noexcept {
         return a.price < b;
     }
 
@@ -128,4 +372,8 @@ struct AskComparatorL3 {
     }
 };
 
+/// Compile-time comparator selection for a side (Buy = descending, Sell = ascending)
+template<Side S>
+using SideComparatorL3 = std::conditional_t<S == Side::Buy, BidComparatorL3, AskComparatorL3>;
+
 SLICK_DETAIL_NAMESPACE_END
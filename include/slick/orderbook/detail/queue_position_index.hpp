@@ -0,0 +1,236 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Order layouts with a `queue_slot` member can be tracked by QueuePositionIndex
+template<typename OrderT>
+concept HasQueueSlot = requires(OrderT& order) { order.queue_slot = uint32_t{0}; };
+
+/// Order-statistic tree over one price level queue, answering "what is ahead of this order"
+///
+/// A treap keyed implicitly by queue position: the in-order walk of the tree is the queue, and every
+/// node carries the order count and quantity of its subtree. An order is tracked in the node at its
+/// `queue_slot`, so inserting next to any resting order (tail, head or middle), removals, quantity
+/// changes and queries are all O(log n) expected, and slots of removed orders are reused.
+///
+/// @tparam OrderT Order type (`quantity` and `queue_slot` members)
+template<typename OrderT>
+class QueuePositionIndex {
+public:
+    /// Assign slots to a queue in order and build the tree in O(n)
+    template<typename List>
+    void build(List& orders) {
+        nodes_.clear();
+        free_ = kNil;
+        root_ = kNil;
+        std::vector<uint32_t> spine;  // Right spine of the tree built so far
+        for (OrderT& order : orders) {
+            const uint32_t slot = static_cast<uint32_t>(nodes_.size());
+            order.queue_slot = slot;
+            nodes_.push_back(Node{order.quantity, nextKey()});
+            uint32_t last = kNil;
+            while (!spine.empty() && nodes_[spine.back()].key < nodes_[slot].key) {
+                last = spine.back();
+                spine.pop_back();
+                pull(last);  // Subtree is complete once the node leaves the spine
+            }
+            link(slot, last, true);
+            if (!spine.empty()) {
+                link(spine.back(), slot, false);
+            }
+            spine.push_back(slot);
+        }
+        while (!spine.empty()) {
+            root_ = spine.back();
+            spine.pop_back();
+            pull(root_);
+        }
+        if (root_ != kNil) {
+            nodes_[root_].parent = kNil;
+        }
+    }
+
+    /// Track an order just inserted into the queue right behind `prev` (nullptr: at the head)
+    void insert(OrderT* order, const OrderT* prev) {
+        const uint32_t slot = allocate(order->quantity);
+        order->queue_slot = slot;
+        if (root_ == kNil) {
+            root_ = slot;
+            return;
+        }
+
+        // Attach as the in-order successor of prev: its right child, or the leftmost node of its right subtree
+        uint32_t parent = prev == nullptr ? root_ : prev->queue_slot;
+        bool left = prev == nullptr;
+        if (!left && nodes_[parent].right != kNil) {
+            parent = nodes_[parent].right;
+            left = true;
+        }
+        if (left) {
+            while (nodes_[parent].left != kNil) {
+                parent = nodes_[parent].left;
+            }
+        }
+        link(parent, slot, left);
+        for (uint32_t i = parent; i != kNil; i = nodes_[i].parent) {
+            nodes_[i].sum += order->quantity;
+            ++nodes_[i].count;
+        }
+
+        while (nodes_[slot].parent != kNil && nodes_[nodes_[slot].parent].key < nodes_[slot].key) {
+            rotateUp(slot);
+        }
+    }
+
+    /// Stop tracking an order
+    void remove(const OrderT* order) noexcept {
+        const uint32_t slot = order->queue_slot;
+        Node& node = nodes_[slot];
+        while (node.left != kNil && node.right != kNil) {
+            const uint32_t child = nodes_[node.left].key > nodes_[node.right].key ? node.left : node.right;
+            rotateUp(child);
+        }
+
+        const uint32_t child = node.left != kNil ? node.left : node.right;
+        const uint32_t parent = node.parent;
+        if (child != kNil) {
+            nodes_[child].parent = parent;
+        }
+        if (parent == kNil) {
+            root_ = child;
+        } else if (nodes_[parent].left == slot) {
+            nodes_[parent].left = child;
+        } else {
+            nodes_[parent].right = child;
+        }
+        for (uint32_t i = parent; i != kNil; i = nodes_[i].parent) {
+            nodes_[i].sum -= node.quantity;
+            --nodes_[i].count;
+        }
+
+        node.parent = free_;
+        free_ = slot;
+    }
+
+    /// Track a quantity change of an order
+    void updateQuantity(const OrderT* order, Quantity delta) noexcept {
+        nodes_[order->queue_slot].quantity += delta;
+        for (uint32_t i = order->queue_slot; i != kNil; i = nodes_[i].parent) {
+            nodes_[i].sum += delta;
+        }
+    }
+
+    /// Get number and total quantity of orders ahead of an order
+    [[nodiscard]] QueuePosition ahead(const OrderT* order) const noexcept {
+        QueuePosition position;
+        uint32_t slot = order->queue_slot;
+        addSubtree(position, nodes_[slot].left);
+        for (uint32_t parent = nodes_[slot].parent; parent != kNil; slot = parent, parent = nodes_[parent].parent) {
+            if (nodes_[parent].right == slot) {
+                addSubtree(position, nodes_[parent].left);
+                ++position.orders_ahead;
+                position.quantity_ahead += nodes_[parent].quantity;
+            }
+        }
+        return position;
+    }
+
+private:
+    static constexpr uint32_t kNil = UINT32_MAX;
+
+    struct Node {
+        Quantity quantity = 0;  // Quantity of this order
+        uint32_t key = 0;       // Heap key (parents have larger keys)
+        Quantity sum = 0;       // Quantity of the subtree
+        uint32_t count = 1;     // Orders in the subtree
+        uint32_t parent = kNil; // Parent node, or next free slot once released
+        uint32_t left = kNil;
+        uint32_t right = kNil;
+
+        Node() noexcept = default;
+        Node(Quantity qty, uint32_t heap_key) noexcept : quantity(qty), key(heap_key), sum(qty) {}
+    };
+
+    uint32_t allocate(Quantity quantity) {
+        if (free_ == kNil) {
+            nodes_.push_back(Node{quantity, nextKey()});
+            return static_cast<uint32_t>(nodes_.size() - 1);
+        }
+        const uint32_t slot = free_;
+        free_ = nodes_[slot].parent;
+        nodes_[slot] = Node{quantity, nextKey()};
+        return slot;
+    }
+
+    void link(uint32_t parent, uint32_t child, bool left) noexcept {
+        (left ? nodes_[parent].left : nodes_[parent].right) = child;
+        if (child != kNil) {
+            nodes_[child].parent = parent;
+        }
+    }
+
+    void pull(uint32_t slot) noexcept {
+        Node& node = nodes_[slot];
+        node.sum = node.quantity;
+        node.count = 1;
+        for (const uint32_t child : {node.left, node.right}) {
+            if (child != kNil) {
+                node.sum += nodes_[child].sum;
+                node.count += nodes_[child].count;
+            }
+        }
+    }
+
+    /// Rotate a node above its parent, keeping the in-order walk
+    void rotateUp(uint32_t slot) noexcept {
+        const uint32_t parent = nodes_[slot].parent;
+        const uint32_t grandparent = nodes_[parent].parent;
+        if (nodes_[parent].left == slot) {
+            link(parent, nodes_[slot].right, true);
+            link(slot, parent, false);
+        } else {
+            link(parent, nodes_[slot].left, false);
+            link(slot, parent, true);
+        }
+        nodes_[slot].parent = grandparent;
+        if (grandparent == kNil) {
+            root_ = slot;
+        } else if (nodes_[grandparent].left == parent) {
+            nodes_[grandparent].left = slot;
+        } else {
+            nodes_[grandparent].right = slot;
+        }
+        pull(parent);
+        pull(slot);
+    }
+
+    void addSubtree(QueuePosition& position, uint32_t slot) const noexcept {
+        if (slot != kNil) {
+            position.orders_ahead += nodes_[slot].count;
+            position.quantity_ahead += nodes_[slot].sum;
+        }
+    }
+
+    uint32_t nextKey() noexcept {
+        seed_ ^= seed_ << 13;
+        seed_ ^= seed_ >> 17;
+        seed_ ^= seed_ << 5;
+        return seed_;
+    }
+
+    std::vector<Node> nodes_;  // Indexed by queue slot
+    uint32_t root_ = kNil;
+    uint32_t free_ = kNil;     // Released slots, chained through `parent`
+    uint32_t seed_ = 2463534242u;
+};
+
+SLICK_DETAIL_NAMESPACE_END
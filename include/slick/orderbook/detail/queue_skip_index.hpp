@@ -0,0 +1,116 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Sparse priority index over an order queue, for inserts that do not belong at the tail
+///
+/// Holds checkpoints {priority, order} in queue order, roughly one per kStride orders. An out-of-order
+/// insert binary-searches the last checkpoint at or below its priority and walks the queue from there,
+/// so it touches O(log(n / kStride) + kStride) orders instead of O(n). Checkpoints are only recorded
+/// while walking queues of at least 2 * kStride orders, so shallow levels and levels that only see
+/// appends never allocate, and cost the level a single pointer.
+///
+/// The index never owns orders. Callers report every removal (erase()) before unlinking the order;
+/// inserts at the head or tail need no bookkeeping.
+///
+/// @tparam OrderT Order type (`priority` member, lower value = earlier in the queue)
+template<typename OrderT>
+class QueueSkipIndex {
+public:
+    static constexpr std::size_t kStride = 32;
+
+    /// Find where an order belongs in a queue
+    /// @param orders Queue, sorted by priority (IntrusiveList or IndexedList)
+    /// @param priority Priority of the order to insert
+    /// @return First order with a greater priority (insert before it), or nullptr to append
+    template<typename List>
+    [[nodiscard]] OrderT* findSuccessor(List& orders, uint64_t priority) {
+        const bool record = orders.size() >= 2 * kStride;
+        if (record && !entries_) {
+            entries_ = std::make_unique<std::vector<Entry>>();
+        }
+        if (!entries_) {
+            OrderT* node = orders.front();
+            while (node != nullptr && node->priority <= priority) {
+                node = List::nextOf(node);
+            }
+            return node;
+        }
+
+        std::vector<Entry>& entries = *entries_;
+        auto pos = std::upper_bound(entries.begin(), entries.end(), priority,
+                                    [](uint64_t p, const Entry& e) { return p < e.priority; });
+        OrderT* node = pos == entries.begin() ? orders.front() : std::prev(pos)->order;
+
+        std::size_t steps = 0;
+        while (node != nullptr && node->priority <= priority) {
+            if (record && ++steps == kStride) {
+                pos = std::next(entries.insert(pos, Entry{node->priority, node}));
+                steps = 0;
+            }
+            node = List::nextOf(node);
+        }
+        return node;
+    }
+
+    /// Forget an order about to be unlinked from the queue
+    /// @param order Order being removed
+    /// @param next Its successor in the queue (nullptr at the tail)
+    void erase(const OrderT* order, OrderT* next) noexcept {
+        if (!entries_) {
+            return;
+        }
+        std::vector<Entry>& entries = *entries_;
+        auto [first, last] = std::equal_range(entries.begin(), entries.end(), Entry{order->priority, nullptr},
+                                              [](const Entry& a, const Entry& b) { return a.priority < b.priority; });
+        for (auto it = first; it != last; ++it) {
+            if (it->order == order) {
+                // Hand the checkpoint to the successor unless it is the next checkpoint already
+                const auto following = std::next(it);
+                if (next != nullptr && (following == entries.end() || following->order != next)) {
+                    *it = Entry{next->priority, next};
+                } else {
+                    entries.erase(it);
+                }
+                return;
+            }
+        }
+    }
+
+    /// Drop all checkpoints
+    void clear() noexcept {
+        entries_.reset();
+    }
+
+    /// Get number of checkpoints
+    [[nodiscard]] std::size_t size() const noexcept {
+        return entries_ ? entries_->size() : 0;
+    }
+
+    /// Check if no checkpoints are held
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+private:
+    struct Entry {
+        uint64_t priority;  // Priority of order when recorded (priorities only change by re-insertion)
+        OrderT* order;      // Checkpointed order
+    };
+
+    std::unique_ptr<std::vector<Entry>> entries_;  // Checkpoints in queue order (priorities non-decreasing),
+                                                   // allocated by the first walk of a deep queue
+};
+
+SLICK_DETAIL_NAMESPACE_END
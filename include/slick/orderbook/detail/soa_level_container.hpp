@@ -0,0 +1,381 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/detail/price_level_l2.hpp>
+#include <slick/orderbook/detail/vector_capacity.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if SLICK_SIMD_AVX512 || SLICK_SIMD_AVX2
+#include <immintrin.h>
+#elif SLICK_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Allocator returning cache-line aligned storage, so vector loads never straddle a line at the start
+template<typename T>
+struct CacheAlignedAllocator {
+    using value_type = T;
+
+    CacheAlignedAllocator() noexcept = default;
+
+    template<typename U>
+    CacheAlignedAllocator(const CacheAlignedAllocator<U>&) noexcept {}
+
+    [[nodiscard]] T* allocate(std::size_t count) {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{SLICK_CACHE_LINE_SIZE}));
+    }
+
+    void deallocate(T* memory, std::size_t) noexcept {
+        ::operator delete(memory, std::align_val_t{SLICK_CACHE_LINE_SIZE});
+    }
+
+    template<typename U>
+    [[nodiscard]] bool operator==(const CacheAlignedAllocator<U>&) const noexcept { return true; }
+};
+
+/// Check if a stored price ranks ahead of price on side S (bids: higher, asks: lower)
+template<Side S, typename P>
+[[nodiscard]] SLICK_FORCE_INLINE bool isBetter(P key, P price) noexcept {
+    if constexpr (S == Side::Buy) {
+        return key > price;
+    } else {
+        return key < price;
+    }
+}
+
+/// Index of the first of keys[0, count) that does not rank ahead of price (count if all do)
+/// Keys are sorted best first, so the keys ranking ahead form a prefix. Compares a vector of keys at a
+/// time (AVX-512, AVX2 or NEON for 32 and 64-bit keys) and stops at the first vector holding the boundary.
+template<Side S, typename P>
+[[nodiscard]] SLICK_FORCE_INLINE std::size_t scanBetter(const P* keys, std::size_t count, P price) noexcept {
+    std::size_t i = 0;
+    [[maybe_unused]] constexpr bool kWide = std::is_same_v<P, int64_t>;
+    [[maybe_unused]] constexpr bool kNarrow = std::is_same_v<P, int32_t>;
+
+#if SLICK_SIMD_AVX512
+    if constexpr (kWide) {
+        const __m512i needle = _mm512_set1_epi64(price);
+        for (; i + 8 <= count; i += 8) {
+            const __m512i block = _mm512_loadu_si512(keys + i);
+            const __mmask8 better = S == Side::Buy ? _mm512_cmpgt_epi64_mask(block, needle)
+                                                   : _mm512_cmplt_epi64_mask(block, needle);
+            if (better != 0xFF) {
+                return i + static_cast<std::size_t>(std::countr_one(static_cast<unsigned>(better)));
+            }
+        }
+    } else if constexpr (kNarrow) {
+        const __m512i needle = _mm512_set1_epi32(price);
+        for (; i + 16 <= count; i += 16) {
+            const __m512i block = _mm512_loadu_si512(keys + i);
+            const __mmask16 better = S == Side::Buy ? _mm512_cmpgt_epi32_mask(block, needle)
+                                                    : _mm512_cmplt_epi32_mask(block, needle);
+            if (better != 0xFFFF) {
+                return i + static_cast<std::size_t>(std::countr_one(static_cast<unsigned>(better)));
+            }
+        }
+    }
+#elif SLICK_SIMD_AVX2
+    if constexpr (kWide) {
+        const __m256i needle = _mm256_set1_epi64x(price);
+        for (; i + 4 <= count; i += 4) {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+            const __m256i better = S == Side::Buy ? _mm256_cmpgt_epi64(block, needle) : _mm256_cmpgt_epi64(needle, block);
+            const auto mask = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(better)));
+            if (mask != 0xF) {
+                return i + static_cast<std::size_t>(std::countr_one(mask));
+            }
+        }
+    } else if constexpr (kNarrow) {
+        const __m256i needle = _mm256_set1_epi32(price);
+        for (; i + 8 <= count; i += 8) {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+            const __m256i better = S == Side::Buy ? _mm256_cmpgt_epi32(block, needle) : _mm256_cmpgt_epi32(needle, block);
+            const auto mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(better)));
+            if (mask != 0xFF) {
+                return i + static_cast<std::size_t>(std::countr_one(mask));
+            }
+        }
+    }
+#elif SLICK_SIMD_NEON
+    if constexpr (kWide) {
+        const int64x2_t needle = vdupq_n_s64(price);
+        const uint64x2_t lanes = {1, 2};
+        for (; i + 2 <= count; i += 2) {
+            const int64x2_t block = vld1q_s64(keys + i);
+            const uint64x2_t better = S == Side::Buy ? vcgtq_s64(block, needle) : vcltq_s64(block, needle);
+            const auto mask = static_cast<unsigned>(vaddvq_u64(vandq_u64(better, lanes)));
+            if (mask != 0x3) {
+                return i + static_cast<std::size_t>(std::countr_one(mask));
+            }
+        }
+    } else if constexpr (kNarrow) {
+        const int32x4_t needle = vdupq_n_s32(price);
+        const uint32x4_t lanes = {1, 2, 4, 8};
+        for (; i + 4 <= count; i += 4) {
+            const int32x4_t block = vld1q_s32(keys + i);
+            const uint32x4_t better = S == Side::Buy ? vcgtq_s32(block, needle) : vcltq_s32(block, needle);
+            const auto mask = static_cast<unsigned>(vaddvq_u32(vandq_u32(better, lanes)));
+            if (mask != 0xF) {
+                return i + static_cast<std::size_t>(std::countr_one(mask));
+            }
+        }
+    }
+#endif
+
+    while (i < count && isBetter<S>(keys[i], price)) {
+        ++i;
+    }
+    return i;
+}
+
+/// Index of the first of keys[0, count) that does not rank ahead of price, by binary search
+/// The loop body selects the next half with a conditional move instead of a branch, so its cost does not
+/// depend on how predictable the searched prices are.
+template<Side S, typename P>
+[[nodiscard]] inline std::size_t searchBetter(const P* keys, std::size_t count, P price) noexcept {
+    if (count == 0) {
+        return 0;
+    }
+    const P* base = keys;
+    while (count > 1) {
+        const std::size_t half = count / 2;
+        base = isBetter<S>(base[half], price) ? base + half : base;
+        count -= half;
+    }
+    return static_cast<std::size_t>(base - keys) + (isBetter<S>(*base, price) ? 1 : 0);
+}
+
+/// Sorted price level container with the prices in a column of their own
+///
+/// Same interface and ordering as LevelContainer, but searches read a separate cache-aligned array of prices
+/// (8 per cache line with 64-bit prices, 16 with 32-bit) instead of striding over whole levels. A search scans
+/// the first two cache lines of prices with vector compares, where most feed updates land, and falls back to
+/// a branchless binary search over the rest. The levels themselves stay in an array of structs beside it, so
+/// best(), getLevel() and getLevelsView() still hand out levels in place; inserts and erases move both arrays.
+///
+/// @tparam S Side (Buy = bids/descending, Sell = asks/ascending)
+/// @tparam Level Stored level type (BasicPriceLevelL2 of the book's FixedPoint widths)
+template<Side S, typename Level = PriceLevelL2>
+class SoaLevelContainer {
+    using Key = typename Level::price_type;
+
+public:
+    using value_type = Level;
+    using iterator = typename std::vector<Level>::iterator;
+    using const_iterator = typename std::vector<Level>::const_iterator;
+    using Comparator = SideComparator<S>;
+
+    /// Number of leading prices searched with vector compares before switching to binary search
+    static constexpr std::size_t kScanWidth = 2 * SLICK_CACHE_LINE_SIZE / sizeof(Key);
+
+    /// Constructor with initial capacity
+    /// @param initial_capacity Initial capacity for levels
+    explicit SoaLevelContainer(std::size_t initial_capacity = 32) {
+        reserve(initial_capacity);
+    }
+
+    /// Get Side
+    [[nodiscard]] static constexpr Side side() noexcept {
+        return S;
+    }
+
+    /// Get number of levels
+    [[nodiscard]] std::size_t size() const noexcept {
+        return levels_.size();
+    }
+
+    /// Check if empty
+    [[nodiscard]] bool empty() const noexcept {
+        return levels_.empty();
+    }
+
+    /// Get level at index (no bounds checking)
+    [[nodiscard]] const Level& operator[](std::size_t index) const noexcept {
+        return levels_[index];
+    }
+
+    /// Get level at index with bounds checking
+    [[nodiscard]] const Level& at(std::size_t index) const {
+        return levels_.at(index);
+    }
+
+    /// Get best level (first element)
+    [[nodiscard]] const Level* best() const noexcept {
+        return levels_.empty() ? nullptr : &levels_.front();
+    }
+
+    /// Get level at index (0 = best), or nullptr if out of range
+    [[nodiscard]] const Level* atIndex(std::size_t index) const noexcept {
+        return index < levels_.size() ? &levels_[index] : nullptr;
+    }
+
+    /// Get index of a level (0 = best)
+    [[nodiscard]] std::size_t indexOf(const_iterator it) const noexcept {
+        return static_cast<std::size_t>(it - levels_.begin());
+    }
+
+    /// Get index of a level, saturated at limit (returns limit if the level is limit or more deep)
+    [[nodiscard]] std::size_t indexOf(const_iterator it, std::size_t limit) const noexcept {
+        return std::min(indexOf(it), limit);
+    }
+
+    /// Number of levels strictly better than price (index the price has or would have)
+    [[nodiscard]] std::size_t lowerBoundIndex(Price price) const noexcept {
+        if constexpr (!std::is_same_v<Key, Price>) {
+            if (!std::in_range<Key>(price)) {
+                // Every stored price ranks ahead of it, or none does
+                return (price < std::numeric_limits<Key>::min()) == (S == Side::Buy) ? prices_.size() : 0;
+            }
+        }
+        const Key key = static_cast<Key>(price);
+        const std::size_t count = prices_.size();
+        const std::size_t scan = std::min(count, kScanWidth);
+        const std::size_t index = scanBetter<S>(prices_.data(), scan, key);
+        if (index < scan || scan == count) {
+            return index;
+        }
+        return scan + searchBetter<S>(prices_.data() + scan, count - scan, key);
+    }
+
+    /// Find level by price
+    /// Returns iterator to level with matching price, or end() if not found
+    [[nodiscard]] iterator find(Price price) noexcept {
+        const std::size_t index = lowerBoundIndex(price);
+        return index < prices_.size() && prices_[index] == price ? levels_.begin() + index : levels_.end();
+    }
+
+    /// Find level by price (const version)
+    [[nodiscard]] const_iterator find(Price price) const noexcept {
+        const std::size_t index = lowerBoundIndex(price);
+        return index < prices_.size() && prices_[index] == price ? levels_.begin() + index : levels_.end();
+    }
+
+    /// Get level by price (returns pointer or nullptr)
+    [[nodiscard]] const Level* getLevel(Price price) const noexcept {
+        auto it = find(price);
+        return (it != levels_.end()) ? &(*it) : nullptr;
+    }
+
+    /// Insert or update a level
+    /// If price exists, updates quantity; otherwise inserts new level
+    /// Returns iterator to the level and whether insertion occurred
+    std::pair<iterator, bool> insertOrUpdate(Price price, Quantity quantity, Timestamp timestamp) {
+        const std::size_t index = lowerBoundIndex(price);
+        if (index < prices_.size() && prices_[index] == price) {
+            Level& level = levels_[index];
+            level.quantity = static_cast<typename Level::quantity_type>(quantity);
+            level.timestamp = timestamp;
+            return {levels_.begin() + index, false};
+        }
+
+        // Grow both arrays first so the inserts below cannot fail halfway
+        if (levels_.size() == capacity()) {
+            reserve(std::max<std::size_t>(levels_.size() * 2, 8));
+        }
+        prices_.insert(prices_.begin() + index, static_cast<Key>(price));
+        return {levels_.insert(levels_.begin() + index, Level{price, quantity, timestamp}), true};
+    }
+
+    /// Remove level by price
+    /// Returns true if level was found and removed
+    bool erase(Price price) noexcept {
+        auto it = find(price);
+        if (it != levels_.end()) {
+            erase(it);
+            return true;
+        }
+        return false;
+    }
+
+    /// Remove level by iterator
+    iterator erase(iterator it) noexcept {
+        prices_.erase(prices_.begin() + (it - levels_.begin()));
+        return levels_.erase(it);
+    }
+
+    /// Clear all levels
+    void clear() noexcept {
+        prices_.clear();
+        levels_.clear();
+    }
+
+    /// Reserve capacity
+    void reserve(std::size_t capacity) {
+        prices_.reserve(capacity);
+        levels_.reserve(capacity);
+    }
+
+    /// Check whether a level at price can be inserted (any price can)
+    [[nodiscard]] static constexpr bool accepts(Price) noexcept {
+        return true;
+    }
+
+    /// Get capacity
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return std::min(prices_.capacity(), levels_.capacity());
+    }
+
+    /// Shrink capacity of both columns to max(size(), keep_capacity) levels
+    void trim(std::size_t keep_capacity = 0) {
+        trimCapacity(prices_, keep_capacity);
+        trimCapacity(levels_, keep_capacity);
+    }
+
+    /// Shrink capacity to the levels held
+    void shrink_to_fit() {
+        trim(0);
+    }
+
+    /// Get bytes held by both columns
+    [[nodiscard]] std::size_t memoryUsage() const noexcept {
+        return prices_.capacity() * sizeof(Key) + levels_.capacity() * sizeof(Level);
+    }
+
+    /// Get all levels up to depth
+    /// @param depth Maximum number of levels to return (0 = all)
+    [[nodiscard]] std::vector<Level> getLevels(std::size_t depth = 0) const {
+        const std::span<const Level> levels = getLevelsView(depth);
+        return std::vector<Level>(levels.begin(), levels.end());
+    }
+
+    /// View the levels up to depth in place (best first, no copy)
+    /// Invalidated by the next insert or erase
+    /// @param depth Maximum number of levels to view (0 = all)
+    [[nodiscard]] std::span<const Level> getLevelsView(std::size_t depth = 0) const noexcept {
+        const std::span<const Level> levels(levels_);
+        return depth == 0 || depth >= levels.size() ? levels : levels.first(depth);
+    }
+
+    /// View the price column (best first)
+    [[nodiscard]] std::span<const Key> prices() const noexcept {
+        return prices_;
+    }
+
+    /// Iterators
+    [[nodiscard]] iterator begin() noexcept { return levels_.begin(); }
+    [[nodiscard]] iterator end() noexcept { return levels_.end(); }
+    [[nodiscard]] const_iterator begin() const noexcept { return levels_.begin(); }
+    [[nodiscard]] const_iterator end() const noexcept { return levels_.end(); }
+    [[nodiscard]] const_iterator cbegin() const noexcept { return levels_.cbegin(); }
+    [[nodiscard]] const_iterator cend() const noexcept { return levels_.cend(); }
+
+private:
+    std::vector<Key, CacheAlignedAllocator<Key>> prices_;  // Level prices, best first (search column)
+    std::vector<Level> levels_;                            // Levels in the same order
+};
+
+SLICK_DETAIL_NAMESPACE_END
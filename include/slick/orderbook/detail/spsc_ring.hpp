@@ -0,0 +1,125 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Bounded single-producer / single-consumer ring buffer
+///
+/// Preallocated power-of-two slot array with head (producer) and tail (consumer) counters on
+/// separate cache lines. Counters are monotonic 64-bit sequence numbers, so there is no ABA.
+///
+/// pushOverwrite() lets the producer evict the oldest element when the ring is full. Eviction
+/// advances tail with a CAS, so the consumer validates every pop with a CAS on tail: a slot the
+/// producer started overwriting is discarded and the pop retried (same read-then-validate scheme
+/// as the top-of-book seqlock). Without pushOverwrite() the CAS never fails.
+///
+/// @tparam T Element type (trivially copyable)
+template<typename T>
+class SPSCRing {
+    static_assert(std::is_trivially_copyable_v<T>, "SPSCRing elements must be trivially copyable");
+
+public:
+    /// Constructor
+    /// @param capacity Minimum number of slots (rounded up to a power of two)
+    explicit SPSCRing(std::size_t capacity)
+        : capacity_(std::bit_ceil(std::max<std::size_t>(capacity, 2))),
+          mask_(capacity_ - 1),
+          slots_(std::make_unique<T[]>(capacity_)) {}
+
+    // Non-copyable, non-movable (shared between threads)
+    SPSCRing(const SPSCRing&) = delete;
+    SPSCRing& operator=(const SPSCRing&) = delete;
+
+    /// Append an element (producer only)
+    /// @return false if the ring is full
+    bool tryPush(const T& value) noexcept {
+        const uint64_t head = head_.load(std::memory_order_relaxed);
+        if (SLICK_UNLIKELY(head - cached_tail_ >= capacity_)) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head - cached_tail_ >= capacity_) {
+                return false;
+            }
+        }
+        slots_[head & mask_] = value;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Append an element, evicting the oldest one if the ring is full (producer only)
+    /// @return true if an element was evicted
+    bool pushOverwrite(const T& value) noexcept {
+        const uint64_t head = head_.load(std::memory_order_relaxed);
+        bool evicted = false;
+        if (SLICK_UNLIKELY(head - cached_tail_ >= capacity_)) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            while (head - cached_tail_ >= capacity_) {
+                // On failure cached_tail_ is reloaded: the consumer freed a slot meanwhile
+                if (tail_.compare_exchange_weak(cached_tail_, cached_tail_ + 1,
+                                                std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    ++cached_tail_;
+                    evicted = true;
+                    break;
+                }
+            }
+        }
+        slots_[head & mask_] = value;
+        head_.store(head + 1, std::memory_order_release);
+        return evicted;
+    }
+
+    /// Remove the oldest element (consumer only)
+    /// @param out Receives the element
+    /// @return false if the ring is empty
+    bool tryPop(T& out) noexcept {
+        uint64_t tail = tail_.load(std::memory_order_acquire);
+        while (true) {
+            if (tail == head_.load(std::memory_order_acquire)) {
+                return false;
+            }
+            out = slots_[tail & mask_];
+            // Fails only if the producer evicted this slot while it was being read
+            if (tail_.compare_exchange_strong(tail, tail + 1,
+                                              std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return true;
+            }
+        }
+    }
+
+    /// Get number of elements currently queued (approximate while both sides are active)
+    [[nodiscard]] std::size_t size() const noexcept {
+        const uint64_t tail = tail_.load(std::memory_order_acquire);
+        const uint64_t head = head_.load(std::memory_order_acquire);
+        return head > tail ? static_cast<std::size_t>(head - tail) : 0;
+    }
+
+    /// Check if ring is empty
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /// Get number of slots
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+private:
+    SLICK_CACHE_ALIGNED std::atomic<uint64_t> head_{0};    // Next sequence to write (producer)
+    uint64_t cached_tail_ = 0;                              // Producer's last seen tail
+    SLICK_CACHE_ALIGNED std::atomic<uint64_t> tail_{0};    // Next sequence to read (consumer)
+    SLICK_CACHE_ALIGNED const std::size_t capacity_;       // Number of slots (power of two)
+    const std::size_t mask_;                                // capacity_ - 1
+    std::unique_ptr<T[]> slots_;                            // Slot storage
+};
+
+SLICK_DETAIL_NAMESPACE_END
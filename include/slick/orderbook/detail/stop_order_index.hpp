@@ -0,0 +1,157 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/detail/memory_pool.hpp>
+#include <slick/orderbook/detail/order_map.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Stop or stop-limit order waiting for its trigger (OrderBookL3::submitStopOrder)
+struct StopOrder {
+    OrderId order_id;                   // Unique order identifier
+    Price stop_price;                   // Trigger price
+    Price limit_price;                  // Limit price once triggered (StopLimit only)
+    Quantity quantity;                  // Order quantity
+    Timestamp timestamp;                // Submission timestamp
+    Side side;                          // Buy or Sell
+    OrderType type;                     // Stop (market once triggered) or StopLimit
+    TimeInForce time_in_force;          // Time in force once triggered
+};
+
+/// Stop orders of one book, sorted by trigger price per side
+///
+/// Buy stops trigger when the last trade price rises to their stop price (lowest stop first), sell stops
+/// when it falls to theirs (highest stop first); equal stop prices trigger in arrival order. Each side is
+/// a sorted vector of (stop price, StopOrder*) with the next stop to trigger at the back, so a
+/// trade checks one entry per side and each triggered stop is popped in O(1). Inserting and cancelling
+/// binary search the stop price (the vector shifts like the level containers). Orders live in a pool
+/// with an OrderId map, so cancels find them directly. Nothing is allocated until the first stop.
+class StopOrderIndex {
+public:
+    StopOrderIndex() : pool_(0), ids_(0) {}
+
+    /// Add a stop order
+    /// @return false if its order id is already indexed or the pool cannot grow
+    bool insert(const StopOrder& stop) {
+        if (ids_.contains(stop.order_id)) {
+            return false;
+        }
+        StopOrder* order = pool_.construct(stop);
+        if (SLICK_UNLIKELY(order == nullptr)) {
+            return false;
+        }
+        ids_.insert(order);
+        auto& entries = sides_[stop.side];
+        // The newest of equal stop prices goes furthest from the back
+        entries.insert(lowerBound(stop.side, stop.stop_price), Entry{stop.stop_price, order});
+        return true;
+    }
+
+    /// Remove a stop order
+    /// @return false if not found
+    bool erase(OrderId order_id) noexcept {
+        StopOrder* order = ids_.find(order_id);
+        if (order == nullptr) {
+            return false;
+        }
+        auto& entries = sides_[order->side];
+        for (auto it = lowerBound(order->side, order->stop_price);
+             it != entries.end() && it->stop_price == order->stop_price; ++it) {
+            if (it->order == order) {
+                entries.erase(it);
+                break;
+            }
+        }
+        ids_.erase(order_id);
+        pool_.destroy(order);
+        return true;
+    }
+
+    /// Find a stop order by OrderId
+    [[nodiscard]] const StopOrder* find(OrderId order_id) const noexcept {
+        return ids_.find(order_id);
+    }
+
+    /// Check if an order id is indexed
+    [[nodiscard]] bool contains(OrderId order_id) const noexcept {
+        return ids_.contains(order_id);
+    }
+
+    /// Check if a trade at last_price triggers a stop of side
+    [[nodiscard]] bool triggers(Side side, Price last_price) const noexcept {
+        const auto& entries = sides_[side];
+        return !entries.empty() && reached(side, entries.back().stop_price, last_price);
+    }
+
+    /// Check if a trade at last_price reaches a stop price of side
+    [[nodiscard]] static bool reached(Side side, Price stop_price, Price last_price) noexcept {
+        return side == Side::Buy ? last_price >= stop_price : last_price <= stop_price;
+    }
+
+    /// Remove and return the next stop of side triggered by a trade at last_price
+    std::optional<StopOrder> popTriggered(Side side, Price last_price) noexcept {
+        if (!triggers(side, last_price)) {
+            return std::nullopt;
+        }
+        auto& entries = sides_[side];
+        StopOrder* order = entries.back().order;
+        entries.pop_back();
+        const StopOrder stop = *order;
+        ids_.erase(stop.order_id);
+        pool_.destroy(order);
+        return stop;
+    }
+
+    /// Get number of stop orders
+    [[nodiscard]] std::size_t size() const noexcept { return ids_.size(); }
+
+    /// Get number of stop orders on a side
+    [[nodiscard]] std::size_t size(Side side) const noexcept { return sides_[side].size(); }
+
+    /// Check if no stop orders are indexed
+    [[nodiscard]] bool empty() const noexcept { return ids_.empty(); }
+
+    /// Remove all stop orders (keeps capacity)
+    void clear() noexcept {
+        for (auto& entries : sides_) {
+            for (const Entry& entry : entries) {
+                pool_.destroy(entry.order);
+            }
+            entries.clear();
+        }
+        ids_.clear();
+    }
+
+private:
+    struct Entry {
+        Price stop_price;       // Sort key
+        StopOrder* order;
+    };
+
+    /// First entry of side whose stop price triggers no later than stop_price
+    /// Buy entries are sorted by descending stop price, sell entries by ascending stop price
+    [[nodiscard]] std::vector<Entry>::iterator lowerBound(Side side, Price stop_price) noexcept {
+        auto& entries = sides_[side];
+        if (side == Side::Buy) {
+            return std::lower_bound(entries.begin(), entries.end(), stop_price,
+                                    [](const Entry& entry, Price price) { return entry.stop_price > price; });
+        }
+        return std::lower_bound(entries.begin(), entries.end(), stop_price,
+                                [](const Entry& entry, Price price) { return entry.stop_price < price; });
+    }
+
+    std::array<std::vector<Entry>, SideCount> sides_;  // Per side, next to trigger at the back
+    ObjectPool<StopOrder> pool_;                        // StopOrder storage
+    BasicOrderMap<OrderIdHash, StopOrder> ids_;         // OrderId -> StopOrder*
+};
+
+SLICK_DETAIL_NAMESPACE_END
@@ -0,0 +1,30 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Shrink a vector's capacity to max(size(), keep_capacity), moving its elements into a new buffer
+/// Unlike shrink_to_fit() the result is guaranteed and keep_capacity leaves headroom for regrowth.
+/// @param values Vector to shrink (unchanged if its capacity is already at most the target)
+/// @param keep_capacity Capacity to keep
+template<typename T, typename Alloc>
+void trimCapacity(std::vector<T, Alloc>& values, std::size_t keep_capacity) {
+    const std::size_t capacity = std::max(values.size(), keep_capacity);
+    if (values.capacity() <= capacity) {
+        return;
+    }
+    std::vector<T, Alloc> trimmed(values.get_allocator());
+    trimmed.reserve(capacity);
+    std::move(values.begin(), values.end(), std::back_inserter(trimmed));
+    values.swap(trimmed);
+}
+
+SLICK_DETAIL_NAMESPACE_END
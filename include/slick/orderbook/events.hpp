@@ -23,18 +23,28 @@ struct PriceLevelUpdate {
     uint64_t seq_num;       // Exchange sequence number (0 = not tracked)
     Price price;            // Price level
     Quantity quantity;      // New total quantity at this level (0 = delete)
+    Quantity max_order_quantity;    // Largest order on the level (L3 books; 0 = not tracked or deleted)
+    Timestamp oldest_timestamp;     // Earliest order timestamp on the level (L3 books; 0 = not tracked or deleted)
     SymbolId symbol;        // Symbol identifier
     uint16_t level_index;   // 0-based index in sorted order (0 = best, 1 = second best, etc.)
-    uint16_t num_orders;    // number of orders on the level
+    uint32_t num_orders;    // Number of orders on the level (L3 books; 0 = not tracked or deleted)
     uint8_t change_flags;   // Bitset of ChangeFlag
     Side side;              // Buy or Sell
 
     PriceLevelUpdate() noexcept = default;
 
-    PriceLevelUpdate(Timestamp ts, SymbolId sym, Side s, Price p, Quantity q, uint16_t order_count = 0,
-                     uint16_t idx = 0, uint8_t flags = 0, uint64_t seq = 0) noexcept
-        : timestamp(ts), seq_num(seq), price(p), quantity(q), symbol(sym),
-          level_index(idx), num_orders(order_count), change_flags(flags), side(s) {}
+    PriceLevelUpdate(Timestamp ts, SymbolId sym, Side s, Price p, Quantity q, uint32_t order_count = 0,
+                     uint16_t idx = 0, uint8_t flags = 0, uint64_t seq = 0, Quantity max_order_qty = 0,
+                     Timestamp oldest_ts = 0) noexcept
+        : timestamp(ts), seq_num(seq), price(p), quantity(q), max_order_quantity(max_order_qty),
+          oldest_timestamp(oldest_ts), symbol(sym), level_index(idx), num_orders(order_count),
+          change_flags(flags), side(s) {}
+
+    /// Build the update of an L3 level from its summary
+    PriceLevelUpdate(Timestamp ts, SymbolId sym, Side s, Price p, const LevelSummary& summary, uint16_t idx,
+                     uint8_t flags, uint64_t seq) noexcept
+        : PriceLevelUpdate(ts, sym, s, p, summary.total_quantity, summary.order_count, idx, flags, seq,
+                           summary.max_order_quantity, summary.oldest_timestamp) {}
 
     /// Check if this is a delete action
     [[nodiscard]] constexpr bool isDelete() const noexcept {
@@ -82,8 +92,8 @@ struct OrderUpdate {
 
     OrderUpdate(SymbolId sym, OrderId id, Side s, Price p, Quantity q, Price op, Quantity oq, Timestamp ts,
                 uint16_t idx = 0, uint64_t prio = 0, uint8_t flags = 0, uint64_t seq = 0) noexcept
-        : symbol(sym), order_id(id), side(s), price(p), quantity(q), old_price(op), old_qty(oq), timestamp(ts),
-          price_level_index(idx), priority(prio), change_flags(flags), seq_num(seq) {}
+        : timestamp(ts), seq_num(seq), order_id(id), price(p), quantity(q), old_price(op), old_qty(oq), symbol(sym),
+          price_level_index(idx), priority(prio), side(s), change_flags(flags) {}
 
     /// Check if this is a delete action
     [[nodiscard]] constexpr bool isDelete() const noexcept {
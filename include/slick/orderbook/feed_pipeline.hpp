@@ -0,0 +1,306 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/orderbook_engine.hpp>
+#include <slick/orderbook/detail/frame_ring.hpp>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+SLICK_NAMESPACE_BEGIN
+
+/// Assigns SymbolIds to a feed's product names ("BTC-USD", ...) in order of first appearance
+///
+/// Meant for the decode stage of a FeedPipeline: one thread looks names up while decoding, without
+/// allocating for names it has seen before.
+class SymbolRegistry {
+public:
+    /// Find a product's SymbolId
+    [[nodiscard]] std::optional<SymbolId> find(std::string_view name) const {
+        const auto it = ids_.find(name);
+        return it != ids_.end() ? std::optional(it->second) : std::nullopt;
+    }
+
+    /// Find a product's SymbolId, assigning the next one on first sight
+    /// @return SymbolId, or std::nullopt once every SymbolId is taken
+    std::optional<SymbolId> getOrAdd(std::string_view name) {
+        if (const auto it = ids_.find(name); it != ids_.end()) {
+            return it->second;
+        }
+        if (names_.size() > std::numeric_limits<SymbolId>::max()) {
+            return std::nullopt;
+        }
+        const auto symbol = static_cast<SymbolId>(names_.size());
+        names_.emplace_back(name);
+        ids_.emplace(names_.back(), symbol);
+        return symbol;
+    }
+
+    /// Get a SymbolId's product name (empty if unassigned)
+    [[nodiscard]] std::string_view name(SymbolId symbol) const noexcept {
+        return symbol < names_.size() ? std::string_view(names_[symbol]) : std::string_view();
+    }
+
+    /// Get number of products registered
+    [[nodiscard]] std::size_t size() const noexcept { return names_.size(); }
+
+private:
+    struct NameHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view name) const noexcept { return std::hash<std::string_view>{}(name); }
+    };
+
+    std::unordered_map<std::string, SymbolId, NameHash, std::equal_to<>> ids_;     // Name -> SymbolId
+    std::vector<std::string> names_;                                                // SymbolId -> name
+};
+
+/// FeedPipeline configuration
+struct FeedPipelineConfig {
+    OrderBookEngineConfig engine{};             // Shards applying the decoded updates
+    std::size_t frame_buffer_bytes = 1 << 22;   // Raw frame ring between the socket and decode threads
+    int decode_cpu = -1;                        // CPU for the decode thread (-1 = not pinned; Linux only)
+};
+
+/// FeedPipeline counters (the engine keeps its own, see OrderBookEngineStats)
+struct FeedPipelineStats {
+    uint64_t frames = 0;            // Frames decoded
+    uint64_t bytes = 0;             // Payload bytes decoded
+    uint64_t updates = 0;           // Updates the decoder emitted
+    uint64_t decode_errors = 0;     // Frames the decoder rejected
+    uint64_t buffer_full = 0;       // tryPush() calls that found the frame ring full
+};
+
+/// Receives the updates a decoder produces from one frame and hands them to the engine's shards
+template<typename OrderBookT>
+class FeedSink {
+public:
+    using Update = typename OrderBookEngine<OrderBookT>::Update;
+
+    explicit FeedSink(OrderBookEngine<OrderBookT>& engine) noexcept : engine_(&engine) {}
+
+    /// Queue an update for its symbol's shard (spins while the shard's ring is full)
+    void operator()(const Update& update) noexcept {
+        engine_->submit(update);
+        ++updates_;
+    }
+
+    /// Get number of updates emitted so far
+    [[nodiscard]] uint64_t updates() const noexcept { return updates_; }
+
+private:
+    OrderBookEngine<OrderBookT>* engine_;
+    uint64_t updates_ = 0;
+};
+
+/// Decoder of one feed frame: emits the frame's updates, in order, to the sink
+/// @return false if the frame is malformed (updates already emitted are still applied)
+template<typename D, typename OrderBookT>
+concept FeedDecoder = requires(D& decoder, std::span<const std::byte> frame, FeedSink<OrderBookT>& sink) {
+    { decoder(frame, sink) } -> std::convertible_to<bool>;
+};
+
+/// Three-stage ingestion pipeline for one feed connection: receive, decode, apply
+///
+///   socket thread   tryPush()/push() copies each raw frame into a byte ring and returns
+///   decode thread   runs the Decoder over each frame in place; decoded L2Update / L3Update messages
+///                   go to the OrderBookEngine shard that owns their symbol
+///   shard workers   apply queued messages in batches (applyBatch-style: top-of-book and depth
+///                   publication once per same-symbol run), one writer per book
+///
+/// The socket callback only pays for a copy, parsing runs on its own core, and a connection carrying
+/// hundreds of products spreads the book updates over the engine's shards.
+///
+/// Threading: one producer thread for tryPush()/push(). Between start() and stop() the decode thread
+/// and the engine workers run; without them, poll() decodes on the caller's thread and the engine is
+/// drained with engine().poll(). Decoder state (a SymbolRegistry, partial snapshots, ...) is only
+/// touched by the decode thread.
+///
+/// @tparam OrderBookT An L2 or L3 book type (selects L2Update or L3Update)
+/// @tparam Decoder Callable satisfying FeedDecoder<Decoder, OrderBookT>
+///
+/// Usage:
+/// @code
+/// auto decode = [registry = SymbolRegistry{}](std::span<const std::byte> frame, FeedSink<OrderBookL2>& sink) mutable {
+///     // parse frame, sink(L2Update{...}) per level change
+///     return true;
+/// };
+/// FeedPipeline<OrderBookL2, decltype(decode)> pipeline(decode, {.engine = {.num_shards = 4}});
+/// pipeline.start();
+/// socket.onMessage([&](std::span<const std::byte> frame) { pipeline.push(frame); });
+/// @endcode
+template<typename OrderBookT, typename Decoder>
+    requires FeedDecoder<Decoder, OrderBookT>
+class FeedPipeline {
+public:
+    using Engine = OrderBookEngine<OrderBookT>;
+    using Update = typename Engine::Update;
+
+    /// Constructor (threads are not started)
+    /// @param decoder Frame decoder, moved into the pipeline
+    /// @param config Engine shards, frame ring size and decode thread pinning
+    explicit FeedPipeline(Decoder decoder, const FeedPipelineConfig& config = {})
+        : config_(config),
+          decoder_(std::move(decoder)),
+          engine_(config.engine),
+          frames_(config.frame_buffer_bytes),
+          sink_(engine_) {}
+
+    ~FeedPipeline() {
+        stop();
+    }
+
+    FeedPipeline(const FeedPipeline&) = delete;
+    FeedPipeline& operator=(const FeedPipeline&) = delete;
+
+    /// Copy a raw frame into the pipeline (producer thread)
+    /// @return false if the frame ring is full or the frame is larger than maxFrameSize()
+    bool tryPush(std::span<const std::byte> frame) noexcept {
+        if (SLICK_LIKELY(frames_.tryPush(frame))) {
+            pushed_.store(pushed_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return true;
+        }
+        buffer_full_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /// Copy a raw frame into the pipeline, spinning while the ring is full (producer thread; threads must be running)
+    /// @return false if the frame is larger than maxFrameSize()
+    bool push(std::span<const std::byte> frame) noexcept {
+        if (SLICK_UNLIKELY(frame.size() > frames_.maxFrameSize())) {
+            return false;
+        }
+        while (!tryPush(frame)) {
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    /// Largest frame accepted (half the frame ring)
+    [[nodiscard]] std::size_t maxFrameSize() const noexcept { return frames_.maxFrameSize(); }
+
+    /// Decode queued frames on the calling thread (only while threads are stopped)
+    /// The engine's rings need room for the decoded updates; drain them with engine().poll().
+    /// @param max_frames Maximum number of frames to decode
+    /// @return Number of frames decoded
+    std::size_t poll(std::size_t max_frames = SIZE_MAX) {
+        std::size_t count = 0;
+        while (count < max_frames && decodeOne()) {
+            ++count;
+        }
+        return count;
+    }
+
+    /// Start the engine's shard workers and the decode thread
+    void start() {
+        engine_.start();
+        if (decoder_thread_.joinable()) {
+            return;
+        }
+        decoder_thread_ = std::jthread([this](std::stop_token stop_token) {
+            detail::pinCurrentThread(config_.decode_cpu);
+            while (!stop_token.stop_requested()) {
+                if (!decodeOne()) {
+                    std::this_thread::yield();
+                }
+            }
+            while (decodeOne()) {}  // Decode what was pushed before stop()
+        });
+    }
+
+    /// Stop after every pushed frame is decoded and applied
+    void stop() {
+        if (decoder_thread_.joinable()) {
+            decoder_thread_.request_stop();
+            decoder_thread_.join();
+        }
+        engine_.stop();
+    }
+
+    /// Check if the threads are running
+    [[nodiscard]] bool running() const noexcept { return decoder_thread_.joinable(); }
+
+    /// Block until every frame pushed before the call is decoded and applied (threads must be running)
+    void waitIdle() const noexcept {
+        const uint64_t target = pushed_.load(std::memory_order_relaxed);
+        while (decoded_.load(std::memory_order_acquire) < target) {
+            std::this_thread::yield();
+        }
+        engine_.waitIdle();
+    }
+
+    /// Get the pipeline's counters (safe to call from any thread)
+    [[nodiscard]] FeedPipelineStats stats() const noexcept {
+        FeedPipelineStats result;
+        result.frames = decoded_.load(std::memory_order_relaxed);
+        result.bytes = bytes_.load(std::memory_order_relaxed);
+        result.updates = updates_.load(std::memory_order_relaxed);
+        result.decode_errors = decode_errors_.load(std::memory_order_relaxed);
+        result.buffer_full = buffer_full_.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    /// Get the engine applying the decoded updates (books, shard counters, onBookCreated())
+    [[nodiscard]] Engine& engine() noexcept { return engine_; }
+    [[nodiscard]] const Engine& engine() const noexcept { return engine_; }
+
+    /// Get the decoder (decode thread only, or while threads are stopped)
+    [[nodiscard]] Decoder& decoder() noexcept { return decoder_; }
+
+private:
+    /// Decode the oldest queued frame (decode stage only)
+    /// @return false if no frame was queued
+    bool decodeOne() {
+        std::span<const std::byte> frame;
+        if (!frames_.front(frame)) {
+            return false;
+        }
+        const bool ok = decoder_(frame, sink_);
+        const std::size_t size = frame.size();
+        frames_.popFront();
+
+        // Counters are only written by the decode stage; atomics make them readable from stats()
+        if (!ok) {
+            decode_errors_.store(decode_errors_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+        bytes_.store(bytes_.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+        updates_.store(sink_.updates(), std::memory_order_relaxed);
+        // Release: the frame's updates are queued before a waitIdle() caller sees it decoded
+        decoded_.store(decoded_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        return true;
+    }
+
+    FeedPipelineConfig config_;                 // Pipeline configuration
+    Decoder decoder_;                           // Decode stage state
+    Engine engine_;                             // Apply stage
+    detail::FrameRing frames_;                  // Socket thread -> decode thread
+    FeedSink<OrderBookT> sink_;                 // Decode stage -> engine shards
+
+    // Producer-written counters
+    SLICK_CACHE_ALIGNED std::atomic<uint64_t> pushed_{0};
+    std::atomic<uint64_t> buffer_full_{0};
+
+    // Decode-stage-written counters
+    SLICK_CACHE_ALIGNED std::atomic<uint64_t> decoded_{0};
+    std::atomic<uint64_t> bytes_{0};
+    std::atomic<uint64_t> updates_{0};
+    std::atomic<uint64_t> decode_errors_{0};
+
+    std::jthread decoder_thread_;               // Decode thread started by start()
+};
+
+SLICK_NAMESPACE_END
@@ -0,0 +1,472 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/detail/book_update.hpp>
+#include <slick/orderbook/detail/mapped_file.hpp>
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+SLICK_NAMESPACE_BEGIN
+
+/// Book call recorded by a journal record
+enum class JournalOp : uint8_t {
+    UpdateLevel,    // OrderBookL2::updateLevel
+    AddOrder,       // OrderBookL3::addOrder
+    ModifyOrder,    // OrderBookL3::modifyOrder
+    DeleteOrder,    // OrderBookL3::deleteOrder
+    ExecuteOrder    // OrderBookL3::executeOrder
+};
+
+/// One journaled book call (fixed size, stored verbatim in journal files)
+struct JournalRecord {
+    static constexpr uint8_t kLastInBatch = 1;  // flags bit: the call passed is_last_in_batch
+
+    Timestamp timestamp = 0;
+    uint64_t seq_num = 0;       // Exchange sequence number (0 = no tracking)
+    uint64_t priority = 0;      // Queue priority (AddOrder/ModifyOrder, 0 = use timestamp)
+    OrderId order_id = 0;       // Order identifier (order calls)
+    Price price = 0;            // Level or order price (UpdateLevel, AddOrder, ModifyOrder)
+    Quantity quantity = 0;      // Level quantity, order quantity or executed quantity
+    SymbolId symbol = 0;        // Book the call applies to
+    Side side = Buy;            // UpdateLevel, AddOrder
+    JournalOp op = JournalOp::UpdateLevel;
+    uint8_t flags = kLastInBatch;
+    uint8_t reserved[3] = {};
+
+    /// Check if the call closed a batch
+    [[nodiscard]] bool isLastInBatch() const noexcept { return (flags & kLastInBatch) != 0; }
+
+    /// Check if the call is an L3 (order) call
+    [[nodiscard]] bool isOrderOp() const noexcept { return op != JournalOp::UpdateLevel; }
+
+    /// Record an L2 engine message
+    [[nodiscard]] static JournalRecord from(const L2Update& update, bool is_last_in_batch = true) noexcept {
+        JournalRecord record;
+        record.timestamp = update.timestamp;
+        record.seq_num = update.seq_num;
+        record.price = update.price;
+        record.quantity = update.quantity;
+        record.symbol = update.symbol;
+        record.side = update.side;
+        record.op = JournalOp::UpdateLevel;
+        record.flags = is_last_in_batch ? kLastInBatch : 0;
+        return record;
+    }
+
+    /// Record an L3 engine message
+    [[nodiscard]] static JournalRecord from(const L3Update& update, bool is_last_in_batch = true) noexcept {
+        JournalRecord record;
+        record.timestamp = update.timestamp;
+        record.seq_num = update.seq_num;
+        record.priority = update.priority;
+        record.order_id = update.order_id;
+        record.price = update.price;
+        record.quantity = update.quantity;
+        record.symbol = update.symbol;
+        record.side = update.side;
+        record.op = static_cast<JournalOp>(static_cast<uint8_t>(update.type) + 1);
+        record.flags = is_last_in_batch ? kLastInBatch : 0;
+        return record;
+    }
+
+    /// Convert an UpdateLevel record to an engine message
+    [[nodiscard]] L2Update toL2Update() const noexcept {
+        return L2Update{.timestamp = timestamp, .seq_num = seq_num, .price = price, .quantity = quantity,
+                        .symbol = symbol, .side = side};
+    }
+
+    /// Convert an order record to an engine message
+    [[nodiscard]] L3Update toL3Update() const noexcept {
+        return L3Update{.timestamp = timestamp, .seq_num = seq_num, .priority = priority, .order_id = order_id,
+                        .price = price, .quantity = quantity, .symbol = symbol, .side = side,
+                        .type = static_cast<L3UpdateType>(static_cast<uint8_t>(op) - 1)};
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<JournalRecord> && sizeof(JournalRecord) == 56);
+static_assert(static_cast<uint8_t>(JournalOp::AddOrder) == static_cast<uint8_t>(L3UpdateType::Add) + 1 &&
+              static_cast<uint8_t>(JournalOp::ExecuteOrder) == static_cast<uint8_t>(L3UpdateType::Execute) + 1);
+
+/// Outcome of JournalReader::replay()
+struct JournalReplayStats {
+    uint64_t records = 0;       // Records applied to a book (not counting rejected or skipped ones)
+    uint64_t rejected = 0;      // Records the book rejected (unknown order, duplicate id, out-of-order seq_num)
+    uint64_t skipped = 0;       // Records for other symbols or the other book kind
+};
+
+SLICK_NAMESPACE_END
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Journal file header, followed by JournalRecords up to the end of the file
+struct JournalFileHeader {
+    static constexpr char kMagic[8] = {'S', 'L', 'K', 'J', 'R', 'N', 'L', '\0'};
+    static constexpr uint32_t kVersion = 1;
+
+    char magic[8];          // kMagic
+    uint32_t version;       // kVersion
+    uint32_t record_size;   // sizeof(JournalRecord) of the writer
+};
+
+static_assert(sizeof(JournalFileHeader) % 8 == 0);
+
+/// Apply one journal record to a book
+/// @return 1 if applied, 0 if rejected, -1 if the record is for the other book kind
+template<typename BookT>
+int applyJournalRecord(BookT& book, const JournalRecord& record) {
+    if (record.isOrderOp() != OrderUpdatableBook<BookT>) {
+        return -1;
+    }
+    if constexpr (OrderUpdatableBook<BookT>) {
+        return applyUpdate(book, record.toL3Update(), record.isLastInBatch()) ? 1 : 0;
+    } else {
+        return applyUpdate(book, record.toL2Update(), record.isLastInBatch()) ? 1 : 0;
+    }
+}
+
+SLICK_DETAIL_NAMESPACE_END
+
+SLICK_NAMESPACE_BEGIN
+
+/// Append-only journal of book calls
+///
+/// Records the input calls of L2 and L3 books (with their sequence numbers and is_last_in_batch flags)
+/// so a session can be replayed deterministically with JournalReader. Records are buffered and written
+/// in blocks; call flush() or sync() to bound what a crash can lose. A torn last record is ignored by
+/// the reader and dropped when the journal is reopened for appending.
+///
+/// Not thread-safe: use one writer per feed thread (one file each), or journal in front of the engine.
+///
+/// Usage:
+/// @code
+/// JournalWriter journal;
+/// journal.open("session.jrnl");
+/// journal.addOrder(symbol, order_id, Side::Buy, price, quantity, timestamp, 0, seq_num);
+/// book.addOrder(order_id, Side::Buy, price, quantity, timestamp, 0, seq_num);
+/// @endcode
+class JournalWriter {
+public:
+    /// Constructor
+    /// @param buffer_records Records buffered between writes
+    explicit JournalWriter(std::size_t buffer_records = 4096) {
+        buffer_.reserve(std::max<std::size_t>(buffer_records, 1));
+    }
+
+    /// Destructor - writes buffered records and closes the file
+    ~JournalWriter() { close(); }
+
+    JournalWriter(const JournalWriter&) = delete;
+    JournalWriter& operator=(const JournalWriter&) = delete;
+
+    /// Open a journal file
+    /// @param path Journal file
+    /// @param append Keep the records of an existing journal and append after them
+    /// @return false if the file cannot be created, or an existing file is not a journal of this layout
+    bool open(const std::string& path, bool append = false) {
+        close();
+        std::error_code ec;
+        const bool existing = append && std::filesystem::exists(path, ec) && std::filesystem::file_size(path, ec) > 0;
+        if (existing) {
+            detail::MappedFile file;
+            if (!file.open(path) || !validHeader(file)) {
+                return false;
+            }
+            // Drop a torn last record so appended records stay aligned
+            const std::size_t records = (file.size() - sizeof(detail::JournalFileHeader)) / sizeof(JournalRecord);
+            file.close();
+            std::filesystem::resize_file(path, sizeof(detail::JournalFileHeader) + records * sizeof(JournalRecord), ec);
+            if (ec) {
+                return false;
+            }
+            file_ = std::fopen(path.c_str(), "ab");
+        } else {
+            file_ = std::fopen(path.c_str(), "wb");
+            if (file_ != nullptr) {
+                detail::JournalFileHeader header{};
+                std::memcpy(header.magic, detail::JournalFileHeader::kMagic, sizeof(header.magic));
+                header.version = detail::JournalFileHeader::kVersion;
+                header.record_size = sizeof(JournalRecord);
+                if (std::fwrite(&header, sizeof(header), 1, file_) != 1) {
+                    std::fclose(file_);
+                    file_ = nullptr;
+                }
+            }
+        }
+        failed_ = file_ == nullptr;
+        return file_ != nullptr;
+    }
+
+    /// Write buffered records and close the file
+    /// @return false if any write failed
+    bool close() {
+        if (file_ == nullptr) {
+            return !failed_;
+        }
+        flush();
+        failed_ |= std::fclose(file_) != 0;
+        file_ = nullptr;
+        return !failed_;
+    }
+
+    /// Check if a journal is open
+    [[nodiscard]] bool isOpen() const noexcept { return file_ != nullptr; }
+
+    /// Check if a write failed (records from then on may be missing)
+    [[nodiscard]] bool failed() const noexcept { return failed_; }
+
+    /// Get number of records appended since open()
+    [[nodiscard]] uint64_t recordCount() const noexcept { return records_; }
+
+    /// Append a record
+    /// @return false if no journal is open or writing the buffer failed
+    bool append(const JournalRecord& record) {
+        if (SLICK_UNLIKELY(file_ == nullptr)) {
+            return false;
+        }
+        buffer_.push_back(record);
+        ++records_;
+        return buffer_.size() < buffer_.capacity() || flush();
+    }
+
+    /// Append an engine message
+    bool append(const L2Update& update, bool is_last_in_batch = true) {
+        return append(JournalRecord::from(update, is_last_in_batch));
+    }
+
+    /// Append an engine message
+    bool append(const L3Update& update, bool is_last_in_batch = true) {
+        return append(JournalRecord::from(update, is_last_in_batch));
+    }
+
+    /// Append a packet as one batch (as passed to applyBatch())
+    template<typename Update>
+        requires std::same_as<Update, L2Update> || std::same_as<Update, L3Update>
+    bool appendBatch(std::span<const Update> updates) {
+        bool ok = true;
+        for (std::size_t i = 0; i < updates.size(); ++i) {
+            ok &= append(updates[i], i + 1 == updates.size());
+        }
+        return ok;
+    }
+
+    /// Record OrderBookL2::updateLevel()
+    bool updateLevel(SymbolId symbol, Side side, Price price, Quantity quantity, Timestamp timestamp,
+                     uint64_t seq_num = 0, bool is_last_in_batch = true) {
+        return append(L2Update{.timestamp = timestamp, .seq_num = seq_num, .price = price, .quantity = quantity,
+                               .symbol = symbol, .side = side}, is_last_in_batch);
+    }
+
+    /// Record OrderBookL3::addOrder()
+    bool addOrder(SymbolId symbol, OrderId order_id, Side side, Price price, Quantity quantity, Timestamp timestamp,
+                  uint64_t priority = 0, uint64_t seq_num = 0, bool is_last_in_batch = true) {
+        return append(L3Update{.timestamp = timestamp, .seq_num = seq_num, .priority = priority, .order_id = order_id,
+                               .price = price, .quantity = quantity, .symbol = symbol, .side = side,
+                               .type = L3UpdateType::Add}, is_last_in_batch);
+    }
+
+    /// Record OrderBookL3::modifyOrder()
+    bool modifyOrder(SymbolId symbol, OrderId order_id, Price new_price, Quantity new_quantity, Timestamp timestamp,
+                     uint64_t new_priority = 0, uint64_t seq_num = 0, bool is_last_in_batch = true) {
+        return append(L3Update{.timestamp = timestamp, .seq_num = seq_num, .priority = new_priority,
+                               .order_id = order_id, .price = new_price, .quantity = new_quantity, .symbol = symbol,
+                               .type = L3UpdateType::Modify}, is_last_in_batch);
+    }
+
+    /// Record OrderBookL3::deleteOrder()
+    bool deleteOrder(SymbolId symbol, OrderId order_id, Timestamp timestamp, uint64_t seq_num = 0,
+                     bool is_last_in_batch = true) {
+        return append(L3Update{.timestamp = timestamp, .seq_num = seq_num, .order_id = order_id, .symbol = symbol,
+                               .type = L3UpdateType::Delete}, is_last_in_batch);
+    }
+
+    /// Record OrderBookL3::executeOrder()
+    bool executeOrder(SymbolId symbol, OrderId order_id, Quantity executed_quantity, Timestamp timestamp,
+                      uint64_t seq_num = 0, bool is_last_in_batch = true) {
+        return append(L3Update{.timestamp = timestamp, .seq_num = seq_num, .order_id = order_id,
+                               .quantity = executed_quantity, .symbol = symbol, .type = L3UpdateType::Execute},
+                      is_last_in_batch);
+    }
+
+    /// Write buffered records to the file (and the OS page cache)
+    /// @return false if the write failed
+    bool flush() {
+        if (file_ == nullptr) {
+            return false;
+        }
+        if (!buffer_.empty()) {
+            failed_ |= std::fwrite(buffer_.data(), sizeof(JournalRecord), buffer_.size(), file_) != buffer_.size();
+            buffer_.clear();
+        }
+        failed_ |= std::fflush(file_) != 0;
+        return !failed_;
+    }
+
+    /// Write buffered records and wait until they are on disk
+    /// @return false if the write failed
+    bool sync() {
+        if (!flush()) {
+            return false;
+        }
+#if defined(__linux__)
+        failed_ |= ::fsync(::fileno(file_)) != 0;
+#endif
+        return !failed_;
+    }
+
+    /// Check a journal file header
+    static bool validHeader(const detail::MappedFile& file) noexcept {
+        detail::JournalFileHeader header;
+        if (file.size() < sizeof(header)) {
+            return false;
+        }
+        std::memcpy(&header, file.data(), sizeof(header));
+        return std::memcmp(header.magic, detail::JournalFileHeader::kMagic, sizeof(header.magic)) == 0 &&
+               header.version == detail::JournalFileHeader::kVersion && header.record_size == sizeof(JournalRecord);
+    }
+
+private:
+    std::FILE* file_ = nullptr;             // Open journal
+    std::vector<JournalRecord> buffer_;     // Records not yet written
+    uint64_t records_ = 0;                  // Records appended since open()
+    bool failed_ = false;                   // A write failed
+};
+
+/// Memory-mapped journal reader and replay engine
+///
+/// Maps a journal written by JournalWriter and replays it in file order, so the same journal always
+/// rebuilds the same books. Records are read straight from the mapping (no decode or copy) with
+/// software prefetching ahead of the replay cursor; the kernel reads the file ahead sequentially.
+///
+/// Usage:
+/// @code
+/// JournalReader journal;
+/// if (journal.open("session.jrnl")) {
+///     OrderBookManager<OrderBookL3> books;
+///     JournalReplayStats stats = journal.replay(books);
+/// }
+/// @endcode
+class JournalReader {
+public:
+    /// Records ahead of the cursor to prefetch
+    static constexpr std::size_t kPrefetchDistance = 16;
+
+    /// Open a journal file
+    /// @return false if the file is missing or not a journal of this layout
+    bool open(const std::string& path) {
+        close();
+        if (!file_.open(path) || !JournalWriter::validHeader(file_)) {
+            close();
+            return false;
+        }
+        // A torn last record (crash while appending) is ignored
+        const std::size_t count = (file_.size() - sizeof(detail::JournalFileHeader)) / sizeof(JournalRecord);
+        records_ = {reinterpret_cast<const JournalRecord*>(file_.data() + sizeof(detail::JournalFileHeader)), count};
+        return true;
+    }
+
+    /// Release the file
+    void close() noexcept {
+        file_.close();
+        records_ = {};
+    }
+
+    /// Check if a journal is open
+    [[nodiscard]] bool isOpen() const noexcept { return file_.isOpen(); }
+
+    /// Get all records (views into the mapping, valid until close())
+    [[nodiscard]] std::span<const JournalRecord> records() const noexcept { return records_; }
+
+    /// Get number of records
+    [[nodiscard]] std::size_t size() const noexcept { return records_.size(); }
+
+    /// Call fn(record) for every record in file order
+    template<typename Fn>
+    void forEach(Fn&& fn) const {
+        forEach(records_, fn);
+    }
+
+    /// Call fn(record) for every record of a range in order, prefetching ahead
+    template<typename Fn>
+    static void forEach(std::span<const JournalRecord> records, Fn&& fn) {
+        const JournalRecord* record = records.data();
+        const JournalRecord* const end = record + records.size();
+        for (; record != end; ++record) {
+            // Stay inside the mapping: forming a pointer past its end is undefined
+            if (end - record > static_cast<std::ptrdiff_t>(kPrefetchDistance)) {
+                SLICK_PREFETCH(record + kPrefetchDistance);
+            }
+            fn(*record);
+        }
+    }
+
+    /// Replay the records of one book's symbol into it
+    template<typename BookT>
+        requires detail::LevelUpdatableBook<BookT> || detail::OrderUpdatableBook<BookT>
+    JournalReplayStats replay(BookT& book) const {
+        return replay(book, records_);
+    }
+
+    /// Replay the records of one book's symbol from a range of records into it
+    template<typename BookT>
+        requires detail::LevelUpdatableBook<BookT> || detail::OrderUpdatableBook<BookT>
+    static JournalReplayStats replay(BookT& book, std::span<const JournalRecord> records) {
+        JournalReplayStats stats;
+        const SymbolId symbol = book.symbol();
+        forEach(records, [&](const JournalRecord& record) {
+            if (record.symbol != symbol) {
+                ++stats.skipped;
+                return;
+            }
+            count(stats, detail::applyJournalRecord(book, record));
+        });
+        return stats;
+    }
+
+    /// Replay every record into a manager's books, creating books on first use
+    template<typename Manager>
+        requires requires(Manager& manager, SymbolId symbol) { manager.getOrCreateOrderBook(symbol); }
+    JournalReplayStats replay(Manager& manager) const {
+        JournalReplayStats stats;
+        SymbolId symbol = 0;
+        decltype(manager.getOrCreateOrderBook(symbol)) book = nullptr;
+        forEach([&](const JournalRecord& record) {
+            // Feeds arrive in runs per symbol; only look the book up when the symbol changes
+            if (book == nullptr || record.symbol != symbol) {
+                symbol = record.symbol;
+                book = manager.getOrCreateOrderBook(symbol);
+            }
+            count(stats, detail::applyJournalRecord(*book, record));
+        });
+        return stats;
+    }
+
+private:
+    static void count(JournalReplayStats& stats, int result) noexcept {
+        stats.records += result > 0 ? 1 : 0;
+        stats.rejected += result == 0 ? 1 : 0;
+        stats.skipped += result < 0 ? 1 : 0;
+    }
+
+    detail::MappedFile file_;                   // Journal file contents
+    std::span<const JournalRecord> records_;    // Records in the mapping
+};
+
+SLICK_NAMESPACE_END
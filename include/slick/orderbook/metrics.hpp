@@ -0,0 +1,382 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/events.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+SLICK_NAMESPACE_BEGIN
+
+/// Book operations timed by BookMetrics
+enum class BookOperation : uint8_t {
+    UpdateLevel,    // OrderBookL2::updateLevel()
+    ApplyBatch,     // applyBatch() of either book (the whole batch)
+    AddOrder,       // OrderBookL3::addOrder() and addOrModifyOrder()
+    ModifyOrder,    // OrderBookL3::modifyOrder()
+    DeleteOrder,    // OrderBookL3::deleteOrder()
+    ExecuteOrder,   // OrderBookL3::executeOrder()
+    SubmitOrder,    // OrderBookL3::submitOrder() and submitStopOrder(), including matching (stops it triggers are also timed on their own)
+    Notify,         // One observer fan-out (every observer called for one event)
+    Count
+};
+
+/// Events counted by BookMetrics
+enum class BookCounter : uint8_t {
+    RejectedSeqNum,     // Calls rejected for an out-of-order sequence number (a rejected batch counts once)
+    OrderNotFound,      // Modify, delete or execute of an order id the book does not hold
+    LevelInserted,      // Price levels created
+    LevelErased,        // Price levels removed
+    PoolGrowth,         // Order pool growths after the first allocation (OrderBookL3)
+    Count
+};
+
+[[nodiscard]] constexpr const char* toString(BookOperation operation) noexcept {
+    switch (operation) {
+        case BookOperation::UpdateLevel:  return "UpdateLevel";
+        case BookOperation::ApplyBatch:   return "ApplyBatch";
+        case BookOperation::AddOrder:     return "AddOrder";
+        case BookOperation::ModifyOrder:  return "ModifyOrder";
+        case BookOperation::DeleteOrder:  return "DeleteOrder";
+        case BookOperation::ExecuteOrder: return "ExecuteOrder";
+        case BookOperation::SubmitOrder:  return "SubmitOrder";
+        case BookOperation::Notify:       return "Notify";
+        default:                          return "Unknown";
+    }
+}
+
+[[nodiscard]] constexpr const char* toString(BookCounter counter) noexcept {
+    switch (counter) {
+        case BookCounter::RejectedSeqNum: return "RejectedSeqNum";
+        case BookCounter::OrderNotFound:  return "OrderNotFound";
+        case BookCounter::LevelInserted:  return "LevelInserted";
+        case BookCounter::LevelErased:    return "LevelErased";
+        case BookCounter::PoolGrowth:     return "PoolGrowth";
+        default:                          return "Unknown";
+    }
+}
+
+/// Copy of a LatencyHistogram
+/// Buckets are log-linear (HDR-style): each power of two of nanoseconds is split into 8 equal buckets,
+/// so a bucket's bounds are within 12.5% of each other. Values of 2^32 ns (about 4.3 s) and more share
+/// the last bucket.
+struct LatencySnapshot {
+    static constexpr unsigned kSubBucketBits = 3;
+    static constexpr std::size_t kSubBuckets = std::size_t{1} << kSubBucketBits;
+    static constexpr std::size_t kBucketCount = (32 - kSubBucketBits + 1) * kSubBuckets;
+
+    std::array<uint64_t, kBucketCount> buckets{};   // Samples per bucket
+    uint64_t count = 0;                             // Samples (sum of buckets)
+    uint64_t total_nanos = 0;                       // Sum of all samples
+    uint64_t max_nanos = 0;                         // Largest sample
+
+    /// Get the bucket a value falls in
+    [[nodiscard]] static constexpr std::size_t bucketOf(uint64_t nanos) noexcept {
+        if (nanos < kSubBuckets) {
+            return static_cast<std::size_t>(nanos);
+        }
+        const unsigned exponent = static_cast<unsigned>(std::bit_width(nanos)) - 1;
+        if (exponent >= 32) {
+            return kBucketCount - 1;
+        }
+        const unsigned shift = exponent - kSubBucketBits;
+        return (exponent - kSubBucketBits + 1) * kSubBuckets + ((nanos >> shift) & (kSubBuckets - 1));
+    }
+
+    /// Get the largest value a bucket holds
+    [[nodiscard]] static constexpr uint64_t bucketUpperBound(std::size_t bucket) noexcept {
+        if (bucket < kSubBuckets) {
+            return bucket;
+        }
+        const std::size_t shift = bucket / kSubBuckets - 1;
+        const uint64_t lower = (kSubBuckets + bucket % kSubBuckets) << shift;
+        return lower + (uint64_t{1} << shift) - 1;
+    }
+
+    /// Get the value at or below which a fraction q of the samples fall (0 if empty)
+    /// Reports the upper bound of the bucket holding that sample, capped at max_nanos
+    [[nodiscard]] uint64_t percentile(double q) const noexcept {
+        if (count == 0) {
+            return 0;
+        }
+        const auto rank = static_cast<uint64_t>(std::clamp(q, 0.0, 1.0) * static_cast<double>(count - 1)) + 1;
+        uint64_t seen = 0;
+        for (std::size_t bucket = 0; bucket < kBucketCount; ++bucket) {
+            seen += buckets[bucket];
+            if (seen >= rank) {
+                return std::min(bucketUpperBound(bucket), max_nanos);
+            }
+        }
+        return max_nanos;
+    }
+
+    /// Get the mean sample (0 if empty)
+    [[nodiscard]] double mean() const noexcept {
+        return count == 0 ? 0.0 : static_cast<double>(total_nanos) / static_cast<double>(count);
+    }
+
+    /// Add another snapshot's samples
+    void merge(const LatencySnapshot& other) noexcept {
+        for (std::size_t bucket = 0; bucket < kBucketCount; ++bucket) {
+            buckets[bucket] += other.buckets[bucket];
+        }
+        count += other.count;
+        total_nanos += other.total_nanos;
+        max_nanos = std::max(max_nanos, other.max_nanos);
+    }
+};
+
+/// Latency histogram written by one thread and readable from any other
+/// Every bucket is an atomic counter that the writer bumps with a relaxed load and store (no locked
+/// instruction). A snapshot() taken while the writer runs is not a single instant, but every counter in it
+/// is a value the writer stored, so totals never go backwards between snapshots.
+class LatencyHistogram {
+public:
+    /// Record a sample (writer thread only)
+    void record(uint64_t nanos) noexcept {
+        bump(buckets_[LatencySnapshot::bucketOf(nanos)], 1);
+        bump(total_nanos_, nanos);
+        if (nanos > max_nanos_.load(std::memory_order_relaxed)) {
+            max_nanos_.store(nanos, std::memory_order_relaxed);
+        }
+    }
+
+    /// Copy the histogram (any thread, lock-free)
+    [[nodiscard]] LatencySnapshot snapshot() const noexcept {
+        LatencySnapshot out;
+        for (std::size_t bucket = 0; bucket < LatencySnapshot::kBucketCount; ++bucket) {
+            out.buckets[bucket] = buckets_[bucket].load(std::memory_order_relaxed);
+            out.count += out.buckets[bucket];
+        }
+        out.total_nanos = total_nanos_.load(std::memory_order_relaxed);
+        out.max_nanos = max_nanos_.load(std::memory_order_relaxed);
+        return out;
+    }
+
+private:
+    static void bump(std::atomic<uint64_t>& counter, uint64_t amount) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<uint64_t>, LatencySnapshot::kBucketCount> buckets_{};
+    std::atomic<uint64_t> total_nanos_{0};
+    std::atomic<uint64_t> max_nanos_{0};
+};
+
+/// Copy of a BookMetrics, or the sum of several (OrderBookManager::metricsSnapshot())
+struct BookMetricsSnapshot {
+    std::array<LatencySnapshot, static_cast<std::size_t>(BookOperation::Count)> latency{};
+    std::array<uint64_t, static_cast<std::size_t>(BookCounter::Count)> counters{};
+
+    [[nodiscard]] const LatencySnapshot& operator[](BookOperation operation) const noexcept {
+        return latency[static_cast<std::size_t>(operation)];
+    }
+
+    [[nodiscard]] uint64_t operator[](BookCounter counter) const noexcept {
+        return counters[static_cast<std::size_t>(counter)];
+    }
+
+    /// Add another snapshot's samples and counts
+    void merge(const BookMetricsSnapshot& other) noexcept {
+        for (std::size_t i = 0; i < latency.size(); ++i) {
+            latency[i].merge(other.latency[i]);
+        }
+        for (std::size_t i = 0; i < counters.size(); ++i) {
+            counters[i] += other.counters[i];
+        }
+    }
+};
+
+/// Hot-path latency histograms and counters of one book
+///
+/// Books record into it only when the build defines SLICK_ORDERBOOK_METRICS=1 (CMake option
+/// SLICK_ORDERBOOK_ENABLE_METRICS); otherwise they hold no metrics and every hook compiles away.
+/// The book's update thread writes, monitoring threads read snapshot() without locking.
+/// Latencies are steady_clock nanoseconds; a timed call costs two clock reads plus three relaxed stores
+/// (tens of nanoseconds), and a book holds about 16 KB of histograms.
+class BookMetrics {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Records the time from its construction to its destruction as one sample
+    class Timer {
+    public:
+        Timer(BookMetrics& metrics, BookOperation operation) noexcept
+            : metrics_(metrics), start_(Clock::now()), operation_(operation) {}
+
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+
+        ~Timer() {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_);
+            metrics_.record(operation_, static_cast<uint64_t>(elapsed.count()));
+        }
+
+    private:
+        BookMetrics& metrics_;
+        Clock::time_point start_;
+        BookOperation operation_;
+    };
+
+    /// Time an operation until the returned timer goes out of scope
+    [[nodiscard]] Timer time(BookOperation operation) noexcept {
+        return Timer(*this, operation);
+    }
+
+    /// Record a latency sample
+    void record(BookOperation operation, uint64_t nanos) noexcept {
+        latency_[static_cast<std::size_t>(operation)].record(nanos);
+    }
+
+    /// Add to a counter
+    void count(BookCounter counter, uint64_t amount = 1) noexcept {
+        auto& value = counters_[static_cast<std::size_t>(counter)];
+        value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    /// Count a PoolGrowth if the pool capacity grew since the last call (the first call only sets the baseline)
+    void notePoolCapacity(std::size_t capacity) noexcept {
+        if (SLICK_UNLIKELY(capacity != pool_capacity_)) {
+            if (pool_capacity_ != 0) {
+                count(BookCounter::PoolGrowth);
+            }
+            pool_capacity_ = capacity;
+        }
+    }
+
+    /// Get a latency histogram
+    [[nodiscard]] const LatencyHistogram& histogram(BookOperation operation) const noexcept {
+        return latency_[static_cast<std::size_t>(operation)];
+    }
+
+    /// Get a counter (any thread)
+    [[nodiscard]] uint64_t counter(BookCounter counter) const noexcept {
+        return counters_[static_cast<std::size_t>(counter)].load(std::memory_order_relaxed);
+    }
+
+    /// Copy every histogram and counter (any thread, lock-free)
+    [[nodiscard]] BookMetricsSnapshot snapshot() const noexcept {
+        BookMetricsSnapshot out;
+        for (std::size_t i = 0; i < latency_.size(); ++i) {
+            out.latency[i] = latency_[i].snapshot();
+        }
+        for (std::size_t i = 0; i < counters_.size(); ++i) {
+            out.counters[i] = counters_[i].load(std::memory_order_relaxed);
+        }
+        return out;
+    }
+
+private:
+    std::array<LatencyHistogram, static_cast<std::size_t>(BookOperation::Count)> latency_;
+    std::array<std::atomic<uint64_t>, static_cast<std::size_t>(BookCounter::Count)> counters_{};
+    std::size_t pool_capacity_ = 0;  // Writer thread only
+};
+
+SLICK_NAMESPACE_END
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+#if SLICK_ORDERBOOK_METRICS
+
+/// A book's BookMetrics, on the heap so the book stays movable and observer dispatch can point at it
+class BookMetricsSlot {
+public:
+    BookMetricsSlot() : metrics_(std::make_unique<BookMetrics>()) {}
+
+    [[nodiscard]] BookMetrics::Timer time(BookOperation operation) noexcept { return metrics_->time(operation); }
+    void count(BookCounter counter, uint64_t amount = 1) noexcept { metrics_->count(counter, amount); }
+    void notePoolCapacity(std::size_t capacity) noexcept { metrics_->notePoolCapacity(capacity); }
+
+    [[nodiscard]] BookMetrics& get() const noexcept { return *metrics_; }
+
+    /// Point an observer dispatch's fan-out timing at these metrics
+    template<typename Dispatch>
+    void bind(Dispatch& dispatch) const noexcept { dispatch.bindMetrics(*metrics_); }
+
+private:
+    std::unique_ptr<BookMetrics> metrics_;
+};
+
+/// Observer dispatch that times every fan-out into BookOperation::Notify
+/// Events nobody subscribed to are neither delivered nor timed.
+template<typename Dispatch>
+class MeteredObserverDispatch : public Dispatch {
+public:
+    using Dispatch::Dispatch;
+
+    void bindMetrics(BookMetrics& metrics) noexcept { metrics_ = &metrics; }
+
+    void notifyPriceLevelUpdate(const PriceLevelUpdate& update) const {
+        if (this->wantsPriceLevelUpdates()) {
+            [[maybe_unused]] const auto timer = metrics_->time(BookOperation::Notify);
+            Dispatch::notifyPriceLevelUpdate(update);
+        }
+    }
+
+    void notifyOrderUpdate(const OrderUpdate& update) const {
+        if (this->wantsOrderUpdates()) {
+            [[maybe_unused]] const auto timer = metrics_->time(BookOperation::Notify);
+            Dispatch::notifyOrderUpdate(update);
+        }
+    }
+
+    void notifyTrade(const Trade& trade) const {
+        if (this->wantsTrades()) {
+            [[maybe_unused]] const auto timer = metrics_->time(BookOperation::Notify);
+            Dispatch::notifyTrade(trade);
+        }
+    }
+
+    void notifyTopOfBookUpdate(const TopOfBook& tob) const {
+        if (this->wantsTopOfBookUpdates()) {
+            [[maybe_unused]] const auto timer = metrics_->time(BookOperation::Notify);
+            Dispatch::notifyTopOfBookUpdate(tob);
+        }
+    }
+
+    void notifySnapshotBegin(SymbolId symbol, uint64_t seq_num, Timestamp timestamp) const {
+        [[maybe_unused]] const auto timer = metrics_->time(BookOperation::Notify);
+        Dispatch::notifySnapshotBegin(symbol, seq_num, timestamp);
+    }
+
+    void notifySnapshotEnd(SymbolId symbol, uint64_t seq_num, Timestamp timestamp) const {
+        [[maybe_unused]] const auto timer = metrics_->time(BookOperation::Notify);
+        Dispatch::notifySnapshotEnd(symbol, seq_num, timestamp);
+    }
+
+private:
+    BookMetrics* metrics_ = nullptr;
+};
+
+template<typename Dispatch>
+using ObserverDispatchOf = MeteredObserverDispatch<Dispatch>;
+
+#else
+
+/// Stand-in for BookMetricsSlot when metrics are compiled out: every hook is an empty inline call
+struct BookMetricsSlot {
+    struct Timer {};
+
+    [[nodiscard]] static constexpr Timer time(BookOperation) noexcept { return {}; }
+    static constexpr void count(BookCounter, uint64_t = 1) noexcept {}
+    static constexpr void notePoolCapacity(std::size_t) noexcept {}
+
+    template<typename Dispatch>
+    static constexpr void bind(Dispatch&) noexcept {}
+};
+
+template<typename Dispatch>
+using ObserverDispatchOf = Dispatch;
+
+#endif
+
+SLICK_DETAIL_NAMESPACE_END
@@ -8,6 +8,8 @@
 #include <slick/orderbook/concepts.hpp>
 #include <vector>
 #include <memory>
+#include <algorithm>
+#include <cstdint>
 
 SLICK_NAMESPACE_BEGIN
 
@@ -46,8 +48,22 @@ public:
     }
 };
 
+/// Observer event subscription mask (regular enum for bitwise operations)
+enum ObserverEvents : uint8_t {
+    PriceLevelEvents = 1 << 0,  // onPriceLevelUpdate()
+    OrderEvents = 1 << 1,       // onOrderUpdate()
+    TradeEvents = 1 << 2,       // onTrade()
+    TopOfBookEvents = 1 << 3,   // onTopOfBookUpdate()
+    SnapshotEvents = 1 << 4,    // onSnapshotBegin() / onSnapshotEnd()
+    AllEvents = PriceLevelEvents | OrderEvents | TradeEvents | TopOfBookEvents | SnapshotEvents
+};
+
 /// Observer manager for notifying multiple observers
 /// Uses type erasure to support both concept-based and inheritance-based observers
+///
+/// Each observer subscribes to a set of ObserverEvents and optionally a depth: price level and order
+/// updates at a level index >= depth are not delivered to it. The manager keeps the union of all
+/// subscriptions so the book can skip building events (and computing level indexes) nobody will see.
 class ObserverManager {
 public:
     ObserverManager() = default;
@@ -61,9 +77,12 @@ public:
 
     /// Add an observer
     /// @param observer Shared pointer to observer (can be IOrderBookObserver or concept-based)
-    void addObserver(std::shared_ptr<IOrderBookObserver> observer) {
+    /// @param events Bitset of ObserverEvents to deliver (default: all)
+    /// @param depth Only deliver price level and order updates for the top N levels (0 = all levels)
+    void addObserver(std::shared_ptr<IOrderBookObserver> observer, uint8_t events = AllEvents, std::size_t depth = 0) {
         if (observer) {
-            observers_.push_back(std::move(observer));
+            observers_.push_back({std::move(observer), depth == 0 ? kAllLevels : depth, events});
+            updateSubscriptions();
         }
     }
 
@@ -71,9 +90,11 @@ public:
     /// @param observer Observer to remove
     /// @return true if observer was found and removed
     bool removeObserver(const std::shared_ptr<IOrderBookObserver>& observer) {
-        auto it = std::find(observers_.begin(), observers_.end(), observer);
+        auto it = std::find_if(observers_.begin(), observers_.end(),
+                               [&observer](const Subscription& sub) { return sub.observer == observer; });
         if (it != observers_.end()) {
             observers_.erase(it);
+            updateSubscriptions();
             return true;
         }
         return false;
@@ -82,6 +103,7 @@ public:
     /// Clear all observers
     void clearObservers() noexcept {
         observers_.clear();
+        updateSubscriptions();
     }
 
     /// Get number of observers
@@ -89,50 +111,173 @@ public:
         return observers_.size();
     }
 
+    /// Check if any observer is subscribed to events of each kind
+    /// Lets the book skip building events nobody will see
+    [[nodiscard]] bool wantsPriceLevelUpdates() const noexcept { return (event_mask_ & PriceLevelEvents) != 0; }
+    [[nodiscard]] bool wantsOrderUpdates() const noexcept { return (event_mask_ & OrderEvents) != 0; }
+    [[nodiscard]] bool wantsTrades() const noexcept { return (event_mask_ & TradeEvents) != 0; }
+    [[nodiscard]] bool wantsTopOfBookUpdates() const noexcept { return (event_mask_ & TopOfBookEvents) != 0; }
+
+    /// Number of leading levels whose index any price level or order subscriber can receive
+    /// 0 if there are no such subscribers, SIZE_MAX if one of them wants all levels
+    [[nodiscard]] std::size_t levelIndexLimit() const noexcept {
+        return level_index_limit_;
+    }
+
     /// Notify all observers of price level update
     void notifyPriceLevelUpdate(const PriceLevelUpdate& update) const {
-        for (const auto& observer : observers_) {
-            observer->onPriceLevelUpdate(update);
+        if (!wantsPriceLevelUpdates()) {
+            return;
+        }
+        for (const auto& sub : observers_) {
+            if (sub.accepts(PriceLevelEvents, update.level_index)) {
+                sub.observer->onPriceLevelUpdate(update);
+            }
         }
     }
 
     /// Notify all observers of order update
     void notifyOrderUpdate(const OrderUpdate& update) const {
-        for (const auto& observer : observers_) {
-            observer->onOrderUpdate(update);
+        if (!wantsOrderUpdates()) {
+            return;
+        }
+        for (const auto& sub : observers_) {
+            if (sub.accepts(OrderEvents, update.price_level_index)) {
+                sub.observer->onOrderUpdate(update);
+            }
         }
     }
 
     /// Notify all observers of trade
     void notifyTrade(const Trade& trade) const {
-        for (const auto& observer : observers_) {
-            observer->onTrade(trade);
-        }
+        notifyAll(TradeEvents, [&trade](IOrderBookObserver& observer) { observer.onTrade(trade); });
     }
 
     /// Notify all observers of top-of-book update
     void notifyTopOfBookUpdate(const TopOfBook& tob) const {
-        for (const auto& observer : observers_) {
-            observer->onTopOfBookUpdate(tob);
-        }
+        notifyAll(TopOfBookEvents, [&tob](IOrderBookObserver& observer) { observer.onTopOfBookUpdate(tob); });
     }
 
     /// Notify all observers that snapshot processing is beginning
     void notifySnapshotBegin(SymbolId symbol, uint64_t seq_num, Timestamp timestamp) const {
-        for (const auto& observer : observers_) {
-            observer->onSnapshotBegin(symbol, seq_num, timestamp);
-        }
+        notifyAll(SnapshotEvents, [&](IOrderBookObserver& observer) { observer.onSnapshotBegin(symbol, seq_num, timestamp); });
     }
 
     /// Notify all observers that snapshot processing is complete
     void notifySnapshotEnd(SymbolId symbol, uint64_t seq_num, Timestamp timestamp) const {
-        for (const auto& observer : observers_) {
-            observer->onSnapshotEnd(symbol, seq_num, timestamp);
+        notifyAll(SnapshotEvents, [&](IOrderBookObserver& observer) { observer.onSnapshotEnd(symbol, seq_num, timestamp); });
+    }
+
+private:
+    static constexpr std::size_t kAllLevels = SIZE_MAX;
+
+    struct Subscription {
+        std::shared_ptr<IOrderBookObserver> observer;
+        std::size_t depth;      // Level indexes >= depth are filtered out (kAllLevels = no filter)
+        uint8_t events;         // Bitset of ObserverEvents
+
+        [[nodiscard]] bool accepts(uint8_t event, uint16_t level_index) const noexcept {
+            return (events & event) != 0 && level_index < depth;
+        }
+    };
+
+    template<typename Fn>
+    void notifyAll(uint8_t event, Fn&& fn) const {
+        if ((event_mask_ & event) == 0) {
+            return;
+        }
+        for (const auto& sub : observers_) {
+            if (sub.events & event) {
+                fn(*sub.observer);
+            }
+        }
+    }
+
+    /// Recompute the union of all subscriptions
+    void updateSubscriptions() noexcept {
+        event_mask_ = 0;
+        level_index_limit_ = 0;
+        for (const auto& sub : observers_) {
+            event_mask_ |= sub.events;
+            if (sub.events & (PriceLevelEvents | OrderEvents)) {
+                level_index_limit_ = std::max(level_index_limit_, sub.depth);
+            }
+        }
+    }
+
+    std::vector<Subscription> observers_;
+    uint8_t event_mask_ = 0;                // Union of all subscribed events
+    std::size_t level_index_limit_ = 0;     // Deepest level index any level/order subscriber receives
+};
+
+/// Compile-time observer dispatch for a single observer type
+///
+/// The book owns one Observer by value and calls it directly, so callbacks are resolved at compile
+/// time and can be inlined. Observer may implement any subset of the IOrderBookObserver callbacks
+/// (it does not need to inherit from it); events it does not handle are never built.
+/// Same notify interface as ObserverManager, selected through the book traits.
+///
+/// @tparam Observer Observer type (default constructible)
+template<typename Observer>
+class StaticObserverDispatch {
+public:
+    StaticObserverDispatch() = default;
+
+    /// Get the observer
+    [[nodiscard]] Observer& observer() noexcept { return observer_; }
+    [[nodiscard]] const Observer& observer() const noexcept { return observer_; }
+
+    /// Compile-time event selection: false for callbacks Observer does not implement
+    [[nodiscard]] static constexpr bool wantsPriceLevelUpdates() noexcept { return ObservesPriceLevelUpdates<Observer>; }
+    [[nodiscard]] static constexpr bool wantsOrderUpdates() noexcept { return ObservesOrderUpdates<Observer>; }
+    [[nodiscard]] static constexpr bool wantsTrades() noexcept { return ObservesTrades<Observer>; }
+    [[nodiscard]] static constexpr bool wantsTopOfBookUpdates() noexcept { return ObservesTopOfBook<Observer>; }
+
+    /// Level indexes are only needed if the observer takes price level or order updates
+    [[nodiscard]] static constexpr std::size_t levelIndexLimit() noexcept {
+        return (ObservesPriceLevelUpdates<Observer> || ObservesOrderUpdates<Observer>) ? SIZE_MAX : 0;
+    }
+
+    void notifyPriceLevelUpdate([[maybe_unused]] const PriceLevelUpdate& update) const {
+        if constexpr (ObservesPriceLevelUpdates<Observer>) {
+            observer_.onPriceLevelUpdate(update);
+        }
+    }
+
+    void notifyOrderUpdate([[maybe_unused]] const OrderUpdate& update) const {
+        if constexpr (ObservesOrderUpdates<Observer>) {
+            observer_.onOrderUpdate(update);
+        }
+    }
+
+    void notifyTrade([[maybe_unused]] const Trade& trade) const {
+        if constexpr (ObservesTrades<Observer>) {
+            observer_.onTrade(trade);
+        }
+    }
+
+    void notifyTopOfBookUpdate([[maybe_unused]] const TopOfBook& tob) const {
+        if constexpr (ObservesTopOfBook<Observer>) {
+            observer_.onTopOfBookUpdate(tob);
+        }
+    }
+
+    void notifySnapshotBegin([[maybe_unused]] SymbolId symbol, [[maybe_unused]] uint64_t seq_num,
+                             [[maybe_unused]] Timestamp timestamp) const {
+        if constexpr (ObservesSnapshots<Observer>) {
+            observer_.onSnapshotBegin(symbol, seq_num, timestamp);
+        }
+    }
+
+    void notifySnapshotEnd([[maybe_unused]] SymbolId symbol, [[maybe_unused]] uint64_t seq_num,
+                           [[maybe_unused]] Timestamp timestamp) const {
+        if constexpr (ObservesSnapshots<Observer>) {
+            observer_.onSnapshotEnd(symbol, seq_num, timestamp);
         }
     }
 
 private:
-    std::vector<std::shared_ptr<IOrderBookObserver>> observers_;
+    mutable Observer observer_;     // Notifications are const on the book side, like ObserverManager
 };
 
 SLICK_NAMESPACE_END
@@ -11,3 +11,14 @@
 #include <slick/orderbook/orderbook_l2.hpp>
 #include <slick/orderbook/orderbook_l3.hpp>
 #include <slick/orderbook/orderbook_manager.hpp>
+#include <slick/orderbook/orderbook_engine.hpp>
+#include <slick/orderbook/feed_pipeline.hpp>
+#include <slick/orderbook/async_observer.hpp>
+#include <slick/orderbook/book_analytics.hpp>
+#include <slick/orderbook/metrics.hpp>
+#include <slick/orderbook/checkpoint.hpp>
+#include <slick/orderbook/journal.hpp>
+#include <slick/orderbook/wire_format.hpp>
+#include <slick/orderbook/shared_book.hpp>
+#include <slick/orderbook/sequenced_book.hpp>
+#include <slick/orderbook/consolidated_book.hpp>
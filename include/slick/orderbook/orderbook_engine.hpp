@@ -0,0 +1,352 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/orderbook_manager.hpp>
+#include <slick/orderbook/detail/book_update.hpp>
+#include <slick/orderbook/detail/mpsc_ring.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Pin the calling thread to one CPU (best effort, Linux only)
+inline void pinCurrentThread(int cpu) noexcept {
+#if defined(__linux__)
+    if (cpu >= 0 && cpu < CPU_SETSIZE) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(cpu, &cpus);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    }
+#else
+    (void)cpu;
+#endif
+}
+
+SLICK_DETAIL_NAMESPACE_END
+
+SLICK_NAMESPACE_BEGIN
+
+/// OrderBookEngine configuration
+struct OrderBookEngineConfig {
+    std::size_t num_shards = 1;               // Worker threads; symbol s is owned by shard s % num_shards
+    std::size_t queue_capacity = 65536;       // Ring slots per shard (rounded up to a power of two)
+    std::size_t max_batch = 256;              // Messages a worker drains before applying them
+    std::vector<int> cpu_affinity{};          // CPU for shard i's worker (empty or -1 = not pinned; Linux only)
+    std::vector<MemoryConfig> shard_memory{}; // Pooled memory placement of shard i's books (missing = heap)
+};
+
+/// OrderBookEngine counters (per shard, or summed over shards)
+struct OrderBookEngineStats {
+    uint64_t messages = 0;      // Messages applied (including rejected ones)
+    uint64_t rejected = 0;      // Messages the book rejected (unknown order, duplicate id, out-of-order seq_num)
+    uint64_t batches = 0;       // Non-empty drains
+    uint64_t max_batch = 0;     // Largest drain
+    uint64_t queue_full = 0;    // Submissions that found the ring full
+    uint64_t books = 0;         // Books created on first message
+
+    /// Mean messages per drain
+    [[nodiscard]] double meanBatch() const noexcept {
+        return batches ? static_cast<double>(messages) / static_cast<double>(batches) : 0.0;
+    }
+};
+
+/// Sharded multi-threaded ingestion engine
+///
+/// Owns a DirectOrderBookManager and one worker per shard. Symbols are hashed to shards by SymbolId, so
+/// every book keeps a single writer (its shard's worker) and the books of different shards are updated
+/// in parallel. Feed threads hand over decoded L2Update / L3Update messages through a bounded MPSC ring
+/// per shard; a worker drains up to max_batch messages at a time and applies them, flagging the last
+/// message of each same-symbol run as is_last_in_batch so top-of-book notifications and depth
+/// publication happen once per run instead of once per message.
+///
+/// Books are created by the owning worker on their first message and configured through the
+/// onBookCreated() callback, which also runs on the worker (attach observers, setPublishedDepth(), ...).
+/// Observers of a book are therefore notified on its shard's worker thread.
+/// L3 books of shard i place their order pools as shard_memory[i] asks (huge pages, the NUMA node of
+/// the shard's pinned CPU, prefaulting at creation).
+///
+/// Threading: submit()/trySubmit() from any number of threads; messages submitted by one thread are
+/// applied in submission order. Workers run between start() and stop(); without them, poll() drains a
+/// shard on the caller's thread (one caller per shard). Reading a book from another thread follows the
+/// book's own rules (topOfBook(), readDepth()), or waitIdle() first.
+///
+/// In compiled mode OrderBookT is OrderBookL2 or OrderBookL3 (the instantiated managers); other traits
+/// need header-only mode.
+///
+/// @tparam OrderBookT An L2 or L3 book type (selects L2Update or L3Update)
+///
+/// Usage:
+/// @code
+/// OrderBookEngine<OrderBookL2> engine({.num_shards = 4, .cpu_affinity = {2, 3, 4, 5}});
+/// engine.onBookCreated([](OrderBookL2& book) { book.setPublishedDepth(10); });
+/// engine.start();
+/// engine.submit(L2Update{.timestamp = ts, .price = 10000, .quantity = 100, .symbol = 7, .side = Side::Buy});
+/// engine.waitIdle();
+/// @endcode
+template<typename OrderBookT>
+class OrderBookEngine {
+public:
+    using Update = detail::EngineUpdateT<OrderBookT>;
+    using Manager = DirectOrderBookManager<OrderBookT>;
+    using BookCreatedCallback = std::function<void(OrderBookT&)>;
+
+    /// Constructor (workers are not started)
+    /// @param config Shard count, queue capacity, batch size and CPU pinning
+    explicit OrderBookEngine(const OrderBookEngineConfig& config = {})
+        : config_(config) {
+        config_.num_shards = std::max<std::size_t>(config_.num_shards, 1);
+        config_.max_batch = std::max<std::size_t>(config_.max_batch, 1);
+        shards_.reserve(config_.num_shards);
+        for (std::size_t i = 0; i < config_.num_shards; ++i) {
+            const MemoryConfig memory = i < config_.shard_memory.size() ? config_.shard_memory[i] : MemoryConfig{};
+            shards_.push_back(std::make_unique<Shard>(config_.queue_capacity, config_.max_batch, memory));
+        }
+    }
+
+    ~OrderBookEngine() {
+        stop();
+    }
+
+    OrderBookEngine(const OrderBookEngine&) = delete;
+    OrderBookEngine& operator=(const OrderBookEngine&) = delete;
+
+    /// Set callback run on a shard's worker when it creates a book (before start())
+    void onBookCreated(BookCreatedCallback callback) {
+        on_book_created_ = std::move(callback);
+    }
+
+    /// Queue a message for its symbol's shard (any thread)
+    /// @return false if the shard's ring is full
+    bool trySubmit(const Update& update) noexcept {
+        Shard& shard = *shards_[shardOf(update.symbol)];
+        if (SLICK_LIKELY(shard.queue.tryPush(update))) {
+            return true;
+        }
+        shard.queue_full.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /// Queue a message, spinning while the shard's ring is full (any thread; workers must be running)
+    void submit(const Update& update) noexcept {
+        Shard& shard = *shards_[shardOf(update.symbol)];
+        if (SLICK_UNLIKELY(!shard.queue.tryPush(update))) {
+            shard.queue_full.fetch_add(1, std::memory_order_relaxed);
+            while (!shard.queue.tryPush(update)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /// Queue a batch of messages in order (any thread; workers must be running)
+    void submit(std::span<const Update> updates) noexcept {
+        for (const Update& update : updates) {
+            submit(update);
+        }
+    }
+
+    /// Drain and apply a shard's queued messages on the calling thread (only while workers are stopped)
+    /// @param shard Shard index
+    /// @param max_messages Maximum number of messages to apply
+    /// @return Number of messages applied
+    std::size_t poll(std::size_t shard, std::size_t max_messages = SIZE_MAX) {
+        std::size_t total = 0;
+        while (total < max_messages) {
+            const std::size_t count = drain(*shards_[shard], max_messages - total);
+            if (count == 0) {
+                break;
+            }
+            total += count;
+        }
+        return total;
+    }
+
+    /// Start one worker per shard (pinned when cpu_affinity names a CPU for it)
+    void start() {
+        for (std::size_t i = 0; i < shards_.size(); ++i) {
+            Shard& shard = *shards_[i];
+            if (shard.worker.joinable()) {
+                continue;
+            }
+            const int cpu = i < config_.cpu_affinity.size() ? config_.cpu_affinity[i] : -1;
+            shard.worker = std::jthread([this, &shard, cpu](std::stop_token stop_token) {
+                detail::pinCurrentThread(cpu);
+                while (!stop_token.stop_requested()) {
+                    if (drain(shard, SIZE_MAX) == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+                while (drain(shard, SIZE_MAX) != 0) {}  // Apply what was queued before stop()
+            });
+        }
+    }
+
+    /// Stop the workers after they apply the remaining messages
+    void stop() {
+        for (auto& shard : shards_) {
+            if (shard->worker.joinable()) {
+                shard->worker.request_stop();
+                shard->worker.join();
+            }
+        }
+    }
+
+    /// Check if the workers are running
+    [[nodiscard]] bool running() const noexcept {
+        return shards_.front()->worker.joinable();
+    }
+
+    /// Block until every message submitted before the call has been applied (workers must be running)
+    void waitIdle() const noexcept {
+        for (const auto& shard : shards_) {
+            const uint64_t target = shard->queue.pushed();
+            while (shard->messages.load(std::memory_order_acquire) < target) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /// Get number of shards
+    [[nodiscard]] std::size_t shardCount() const noexcept {
+        return shards_.size();
+    }
+
+    /// Get the shard that owns a symbol
+    [[nodiscard]] std::size_t shardOf(SymbolId symbol) const noexcept {
+        return symbol % shards_.size();
+    }
+
+    /// Get number of messages waiting in a shard's ring
+    [[nodiscard]] std::size_t pending(std::size_t shard) const noexcept {
+        return shards_[shard]->queue.size();
+    }
+
+    /// Get one shard's counters (safe to call from any thread)
+    [[nodiscard]] OrderBookEngineStats stats(std::size_t shard) const noexcept {
+        const Shard& s = *shards_[shard];
+        OrderBookEngineStats result;
+        result.messages = s.messages.load(std::memory_order_relaxed);
+        result.rejected = s.rejected.load(std::memory_order_relaxed);
+        result.batches = s.batches.load(std::memory_order_relaxed);
+        result.max_batch = s.max_batch.load(std::memory_order_relaxed);
+        result.queue_full = s.queue_full.load(std::memory_order_relaxed);
+        result.books = s.books.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    /// Get counters summed over all shards (max_batch is the largest of any shard)
+    [[nodiscard]] OrderBookEngineStats stats() const noexcept {
+        OrderBookEngineStats total;
+        for (std::size_t i = 0; i < shards_.size(); ++i) {
+            const OrderBookEngineStats shard = stats(i);
+            total.messages += shard.messages;
+            total.rejected += shard.rejected;
+            total.batches += shard.batches;
+            total.max_batch = std::max(total.max_batch, shard.max_batch);
+            total.queue_full += shard.queue_full;
+            total.books += shard.books;
+        }
+        return total;
+    }
+
+    /// Get the books (lookups are lock-free; a book is written only by its shard's worker)
+    [[nodiscard]] Manager& manager() noexcept { return manager_; }
+    [[nodiscard]] const Manager& manager() const noexcept { return manager_; }
+
+private:
+    struct Shard {
+        Shard(std::size_t capacity, std::size_t max_batch, const MemoryConfig& memory_config)
+            : queue(capacity), buffer(max_batch), memory(memory_config) {}
+
+        detail::MPSCRing<Update> queue;                         // Feed threads -> worker
+        std::vector<Update> buffer;                             // Messages of the current drain (worker)
+        MemoryConfig memory;                                    // Placement of the shard's books
+
+        // Worker-written counters
+        SLICK_CACHE_ALIGNED std::atomic<uint64_t> messages{0};  // Also the waitIdle() progress counter
+        std::atomic<uint64_t> rejected{0};
+        std::atomic<uint64_t> batches{0};
+        std::atomic<uint64_t> max_batch{0};
+        std::atomic<uint64_t> books{0};
+
+        // Producer-written counters
+        SLICK_CACHE_ALIGNED std::atomic<uint64_t> queue_full{0};
+
+        std::jthread worker;                                    // Worker started by start()
+    };
+
+    /// Pop up to max_batch messages and apply them (one thread per shard)
+    /// @return Number of messages applied
+    std::size_t drain(Shard& shard, std::size_t max_messages) {
+        Update* buffer = shard.buffer.data();
+        const std::size_t limit = std::min(max_messages, shard.buffer.size());
+        std::size_t count = 0;
+        while (count < limit && shard.queue.tryPop(buffer[count])) {
+            ++count;
+        }
+        if (count == 0) {
+            return 0;
+        }
+
+        uint64_t rejected = 0;
+        OrderBookT* book = nullptr;
+        for (std::size_t i = 0; i < count; ++i) {
+            const Update& update = buffer[i];
+            if (book == nullptr || book->symbol() != update.symbol) {
+                book = findOrCreate(shard, update.symbol);
+            }
+            // Top-of-book and depth publication happen once per same-symbol run
+            const bool is_last_in_batch = i + 1 == count || buffer[i + 1].symbol != update.symbol;
+            if (!detail::applyUpdate(*book, update, is_last_in_batch)) {
+                ++rejected;
+            }
+        }
+
+        // Counters are only written by the worker; atomics make them readable from stats()
+        if (rejected != 0) {
+            shard.rejected.store(shard.rejected.load(std::memory_order_relaxed) + rejected, std::memory_order_relaxed);
+        }
+        shard.batches.store(shard.batches.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (count > shard.max_batch.load(std::memory_order_relaxed)) {
+            shard.max_batch.store(count, std::memory_order_relaxed);
+        }
+        // Release: the applied updates are visible to a waitIdle() caller that observes the count
+        shard.messages.store(shard.messages.load(std::memory_order_relaxed) + count, std::memory_order_release);
+        return count;
+    }
+
+    OrderBookT* findOrCreate(Shard& shard, SymbolId symbol) {
+        if (OrderBookT* book = manager_.getOrderBook(symbol)) {
+            return book;
+        }
+        OrderBookT* book = manager_.getOrCreateOrderBook(symbol, shard.memory);
+        shard.books.store(shard.books.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (on_book_created_) {
+            on_book_created_(*book);
+        }
+        return book;
+    }
+
+    OrderBookEngineConfig config_;                  // Engine configuration
+    Manager manager_;                               // Books of all shards
+    BookCreatedCallback on_book_created_;           // Runs on the owning worker
+    std::vector<std::unique_ptr<Shard>> shards_;    // One ring, worker and counter block per shard
+};
+
+SLICK_NAMESPACE_END
@@ -9,13 +9,74 @@
 #include <slick/orderbook/observer.hpp>
 #include <slick/orderbook/detail/price_level_l2.hpp>
 #include <slick/orderbook/detail/level_container.hpp>
+#include <slick/orderbook/detail/soa_level_container.hpp>
+#include <slick/orderbook/detail/price_ladder.hpp>
+#include <slick/orderbook/book_analytics.hpp>
+#include <slick/orderbook/detail/depth_publisher.hpp>
+#include <slick/orderbook/detail/level_batch.hpp>
+#include <slick/orderbook/metrics.hpp>
 #include <memory>
+#include <algorithm>
 #include <vector>
 #include <array>
 #include <atomic>
+#include <concepts>
+#include <span>
 
 SLICK_NAMESPACE_BEGIN
 
+/// Default policies for BasicOrderBookL2
+/// Derive from this and override individual members to customize a book
+struct DefaultOrderBookL2Traits {
+    /// Stored price and quantity widths and their decimal scale (64-bit, unscaled)
+    using FixedPoint = slick::orderbook::FixedPoint<>;
+
+    /// Per-side price level storage (sorted vector, binary search)
+    template<Side S>
+    using LevelContainer = detail::LevelContainer<S>;
+
+    /// Observer notification (runtime list of IOrderBookObserver, virtual dispatch)
+    using ObserverDispatch = ObserverManager;
+};
+
+/// Policies for instruments whose prices stay within a bounded band around mid (futures, FX)
+/// Price levels live in a tick-indexed ladder: O(1) updates, bitmap scan for the next best level
+struct LadderOrderBookL2Traits : DefaultOrderBookL2Traits {
+    template<Side S>
+    using LevelContainer = detail::PriceLadder<S>;
+};
+
+/// Policies for deep books updated near the touch
+/// Level prices are kept in a column of their own and searched with vector compares over the first
+/// cache lines, then a branchless binary search (see detail::SoaLevelContainer)
+struct SoaOrderBookL2Traits : DefaultOrderBookL2Traits {
+    template<Side S>
+    using LevelContainer = detail::SoaLevelContainer<S>;
+};
+
+/// Policies for a book whose levels store narrower prices and quantities
+/// With 32-bit widths a level is 16 bytes instead of 24. Updates whose price or quantity does not fit the
+/// stored types (FixedPoint::fits()) are ignored. Events and depth snapshots still report 64-bit values.
+/// @tparam Numeric FixedPoint instantiation
+/// @tparam Base Traits providing the other policies
+template<typename Numeric, typename Base = DefaultOrderBookL2Traits>
+struct FixedPointOrderBookL2Traits : Base {
+    using FixedPoint = Numeric;
+
+    template<Side S>
+    using LevelContainer = detail::LevelContainer<
+        S, detail::BasicPriceLevelL2<typename Numeric::price_type, typename Numeric::quantity_type>>;
+};
+
+/// Policies for a book that notifies a single observer type with compile-time dispatch
+/// Observer callbacks are called directly (and inlined); callbacks Observer does not implement compile away
+/// @tparam Observer Observer type, owned by the book (see StaticObserverDispatch)
+/// @tparam Base Traits providing the other policies
+template<typename Observer, typename Base = DefaultOrderBookL2Traits>
+struct StaticObserverOrderBookL2Traits : Base {
+    using ObserverDispatch = StaticObserverDispatch<Observer>;
+};
+
 /// Level 2 OrderBook - aggregated price levels
 ///
 /// Maintains aggregated order book state with price levels and total quantities.
@@ -27,7 +88,8 @@ SLICK_NAMESPACE_BEGIN
 /// - Cache-friendly memory layout
 /// - Observer pattern for notifications
 ///
-/// Thread Safety: Single writer, multiple readers (lock-free reads planned)
+/// Thread Safety: Single writer, multiple readers. getBestBid(), getBestAsk(), getTopOfBook() and
+/// readDepth() are safe to call from other threads; other queries are writer-thread only
 ///
 /// Memory Layout: Cache-aligned to 64 bytes for optimal performance
 ///
@@ -37,21 +99,43 @@ SLICK_NAMESPACE_BEGIN
 /// book.updateLevel(Side::Buy, 10000, 100, timestamp);
 /// auto best_bid = book.getBestBid();
 /// @endcode
-class SLICK_CACHE_ALIGNED OrderBookL2 {
+///
+/// @tparam Traits Policy bundle (see DefaultOrderBookL2Traits)
+template<typename Traits = DefaultOrderBookL2Traits>
+class SLICK_CACHE_ALIGNED BasicOrderBookL2 {
 public:
+    /// Per-side price level container policy
+    template<Side S>
+    using LevelContainer = typename Traits::template LevelContainer<S>;
+
+    /// Observer notification policy (ObserverManager or StaticObserverDispatch<Observer>)
+    using ObserverDispatch = typename Traits::ObserverDispatch;
+
+    /// Stored price and quantity widths and their decimal scale
+    using FixedPoint = typename Traits::FixedPoint;
+
+    /// Stored price level type (detail::PriceLevelL2 unless FixedPoint narrows it)
+    using Level = typename LevelContainer<Side::Buy>::value_type;
+
     /// Constructor
     /// @param symbol Symbol identifier
     /// @param initial_capacity Initial capacity for price levels per side
-    explicit OrderBookL2(SymbolId symbol, std::size_t initial_capacity = 32);
+    explicit BasicOrderBookL2(SymbolId symbol, std::size_t initial_capacity = 32);
+
+    /// Constructor for tick-indexed level containers
+    /// @param symbol Symbol identifier
+    /// @param ladder_config Tick size and initial ladder width
+    BasicOrderBookL2(SymbolId symbol, const PriceLadderConfig& ladder_config)
+        requires std::constructible_from<LevelContainer<Side::Buy>, const PriceLadderConfig&>;
 
     /// Destructor
-    virtual ~OrderBookL2() = default;
+    virtual ~BasicOrderBookL2() = default;
 
     // Non-copyable, movable (manual implementation due to std::atomic member)
-    OrderBookL2(const OrderBookL2&) = delete;
-    OrderBookL2& operator=(const OrderBookL2&) = delete;
-    OrderBookL2(OrderBookL2&&) noexcept;
-    OrderBookL2& operator=(OrderBookL2&&) noexcept;
+    BasicOrderBookL2(const BasicOrderBookL2&) = delete;
+    BasicOrderBookL2& operator=(const BasicOrderBookL2&) = delete;
+    BasicOrderBookL2(BasicOrderBookL2&&) noexcept;
+    BasicOrderBookL2& operator=(BasicOrderBookL2&&) noexcept;
 
     /// Get symbol ID
     [[nodiscard]] SymbolId symbol() const noexcept { return symbol_; }
@@ -66,9 +150,25 @@ public:
     ///                Out-of-order updates (seq_num <= last_seq_num) are rejected
     /// @param is_last_in_batch Set to true if this is the last update in an external batch
     ///                         (enables batching of TopOfBook updates)
+    /// Prices the level container does not accept (off the tick grid or beyond the width of a
+    /// price ladder), and prices or quantities too wide for FixedPoint, are rejected like
+    /// out-of-order updates.
     void updateLevel(Side side, Price price, Quantity quantity, Timestamp timestamp,
                      uint64_t seq_num = 0, bool is_last_in_batch = true);
 
+    /// Apply a packet of level updates with one sequence check and coalesced notifications
+    /// The batch is rejected as a whole if a sequenced update is older than getLastSeqNum() or than an
+    /// earlier sequenced update of the batch; otherwise updates are applied in order and the last
+    /// sequenced one becomes the last processed sequence number. L2Update::symbol is not checked.
+    /// Observers get at most one onPriceLevelUpdate() per touched level, describing the level after the
+    /// batch (in first-touch order; level_index is the final position, for removed levels the
+    /// position they would occupy). Levels added and removed within the batch are not reported. The last
+    /// update is flagged LastInBatch and followed by at most one onTopOfBookUpdate().
+    /// Updates at prices the level container does not accept, or too wide for FixedPoint, are skipped.
+    /// @param updates Level updates in exchange order (quantity 0 = delete)
+    /// @return Number of updates applied (0 if the batch was rejected)
+    std::size_t applyBatch(std::span<const L2Update> updates);
+
     /// Delete a price level
     /// @param side Buy or Sell
     /// @param price Price level to delete
@@ -84,11 +184,11 @@ public:
 
     /// Get best bid (highest buy price)
     /// @return Pointer to best bid level, or nullptr if no bids
-    [[nodiscard]] const detail::PriceLevelL2* getBestBid() const noexcept;
+    [[nodiscard]] const Level* getBestBid() const noexcept;
 
     /// Get best ask (lowest sell price)
     /// @return Pointer to best ask level, or nullptr if no asks
-    [[nodiscard]] const detail::PriceLevelL2* getBestAsk() const noexcept;
+    [[nodiscard]] const Level* getBestAsk() const noexcept;
 
     /// Get top-of-book snapshot
     /// @return TopOfBook structure with best bid/ask
@@ -98,19 +198,34 @@ public:
     /// @param side Buy or Sell
     /// @param depth Maximum number of levels (0 = all)
     /// @return Vector of price levels
-    [[nodiscard]] std::vector<detail::PriceLevelL2> getLevels(Side side, std::size_t depth = 0) const;
+    [[nodiscard]] std::vector<Level> getLevels(Side side, std::size_t depth = 0) const;
+
+    /// Copy the best price levels of a side into a caller buffer (no allocation)
+    /// @param side Buy or Sell
+    /// @param out Receives up to out.size() levels, best first
+    /// @return Number of levels copied
+    std::size_t getLevels(Side side, std::span<Level> out) const noexcept;
+
+    /// View the price levels of a side in place (contiguous level containers only, no copy)
+    /// The view is invalidated by the next update; read it on the update thread (see readDepth()).
+    /// @param side Buy or Sell
+    /// @param depth Maximum number of levels (0 = all)
+    [[nodiscard]] std::span<const Level> getLevelsView(Side side, std::size_t depth = 0) const noexcept
+        requires requires(const LevelContainer<Side::Buy>& levels) { levels.getLevelsView(std::size_t{}); } {
+        return visitLevels(side, [depth](const auto& levels) { return levels.getLevelsView(depth); });
+    }
 
     /// Get a specific price level by price
     /// @param side Buy or Sell
     /// @param price Price to look up
     /// @return Pointer to price level, or nullptr if not found
-    [[nodiscard]] const detail::PriceLevelL2* getLevel(Side side, Price price) const noexcept;
+    [[nodiscard]] const Level* getLevel(Side side, Price price) const noexcept;
 
     /// Get a price level by index (0 = best)
     /// @param side Buy or Sell
     /// @param index Level index (0-based, 0 = best bid/ask)
     /// @return Pointer to price level, or nullptr if index out of range
-    [[nodiscard]] const detail::PriceLevelL2* getLevelByIndex(Side side, uint16_t index) const noexcept;
+    [[nodiscard]] const Level* getLevelByIndex(Side side, uint16_t index) const noexcept;
 
     /// Get number of levels on a side
     /// @param side Buy or Sell
@@ -126,56 +241,227 @@ public:
     /// @return true if both sides are empty
     [[nodiscard]] bool isEmpty() const noexcept;
 
-    /// Observer management
-    void addObserver(std::shared_ptr<IOrderBookObserver> observer) {
-        observers_.addObserver(std::move(observer));
+    /// Publish the top levels of each side for lock-free readers on other threads (see readDepth())
+    /// The depth block is allocated once here and republished whenever an update batch touches one of
+    /// the top depth levels. Call during setup, before readers start.
+    /// @param depth Levels per side to publish (0 = disable)
+    void setPublishedDepth(std::size_t depth);
+
+    /// Get number of levels published per side (0 = disabled)
+    [[nodiscard]] std::size_t publishedDepth() const noexcept { return depth_publisher_.depth(); }
+
+    /// Copy the published top-N depth (safe to call from any thread, never allocates)
+    /// Both sides come from the same publication. Copies min(N, publishedDepth()) levels per side.
+    /// @param out Receives the levels
+    template<std::size_t N>
+    void readDepth(DepthSnapshot<N>& out) const noexcept {
+        depth_publisher_.read(out);
     }
 
-    bool removeObserver(const std::shared_ptr<IOrderBookObserver>& observer) {
+    /// Maintain running sums over the top levels of each side (microprice, imbalance, price to fill)
+    /// The arrays are allocated once here and refreshed at the end of every update batch that touches one
+    /// of the top depth levels, from the shallowest changed level down.
+    /// @param depth Levels per side to track (0 = disable)
+    void setAnalyticsDepth(std::size_t depth);
+
+    /// Get analytics over the top levels (see setAnalyticsDepth(); read on the update thread only)
+    [[nodiscard]] const BookAnalytics& analytics() const noexcept { return analytics_; }
+
+    /// Observer management (runtime dispatch through ObserverManager)
+    /// @param observer Observer to add
+    /// @param events Bitset of ObserverEvents to deliver (default: all)
+    /// @param depth Only deliver price level updates for the top N levels (0 = all levels)
+    void addObserver(std::shared_ptr<IOrderBookObserver> observer, uint8_t events = AllEvents, std::size_t depth = 0)
+        requires std::same_as<ObserverDispatch, ObserverManager> {
+        observers_.addObserver(std::move(observer), events, depth);
+    }
+
+    bool removeObserver(const std::shared_ptr<IOrderBookObserver>& observer)
+        requires std::same_as<ObserverDispatch, ObserverManager> {
         return observers_.removeObserver(observer);
     }
 
-    void clearObservers() noexcept {
+    void clearObservers() noexcept
+        requires std::same_as<ObserverDispatch, ObserverManager> {
         observers_.clearObservers();
     }
 
-    [[nodiscard]] std::size_t observerCount() const noexcept {
+    [[nodiscard]] std::size_t observerCount() const noexcept
+        requires std::same_as<ObserverDispatch, ObserverManager> {
         return observers_.observerCount();
     }
 
+    /// Get the statically dispatched observer (StaticObserverDispatch policies only)
+    [[nodiscard]] auto& observer() noexcept
+        requires requires(ObserverDispatch& dispatch) { dispatch.observer(); } {
+        return observers_.observer();
+    }
+
+    [[nodiscard]] const auto& observer() const noexcept
+        requires requires(const ObserverDispatch& dispatch) { dispatch.observer(); } {
+        return observers_.observer();
+    }
+
     /// Get last processed sequence number
     /// @return Last sequence number (0 if not tracking)
     [[nodiscard]] uint64_t getLastSeqNum() const noexcept {
         return last_seq_num_;
     }
 
+    /// Get bytes held by the book: the object itself and both level containers
+    [[nodiscard]] std::size_t memoryUsage() const noexcept {
+        return sizeof(*this) + bids_.memoryUsage() + asks_.memoryUsage();
+    }
+
+    /// Release level capacity the book no longer needs, keeping room for keep_levels levels per side
+    /// Level contents are unchanged; price ladders keep their size. Call it off the hot path, from the writer thread.
+    /// @param keep_levels Levels to keep capacity for per side
+    /// @return Bytes released
+    std::size_t trim(std::size_t keep_levels = 0) {
+        const std::size_t before = memoryUsage();
+        bids_.trim(keep_levels);
+        asks_.trim(keep_levels);
+        return before - memoryUsage();
+    }
+
+#if SLICK_ORDERBOOK_METRICS
+    /// Get the book's latency histograms and counters (snapshot() may be called from any thread)
+    [[nodiscard]] const BookMetrics& metrics() const noexcept { return metrics_.get(); }
+#endif
+
     /// Emit complete orderbook snapshot to observers
     /// Useful for replaying full book state to a new observer
     /// Calls onSnapshotBegin(), followed by onPriceLevelUpdate() for each level, then onSnapshotEnd()
     /// @param timestamp Snapshot timestamp
     void emitSnapshot(Timestamp timestamp);
 
+    /// Replace the book contents with an exchange snapshot (e.g. when recovering from a gap)
+    /// Each side is sorted once (skipped if already best first) and rebuilt in a single pass.
+    /// Levels with quantity <= 0 or at prices the level container does not accept are skipped;
+    /// for duplicate prices the last entry wins.
+    /// Observers see a single onSnapshotBegin()/onSnapshotEnd() bracket with one onPriceLevelUpdate()
+    /// per level, followed by onTopOfBookUpdate() if the top of book changed
+    /// @param bids Bid levels, in any order
+    /// @param asks Ask levels, in any order
+    /// @param seq_num Snapshot sequence number; becomes the last processed sequence number
+    /// @param timestamp Snapshot timestamp
+    void loadSnapshot(std::span<const detail::PriceLevelL2> bids, std::span<const detail::PriceLevelL2> asks,
+                      uint64_t seq_num = 0, Timestamp timestamp = 0);
+
 protected:
+    /// Rebuild one side from snapshot levels
+    template<Side S>
+    void loadLevels(LevelContainer<S>& levels, std::span<const detail::PriceLevelL2> snapshot);
+
     /// Notify observers of top-of-book update if best changed
     /// Updates cached_tob_ after notification
     /// @param timestamp Update timestamp
     void notifyTopOfBookIfChanged(Timestamp timestamp);
 
+    /// Close an update batch: republish the depth block and top-of-book if the batch touched them
+    /// @param timestamp Update timestamp
+    void endBatch(Timestamp timestamp);
+
+    /// Copy the top levels into the published depth block
+    /// @param timestamp Update timestamp
+    void publishDepth(Timestamp timestamp) noexcept;
+
+    /// Refresh analytics from a level index down
+    /// @param sides Sides to refresh (bit 1 << Side)
+    void updateAnalytics(std::size_t from_level, uint8_t sides) noexcept;
+
+    static constexpr uint8_t kAllSides = (1 << SideCount) - 1;
+
+    /// Notify one coalesced update per level recorded in level_batch_
+    void flushLevelBatch();
+
+    /// Check if a level can be stored: the price and quantity fit FixedPoint and the container takes the price
+    template<typename Levels>
+    [[nodiscard]] static bool accepts(const Levels& levels, Price price, Quantity quantity) noexcept {
+        return FixedPoint::fits(price, quantity) && levels.accepts(price);
+    }
+
+    /// Level index reported for an update, INVALID_INDEX beyond the deepest level any observer subscribes to
+    /// and beyond the published depth. Index 0 is always exact so top-of-book changes are still detected
+    template<typename Levels>
+    [[nodiscard]] uint16_t levelIndexOf(const Levels& levels, typename Levels::const_iterator it) const noexcept {
+        const std::size_t limit = levelIndexLimit();
+        const std::size_t index = levels.indexOf(it, limit);
+        return index < limit ? static_cast<uint16_t>(index) : INVALID_INDEX;
+    }
+
+    /// Number of level indexes kept exact (see levelIndexOf())
+    [[nodiscard]] std::size_t levelIndexLimit() const noexcept {
+        return std::clamp<std::size_t>(std::max({observers_.levelIndexLimit(), depth_publisher_.depth(), analytics_.depth()}),
+                                       1, INVALID_INDEX);
+    }
+
+    /// Invoke fn with the side-specialized level container for a runtime side
+    /// Costs a single branch; everything inside fn is compiled per side with inlined comparisons
+    template<typename Fn>
+    decltype(auto) visitLevels(Side side, Fn&& fn) {
+        SLICK_ASSERT(side < SideCount);
+        return side == Side::Buy ? fn(bids_) : fn(asks_);
+    }
+
+    template<typename Fn>
+    decltype(auto) visitLevels(Side side, Fn&& fn) const {
+        SLICK_ASSERT(side < SideCount);
+        return side == Side::Buy ? fn(bids_) : fn(asks_);
+    }
+
     SymbolId symbol_;                                                   // Symbol identifier
-    std::array<detail::LevelContainer, SideCount> sides_;               // Bid and ask sides (indexed by Side enum)
-    ObserverManager observers_;                                         // Observer notifications
+    LevelContainer<Side::Buy> bids_;                                    // Bid side (best first)
+    LevelContainer<Side::Sell> asks_;                                   // Ask side (best first)
+    detail::ObserverDispatchOf<ObserverDispatch> observers_;            // Observer notifications (timed when metrics are on)
     TopOfBook cached_tob_;                                              // Cached top-of-book for efficient change detection
-    detail::PriceLevelL2 cached_best_bid_;                              // Cached best bid (for thread-safe access)
-    detail::PriceLevelL2 cached_best_ask_;                              // Cached best ask (for thread-safe access)
+    Level cached_best_bid_;                                             // Cached best bid (for thread-safe access)
+    Level cached_best_ask_;                                             // Cached best ask (for thread-safe access)
     std::atomic<uint64_t> tob_seq_;                                     // Sequence lock for cached_tob_ and best bid/ask (odd = writing, even = readable)
+    detail::DepthPublisher depth_publisher_;                            // Seqlock-published top-N depth for other threads
+    BookAnalytics analytics_;                                           // Running sums over the top levels
+    detail::LevelBatch level_batch_;                                    // Levels touched by the current applyBatch()
     uint64_t last_seq_num_;                                             // Last processed sequence number (0 = not tracking)
+    [[no_unique_address]] detail::BookMetricsSlot metrics_;             // Latency histograms and counters (empty unless SLICK_ORDERBOOK_METRICS)
     uint16_t change_starting_index_ = INVALID_INDEX;                    // The lowerest level had changed in a batch. The value reset to INVALID_INDEX after TopOfBook change notified
+    uint8_t changed_sides_ = 0;                                         // Sides changed in a batch (bit 1 << Side), reset with change_starting_index_
 };
 
+/// Level 2 orderbook with default policies
+using OrderBookL2 = BasicOrderBookL2<>;
+
+/// Level 2 orderbook with tick-indexed price ladders
+using LadderOrderBookL2 = BasicOrderBookL2<LadderOrderBookL2Traits>;
+
+/// Level 2 orderbook searching a separate price column (SIMD scan near the touch)
+using SoaOrderBookL2 = BasicOrderBookL2<SoaOrderBookL2Traits>;
+
+/// Level 2 orderbook storing prices and quantities as Numeric (a FixedPoint instantiation)
+/// In compiled mode include detail/impl/orderbook_l2_impl.hpp to instantiate it
+template<typename Numeric>
+using FixedPointOrderBookL2 = BasicOrderBookL2<FixedPointOrderBookL2Traits<Numeric>>;
+
+/// Level 2 orderbook with 32-bit prices and quantities (16-byte levels)
+using CompactOrderBookL2 = FixedPointOrderBookL2<FixedPoint<int32_t, int32_t>>;
+
+/// Level 2 orderbook notifying a single Observer type with compile-time dispatch
+/// In compiled mode include detail/impl/orderbook_l2_impl.hpp to instantiate it
+template<typename Observer>
+using StaticObserverOrderBookL2 = BasicOrderBookL2<StaticObserverOrderBookL2Traits<Observer>>;
+
 SLICK_NAMESPACE_END
 
 // Include implementation for header-only mode
+// In compiled mode OrderBookL2, LadderOrderBookL2, SoaOrderBookL2 and CompactOrderBookL2 are explicitly
+// instantiated in the library; include detail/impl/orderbook_l2_impl.hpp directly to use other traits
 #ifdef SLICK_ORDERBOOK_HEADER_ONLY
 #include <slick/orderbook/detail/impl/orderbook_l2_impl.hpp>
+#else
+SLICK_NAMESPACE_BEGIN
+extern template class BasicOrderBookL2<DefaultOrderBookL2Traits>;
+extern template class BasicOrderBookL2<LadderOrderBookL2Traits>;
+extern template class BasicOrderBookL2<SoaOrderBookL2Traits>;
+extern template class BasicOrderBookL2<FixedPointOrderBookL2Traits<FixedPoint<int32_t, int32_t>>>;
+SLICK_NAMESPACE_END
 #endif
 
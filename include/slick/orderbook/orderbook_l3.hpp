@@ -11,18 +11,93 @@
 #include <slick/orderbook/detail/price_level_l3.hpp>
 #include <slick/orderbook/detail/order.hpp>
 #include <slick/orderbook/detail/order_map.hpp>
+#include <slick/orderbook/detail/direct_order_map.hpp>
 #include <slick/orderbook/detail/memory_pool.hpp>
-#include <slick/orderbook/detail/flat_map.hpp>
+#include <slick/orderbook/detail/level_container_l3.hpp>
+#include <slick/orderbook/detail/pooled_level_container_l3.hpp>
+#include <slick/orderbook/detail/price_ladder.hpp>
 #include <slick/orderbook/detail/intrusive_list.hpp>
+#include <slick/orderbook/book_analytics.hpp>
+#include <slick/orderbook/detail/depth_publisher.hpp>
+#include <slick/orderbook/detail/aggregated_level_cache.hpp>
+#include <slick/orderbook/detail/level_batch.hpp>
+#include <slick/orderbook/detail/stop_order_index.hpp>
+#include <slick/orderbook/metrics.hpp>
+#include <concepts>
 #include <memory>
+#include <optional>
 #include <algorithm>
 #include <vector>
 #include <array>
+#include <span>
 #include <tuple>
-#include <functional>
 
 SLICK_NAMESPACE_BEGIN
 
+/// Default policies for BasicOrderBookL3
+/// Derive from this and override individual members to customize a book
+struct DefaultOrderBookL3Traits {
+    /// Order layout (64-byte, pointer-linked)
+    using Order = detail::Order;
+
+    /// OrderId -> Order* lookup (open-addressing hash table)
+    using OrderMap = detail::OrderMap;
+
+    /// Per-side price level storage (sorted vector, binary search)
+    template<Side S>
+    using LevelContainer = detail::LevelContainerL3<S>;
+
+    /// Observer notification (runtime list of IOrderBookObserver, virtual dispatch)
+    using ObserverDispatch = ObserverManager;
+};
+
+/// Policies for feeds with dense, roughly monotonic order ids (e.g. ITCH, many crypto MBO feeds)
+/// Orders are looked up by direct index into a sliding window, with hashing only for outliers
+/// @tparam WindowSize Number of order ids covered by the window (power of two)
+template<std::size_t WindowSize = 65536>
+struct DirectIndexedOrderBookL3Traits : DefaultOrderBookL3Traits {
+    using OrderMap = detail::DirectOrderMap<WindowSize>;
+};
+
+/// Policies for instruments whose prices stay within a bounded band around mid (futures, FX)
+/// Price levels live in a tick-indexed ladder: O(1) level lookup, bitmap scan for the next best level
+struct LadderOrderBookL3Traits : DefaultOrderBookL3Traits {
+    template<Side S>
+    using LevelContainer = detail::PriceLadderL3<S>;
+};
+
+/// Policies for venues that create and remove many levels near the touch (quote stuffing)
+/// Levels live in a per-side ObjectPool and the sorted index holds 16-byte (price, level pointer) entries:
+/// a level insert or erase shifts 16 bytes per deeper level and reuses pooled slots, at the cost of a
+/// pointer hop per level read. getLevelsL3() returns a detail::PooledLevelView instead of a std::span.
+struct PooledLevelOrderBookL3Traits : DefaultOrderBookL3Traits {
+    template<Side S>
+    using LevelContainer = detail::PooledLevelContainerL3<S>;
+};
+
+/// Policies for deep books where resident memory matters more than the last few nanoseconds
+/// Orders use the 48-byte CompactOrder layout (index links, packed side)
+/// instead of 64-byte Order; following a queue link costs an extra chunk table lookup.
+/// The order map and level containers are instantiated for the layout (e.g. use
+/// detail::DirectOrderMap<W, detail::OrderIdHash, detail::CompactOrder> or
+/// detail::PriceLadderL3<S, detail::CompactPriceLevelL3> in a derived traits)
+struct CompactOrderBookL3Traits : DefaultOrderBookL3Traits {
+    using Order = detail::CompactOrder;
+    using OrderMap = detail::CompactOrderMap;
+
+    template<Side S>
+    using LevelContainer = detail::LevelContainerL3<S, detail::CompactPriceLevelL3>;
+};
+
+/// Policies for a book that notifies a single observer type with compile-time dispatch
+/// Observer callbacks are called directly (and inlined); callbacks Observer does not implement compile away
+/// @tparam Observer Observer type, owned by the book (see StaticObserverDispatch)
+/// @tparam Base Traits providing the other policies
+template<typename Observer, typename Base = DefaultOrderBookL3Traits>
+struct StaticObserverOrderBookL3Traits : Base {
+    using ObserverDispatch = StaticObserverDispatch<Observer>;
+};
+
 /// Level 3 OrderBook - Individual order tracking with price-time priority
 ///
 /// Maintains full order-by-order state with individual order visibility.
@@ -36,7 +111,8 @@ SLICK_NAMESPACE_BEGIN
 /// - Observer pattern for notifications
 /// - Zero-allocation order management via object pool
 ///
-/// Thread Safety: Single writer, multiple readers (lock-free reads planned)
+/// Thread Safety: Single writer, multiple readers. readDepth() is safe to call from other threads;
+/// other queries are writer-thread only
 ///
 /// Memory Layout: Cache-aligned to 64 bytes for optimal performance
 ///
@@ -58,45 +134,71 @@ SLICK_NAMESPACE_BEGIN
 ///
 /// book.deleteOrder(order_id);
 /// @endcode
-class SLICK_CACHE_ALIGNED OrderBookL3 {
+///
+/// @tparam Traits Policy bundle (see DefaultOrderBookL3Traits)
+template<typename Traits = DefaultOrderBookL3Traits>
+class SLICK_CACHE_ALIGNED BasicOrderBookL3 {
 public:
-    struct PriceComparator {
-        using Comparator = std::function<bool(Price, Price)>;
-        Comparator compare_;
-
-        // Default constructor (for array initialization on MSVC)
-        PriceComparator() : compare_(detail::BidComparatorL3{}) {}
-
-        explicit PriceComparator(Side side)
-            : compare_(side == Side::Buy
-                ? Comparator{detail::BidComparatorL3{}}
-                : Comparator{detail::AskComparatorL3{}}
-            )
-        {}
-        bool operator()(Price a, Price b) const noexcept {
-            return compare_(a, b);
-        }
-    };
-    using PriceLevelMap = detail::FlatMap<Price, detail::PriceLevelL3, PriceComparator>;
+    /// Order layout (detail::Order or detail::CompactOrder)
+    using Order = typename Traits::Order;
+
+    /// Price level holding a queue of Order
+    using PriceLevel = detail::BasicPriceLevelL3<Order>;
+
+    /// OrderId -> Order* map policy
+    using OrderMap = typename Traits::OrderMap;
+
+    /// Observer notification policy (ObserverManager or StaticObserverDispatch<Observer>)
+    using ObserverDispatch = typename Traits::ObserverDispatch;
+
+    /// Side-specialized price level container policy (both sides iterate best first)
+    template<Side S>
+    using PriceLevelMap = typename Traits::template LevelContainer<S>;
+
+    /// Zero-copy view over one side's price levels, as (price, level) pairs best first
+    using LevelsL3View = typename PriceLevelMap<Side::Buy>::view_type;
 
     /// Constructor
     /// @param symbol Symbol identifier
     /// @param interested_num_levels The top N levels to track for observer notifications (0 = all levels)
     /// @param initial_order_capacity Initial capacity for order pool
     /// @param initial_level_capacity Initial capacity for price levels per side
-    explicit OrderBookL3(SymbolId symbol,
+    explicit BasicOrderBookL3(SymbolId symbol,
                         std::size_t interested_num_levels = 10,
                         std::size_t initial_order_capacity = 1024,
                         std::size_t initial_level_capacity = 32);
 
+    /// Constructor for tick-indexed level containers
+    /// @param symbol Symbol identifier
+    /// @param ladder_config Tick size and initial ladder width
+    /// @param interested_num_levels The top N levels to track for observer notifications (0 = all levels)
+    /// @param initial_order_capacity Initial capacity for order pool
+    BasicOrderBookL3(SymbolId symbol,
+                     const PriceLadderConfig& ladder_config,
+                     std::size_t interested_num_levels = 10,
+                     std::size_t initial_order_capacity = 1024)
+        requires std::constructible_from<PriceLevelMap<Side::Buy>, const PriceLadderConfig&>;
+
+    /// Constructor placing the order pool as memory asks (huge pages, NUMA node, prefaulting)
+    /// @param symbol Symbol identifier
+    /// @param memory Placement of order pool blocks
+    /// @param interested_num_levels The top N levels to track for observer notifications (0 = all levels)
+    /// @param initial_order_capacity Initial capacity for order pool
+    /// @param initial_level_capacity Initial capacity for price levels per side
+    BasicOrderBookL3(SymbolId symbol,
+                     const MemoryConfig& memory,
+                     std::size_t interested_num_levels = 10,
+                     std::size_t initial_order_capacity = 1024,
+                     std::size_t initial_level_capacity = 32);
+
     /// Destructor
-    virtual ~OrderBookL3();
+    virtual ~BasicOrderBookL3();
 
     // Non-copyable, movable
-    OrderBookL3(const OrderBookL3&) = delete;
-    OrderBookL3& operator=(const OrderBookL3&) = delete;
-    OrderBookL3(OrderBookL3&&) noexcept = default;
-    OrderBookL3& operator=(OrderBookL3&&) noexcept = default;
+    BasicOrderBookL3(const BasicOrderBookL3&) = delete;
+    BasicOrderBookL3& operator=(const BasicOrderBookL3&) = delete;
+    BasicOrderBookL3(BasicOrderBookL3&&) noexcept = default;
+    BasicOrderBookL3& operator=(BasicOrderBookL3&&) noexcept = default;
 
     /// Get symbol ID
     [[nodiscard]] SymbolId symbol() const noexcept { return symbol_; }
@@ -129,7 +231,8 @@ public:
     ///                Out-of-order updates (seq_num < last_seq_num) are rejected
     /// @param is_last_in_batch Set to true if this is the last update in an external batch
     ///                         (enables batching of TopOfBook updates)
-    /// @return true if order was added successfully, false if OrderId already exists
+    /// @return true if order was added successfully, false if OrderId already exists or the level
+    ///         container does not accept the price (off the tick grid or beyond a price ladder's width)
     bool addOrder(OrderId order_id, Side side, Price price, Quantity quantity,
                   Timestamp timestamp, uint64_t priority = 0, uint64_t seq_num = 0, bool is_last_in_batch = true);
 
@@ -145,7 +248,7 @@ public:
     ///                Out-of-order updates (seq_num < last_seq_num) are rejected
     /// @param is_last_in_batch Set to true if this is the last update in an external batch
     ///                         (enables batching of TopOfBook updates)
-    /// @return true if order was found and modified
+    /// @return true if order was found and modified (false if the level container does not accept new_price)
     bool modifyOrder(OrderId order_id, Price new_price, Quantity new_quantity,
                      Timestamp new_timestamp, uint64_t new_priority = 0,
                      uint64_t seq_num = 0, bool is_last_in_batch = true);
@@ -172,36 +275,141 @@ public:
     virtual bool executeOrder(OrderId order_id, Quantity executed_quantity, Timestamp timestamp,
                       uint64_t seq_num = 0, bool is_last_in_batch = true);
 
+    /// Apply a packet of order updates with one sequence check and coalesced level notifications
+    /// The batch is rejected as a whole if a sequenced update is older than getLastSeqNum() or than an
+    /// earlier sequenced update of the batch. Updates are then applied in order, with the semantics of
+    /// addOrder(), modifyOrder(), deleteOrder() and executeOrder() but without their per-call sequence
+    /// checks (an update the operation rejects is skipped). L3Update::symbol is not checked.
+    /// Order updates are delivered per operation, the last one flagged LastInBatch. Price level updates are
+    /// deferred to the end: at most one per touched level, describing the level after the batch (in
+    /// first-touch order; for removed levels level_index is the position they would occupy), the last one
+    /// flagged LastInBatch and followed by at most one onTopOfBookUpdate().
+    /// @param updates Order updates in exchange order
+    /// @return Number of updates applied
+    std::size_t applyBatch(std::span<const L3Update> updates);
+
+    /// Match an incoming order against the opposite side, then rest or cancel the remainder
+    /// Walks the best opposite levels in price-time priority while they cross the limit price (any
+    /// price for market orders), filling resting orders front to back. Each fill notifies onTrade() at
+    /// the resting order's price, then the resting order's update (deleted when fully filled); each
+    /// swept level is notified once, after its fills. A Day limit order rests its remainder through
+    /// addOrder(); IOC and market orders cancel it. FOK orders are rejected untouched unless the
+    /// crossing levels hold the whole quantity. The sweep does not allocate.
+    /// @param order_id Unique order identifier (rejected if already resting)
+    /// @param side Buy or Sell
+    /// @param price Limit price (ignored for market orders)
+    /// @param quantity Order quantity
+    /// @param timestamp Order timestamp (trade timestamp, and priority if the remainder rests)
+    /// @param type OrderType::Limit or OrderType::Market (stop orders go through submitStopOrder())
+    /// @param time_in_force Day, IOC or FOK
+    /// @param seq_num Exchange sequence number (0 = no tracking, default)
+    ///                Out-of-order updates (seq_num < last_seq_num) are rejected
+    /// @param is_last_in_batch Set to true if this is the last update in an external batch
+    ///                         (enables batching of TopOfBook updates)
+    /// @return Status, filled and remaining quantity and number of trades
+    SubmitResult submitOrder(OrderId order_id, Side side, Price price, Quantity quantity, Timestamp timestamp,
+                             OrderType type = OrderType::Limit, TimeInForce time_in_force = TimeInForce::Day,
+                             uint64_t seq_num = 0, bool is_last_in_batch = true);
+
+    /// Park a stop or stop-limit order until the last trade price reaches its stop price
+    /// Buy stops trigger when a submitOrder() trade prints at or above the stop price, sell stops at or
+    /// below it; a stop price already reached triggers at once. A triggered stop is submitted through
+    /// submitOrder() as a market order (Stop) or a limit order at limit_price (StopLimit), with the
+    /// triggering timestamp, after the order that triggered it completes; its trades can trigger more
+    /// stops. Each triggered order notifies observers as its own batch. Only trades of the matching path
+    /// move the last trade price: executeOrder() reports exchange fills and does not trigger stops.
+    /// @param order_id Unique order identifier (rejected if resting or already pending). submitOrder() does
+    ///                not look up pending stop ids; a stop whose id rests on the book when it triggers is dropped
+    /// @param side Buy or Sell
+    /// @param stop_price Trigger price
+    /// @param quantity Order quantity
+    /// @param timestamp Submission timestamp
+    /// @param type OrderType::Stop or OrderType::StopLimit
+    /// @param limit_price Limit price once triggered (StopLimit only)
+    /// @param time_in_force Time in force once triggered
+    /// @param seq_num Exchange sequence number (0 = no tracking, default)
+    ///                Out-of-order updates (seq_num < last_seq_num) are rejected
+    /// @return SubmitStatus::Pending if parked, else the result of the triggered order
+    SubmitResult submitStopOrder(OrderId order_id, Side side, Price stop_price, Quantity quantity, Timestamp timestamp,
+                                 OrderType type = OrderType::Stop, Price limit_price = 0,
+                                 TimeInForce time_in_force = TimeInForce::Day, uint64_t seq_num = 0);
+
+    /// Cancel a pending stop order
+    /// @return true if the stop order was pending
+    bool cancelStopOrder(OrderId order_id) noexcept {
+        return stops_.erase(order_id);
+    }
+
+    /// Find a pending stop order
+    /// @return Pointer to the stop order, or nullptr if not pending
+    [[nodiscard]] const detail::StopOrder* findStopOrder(OrderId order_id) const noexcept {
+        return stops_.find(order_id);
+    }
+
+    /// Get number of pending stop orders
+    [[nodiscard]] std::size_t stopOrderCount() const noexcept { return stops_.size(); }
+
+    /// Get number of pending stop orders on a side
+    [[nodiscard]] std::size_t stopOrderCount(Side side) const noexcept { return stops_.size(side); }
+
+    /// Get the price of the last submitOrder() trade (std::nullopt before the first one)
+    [[nodiscard]] std::optional<Price> lastTradePrice() const noexcept {
+        return has_traded_ ? std::optional<Price>(last_trade_price_) : std::nullopt;
+    }
+
     /// Find order by OrderId
     /// @param order_id Order identifier
     /// @return Pointer to order, or nullptr if not found
-    [[nodiscard]] const detail::Order* findOrder(OrderId order_id) const noexcept;
+    [[nodiscard]] const Order* findOrder(OrderId order_id) const noexcept;
+
+    /// Get number and total quantity of orders queued ahead of an order at its price
+    /// O(log n) expected in the level's order count. The first query at a level builds an order-statistic
+    /// treap over its queue in O(n); from then on every insert (at any queue position), cancel and fill at
+    /// the level updates it in O(log n), so it is never rebuilt. Levels that are never queried pay nothing.
+    /// With CompactOrderBookL3 the level is walked instead (O(n)).
+    /// @param order_id Order identifier
+    /// @return Position of the order, or std::nullopt if not found
+    [[nodiscard]] std::optional<QueuePosition> queuePosition(OrderId order_id) const;
+
+    /// Get order count, total and largest order quantity and oldest order timestamp of a price level
+    /// O(1): levels keep these as orders come and go (see PriceLevelL3::summary()), and price level
+    /// updates carry the same figures, so consumers never walk the orders.
+    /// @param side Buy or Sell
+    /// @param price Level price
+    /// @return Summary of the level, or std::nullopt if no order rests at the price
+    [[nodiscard]] std::optional<LevelSummary> getLevelSummary(Side side, Price price) const;
 
     /// Get the best price level for a given side
     /// @tparam SIDE 
     /// @return Pointer to the best price level, or nullptr if no orders exist on that side
     template<Side SIDE>
-    [[nodiscard]] const detail::PriceLevelL3* getBestLevel() const noexcept;
+    [[nodiscard]] const PriceLevel* getBestLevel() const noexcept {
+        if constexpr (SIDE == Side::Buy) {
+            return getBestBid();
+        } else {
+            return getBestAsk();
+        }
+    }
 
     /// Get best bid (highest buy price)
     /// @return Pointer to best bid level, or nullptr if no bids
-    [[nodiscard]] const detail::PriceLevelL3* getBestBid() const noexcept;
+    [[nodiscard]] const PriceLevel* getBestBid() const noexcept;
 
     /// Get best ask (lowest sell price)
     /// @return Pointer to best ask level, or nullptr if no asks
-    [[nodiscard]] const detail::PriceLevelL3* getBestAsk() const noexcept;
+    [[nodiscard]] const PriceLevel* getBestAsk() const noexcept;
 
     /// Get top-of-book snapshot (aggregated L2 view)
     /// @return TopOfBook structure with best bid/ask
     [[nodiscard]] TopOfBook getTopOfBook() const noexcept;
 
     /// Get L3 price levels for a side (zero-copy access to full order data)
-    /// Returns reference to flat_map, iterate with range-for
+    /// Returns a view of (price, level) pairs, iterate with range-for
     /// @param side Buy or Sell
-    /// @return Reference to L3 price level map
-    [[nodiscard]] const PriceLevelMap& getLevelsL3(Side side) const noexcept {
+    /// @return View of L3 price levels (best first)
+    [[nodiscard]] LevelsL3View getLevelsL3(Side side) const noexcept {
         SLICK_ASSERT(side < SideCount);
-        return levels_[side];
+        return side == Side::Buy ? bids_.view() : asks_.view();
     }
 
     /// Get aggregated L2 price levels for a side
@@ -211,20 +419,40 @@ public:
     /// @return Vector of aggregated L2 price levels
     [[nodiscard]] std::vector<detail::PriceLevelL2> getLevelsL2(Side side, std::size_t depth = 0) const;
 
+    /// Aggregate the best price levels of a side into a caller buffer (no allocation)
+    /// @param side Buy or Sell
+    /// @param out Receives up to out.size() aggregated levels, best first
+    /// @return Number of levels written
+    std::size_t getLevelsL2(Side side, std::span<detail::PriceLevelL2> out) const noexcept;
+
+    /// Get aggregated L2 price levels for a side from the book's cached L2 view (no allocation)
+    /// The view is refreshed lazily from the first level changed since the last call, so repeated
+    /// reads between updates cost nothing and a refresh is proportional to the levels that moved.
+    /// Update thread only; the span is invalidated by the next update or by a deeper call.
+    /// @param side Buy or Sell
+    /// @param depth Maximum number of levels (0 = all)
+    /// @return Aggregated L2 price levels, best first
+    [[nodiscard]] std::span<const detail::PriceLevelL2> getLevelsL2View(Side side, std::size_t depth = 0) const {
+        SLICK_ASSERT(side < SideCount);
+        return visitLevels(side, [this, side, depth](const auto& level_map) {
+            return l2_cache_[side].view(level_map, depth, [](const auto& entry) { return aggregateLevel(entry); });
+        });
+    }
+
     /// Get L3 price level by price
     /// Access the orders at this price via level->orders (IntrusiveList)
     /// @param side Buy or Sell
     /// @param price Price level
     /// @return Pair of pointer to L3 price level (or nullptr if not found) and level index
-    [[nodiscard]] std::pair<const detail::PriceLevelL3*, uint16_t> getLevel(Side side, Price price) const noexcept;
+    [[nodiscard]] std::pair<const PriceLevel*, uint16_t> getLevel(Side side, Price price) const noexcept;
 
-    [[nodiscard]] std::pair<detail::PriceLevelL3*, uint16_t> getLevel(Side side, Price price) noexcept;
+    [[nodiscard]] std::pair<PriceLevel*, uint16_t> getLevel(Side side, Price price) noexcept;
 
     /// Get L3 price level by index (0 = best)
     /// @param side Buy or Sell
     /// @param index Level index (0-based, 0 = best bid/ask)
     /// @return Pointer to L3 price level, or nullptr if index out of range
-    [[nodiscard]] const detail::PriceLevelL3* getLevelByIndex(Side side, uint16_t index) const noexcept;
+    [[nodiscard]] const PriceLevel* getLevelByIndex(Side side, uint16_t index) const noexcept;
 
     /// Get number of price levels on a side
     /// @param side Buy or Sell
@@ -253,51 +481,289 @@ public:
     /// @param side Buy or Sell
     void clearSide(Side side) noexcept;
 
-    /// Clear all orders (both sides)
+    /// Clear all orders (both sides), pending stop orders and the last trade price
     void clear() noexcept;
 
-    /// Observer management
-    void addObserver(std::shared_ptr<IOrderBookObserver> observer) {
-        observers_.addObserver(std::move(observer));
+    /// Observer management (runtime dispatch through ObserverManager)
+    /// @param observer Observer to add
+    /// @param events Bitset of ObserverEvents to deliver (default: all)
+    /// @param depth Only deliver price level and order updates for the top N levels (0 = all levels)
+    void addObserver(std::shared_ptr<IOrderBookObserver> observer, uint8_t events = AllEvents, std::size_t depth = 0)
+        requires std::same_as<ObserverDispatch, ObserverManager> {
+        observers_.addObserver(std::move(observer), events, depth);
     }
 
-    bool removeObserver(const std::shared_ptr<IOrderBookObserver>& observer) {
+    bool removeObserver(const std::shared_ptr<IOrderBookObserver>& observer)
+        requires std::same_as<ObserverDispatch, ObserverManager> {
         return observers_.removeObserver(observer);
     }
 
-    void clearObservers() noexcept {
+    void clearObservers() noexcept
+        requires std::same_as<ObserverDispatch, ObserverManager> {
         observers_.clearObservers();
     }
 
-    [[nodiscard]] std::size_t observerCount() const noexcept {
+    [[nodiscard]] std::size_t observerCount() const noexcept
+        requires std::same_as<ObserverDispatch, ObserverManager> {
         return observers_.observerCount();
     }
 
+    /// Get the statically dispatched observer (StaticObserverDispatch policies only)
+    [[nodiscard]] auto& observer() noexcept
+        requires requires(ObserverDispatch& dispatch) { dispatch.observer(); } {
+        return observers_.observer();
+    }
+
+    [[nodiscard]] const auto& observer() const noexcept
+        requires requires(const ObserverDispatch& dispatch) { dispatch.observer(); } {
+        return observers_.observer();
+    }
+
+    /// Publish the top aggregated levels of each side for lock-free readers on other threads (see readDepth())
+    /// The depth block is allocated once here and republished whenever an update batch touches one of
+    /// the top depth levels. Call during setup, before readers start.
+    /// @param depth Levels per side to publish (0 = disable)
+    void setPublishedDepth(std::size_t depth);
+
+    /// Get number of levels published per side (0 = disabled)
+    [[nodiscard]] std::size_t publishedDepth() const noexcept { return depth_publisher_.depth(); }
+
+    /// Copy the published top-N aggregated depth (safe to call from any thread, never allocates)
+    /// Same levels as getLevelsL2(side, N), with both sides from the same publication.
+    /// Copies min(N, publishedDepth()) levels per side.
+    /// @param out Receives the levels
+    template<std::size_t N>
+    void readDepth(DepthSnapshot<N>& out) const noexcept {
+        depth_publisher_.read(out);
+    }
+
+    /// Maintain running sums over the top aggregated levels of each side (microprice, imbalance, price to fill)
+    /// The arrays are allocated once here and refreshed at the end of every update batch that touches one
+    /// of the top depth levels, from the shallowest changed level down.
+    /// @param depth Levels per side to track (0 = disable)
+    void setAnalyticsDepth(std::size_t depth);
+
+    /// Get analytics over the top levels (see setAnalyticsDepth(); read on the update thread only)
+    [[nodiscard]] const BookAnalytics& analytics() const noexcept { return analytics_; }
+
+    /// Stop computing exact level indexes past the interested levels
+    /// When enabled, updates to levels deeper than interested_num_levels report INVALID_INDEX as their
+    /// level index (OrderUpdate::price_level_index), so no update scans past the interested range.
+    /// No effect when interested_num_levels is 0 (all levels)
+    /// @param skip true to bound level index computation to interested_num_levels
+    void setSkipLevelIndexBeyondInterested(bool skip) noexcept {
+        level_index_limit_ = (skip && interested_num_levels_ > 0)
+            ? std::min<std::size_t>(interested_num_levels_, INVALID_INDEX)
+            : INVALID_INDEX;
+    }
+
+    /// Check if level index computation is bounded to the interested levels
+    [[nodiscard]] bool skipsLevelIndexBeyondInterested() const noexcept {
+        return level_index_limit_ != INVALID_INDEX;
+    }
+
+    /// Conflate price level updates across an external batch
+    /// When enabled, operations called with is_last_in_batch = false no longer notify onPriceLevelUpdate();
+    /// the levels they touch are collected and reported by the operation that closes the batch, before its
+    /// onTopOfBookUpdate(): at most one update per level with its final quantity and order count, the same
+    /// coalescing as applyBatch(). Order updates and trades are still delivered per operation.
+    /// Level updates stay pending if the closing operation is rejected, until the next one closes the batch.
+    /// @param conflate true to conflate level updates
+    void setConflateLevelUpdates(bool conflate) noexcept {
+        conflate_level_updates_ = conflate;
+    }
+
+    /// Check if price level updates are conflated across external batches
+    [[nodiscard]] bool conflatesLevelUpdates() const noexcept {
+        return conflate_level_updates_;
+    }
+
+    /// Get number of orders the order pool holds without growing
+    [[nodiscard]] std::size_t orderPoolCapacity() const noexcept {
+        return order_pool_.capacity();
+    }
+
+    /// Get bytes held by the book: the object itself, order pool, order map, level containers and L2 view caches
+    [[nodiscard]] std::size_t memoryUsage() const noexcept {
+        return sizeof(*this) + order_pool_.memoryUsage() + order_map_.memoryUsage() + bids_.memoryUsage() +
+               asks_.memoryUsage() + l2_cache_[Side::Buy].memoryUsage() + l2_cache_[Side::Sell].memoryUsage();
+    }
+
+    /// Release memory the book no longer needs (e.g. after a busy session), keeping room for the given
+    /// high watermarks. Resting orders, their ids and level contents are unchanged; containers whose
+    /// storage is sized by price range or fixed windows keep their size.
+    /// Rehashes the order map and may move levels, so call it off the hot path, from the writer thread.
+    /// @param keep_orders Orders to keep capacity for in the order pool and order map
+    /// @param keep_levels Levels to keep capacity for per side
+    /// @return Bytes released
+    std::size_t trim(std::size_t keep_orders = 0, std::size_t keep_levels = 0) {
+        const std::size_t before = memoryUsage();
+        order_pool_.trim(keep_orders);
+        order_map_.trim(keep_orders);
+        bids_.trim(keep_levels);
+        asks_.trim(keep_levels);
+        return before - memoryUsage();
+    }
+
+    /// Get order pool block allocator (memory placement, huge page fallbacks and NUMA binding failures)
+    [[nodiscard]] const detail::PageAllocator& orderPoolAllocator() const noexcept {
+        return order_pool_.allocator();
+    }
+
     /// Get last processed sequence number
     /// @return Last sequence number (0 if not tracking)
     [[nodiscard]] uint64_t getLastSeqNum() const noexcept {
         return last_seq_num_;
     }
 
+#if SLICK_ORDERBOOK_METRICS
+    /// Get the book's latency histograms and counters (snapshot() may be called from any thread)
+    [[nodiscard]] const BookMetrics& metrics() const noexcept { return metrics_.get(); }
+#endif
+
     /// Emit complete orderbook snapshot to observers (L3 MBO)
     /// Useful for replaying full book state to a new observer
     /// Calls onSnapshotBegin(), followed by onOrderUpdate() for each order, then onSnapshotEnd()
     /// @param timestamp Snapshot timestamp
     void emitSnapshot(Timestamp timestamp);
 
+    /// Replace the book contents with an exchange snapshot (e.g. when recovering from a gap)
+    /// Orders are sorted once by side, price and priority, the pools are reserved up front and each
+    /// level is built by appending, so loading is O(n log n) with no per-order level shifting.
+    /// Orders with quantity <= 0 or at prices the level container does not accept are skipped; for
+    /// duplicate order ids the first entry wins.
+    /// Only resting orders are replaced: pending stop orders and the last trade price are kept
+    /// (use clear() first to drop them too).
+    /// Observers see a single onSnapshotBegin()/onSnapshotEnd() bracket with one onOrderUpdate()
+    /// per order, followed by onTopOfBookUpdate() if the top of book changed
+    /// @param orders Resting orders, in any order
+    /// @param seq_num Snapshot sequence number; becomes the last processed sequence number
+    /// @param timestamp Snapshot timestamp
+    void loadSnapshot(std::span<const SnapshotOrder> orders, uint64_t seq_num = 0, Timestamp timestamp = 0);
+
 protected:
+    /// Rebuild one side from snapshot orders sorted best price first, then by priority
+    template<Side S>
+    void loadLevels(PriceLevelMap<S>& level_map, std::span<const SnapshotOrder* const> orders);
+
+    /// Check if a level of the resting side S crosses an incoming order's limit price
+    template<Side S>
+    [[nodiscard]] static constexpr bool crosses(Price level_price, Price limit_price, bool is_market) noexcept {
+        if constexpr (S == Side::Sell) {
+            return is_market || level_price <= limit_price;
+        } else {
+            return is_market || level_price >= limit_price;
+        }
+    }
+
+    /// Accept an update's sequence number (0 = not tracked) unless it is older than last_seq_num_
+    [[nodiscard]] bool acceptSeqNum(uint64_t seq_num) noexcept {
+        if (seq_num > 0) {
+            if (seq_num < last_seq_num_) {
+                metrics_.count(BookCounter::RejectedSeqNum);
+                return false;
+            }
+            last_seq_num_ = seq_num;
+        }
+        return true;
+    }
+
+    /// Operations behind addOrder(), modifyOrder(), deleteOrder() and executeOrder()
+    /// The sequence number is already accepted and the order already looked up (addNewOrder(): absent)
+    bool addNewOrder(OrderId order_id, Side side, Price price, Quantity quantity, Timestamp timestamp,
+                     uint64_t priority, uint64_t seq_num, bool is_last_in_batch);
+    bool modifyFoundOrder(Order* order, Price new_price, Quantity new_quantity, Timestamp new_timestamp,
+                          uint64_t new_priority, uint64_t seq_num, bool is_last_in_batch);
+    bool deleteFoundOrder(Order* order, Timestamp timestamp, uint64_t seq_num, bool is_last_in_batch);
+    bool executeFoundOrder(Order* order, Quantity executed_quantity, Timestamp timestamp, uint64_t seq_num,
+                           bool is_last_in_batch);
+
+    /// Prefetch the order map slot of the update kBatchPrefetchDistance ahead of applyBatch()'s cursor
+    /// Only the slot address is computed; the lookup itself is left to the update
+    void prefetchBatchOrders(std::span<const L3Update> updates, std::size_t cursor) const noexcept {
+        if constexpr (requires { order_map_.prefetch(OrderId{}); }) {
+            if (cursor + kBatchPrefetchDistance < updates.size()) {
+                order_map_.prefetch(updates[cursor + kBatchPrefetchDistance].order_id);
+            }
+        }
+    }
+
+    /// Fast path shared by partial executions and quantity-only modifies: the order keeps its price and
+    /// queue position, so the level is only looked up (never created or re-sorted) and updated in place
+    bool updateFoundOrderQuantity(Order* order, Quantity new_quantity, Timestamp timestamp, uint64_t seq_num,
+                                  bool is_last_in_batch);
+
+    /// Check if the crossing levels of side S hold at least quantity (FOK pre-check)
+    template<Side S>
+    [[nodiscard]] bool canFill(const PriceLevelMap<S>& level_map, Price limit_price, bool is_market,
+                               Quantity quantity) const noexcept;
+
+    /// Fill an incoming order against the resting orders of side S (see submitOrder())
+    /// Accumulates filled_quantity and trade_count into result
+    /// @param rest_remainder The remainder will rest (so the sweep does not close the batch)
+    template<Side S>
+    void matchLevels(PriceLevelMap<S>& level_map, OrderId aggressive_order_id, Price limit_price, bool is_market,
+                     Quantity quantity, bool rest_remainder, Timestamp timestamp, uint64_t seq_num,
+                     bool is_last_in_batch, SubmitResult& result);
+
+    /// Submit the stop orders triggered by the last trade price, until none is left (see submitStopOrder())
+    /// @return Number of stop orders triggered
+    uint32_t triggerStops(Timestamp timestamp);
+
+    /// Submit a triggered stop order through submitOrder()
+    SubmitResult submitTriggered(const detail::StopOrder& stop, Timestamp timestamp, uint64_t seq_num);
+
     /// Get or create price level, returns pointer, index and if new level created
-    std::tuple<detail::PriceLevelL3*, uint16_t, bool> getOrCreateLevel(Side side, Price price);
+    /// Precondition: acceptsPrice(side, price)
+    std::tuple<PriceLevel*, uint16_t, bool> getOrCreateLevel(Side side, Price price);
+
+    /// Check whether the level container of a side can hold a level at price
+    [[nodiscard]] bool acceptsPrice(Side side, Price price) const noexcept {
+        return visitLevels(side, [price](const auto& level_map) { return level_map.accepts(price); });
+    }
 
     /// Remove price level if empty
     bool removeLevelIfEmpty(Side side, Price price) noexcept;
 
+    /// Release all orders in a side's level map and clear it
+    template<typename LevelMap>
+    void clearLevels(LevelMap& level_map) noexcept;
+
     /// Notify observers of order update with level index and change flags
-    void notifyOrderUpdate(const detail::Order* order, Quantity old_quantity, Price old_price,
+    void notifyOrderUpdate(const Order* order, Quantity old_quantity, Price old_price,
                           Timestamp timestamp, uint16_t level_index, uint8_t change_flags, uint64_t seq_num) const;
 
     /// Notify observers of order delete with level index
-    void notifyOrderDelete(const detail::Order* order, Timestamp timestamp, uint16_t level_index, uint8_t change_flags, uint64_t seq_num) const;
+    void notifyOrderDelete(const Order* order, Timestamp timestamp, uint16_t level_index, uint8_t change_flags, uint64_t seq_num) const;
+
+    /// Find price level for an update, with its index bounded by updateLevelIndexLimit()
+    std::pair<PriceLevel*, uint16_t> findLevel(Side side, Price price) noexcept;
+
+    /// Level index of a level, INVALID_INDEX if it is at or beyond limit
+    template<typename LevelMap>
+    [[nodiscard]] static uint16_t levelIndexOf(const LevelMap& level_map, typename LevelMap::const_iterator it,
+                                               std::size_t limit) noexcept {
+        const std::size_t index = level_map.indexOf(it, limit);
+        return index < limit ? static_cast<uint16_t>(index) : INVALID_INDEX;
+    }
+
+    /// Depth up to which update events need an exact level index
+    /// Bounded by level_index_limit_ and by the deepest level any observer subscribes to, but never below
+    /// the published depth; index 0 is always exact so top-of-book changes are still detected
+    [[nodiscard]] std::size_t updateLevelIndexLimit() const noexcept {
+        const std::size_t limit = std::clamp<std::size_t>(observers_.levelIndexLimit(), 1, level_index_limit_);
+        const std::size_t cached = std::min<std::size_t>(std::max(l2_cache_[Side::Buy].depth(), l2_cache_[Side::Sell].depth()),
+                                                         INVALID_INDEX);
+        return std::max({limit, depth_publisher_.depth(), analytics_.depth(), cached});
+    }
+
+    /// Record a level change: widens the batch's changed range and marks the cached L2 view stale from it
+    /// @param level_idx Index of the changed level (INVALID_INDEX = beyond updateLevelIndexLimit())
+    void noteLevelChange(Side side, uint16_t level_idx) noexcept {
+        change_starting_index_ = std::min(change_starting_index_, level_idx);
+        changed_sides_ |= static_cast<uint8_t>(1 << side);
+        l2_cache_[side].invalidateFrom(level_idx);
+    }
 
     /// Calculate price level index for a given side and price
     [[nodiscard]] uint16_t calculateLevelIndex(Side side, Price price) const noexcept;
@@ -307,39 +773,117 @@ protected:
                      Side aggressor_side, Price price, Quantity quantity, Timestamp timestamp) const;
 
     /// Notify observers of price level update (L2 aggregated view)
-    void notifyPriceLevelUpdate(Timestamp timestamp, Side side, Price price, Quantity total_quantity, size_t order_count, uint16_t level_index, uint8_t change_flags, uint64_t seq_num) const;
+    /// Deferred to level_batch_ while applyBatch() runs, or until the end of the batch when conflating
+    /// @param level Level after the change, nullptr if it was removed
+    void notifyPriceLevelUpdate(Timestamp timestamp, Side side, Price price, const PriceLevel* level, uint16_t level_index, uint8_t change_flags, uint64_t seq_num);
+
+    /// Notify one coalesced update per level recorded in level_batch_
+    void flushLevelBatch();
 
     /// Notify observers of top-of-book update if best changed
     /// Updates cached_tob_ after notification
     /// @param timestamp Update timestamp
     void notifyTopOfBookIfChanged(Timestamp timestamp);
 
+    /// Close an update batch: republish the depth block and top-of-book if the batch touched them
+    /// Flushes conflated level updates first. No-op while applyBatch() runs; it closes the batch itself
+    /// @param timestamp Update timestamp
+    void endBatch(Timestamp timestamp);
+
+    /// Copy the top aggregated levels into the published depth block
+    /// @param timestamp Update timestamp
+    void publishDepth(Timestamp timestamp) noexcept;
+
+    /// Refresh analytics from a level index down
+    /// @param sides Sides to refresh (bit 1 << Side)
+    void updateAnalytics(std::size_t from_level, uint8_t sides) noexcept;
+
+    static constexpr uint8_t kAllSides = (1 << SideCount) - 1;
+    static constexpr std::size_t kBatchPrefetchDistance = 8;   // Updates ahead whose order map slot applyBatch() prefetches
+
+    /// Aggregate a (price, level) entry like getLevelsL2()
+    template<typename Entry>
+    [[nodiscard]] static detail::PriceLevelL2 aggregateLevel(const Entry& entry) noexcept {
+        const auto& [price, level] = entry;
+        Timestamp latest_timestamp = level.orders.empty() ? 0 : detail::timestampOf(*level.orders.front());
+        return detail::PriceLevelL2(price, level.getTotalQuantity(), latest_timestamp);
+    }
+
+    /// Invoke fn with the side-specialized level container for a runtime side
+    /// Costs a single branch; everything inside fn is compiled per side with inlined comparisons
+    template<typename Fn>
+    decltype(auto) visitLevels(Side side, Fn&& fn) {
+        SLICK_ASSERT(side < SideCount);
+        return side == Side::Buy ? fn(bids_) : fn(asks_);
+    }
+
+    template<typename Fn>
+    decltype(auto) visitLevels(Side side, Fn&& fn) const {
+        SLICK_ASSERT(side < SideCount);
+        return side == Side::Buy ? fn(bids_) : fn(asks_);
+    }
+
 protected:
     SymbolId symbol_;                                           // Symbol identifier
-    std::array<PriceLevelMap, SideCount> levels_;               // Price levels per side (indexed by Side enum)
-    detail::OrderMap order_map_;                                // OrderId -> Order* lookup
-    detail::ObjectPool<detail::Order> order_pool_;              // Memory pool for Order objects
-    ObserverManager observers_;                                 // Observer notifications
+    PriceLevelMap<Side::Buy> bids_;                             // Bid price levels (descending)
+    PriceLevelMap<Side::Sell> asks_;                            // Ask price levels (ascending)
+    OrderMap order_map_;                                        // OrderId -> Order* lookup
+    typename detail::OrderStorage<Order>::Pool order_pool_;     // Memory pool for Order objects
+    detail::ObserverDispatchOf<ObserverDispatch> observers_;    // Observer notifications (timed when metrics are on)
     TopOfBook cached_tob_;                                      // Cached top-of-book for efficient change detection
+    detail::DepthPublisher depth_publisher_;                    // Seqlock-published top-N depth for other threads
+    BookAnalytics analytics_;                                   // Running sums over the top levels
+    mutable std::array<detail::AggregatedLevelCache, SideCount> l2_cache_;  // Lazily refreshed L2 view per side (getLevelsL2View)
+    detail::LevelBatch level_batch_;                            // Levels touched by the current applyBatch() or conflated batch
     uint64_t last_seq_num_;                                     // Last processed sequence number (0 = not tracking)
+    [[no_unique_address]] detail::BookMetricsSlot metrics_;     // Latency histograms and counters (empty unless SLICK_ORDERBOOK_METRICS)
     uint16_t change_starting_index_ = INVALID_INDEX;            // The lowerest level had changed in a batch. The value reset to INVALID_INDEX after TopOfBook change notified
+    uint8_t changed_sides_ = 0;                                 // Sides changed in a batch (bit 1 << Side), reset with change_starting_index_
     std::size_t interested_num_levels_;                         // The top N levels to track for observer notifications (0 = all levels)
+    std::size_t level_index_limit_ = INVALID_INDEX;             // Level indexes are computed up to this depth, deeper levels report INVALID_INDEX
+    bool conflate_level_updates_ = false;                       // Defer level updates to the LastInBatch operation
+    bool applying_batch_ = false;                               // applyBatch() is running; it closes the batch itself
+    detail::StopOrderIndex stops_;                              // Pending stop orders by trigger price
+    Price last_trade_price_ = 0;                                // Price of the last submitOrder() trade
+    bool has_traded_ = false;                                   // last_trade_price_ is set
+    bool triggering_stops_ = false;                             // triggerStops() is running; it handles cascades
 };
 
-template<>
-inline const detail::PriceLevelL3* OrderBookL3::getBestLevel<Side::Buy>() const noexcept {
-    return getBestBid();
-}
+/// Level 3 orderbook with default policies
+using OrderBookL3 = BasicOrderBookL3<>;
+
+/// Level 3 orderbook with direct-indexed order lookup for dense sequential order ids
+using DirectIndexedOrderBookL3 = BasicOrderBookL3<DirectIndexedOrderBookL3Traits<>>;
+
+/// Level 3 orderbook with tick-indexed price ladders
+using LadderOrderBookL3 = BasicOrderBookL3<LadderOrderBookL3Traits>;
 
-template<>
-inline const detail::PriceLevelL3* OrderBookL3::getBestLevel<Side::Sell>() const noexcept {
-    return getBestAsk();
-}   
+/// Level 3 orderbook with the 48-byte compact order layout
+using CompactOrderBookL3 = BasicOrderBookL3<CompactOrderBookL3Traits>;
+
+/// Level 3 orderbook with pooled price levels behind a 16-byte sorted index
+using PooledLevelOrderBookL3 = BasicOrderBookL3<PooledLevelOrderBookL3Traits>;
+
+/// Level 3 orderbook notifying a single Observer type with compile-time dispatch
+/// In compiled mode include detail/impl/orderbook_l3_impl.hpp to instantiate it
+template<typename Observer>
+using StaticObserverOrderBookL3 = BasicOrderBookL3<StaticObserverOrderBookL3Traits<Observer>>;
 
 SLICK_NAMESPACE_END
 
 // Include implementation for header-only mode
+// In compiled mode OrderBookL3, DirectIndexedOrderBookL3, LadderOrderBookL3, CompactOrderBookL3 and
+// PooledLevelOrderBookL3 are explicitly instantiated in the library; include detail/impl/orderbook_l3_impl.hpp
+// directly to use other traits
 #ifdef SLICK_ORDERBOOK_HEADER_ONLY
 #include <slick/orderbook/detail/impl/orderbook_l3_impl.hpp>
+#else
+SLICK_NAMESPACE_BEGIN
+extern template class BasicOrderBookL3<DefaultOrderBookL3Traits>;
+extern template class BasicOrderBookL3<DirectIndexedOrderBookL3Traits<>>;
+extern template class BasicOrderBookL3<LadderOrderBookL3Traits>;
+extern template class BasicOrderBookL3<CompactOrderBookL3Traits>;
+extern template class BasicOrderBookL3<PooledLevelOrderBookL3Traits>;
+SLICK_NAMESPACE_END
 #endif
 
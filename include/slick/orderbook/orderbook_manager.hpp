@@ -8,14 +8,48 @@
 #include <slick/orderbook/orderbook_l2.hpp>
 #include <slick/orderbook/orderbook_l3.hpp>
 #include <slick/orderbook/detail/flat_map.hpp>
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <shared_mutex>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 #include <mutex>
 
 SLICK_NAMESPACE_BEGIN
 
+/// Symbol lookup strategy for OrderBookManager
+enum class SymbolLookup : uint8_t {
+    SharedLock,     // FlatMap under a shared lock (binary search per lookup)
+    DirectTable,    // One atomic pointer per SymbolId (single acquire load per lookup)
+};
+
+/// Bytes held by one symbol's orderbook (OrderBookManager::memoryUsage())
+struct SymbolMemoryUsage {
+    SymbolId symbol;        // Symbol identifier
+    std::size_t bytes;      // Bytes held by the book (OrderBookT::memoryUsage())
+};
+
+/// How OrderBookManager::forEachBook() spreads the books over threads
+/// Books are split into workers contiguous ranges of symbol order, so a given set of symbols always
+/// lands on the same workers; the calling thread sweeps the first range.
+struct SweepPolicy {
+    std::size_t workers = 1;    // Threads sweeping the books, including the caller (0 = hardware concurrency)
+};
+
+/// One symbol's published depth (OrderBookManager::parallelSnapshot())
+/// @tparam N Maximum levels per side copied out
+template<std::size_t N>
+struct SymbolDepthSnapshot {
+    SymbolId symbol = 0;        // Symbol identifier
+    DepthSnapshot<N> depth;     // Book's published depth (version 0 if the book publishes none)
+};
+
 /// Multi-symbol OrderBook Manager
 ///
 /// Manages multiple orderbook instances (L2 or L3) across different symbols.
@@ -25,7 +59,7 @@ SLICK_NAMESPACE_BEGIN
 /// - Thread-safe symbol registry using shared_mutex
 /// - Per-symbol orderbook isolation (no cross-symbol locking)
 /// - Automatic orderbook creation on first access
-/// - Efficient symbol lookup via flat_map
+/// - Efficient symbol lookup via flat_map, or a lock-free direct table (SymbolLookup::DirectTable)
 /// - Support for both L2 and L3 orderbooks via template
 ///
 /// Thread Safety:
@@ -33,8 +67,16 @@ SLICK_NAMESPACE_BEGIN
 /// - Symbol map protected by shared_mutex (read-write lock)
 /// - Each orderbook follows single-writer-per-symbol model
 ///
-/// Template Parameter:
+/// Lookup modes:
+/// - SymbolLookup::SharedLock (default): every lookup takes a shared lock on the symbol map
+/// - SymbolLookup::DirectTable: lookups (getOrderBook, hasSymbol, the getOrCreateOrderBook hit path) are a
+///   single acquire load from a 65536-entry table indexed by SymbolId; only creation and removal lock.
+///   Removed books are retired rather than destroyed, since another thread may still hold the pointer;
+///   call reclaimRetired() once no thread can.
+///
+/// Template Parameters:
 /// @tparam OrderBookT Either OrderBookL2 or OrderBookL3
+/// @tparam Lookup Symbol lookup strategy
 ///
 /// Usage:
 /// @code
@@ -48,7 +90,7 @@ SLICK_NAMESPACE_BEGIN
 /// auto* book = l3_manager.getOrCreateOrderBook(symbol_id);
 /// book->addOrder(order_id, Side::Buy, 10000, 100, timestamp);
 /// @endcode
-template<typename OrderBookT>
+template<typename OrderBookT, SymbolLookup Lookup = SymbolLookup::SharedLock>
 class OrderBookManager {
 public:
     using OrderBookPtr = std::unique_ptr<OrderBookT>;
@@ -73,6 +115,15 @@ public:
     /// @return Pointer to orderbook (never null)
     [[nodiscard]] OrderBookT* getOrCreateOrderBook(SymbolId symbol);
 
+    /// Get existing orderbook or create one whose pooled memory is placed as memory asks
+    /// Books without pooled memory (OrderBookL2) ignore memory. Creating from the thread that will
+    /// update the book also keeps first-touch placement on that thread's NUMA node
+    /// Thread-safe: Uses shared_mutex for symbol map access
+    /// @param symbol Symbol identifier
+    /// @param memory Memory placement for a newly created book (e.g. the NUMA node of a shard)
+    /// @return Pointer to orderbook (never null)
+    [[nodiscard]] OrderBookT* getOrCreateOrderBook(SymbolId symbol, const MemoryConfig& memory);
+
     /// Get existing orderbook (read-only access)
     /// Thread-safe: Uses shared lock for read-only access
     /// @param symbol Symbol identifier
@@ -116,11 +167,145 @@ public:
     /// @param capacity Expected number of symbols
     void reserve(std::size_t capacity);
 
+    /// Destroy orderbooks retired by removeOrderBook() and clear() (DirectTable only)
+    /// Thread-safe: Uses exclusive lock. The caller guarantees no thread still uses a pointer obtained
+    /// before the removal (e.g. all feed threads have passed a quiescent point)
+    /// @return Number of orderbooks destroyed
+    std::size_t reclaimRetired()
+        requires (Lookup == SymbolLookup::DirectTable);
+
+    /// Get number of removed orderbooks awaiting reclaimRetired() (DirectTable only)
+    /// Thread-safe: Uses shared lock
+    [[nodiscard]] std::size_t retiredCount() const
+        requires (Lookup == SymbolLookup::DirectTable);
+
+    /// Get bytes held by each orderbook, in symbol order
+    /// Thread-safe: Uses shared lock. Books are read without locking, so call it while their writer
+    /// threads are quiet (e.g. between sessions) or from the writer thread itself
+    /// @return One entry per active symbol
+    [[nodiscard]] std::vector<SymbolMemoryUsage> memoryUsage() const
+        requires requires(const OrderBookT& book) { book.memoryUsage(); };
+
+    /// Release memory of the orderbooks select picks (e.g. idle books, during a quiet period)
+    /// Each selected book's trim() rehashes and moves its storage, so this must stay off the hot path:
+    /// the caller guarantees no thread updates or reads a selected book while it runs.
+    /// Thread-safe with respect to the symbol map: Uses shared lock
+    /// @param select Called as select(SymbolId, const OrderBookT&) -> bool for each active symbol
+    /// @return Bytes released across all selected books
+    template<typename Select>
+        requires std::predicate<Select&, SymbolId, const OrderBookT&>
+    std::size_t trimBooks(Select&& select) {
+        std::shared_lock lock(mutex_);
+        std::size_t released = 0;
+        for (auto& [symbol_id, book] : symbol_map_) {
+            if (select(symbol_id, std::as_const(*book))) {
+                released += book->trim();
+            }
+        }
+        return released;
+    }
+
+    /// Release memory of every orderbook (see trimBooks(select))
+    /// @return Bytes released across all books
+    std::size_t trimBooks() {
+        return trimBooks([](SymbolId, const OrderBookT&) { return true; });
+    }
+
+    /// Call fn for every orderbook, spread over policy.workers threads (e.g. end-of-interval marks)
+    /// fn runs on the workers while the books' writer threads keep updating them, so it may only use
+    /// queries that are safe from other threads, such as readDepth(). It must not throw.
+    /// Thread-safe: Uses shared lock for the whole sweep. Lookups and updates of existing books never
+    /// wait for it; creating or removing a book (exclusive lock) waits until the sweep returns.
+    /// @param policy Number of worker threads
+    /// @param fn Called as fn(SymbolId, const OrderBookT&) once per active symbol
+    template<typename Fn>
+        requires std::invocable<Fn&, SymbolId, const OrderBookT&>
+    void forEachBook(const SweepPolicy& policy, Fn&& fn) const {
+        std::shared_lock lock(mutex_);
+        sweepBooks(policy, [&fn](std::size_t, SymbolId symbol, const OrderBookT& book) { fn(symbol, book); });
+    }
+
+    /// Copy every orderbook's published depth (see setPublishedDepth()), spread over policy.workers threads
+    /// Each copy goes through the book's sequence lock, so writers are never blocked; books are copied
+    /// one by one, so the snapshots are individually consistent rather than taken at a single instant.
+    /// Thread-safe: Uses shared lock (see forEachBook())
+    /// @tparam N Maximum levels per side copied out
+    /// @param policy Number of worker threads
+    /// @return One entry per active symbol, in symbol order
+    template<std::size_t N>
+    [[nodiscard]] std::vector<SymbolDepthSnapshot<N>> parallelSnapshot(const SweepPolicy& policy = {}) const
+        requires requires(const OrderBookT& book, DepthSnapshot<N>& out) { book.readDepth(out); } {
+        std::shared_lock lock(mutex_);
+        std::vector<SymbolDepthSnapshot<N>> snapshots(symbol_map_.size());
+        sweepBooks(policy, [&snapshots](std::size_t index, SymbolId symbol, const OrderBookT& book) {
+            snapshots[index].symbol = symbol;
+            book.readDepth(snapshots[index].depth);
+        });
+        return snapshots;
+    }
+
+#if SLICK_ORDERBOOK_METRICS
+    /// Sum the latency histograms and counters of every orderbook, including removed ones
+    /// Thread-safe: Uses shared lock; the books' own metrics are read without locking while they update
+    [[nodiscard]] BookMetricsSnapshot metricsSnapshot() const
+        requires requires(const OrderBookT& book) { book.metrics(); };
+#endif
+
 private:
-    mutable std::shared_mutex mutex_;  ///< Protects symbol_map_
-    SymbolMap symbol_map_;             ///< Map of SymbolId -> OrderBook
+    using BookSlot = std::atomic<OrderBookT*>;
+    static constexpr std::size_t kTableSize = std::size_t{std::numeric_limits<SymbolId>::max()} + 1;
+
+    /// Lock-free lookup (DirectTable only)
+    [[nodiscard]] OrderBookT* loadBook(SymbolId symbol) const noexcept {
+        return direct_table_[symbol].load(std::memory_order_acquire);
+    }
+
+    /// Call fn(index in symbol order, SymbolId, const OrderBookT&) for every book (called with mutex_ held)
+    /// Worker w sweeps indexes [w * count / workers, (w + 1) * count / workers); the caller is worker 0
+    template<typename Fn>
+    void sweepBooks(const SweepPolicy& policy, const Fn& fn) const {
+        const std::size_t count = symbol_map_.size();
+        const std::size_t requested = policy.workers > 0 ? policy.workers : std::thread::hardware_concurrency();
+        const std::size_t workers = std::clamp<std::size_t>(requested, 1, std::max<std::size_t>(count, 1));
+        auto sweep = [this, &fn, count, workers](std::size_t worker) {
+            const std::size_t begin = worker * count / workers;
+            const std::size_t end = (worker + 1) * count / workers;
+            auto it = std::next(symbol_map_.begin(), static_cast<std::ptrdiff_t>(begin));
+            for (std::size_t index = begin; index < end; ++index, ++it) {
+                fn(index, it->first, std::as_const(*it->second));
+            }
+        };
+        std::vector<std::jthread> threads;
+        threads.reserve(workers - 1);
+        for (std::size_t worker = 1; worker < workers; ++worker) {
+            threads.emplace_back(sweep, worker);
+        }
+        sweep(0);
+        // The workers join as threads goes out of scope
+    }
+
+#if SLICK_ORDERBOOK_METRICS
+    /// Keep a destroyed book's metrics in the manager totals (called with the exclusive lock held)
+    void keepMetrics(const OrderBookT& book) noexcept {
+        if constexpr (requires { book.metrics(); }) {
+            removed_metrics_.merge(book.metrics().snapshot());
+        }
+    }
+#endif
+
+    mutable std::shared_mutex mutex_;           ///< Protects symbol_map_, retired_books_ and writes to direct_table_
+    SymbolMap symbol_map_;                      ///< Map of SymbolId -> OrderBook (owns the books)
+    std::unique_ptr<BookSlot[]> direct_table_;  ///< SymbolId -> OrderBook, published with release stores (DirectTable only)
+    std::vector<OrderBookPtr> retired_books_;   ///< Removed books not yet reclaimed (DirectTable only)
+#if SLICK_ORDERBOOK_METRICS
+    BookMetricsSnapshot removed_metrics_;       ///< Metrics of destroyed books
+#endif
 };
 
+/// Manager whose symbol lookups are a single acquire load (see SymbolLookup::DirectTable)
+template<typename OrderBookT>
+using DirectOrderBookManager = OrderBookManager<OrderBookT, SymbolLookup::DirectTable>;
+
 SLICK_NAMESPACE_END
 
 // Include implementation for header-only mode
@@ -0,0 +1,258 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/detail/book_update.hpp>
+#include <slick/orderbook/detail/price_level_l2.hpp>
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+SLICK_NAMESPACE_BEGIN
+
+/// Outcome of SequencedBook::apply()
+enum class SequenceResult : uint8_t {
+    Applied,    // In sequence and applied to the book
+    Rejected,   // In sequence, but the book rejected it (unknown order, duplicate id)
+    Stale,      // Older than the book (duplicate or late retransmission), dropped
+    Buffered    // Held until the book is recovered from a snapshot
+};
+
+/// SequencedBook counters
+struct SequenceRecoveryStats {
+    uint64_t gaps = 0;                  // Forward gaps detected (live or while draining the buffer)
+    uint64_t missed = 0;                // Sequence numbers skipped by the detected gaps
+    uint64_t stale = 0;                 // Updates dropped as older than the book
+    uint64_t buffered = 0;              // Updates buffered during recoveries
+    uint64_t overwritten = 0;           // Buffered updates evicted by a full buffer (oldest first)
+    uint64_t superseded = 0;            // Buffered updates already covered by the snapshot
+    uint64_t replayed = 0;              // Buffered updates applied after a snapshot
+    uint64_t recoveries = 0;            // Recoveries completed
+    uint64_t last_recovery_ns = 0;      // Gap detection to live again, last recovery
+    uint64_t max_recovery_ns = 0;       // Gap detection to live again, slowest recovery
+    uint64_t total_recovery_ns = 0;     // Sum over all recoveries
+
+    /// Mean time from gap detection to live again
+    [[nodiscard]] double meanRecoveryNs() const noexcept {
+        return recoveries ? static_cast<double>(total_recovery_ns) / static_cast<double>(recoveries) : 0.0;
+    }
+};
+
+/// Sequence gap detection and snapshot recovery around an L2 or L3 book
+///
+/// Feeds decoded L2Update / L3Update messages to a book and checks their sequence numbers. The book
+/// itself drops updates older than getLastSeqNum() and accepts anything newer; this adapter also
+/// detects forward gaps (seq_num > getLastSeqNum() + 1) and, instead of applying updates on top of a
+/// book that missed some, switches to recovery:
+///
+/// 1. onGap(symbol, expected, received) is called (request a snapshot or retransmission from there)
+/// 2. the update and all later ones are copied into a preallocated ring buffer (the oldest are
+///    overwritten if it fills up)
+/// 3. loadSnapshot() bulk-loads the snapshot into the book, drops buffered updates it already covers,
+///    and applies the rest in order; onRecovered(symbol, seq_num, recovery_ns) is called once the book
+///    is live again
+///
+/// If the buffered updates do not continue from the snapshot (snapshot too old, buffer overwritten,
+/// another gap), the book stays in recovery with the remaining updates buffered and onGap() reports
+/// the new gap. Sequence numbers may repeat within a packet (seq_num == getLastSeqNum() is in
+/// sequence); updates with seq_num 0 are not checked. A book with no sequence number yet accepts the
+/// first update as its starting point; call requestRecovery() to wait for a snapshot instead.
+///
+/// Not thread-safe: call from the book's update thread (callbacks run on it too).
+///
+/// Usage:
+/// @code
+/// OrderBookL3 book(symbol);
+/// SequencedBook sequenced(book, 8192);
+/// sequenced.onGap([&](SymbolId s, uint64_t expected, uint64_t) { snapshots.request(s, expected); });
+/// sequenced.apply(update);                          // From the feed handler
+/// sequenced.loadSnapshot(orders, snapshot_seq, ts); // When the snapshot arrives
+/// @endcode
+template<typename BookT>
+    requires detail::LevelUpdatableBook<BookT> || detail::OrderUpdatableBook<BookT>
+class SequencedBook {
+public:
+    using Update = detail::EngineUpdateT<BookT>;
+    using GapCallback = std::function<void(SymbolId symbol, uint64_t expected_seq_num, uint64_t received_seq_num)>;
+    using RecoveredCallback = std::function<void(SymbolId symbol, uint64_t seq_num, uint64_t recovery_ns)>;
+
+    /// Constructor
+    /// @param book Book to feed (must outlive the adapter)
+    /// @param buffer_capacity Updates buffered during recovery (rounded up to a power of two)
+    explicit SequencedBook(BookT& book, std::size_t buffer_capacity = 4096)
+        : book_(book),
+          ring_(std::bit_ceil(std::max<std::size_t>(buffer_capacity, 1))),
+          mask_(ring_.size() - 1) {}
+
+    SequencedBook(const SequencedBook&) = delete;
+    SequencedBook& operator=(const SequencedBook&) = delete;
+
+    /// Set callback for detected gaps
+    void onGap(GapCallback callback) { on_gap_ = std::move(callback); }
+
+    /// Set callback for completed recoveries
+    void onRecovered(RecoveredCallback callback) { on_recovered_ = std::move(callback); }
+
+    /// Apply or buffer one update
+    /// @param update Decoded message (its symbol is not checked)
+    /// @param is_last_in_batch Set to false for all but the last update of a packet
+    SequenceResult apply(const Update& update, bool is_last_in_batch = true) {
+        const uint64_t last = book_.getLastSeqNum();
+        if (update.seq_num != 0 && update.seq_num < last) {
+            ++stats_.stale;
+            return SequenceResult::Stale;
+        }
+        if (SLICK_UNLIKELY(recovering_)) {
+            push(update, is_last_in_batch);
+            return SequenceResult::Buffered;
+        }
+        if (SLICK_UNLIKELY(update.seq_num > last + 1 && last != 0)) {
+            startRecovery();
+            reportGap(last + 1, update.seq_num);
+            push(update, is_last_in_batch);
+            return SequenceResult::Buffered;
+        }
+        return detail::applyUpdate(book_, update, is_last_in_batch) ? SequenceResult::Applied : SequenceResult::Rejected;
+    }
+
+    /// Apply or buffer a packet (the last update closes the batch)
+    /// @return Number of updates applied to the book
+    std::size_t applyBatch(std::span<const Update> updates) {
+        std::size_t applied = 0;
+        for (std::size_t i = 0; i < updates.size(); ++i) {
+            applied += apply(updates[i], i + 1 == updates.size()) == SequenceResult::Applied ? 1 : 0;
+        }
+        return applied;
+    }
+
+    /// Load an L2 snapshot and drain the buffered updates after it
+    /// @return true if the book is live (not recovering) afterwards
+    bool loadSnapshot(std::span<const detail::PriceLevelL2> bids, std::span<const detail::PriceLevelL2> asks,
+                      uint64_t seq_num, Timestamp timestamp)
+        requires detail::LevelUpdatableBook<BookT>
+    {
+        book_.loadSnapshot(bids, asks, seq_num, timestamp);
+        return drain();
+    }
+
+    /// Load an L3 snapshot and drain the buffered updates after it
+    /// @return true if the book is live (not recovering) afterwards
+    bool loadSnapshot(std::span<const SnapshotOrder> orders, uint64_t seq_num, Timestamp timestamp)
+        requires detail::OrderUpdatableBook<BookT>
+    {
+        book_.loadSnapshot(orders, seq_num, timestamp);
+        return drain();
+    }
+
+    /// Buffer updates until the next snapshot (e.g. at start-up, or after a loss reported by the transport)
+    void requestRecovery() {
+        startRecovery();
+    }
+
+    /// Check if updates are being buffered for a snapshot
+    [[nodiscard]] bool isRecovering() const noexcept { return recovering_; }
+
+    /// Get number of buffered updates
+    [[nodiscard]] std::size_t bufferedCount() const noexcept { return size_; }
+
+    /// Get buffer capacity
+    [[nodiscard]] std::size_t bufferCapacity() const noexcept { return ring_.size(); }
+
+    /// Get counters
+    [[nodiscard]] const SequenceRecoveryStats& stats() const noexcept { return stats_; }
+
+    /// Get the book
+    [[nodiscard]] BookT& book() noexcept { return book_; }
+    [[nodiscard]] const BookT& book() const noexcept { return book_; }
+
+private:
+    struct Entry {
+        Update update;
+        bool is_last_in_batch;
+    };
+
+    void startRecovery() {
+        if (!recovering_) {
+            recovering_ = true;
+            recovery_start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    void reportGap(uint64_t expected, uint64_t received) {
+        ++stats_.gaps;
+        stats_.missed += received - expected;
+        if (on_gap_) {
+            on_gap_(book_.symbol(), expected, received);
+        }
+    }
+
+    void push(const Update& update, bool is_last_in_batch) {
+        if (SLICK_UNLIKELY(size_ == ring_.size())) {
+            head_ = (head_ + 1) & mask_;
+            --size_;
+            ++stats_.overwritten;
+        }
+        ring_[(head_ + size_) & mask_] = Entry{update, is_last_in_batch};
+        ++size_;
+        ++stats_.buffered;
+    }
+
+    /// Apply buffered updates that continue the book's sequence; stop at the first gap
+    bool drain() {
+        const uint64_t snapshot_seq_num = book_.getLastSeqNum();
+        while (size_ > 0) {
+            const Entry& entry = ring_[head_];
+            const uint64_t last = book_.getLastSeqNum();
+            const uint64_t seq_num = entry.update.seq_num;
+            if (seq_num != 0 && seq_num <= snapshot_seq_num) {
+                ++stats_.superseded;
+            } else if (seq_num > last + 1 && last != 0) {
+                recovering_ = true;
+                reportGap(last + 1, seq_num);
+                return false;
+            } else {
+                detail::applyUpdate(book_, entry.update, entry.is_last_in_batch);
+                ++stats_.replayed;
+            }
+            head_ = (head_ + 1) & mask_;
+            --size_;
+        }
+        head_ = 0;
+
+        if (recovering_) {
+            recovering_ = false;
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - recovery_start_).count();
+            const auto recovery_ns = static_cast<uint64_t>(std::max<decltype(elapsed)>(elapsed, 0));
+            ++stats_.recoveries;
+            stats_.last_recovery_ns = recovery_ns;
+            stats_.max_recovery_ns = std::max(stats_.max_recovery_ns, recovery_ns);
+            stats_.total_recovery_ns += recovery_ns;
+            if (on_recovered_) {
+                on_recovered_(book_.symbol(), book_.getLastSeqNum(), recovery_ns);
+            }
+        }
+        return true;
+    }
+
+    BookT& book_;                                           // Adapted book
+    std::vector<Entry> ring_;                               // Updates buffered during recovery
+    std::size_t mask_;                                      // ring_.size() - 1
+    std::size_t head_ = 0;                                  // Oldest buffered update
+    std::size_t size_ = 0;                                  // Buffered updates
+    bool recovering_ = false;                               // Buffering until the next snapshot
+    std::chrono::steady_clock::time_point recovery_start_;  // When the current recovery started
+    SequenceRecoveryStats stats_;
+    GapCallback on_gap_;
+    RecoveredCallback on_recovered_;
+};
+
+SLICK_NAMESPACE_END
@@ -0,0 +1,515 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/events.hpp>
+#include <slick/orderbook/detail/depth_publisher.hpp>
+#include <slick/orderbook/detail/price_level_l2.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+/// Shared memory region holding the published books
+///
+///   SharedBookHeader   Region description and a SymbolId -> slot directory
+///   SharedBookSlot[]   One per published symbol, slot_stride bytes apart:
+///                        sequence lock, top-of-book, then depth bids and depth asks (PriceLevelL2)
+///
+/// The writer fills slots under the same sequence lock protocol as DepthPublisher (odd = writing,
+/// even = readable), so readers in other processes copy a slot out and retry if it moved. The atomics
+/// are lock-free and therefore address-free, which is what lets both sides map them.
+struct SharedBookHeader {
+    static constexpr uint64_t kMagic = 0x314B4F4F424B4C53;     // "SLKBOOK1"
+    static constexpr uint32_t kVersion = 1;
+    static constexpr std::size_t kDirectorySize = std::size_t{std::numeric_limits<SymbolId>::max()} + 1;
+
+    std::atomic<uint64_t> magic;                // kMagic once the region is initialized (stored last)
+    uint32_t version;                           // Layout version (kVersion)
+    uint32_t depth;                             // Levels per side in each slot
+    uint32_t capacity;                          // Number of slots
+    uint32_t slot_stride;                       // Bytes between slots
+    uint64_t region_size;                       // Total size of the region in bytes
+    std::atomic<uint32_t> slot_count;           // Slots handed out so far
+    std::atomic<uint16_t> directory[kDirectorySize];    // Slot index + 1 per symbol (0 = not published)
+};
+
+struct SharedBookSlot {
+    SLICK_CACHE_ALIGNED std::atomic<uint64_t> seq;  // Sequence lock (odd = writing, even = readable)
+    SymbolId symbol;                                // Symbol published in this slot
+    uint32_t bid_count;                             // Valid bid levels
+    uint32_t ask_count;                             // Valid ask levels
+    uint64_t seq_num;                               // Book's last processed sequence number at publication
+    TopOfBook top;                                  // Top of book at publication
+
+    [[nodiscard]] PriceLevelL2* levels() noexcept {
+        return reinterpret_cast<PriceLevelL2*>(reinterpret_cast<std::byte*>(this) + sizeof(SharedBookSlot));
+    }
+    [[nodiscard]] const PriceLevelL2* levels() const noexcept {
+        return reinterpret_cast<const PriceLevelL2*>(reinterpret_cast<const std::byte*>(this) + sizeof(SharedBookSlot));
+    }
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free &&
+              std::atomic<uint16_t>::is_always_lock_free, "shared book atomics must be address-free");
+static_assert(std::is_trivially_copyable_v<PriceLevelL2> && std::is_trivially_copyable_v<TopOfBook>);
+
+[[nodiscard]] constexpr std::size_t sharedBookHeaderSize() noexcept {
+    return (sizeof(SharedBookHeader) + SLICK_CACHE_LINE_SIZE - 1) / SLICK_CACHE_LINE_SIZE * SLICK_CACHE_LINE_SIZE;
+}
+
+[[nodiscard]] constexpr std::size_t sharedBookSlotStride(std::size_t depth) noexcept {
+    const std::size_t bytes = sizeof(SharedBookSlot) + 2 * depth * sizeof(PriceLevelL2);
+    return (bytes + SLICK_CACHE_LINE_SIZE - 1) / SLICK_CACHE_LINE_SIZE * SLICK_CACHE_LINE_SIZE;
+}
+
+SLICK_DETAIL_NAMESPACE_END
+
+SLICK_NAMESPACE_BEGIN
+
+/// Publishes books into a named shared memory region for reader processes (see SharedBookReader)
+///
+/// The process that maintains the books (typically through an OrderBookManager) creates the region
+/// and calls publish() after applying updates. Each symbol gets a slot the first time it is published;
+/// a publication copies the book's top of book and its best depth() levels per side into the slot
+/// under the slot's sequence lock. Nothing is allocated after create().
+///
+/// Thread Safety: single writer. Call publish() from the thread that updates the book, or at least
+/// not concurrently with it or with another publish().
+///
+/// POSIX shared memory, available on Linux; elsewhere create() fails.
+///
+/// Usage:
+/// @code
+/// SharedBookPublisher publisher;
+/// publisher.create("/md-books", 4096, 10);
+/// auto* book = manager.getOrCreateOrderBook(symbol);
+/// book->updateLevel(Side::Buy, 10000, 100, timestamp);
+/// publisher.publish(*book);
+/// @endcode
+class SharedBookPublisher {
+public:
+    SharedBookPublisher() = default;
+    ~SharedBookPublisher() { close(); }
+
+    SharedBookPublisher(const SharedBookPublisher&) = delete;
+    SharedBookPublisher& operator=(const SharedBookPublisher&) = delete;
+
+    SharedBookPublisher(SharedBookPublisher&& other) noexcept
+        : name_(std::move(other.name_)),
+          region_(std::exchange(other.region_, nullptr)),
+          size_(std::exchange(other.size_, 0)) {}
+
+    SharedBookPublisher& operator=(SharedBookPublisher&& other) noexcept {
+        if (this != &other) {
+            close();
+            name_ = std::move(other.name_);
+            region_ = std::exchange(other.region_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    /// Create the region, replacing any region left under the same name
+    /// Readers still attached to a replaced region keep seeing its last publications; they reopen to
+    /// follow the new one.
+    /// @param name Shared memory object name ("/name")
+    /// @param max_symbols Number of symbols that can be published (at most 65535)
+    /// @param depth Levels per side published for each symbol (0 = top of book only)
+    /// @return true if the region was created and mapped
+    bool create(const std::string& name, std::size_t max_symbols, std::size_t depth) {
+        close();
+        if (max_symbols == 0 || max_symbols >= detail::SharedBookHeader::kDirectorySize ||
+            depth > std::numeric_limits<uint32_t>::max() / 2) {
+            return false;
+        }
+#if defined(__linux__)
+        const std::size_t stride = detail::sharedBookSlotStride(depth);
+        const std::size_t size = detail::sharedBookHeaderSize() + max_symbols * stride;
+
+        ::shm_unlink(name.c_str());
+        const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            return false;
+        }
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            return false;
+        }
+        void* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+        ::close(fd);
+        if (memory == MAP_FAILED) {
+            ::shm_unlink(name.c_str());
+            return false;
+        }
+
+        // The object starts zero-filled: every directory entry is empty and every slot unpublished
+        region_ = static_cast<std::byte*>(memory);
+        size_ = size;
+        name_ = name;
+        auto* header = new (region_) detail::SharedBookHeader;
+        header->version = detail::SharedBookHeader::kVersion;
+        header->depth = static_cast<uint32_t>(depth);
+        header->capacity = static_cast<uint32_t>(max_symbols);
+        header->slot_stride = static_cast<uint32_t>(stride);
+        header->region_size = size;
+        header->slot_count.store(0, std::memory_order_relaxed);
+        for (auto& entry : header->directory) {
+            entry.store(0, std::memory_order_relaxed);
+        }
+        for (std::size_t i = 0; i < max_symbols; ++i) {
+            new (region_ + detail::sharedBookHeaderSize() + i * stride) detail::SharedBookSlot{};
+        }
+        header->magic.store(detail::SharedBookHeader::kMagic, std::memory_order_release);
+        return true;
+#else
+        (void)name;
+        return false;
+#endif
+    }
+
+    /// Unmap and remove the region (attached readers keep their mapping)
+    void close() noexcept {
+#if defined(__linux__)
+        if (region_ != nullptr) {
+            ::munmap(region_, size_);
+            ::shm_unlink(name_.c_str());
+        }
+#endif
+        region_ = nullptr;
+        size_ = 0;
+        name_.clear();
+    }
+
+    /// Check if a region is open
+    [[nodiscard]] bool isOpen() const noexcept { return region_ != nullptr; }
+
+    /// Get levels published per side
+    [[nodiscard]] std::size_t depth() const noexcept { return region_ ? header()->depth : 0; }
+
+    /// Get number of symbols published so far
+    [[nodiscard]] std::size_t symbolCount() const noexcept {
+        return region_ ? header()->slot_count.load(std::memory_order_relaxed) : 0;
+    }
+
+    /// Get maximum number of symbols
+    [[nodiscard]] std::size_t capacity() const noexcept { return region_ ? header()->capacity : 0; }
+
+    /// Hand out a symbol's slot ahead of its first publication (e.g. to fix the slot order at startup)
+    /// Readers find the symbol with hasSymbol() but read nothing from it until the first publish().
+    /// @return false if no region is open or no slot is left
+    bool reserve(SymbolId symbol) noexcept { return slotFor(symbol) != nullptr; }
+
+    /// Publish a book's top of book and top depth() levels per side
+    /// Works with any book exposing symbol(), getTopOfBook(), getLastSeqNum() and either
+    /// getLevels(side, span) (L2) or getLevelsL2(side, span) (L3).
+    /// @param book Book to publish
+    /// @return false if no region is open or the book's symbol needs a slot and none is left
+    template<typename Book>
+    bool publish(const Book& book) {
+        detail::SharedBookSlot* slot = slotFor(book.symbol());
+        if (slot == nullptr) {
+            return false;
+        }
+        const std::size_t depth = header()->depth;
+        detail::PriceLevelL2* levels = slot->levels();
+
+        const uint64_t seq = slot->seq.load(std::memory_order_relaxed);
+        slot->seq.store(seq + 1, std::memory_order_relaxed);    // Mark as writing (odd)
+        std::atomic_thread_fence(std::memory_order_release);    // Odd sequence is visible before any slot write
+
+        slot->top = book.getTopOfBook();
+        slot->seq_num = book.getLastSeqNum();
+        slot->bid_count = static_cast<uint32_t>(copyLevels(book, Side::Buy, std::span(levels, depth)));
+        slot->ask_count = static_cast<uint32_t>(copyLevels(book, Side::Sell, std::span(levels + depth, depth)));
+
+        slot->seq.store(seq + 2, std::memory_order_release);    // Mark as readable (even)
+        return true;
+    }
+
+    /// Publish every book of a manager
+    /// Allocates the manager's symbol list; meant for an initial or periodic full publication, with
+    /// publish(book) on the update path.
+    /// @return Number of books published
+    template<typename Manager>
+    std::size_t publishAll(const Manager& manager) {
+        std::size_t published = 0;
+        for (const SymbolId symbol : manager.getSymbols()) {
+            if (const auto* book = manager.getOrderBook(symbol); book != nullptr && publish(*book)) {
+                ++published;
+            }
+        }
+        return published;
+    }
+
+private:
+    [[nodiscard]] detail::SharedBookHeader* header() const noexcept {
+        return reinterpret_cast<detail::SharedBookHeader*>(region_);
+    }
+
+    /// Find the symbol's slot, handing out the next one on first publication
+    [[nodiscard]] detail::SharedBookSlot* slotFor(SymbolId symbol) noexcept {
+        if (region_ == nullptr) {
+            return nullptr;
+        }
+        detail::SharedBookHeader* h = header();
+        uint32_t index = h->directory[symbol].load(std::memory_order_relaxed);
+        if (index == 0) {
+            const uint32_t count = h->slot_count.load(std::memory_order_relaxed);
+            if (count == h->capacity) {
+                return nullptr;
+            }
+            index = count + 1;
+            slotAt(count)->symbol = symbol;
+            h->slot_count.store(index, std::memory_order_release);
+            // Readers find the slot only once its symbol is set; its sequence stays 0 until the first publication
+            h->directory[symbol].store(static_cast<uint16_t>(index), std::memory_order_release);
+        }
+        return slotAt(index - 1);
+    }
+
+    [[nodiscard]] detail::SharedBookSlot* slotAt(std::size_t index) const noexcept {
+        return reinterpret_cast<detail::SharedBookSlot*>(region_ + detail::sharedBookHeaderSize() +
+                                                         index * header()->slot_stride);
+    }
+
+    template<typename Book>
+    static std::size_t copyLevels(const Book& book, Side side, std::span<detail::PriceLevelL2> out) {
+        if constexpr (requires { book.getLevelsL2(side, out); }) {
+            return book.getLevelsL2(side, out);
+        } else if constexpr (std::is_same_v<typename Book::Level, detail::PriceLevelL2>) {
+            return book.getLevels(side, out);
+        } else {
+            // Narrow fixed-point levels: copy out, then widen. The scratch grows once to the depth.
+            thread_local std::vector<typename Book::Level> scratch;
+            scratch.resize(std::max(scratch.size(), out.size()));
+            const std::size_t count = book.getLevels(side, std::span(scratch.data(), out.size()));
+            std::transform(scratch.begin(), scratch.begin() + static_cast<std::ptrdiff_t>(count), out.begin(),
+                           [](const auto& level) { return detail::widenLevel(level); });
+            return count;
+        }
+    }
+
+    std::string name_;              // Shared memory object name
+    std::byte* region_ = nullptr;   // Mapped region
+    std::size_t size_ = 0;          // Region size in bytes
+};
+
+/// Read-only attachment to a region created by SharedBookPublisher
+///
+/// Reads are lock-free copies under each slot's sequence lock, consistent within a symbol: the top of
+/// book and the depth come from the same publication. Any number of readers in any number of processes.
+/// A reader spins only while the writer is in the middle of publishing that symbol.
+///
+/// Usage:
+/// @code
+/// SharedBookReader reader;
+/// if (reader.open("/md-books")) {
+///     if (auto tob = reader.readTopOfBook(symbol)) { ... }
+///     DepthSnapshot<10> depth;
+///     reader.readDepth(symbol, depth);
+/// }
+/// @endcode
+class SharedBookReader {
+public:
+    SharedBookReader() = default;
+    ~SharedBookReader() { close(); }
+
+    SharedBookReader(const SharedBookReader&) = delete;
+    SharedBookReader& operator=(const SharedBookReader&) = delete;
+
+    SharedBookReader(SharedBookReader&& other) noexcept
+        : region_(std::exchange(other.region_, nullptr)),
+          size_(std::exchange(other.size_, 0)) {}
+
+    SharedBookReader& operator=(SharedBookReader&& other) noexcept {
+        if (this != &other) {
+            close();
+            region_ = std::exchange(other.region_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    /// Attach to a region
+    /// @param name Shared memory object name passed to SharedBookPublisher::create()
+    /// @return true if the region exists, is initialized and has a layout this reader understands
+    bool open(const std::string& name) {
+        close();
+#if defined(__linux__)
+        const int fd = ::shm_open(name.c_str(), O_RDONLY | O_CLOEXEC, 0);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < detail::sharedBookHeaderSize()) {
+            ::close(fd);
+            return false;
+        }
+        const auto size = static_cast<std::size_t>(st.st_size);
+        void* memory = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (memory == MAP_FAILED) {
+            return false;
+        }
+        region_ = static_cast<const std::byte*>(memory);
+        size_ = size;
+
+        const detail::SharedBookHeader* h = header();
+        if (h->magic.load(std::memory_order_acquire) != detail::SharedBookHeader::kMagic ||
+            h->version != detail::SharedBookHeader::kVersion || h->region_size != size ||
+            h->slot_stride != detail::sharedBookSlotStride(h->depth) ||
+            detail::sharedBookHeaderSize() + std::size_t{h->capacity} * h->slot_stride != size) {
+            close();
+            return false;
+        }
+        return true;
+#else
+        (void)name;
+        return false;
+#endif
+    }
+
+    /// Detach
+    void close() noexcept {
+#if defined(__linux__)
+        if (region_ != nullptr) {
+            ::munmap(const_cast<std::byte*>(region_), size_);
+        }
+#endif
+        region_ = nullptr;
+        size_ = 0;
+    }
+
+    /// Check if attached
+    [[nodiscard]] bool isOpen() const noexcept { return region_ != nullptr; }
+
+    /// Get levels published per side
+    [[nodiscard]] std::size_t depth() const noexcept { return region_ ? header()->depth : 0; }
+
+    /// Get number of symbols published so far
+    [[nodiscard]] std::size_t symbolCount() const noexcept {
+        return region_ ? header()->slot_count.load(std::memory_order_acquire) : 0;
+    }
+
+    /// Check if a symbol has a slot
+    [[nodiscard]] bool hasSymbol(SymbolId symbol) const noexcept { return slotFor(symbol) != nullptr; }
+
+    /// Get number of publications of a symbol (0 = not published)
+    /// Cheap to poll: a reader can skip copying a symbol whose version has not moved.
+    [[nodiscard]] uint64_t version(SymbolId symbol) const noexcept {
+        const detail::SharedBookSlot* slot = slotFor(symbol);
+        return slot ? slot->seq.load(std::memory_order_acquire) / 2 : 0;
+    }
+
+    /// Read a symbol's top of book
+    /// @return Top of book, or std::nullopt if the symbol was never published
+    [[nodiscard]] std::optional<TopOfBook> readTopOfBook(SymbolId symbol) const noexcept {
+        const detail::SharedBookSlot* slot = publishedSlotFor(symbol);
+        if (slot == nullptr) {
+            return std::nullopt;
+        }
+        TopOfBook top;
+        readSlot(*slot, [&] { top = slot->top; });
+        return top;
+    }
+
+    /// Read a symbol's depth and top of book from the same publication
+    /// Copies min(N, depth()) levels per side.
+    /// @param symbol Symbol to read
+    /// @param out Receives the levels (version = number of publications)
+    /// @param top Receives the top of book (optional)
+    /// @return false if the symbol was never published
+    template<std::size_t N>
+    bool readDepth(SymbolId symbol, DepthSnapshot<N>& out, TopOfBook* top = nullptr) const noexcept {
+        const detail::SharedBookSlot* slot = publishedSlotFor(symbol);
+        if (slot == nullptr) {
+            return false;
+        }
+        const std::size_t depth = header()->depth;
+        const std::size_t capacity = std::min(N, depth);
+        const detail::PriceLevelL2* levels = slot->levels();
+        out.version = readSlot(*slot, [&] {
+            // Counts may be torn mid-write; clamping keeps the copy in bounds until the retry
+            out.bid_count = std::min<std::size_t>(slot->bid_count, capacity);
+            out.ask_count = std::min<std::size_t>(slot->ask_count, capacity);
+            std::copy_n(levels, out.bid_count, out.bids.begin());
+            std::copy_n(levels + depth, out.ask_count, out.asks.begin());
+            out.timestamp = slot->top.timestamp;
+            out.seq_num = slot->seq_num;
+            if (top != nullptr) {
+                *top = slot->top;
+            }
+        });
+        return true;
+    }
+
+private:
+    [[nodiscard]] const detail::SharedBookHeader* header() const noexcept {
+        return reinterpret_cast<const detail::SharedBookHeader*>(region_);
+    }
+
+    [[nodiscard]] const detail::SharedBookSlot* slotFor(SymbolId symbol) const noexcept {
+        if (region_ == nullptr) {
+            return nullptr;
+        }
+        const detail::SharedBookHeader* h = header();
+        const uint32_t index = h->directory[symbol].load(std::memory_order_acquire);
+        if (index == 0 || index > h->capacity) {
+            return nullptr;
+        }
+        return reinterpret_cast<const detail::SharedBookSlot*>(region_ + detail::sharedBookHeaderSize() +
+                                                               (index - 1) * h->slot_stride);
+    }
+
+    /// Find the symbol's slot once its first publication has started
+    /// A slot enters the directory before it is first written; its sequence only leaves 0 then.
+    [[nodiscard]] const detail::SharedBookSlot* publishedSlotFor(SymbolId symbol) const noexcept {
+        const detail::SharedBookSlot* slot = slotFor(symbol);
+        return slot != nullptr && slot->seq.load(std::memory_order_acquire) != 0 ? slot : nullptr;
+    }
+
+    /// Run copy until it sees a single publication; returns the publication count
+    template<typename Copy>
+    static uint64_t readSlot(const detail::SharedBookSlot& slot, Copy&& copy) noexcept {
+        uint64_t seq1, seq2;
+        do {
+            seq1 = slot.seq.load(std::memory_order_acquire);
+            // If seq1 is odd, writer is in progress, spin
+            while (seq1 & 1) {
+                seq1 = slot.seq.load(std::memory_order_acquire);
+            }
+            copy();
+            // Slot reads complete before re-checking the sequence
+            std::atomic_thread_fence(std::memory_order_acquire);
+            seq2 = slot.seq.load(std::memory_order_relaxed);
+        } while (seq1 != seq2);
+        return seq1 / 2;
+    }
+
+    const std::byte* region_ = nullptr;     // Mapped region (read-only)
+    std::size_t size_ = 0;                  // Region size in bytes
+};
+
+SLICK_NAMESPACE_END
@@ -4,9 +4,12 @@
 #pragma once
 
 #include <slick/orderbook/config.hpp>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <string_view>
 #include <limits>
+#include <utility>
 
 SLICK_NAMESPACE_BEGIN
 
@@ -29,6 +32,52 @@ using SymbolId = uint16_t;
 /// Timestamp in nanoseconds since epoch
 using Timestamp = uint64_t;
 
+/// Stored width and decimal scale of prices and quantities (book traits member FixedPoint)
+/// Books keep taking and reporting Price and Quantity; levels store P and Q, so every price and
+/// quantity of a book must fit them. The scales are compile-time constants: converting for display
+/// is a multiplication by a constant reciprocal.
+/// @tparam P Stored price type
+/// @tparam Q Stored quantity type
+/// @tparam PriceScale Price units per 1.0 (e.g. 10000 for 4 decimal places)
+/// @tparam QuantityScale Quantity units per 1.0
+template<std::signed_integral P = Price, std::signed_integral Q = Quantity,
+         int64_t PriceScale = 1, int64_t QuantityScale = 1>
+struct FixedPoint {
+    static_assert(PriceScale > 0 && QuantityScale > 0, "Scales must be positive");
+
+    using price_type = P;
+    using quantity_type = Q;
+    static constexpr int64_t price_scale = PriceScale;
+    static constexpr int64_t quantity_scale = QuantityScale;
+
+    /// Convert a price to its decimal value
+    [[nodiscard]] static constexpr double toDouble(Price price) noexcept {
+        return static_cast<double>(price) * (1.0 / static_cast<double>(PriceScale));
+    }
+
+    /// Convert a decimal value to the nearest price
+    [[nodiscard]] static constexpr Price fromDouble(double value) noexcept {
+        const double scaled = value * static_cast<double>(PriceScale);
+        return static_cast<Price>(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+    }
+
+    /// Convert a quantity to its decimal value
+    [[nodiscard]] static constexpr double quantityToDouble(Quantity quantity) noexcept {
+        return static_cast<double>(quantity) * (1.0 / static_cast<double>(QuantityScale));
+    }
+
+    /// Convert a decimal value to the nearest quantity
+    [[nodiscard]] static constexpr Quantity quantityFromDouble(double value) noexcept {
+        const double scaled = value * static_cast<double>(QuantityScale);
+        return static_cast<Quantity>(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+    }
+
+    /// Check if a price and quantity fit the stored types
+    [[nodiscard]] static constexpr bool fits(Price price, Quantity quantity) noexcept {
+        return std::in_range<P>(price) && std::in_range<Q>(quantity);
+    }
+};
+
 constexpr uint16_t INVALID_INDEX = std::numeric_limits<uint16_t>::max();
 
 /// Order side - using enum for easy array indexing
@@ -46,6 +95,32 @@ enum class OrderType : uint8_t {
     StopLimit   // Stop-limit order
 };
 
+/// Time in force of an order submitted for matching (OrderBookL3::submitOrder)
+enum class TimeInForce : uint8_t {
+    Day,        // Rest the unfilled remainder on the book
+    IOC,        // Immediate or cancel: fill what crosses now, cancel the remainder
+    FOK         // Fill or kill: fill the whole quantity now or reject the order
+};
+
+/// Outcome of OrderBookL3::submitOrder() and submitStopOrder()
+enum class SubmitStatus : uint8_t {
+    Rejected,           // Not accepted (invalid, duplicate order id, out of sequence, FOK not fillable)
+    Filled,             // Fully filled
+    PartiallyFilled,    // Partially filled, the remainder rests on the book
+    Resting,            // Nothing crossed, the whole quantity rests on the book
+    Cancelled,          // Remainder cancelled (IOC, or a market order that exhausted the book)
+    Pending             // Stop order waiting for its trigger price
+};
+
+/// Result of OrderBookL3::submitOrder() and submitStopOrder()
+struct SubmitResult {
+    SubmitStatus status = SubmitStatus::Rejected;
+    Quantity filled_quantity = 0;       // Quantity traded against resting orders
+    Quantity remaining_quantity = 0;    // Quantity left resting, cancelled or pending
+    uint32_t trade_count = 0;           // Resting orders traded against
+    uint32_t triggered_stops = 0;       // Stop orders triggered by these trades (and the trades they caused)
+};
+
 /// Symbol information
 struct Symbol {
     SymbolId id;               // Unique identifier
@@ -64,6 +139,86 @@ struct Symbol {
     }
 };
 
+/// Resting order in an exchange snapshot (input to OrderBookL3::loadSnapshot)
+struct SnapshotOrder {
+    OrderId order_id;           // Unique order identifier
+    Side side;                  // Buy or Sell
+    Price price;                // Order price
+    Quantity quantity;          // Remaining quantity (orders with quantity <= 0 are skipped)
+    Timestamp timestamp;        // Order timestamp
+    uint64_t priority = 0;      // Queue priority (0 = use timestamp, as in addOrder)
+};
+
+/// Place of a resting order in its price level queue (OrderBookL3::queuePosition)
+struct QueuePosition {
+    std::size_t orders_ahead = 0;   // Orders at the same price with better priority
+    Quantity quantity_ahead = 0;    // Their total quantity
+};
+
+/// Order statistics of an L3 price level, maintained as orders come and go (OrderBookL3::getLevelSummary)
+struct LevelSummary {
+    Quantity total_quantity = 0;        // Total quantity resting at the level
+    uint32_t order_count = 0;           // Orders resting at the level
+    Quantity max_order_quantity = 0;    // Largest resting order (0 = empty level)
+    Timestamp oldest_timestamp = 0;     // Earliest timestamp of a resting order (0 = empty level)
+};
+
+/// Decoded L2 market data message (input to OrderBookEngine)
+struct L2Update {
+    Timestamp timestamp;        // Update timestamp
+    uint64_t seq_num = 0;       // Exchange sequence number (0 = no tracking)
+    Price price;                // Price level
+    Quantity quantity;          // Total quantity at this level (0 = delete)
+    SymbolId symbol;            // Book the update applies to
+    Side side;                  // Buy or Sell
+};
+
+/// L3 message kind
+enum class L3UpdateType : uint8_t {
+    Add,        // New order (addOrder)
+    Modify,     // Price and/or quantity change (modifyOrder)
+    Delete,     // Order removal (deleteOrder)
+    Execute     // Partial or full fill (executeOrder)
+};
+
+/// Decoded L3 market data message (input to OrderBookEngine)
+struct L3Update {
+    Timestamp timestamp;        // Update timestamp
+    uint64_t seq_num = 0;       // Exchange sequence number (0 = no tracking)
+    uint64_t priority = 0;      // Queue priority for Add/Modify (0 = use timestamp)
+    OrderId order_id;           // Order identifier
+    Price price = 0;            // Order price (Add/Modify)
+    Quantity quantity = 0;      // New quantity (Add/Modify) or executed quantity (Execute)
+    SymbolId symbol;            // Book the update applies to
+    Side side = Buy;            // Buy or Sell (Add)
+    L3UpdateType type;          // Which book operation to apply
+};
+
+/// Configuration for tick-indexed price ladders (PriceLadder level containers)
+struct PriceLadderConfig {
+    Price tick_size = 1;            // Minimum price increment; all prices must lie on the tick grid
+    std::size_t num_ticks = 4096;   // Initial ladder width per side in ticks (grows when exceeded)
+    std::size_t max_ticks = std::size_t{1} << 18;  // Widest the ladder grows; prices beyond it are rejected
+};
+
+/// Page backing for pooled memory (see MemoryConfig)
+enum class PageSize : uint8_t {
+    Default,        // Heap allocation (operator new)
+    Transparent,    // Anonymous mmap advised for transparent huge pages (madvise(MADV_HUGEPAGE))
+    Huge,           // mmap(MAP_HUGETLB) from the reserved huge page pool; falls back to Transparent
+};
+
+/// Placement of pooled memory (order pools of L3 books)
+/// Anything but the default maps blocks with mmap (Linux only; other platforms use the heap).
+/// Mapped blocks are rounded up to whole pages. ObjectPool threads its free list through each new block,
+/// so reserved capacity is resident before the first update either way; prefault populates a block in
+/// one madvise call instead of one fault per page
+struct MemoryConfig {
+    PageSize page_size = PageSize::Default; // Page backing of pool blocks
+    int numa_node = -1;                     // Bind blocks to this NUMA node with mbind (-1 = no binding)
+    bool prefault = false;                  // Populate each block on its bound node when it is mapped
+};
+
 /// Helper functions for Side enum
 
 [[nodiscard]] constexpr const char* toString(Side side) noexcept {
@@ -90,4 +245,16 @@ struct Symbol {
     }
 }
 
+/// Helper functions for L3UpdateType enum
+
+[[nodiscard]] constexpr const char* toString(L3UpdateType type) noexcept {
+    switch (type) {
+        case L3UpdateType::Add:     return "Add";
+        case L3UpdateType::Modify:  return "Modify";
+        case L3UpdateType::Delete:  return "Delete";
+        case L3UpdateType::Execute: return "Execute";
+        default:                    return "Unknown";
+    }
+}
+
 SLICK_NAMESPACE_END
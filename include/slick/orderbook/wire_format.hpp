@@ -0,0 +1,403 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <slick/orderbook/config.hpp>
+#include <slick/orderbook/types.hpp>
+#include <slick/orderbook/events.hpp>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+
+SLICK_NAMESPACE_BEGIN
+
+/// Wire layouts of book events
+///
+/// Every message starts with an 8-byte header, followed by the event fields at fixed offsets. All integers
+/// are little-endian, there is no implicit padding and reserved bytes are written as zero. Messages are
+/// multiples of 8 bytes, so 8-byte aligned messages keep every field naturally aligned.
+///
+///   Header          offset  size
+///   length          0       2     Message size in bytes, header included
+///   type            2       1     WireType
+///   version         3       1     kWireVersion
+///   symbol          4       2     SymbolId
+///   reserved        6       2
+///
+/// A version change means an incompatible layout. Within a version, fields may only be appended: decoders
+/// accept a length at least the size they know and skip the rest.
+
+/// Layout version written by encodeWire()
+inline constexpr uint8_t kWireVersion = 1;
+
+/// Event carried by a wire message
+enum class WireType : uint8_t {
+    PriceLevelUpdate = 1,
+    OrderUpdate = 2,
+    TopOfBook = 3,
+    Trade = 4
+};
+
+/// Decoded message header
+struct WireHeader {
+    static constexpr std::size_t kSize = 8;
+
+    uint16_t length = 0;        // Message size in bytes, header included
+    WireType type{};            // Event carried
+    uint8_t version = 0;        // Layout version
+    SymbolId symbol = 0;        // Symbol identifier
+};
+
+SLICK_NAMESPACE_END
+
+SLICK_DETAIL_NAMESPACE_BEGIN
+
+template<std::integral T>
+SLICK_FORCE_INLINE void storeLittleEndian(std::byte* out, T value) noexcept {
+    if constexpr (std::endian::native == std::endian::big) {
+        value = std::byteswap(value);
+    }
+    std::memcpy(out, &value, sizeof(T));
+}
+
+template<std::integral T>
+[[nodiscard]] SLICK_FORCE_INLINE T loadLittleEndian(const std::byte* in) noexcept {
+    T value;
+    std::memcpy(&value, in, sizeof(T));
+    if constexpr (std::endian::native == std::endian::big) {
+        value = std::byteswap(value);
+    }
+    return value;
+}
+
+/// Write a message header and zero the reserved bytes
+SLICK_FORCE_INLINE void storeWireHeader(std::byte* out, uint16_t length, WireType type, SymbolId symbol) noexcept {
+    storeLittleEndian<uint16_t>(out, length);
+    storeLittleEndian<uint8_t>(out + 2, static_cast<uint8_t>(type));
+    storeLittleEndian<uint8_t>(out + 3, kWireVersion);
+    storeLittleEndian<uint16_t>(out + 4, symbol);
+    storeLittleEndian<uint16_t>(out + 6, 0);
+}
+
+/// Field offsets and size of each event's layout
+struct PriceLevelUpdateLayout {
+    static constexpr WireType kType = WireType::PriceLevelUpdate;
+    static constexpr std::size_t kTimestamp = 8;    // u64
+    static constexpr std::size_t kSeqNum = 16;      // u64
+    static constexpr std::size_t kPrice = 24;       // i64
+    static constexpr std::size_t kQuantity = 32;    // i64
+    static constexpr std::size_t kLevelIndex = 40;  // u16
+    static constexpr std::size_t kChangeFlags = 42; // u8
+    static constexpr std::size_t kSide = 43;        // u8
+    static constexpr std::size_t kNumOrders = 44;   // u32
+    static constexpr std::size_t kMaxOrderQuantity = 48;    // i64
+    static constexpr std::size_t kOldestTimestamp = 56;     // u64
+    static constexpr std::size_t kSize = 64;
+};
+
+struct OrderUpdateLayout {
+    static constexpr WireType kType = WireType::OrderUpdate;
+    static constexpr std::size_t kTimestamp = 8;        // u64
+    static constexpr std::size_t kSeqNum = 16;          // u64
+    static constexpr std::size_t kOrderId = 24;         // u64
+    static constexpr std::size_t kPrice = 32;           // i64
+    static constexpr std::size_t kQuantity = 40;        // i64
+    static constexpr std::size_t kOldPrice = 48;        // i64
+    static constexpr std::size_t kOldQuantity = 56;     // i64
+    static constexpr std::size_t kPriority = 64;        // u64
+    static constexpr std::size_t kPriceLevelIndex = 72; // u16
+    static constexpr std::size_t kSide = 74;            // u8
+    static constexpr std::size_t kChangeFlags = 75;     // u8, then 4 reserved bytes
+    static constexpr std::size_t kSize = 80;
+};
+
+struct TopOfBookLayout {
+    static constexpr WireType kType = WireType::TopOfBook;
+    static constexpr std::size_t kTimestamp = 8;        // u64
+    static constexpr std::size_t kBestBid = 16;         // i64
+    static constexpr std::size_t kBidQuantity = 24;     // i64
+    static constexpr std::size_t kBestAsk = 32;         // i64
+    static constexpr std::size_t kAskQuantity = 40;     // i64
+    static constexpr std::size_t kChangeFlags = 48;     // u8[2] (bid, ask), then 6 reserved bytes
+    static constexpr std::size_t kSize = 56;
+};
+
+struct TradeLayout {
+    static constexpr WireType kType = WireType::Trade;
+    static constexpr std::size_t kTimestamp = 8;            // u64
+    static constexpr std::size_t kPrice = 16;               // i64
+    static constexpr std::size_t kQuantity = 24;            // i64
+    static constexpr std::size_t kAggressiveOrderId = 32;   // u64
+    static constexpr std::size_t kPassiveOrderId = 40;      // u64
+    static constexpr std::size_t kAggressorSide = 48;       // u8
+    static constexpr std::size_t kChangeFlags = 49;         // u8, then 6 reserved bytes
+    static constexpr std::size_t kSize = 56;
+};
+
+/// Common part of the message views: checks the header and reads fields in place
+template<typename Layout>
+class WireView {
+public:
+    static constexpr std::size_t kSize = Layout::kSize;
+
+    [[nodiscard]] SymbolId symbol() const noexcept { return loadLittleEndian<uint16_t>(data_ + 4); }
+
+    /// Get the message bytes (the whole message, including fields appended by later layouts)
+    [[nodiscard]] std::span<const std::byte> bytes() const noexcept {
+        return {data_, loadLittleEndian<uint16_t>(data_)};
+    }
+
+protected:
+    explicit WireView(const std::byte* data) noexcept : data_(data) {}
+
+    /// Check that a buffer starts with a complete message of this layout
+    [[nodiscard]] static bool matches(std::span<const std::byte> message) noexcept {
+        if (message.size() < kSize) {
+            return false;
+        }
+        const uint16_t length = loadLittleEndian<uint16_t>(message.data());
+        return loadLittleEndian<uint8_t>(message.data() + 2) == static_cast<uint8_t>(Layout::kType) &&
+               loadLittleEndian<uint8_t>(message.data() + 3) == kWireVersion &&
+               length >= kSize && length <= message.size();
+    }
+
+    template<std::integral T>
+    [[nodiscard]] T field(std::size_t offset) const noexcept {
+        return loadLittleEndian<T>(data_ + offset);
+    }
+
+    const std::byte* data_;
+};
+
+SLICK_DETAIL_NAMESPACE_END
+
+SLICK_NAMESPACE_BEGIN
+
+/// Read the header of the message at the start of a buffer
+/// @return Header, or std::nullopt if the buffer holds less than the header or than the message length,
+///         or the version is not kWireVersion
+[[nodiscard]] inline std::optional<WireHeader> readWireHeader(std::span<const std::byte> buffer) noexcept {
+    if (buffer.size() < WireHeader::kSize) {
+        return std::nullopt;
+    }
+    WireHeader header;
+    header.length = detail::loadLittleEndian<uint16_t>(buffer.data());
+    header.type = static_cast<WireType>(detail::loadLittleEndian<uint8_t>(buffer.data() + 2));
+    header.version = detail::loadLittleEndian<uint8_t>(buffer.data() + 3);
+    header.symbol = detail::loadLittleEndian<uint16_t>(buffer.data() + 4);
+    if (header.version != kWireVersion || header.length < WireHeader::kSize || header.length > buffer.size()) {
+        return std::nullopt;
+    }
+    return header;
+}
+
+/// Get the wire size of an event type
+template<typename Event>
+inline constexpr std::size_t kWireSize = 0;
+template<> inline constexpr std::size_t kWireSize<PriceLevelUpdate> = detail::PriceLevelUpdateLayout::kSize;
+template<> inline constexpr std::size_t kWireSize<OrderUpdate> = detail::OrderUpdateLayout::kSize;
+template<> inline constexpr std::size_t kWireSize<TopOfBook> = detail::TopOfBookLayout::kSize;
+template<> inline constexpr std::size_t kWireSize<Trade> = detail::TradeLayout::kSize;
+
+/// Encode an event into a caller buffer
+/// @return Bytes written (kWireSize of the event), or 0 if the buffer is too small
+inline std::size_t encodeWire(const PriceLevelUpdate& update, std::span<std::byte> out) noexcept {
+    using L = detail::PriceLevelUpdateLayout;
+    if (out.size() < L::kSize) {
+        return 0;
+    }
+    std::byte* p = out.data();
+    detail::storeWireHeader(p, L::kSize, L::kType, update.symbol);
+    detail::storeLittleEndian<uint64_t>(p + L::kTimestamp, update.timestamp);
+    detail::storeLittleEndian<uint64_t>(p + L::kSeqNum, update.seq_num);
+    detail::storeLittleEndian<int64_t>(p + L::kPrice, update.price);
+    detail::storeLittleEndian<int64_t>(p + L::kQuantity, update.quantity);
+    detail::storeLittleEndian<uint16_t>(p + L::kLevelIndex, update.level_index);
+    detail::storeLittleEndian<uint8_t>(p + L::kChangeFlags, update.change_flags);
+    detail::storeLittleEndian<uint8_t>(p + L::kSide, update.side);
+    detail::storeLittleEndian<uint32_t>(p + L::kNumOrders, update.num_orders);
+    detail::storeLittleEndian<int64_t>(p + L::kMaxOrderQuantity, update.max_order_quantity);
+    detail::storeLittleEndian<uint64_t>(p + L::kOldestTimestamp, update.oldest_timestamp);
+    return L::kSize;
+}
+
+inline std::size_t encodeWire(const OrderUpdate& update, std::span<std::byte> out) noexcept {
+    using L = detail::OrderUpdateLayout;
+    if (out.size() < L::kSize) {
+        return 0;
+    }
+    std::byte* p = out.data();
+    detail::storeWireHeader(p, L::kSize, L::kType, update.symbol);
+    detail::storeLittleEndian<uint64_t>(p + L::kTimestamp, update.timestamp);
+    detail::storeLittleEndian<uint64_t>(p + L::kSeqNum, update.seq_num);
+    detail::storeLittleEndian<uint64_t>(p + L::kOrderId, update.order_id);
+    detail::storeLittleEndian<int64_t>(p + L::kPrice, update.price);
+    detail::storeLittleEndian<int64_t>(p + L::kQuantity, update.quantity);
+    detail::storeLittleEndian<int64_t>(p + L::kOldPrice, update.old_price);
+    detail::storeLittleEndian<int64_t>(p + L::kOldQuantity, update.old_qty);
+    detail::storeLittleEndian<uint64_t>(p + L::kPriority, update.priority);
+    detail::storeLittleEndian<uint16_t>(p + L::kPriceLevelIndex, update.price_level_index);
+    detail::storeLittleEndian<uint8_t>(p + L::kSide, update.side);
+    detail::storeLittleEndian<uint8_t>(p + L::kChangeFlags, update.change_flags);
+    detail::storeLittleEndian<uint32_t>(p + L::kChangeFlags + 1, 0);
+    return L::kSize;
+}
+
+inline std::size_t encodeWire(const TopOfBook& tob, std::span<std::byte> out) noexcept {
+    using L = detail::TopOfBookLayout;
+    if (out.size() < L::kSize) {
+        return 0;
+    }
+    std::byte* p = out.data();
+    detail::storeWireHeader(p, L::kSize, L::kType, tob.symbol);
+    detail::storeLittleEndian<uint64_t>(p + L::kTimestamp, tob.timestamp);
+    detail::storeLittleEndian<int64_t>(p + L::kBestBid, tob.best_bid);
+    detail::storeLittleEndian<int64_t>(p + L::kBidQuantity, tob.bid_quantity);
+    detail::storeLittleEndian<int64_t>(p + L::kBestAsk, tob.best_ask);
+    detail::storeLittleEndian<int64_t>(p + L::kAskQuantity, tob.ask_quantity);
+    detail::storeLittleEndian<uint8_t>(p + L::kChangeFlags, tob.change_flags[0]);
+    detail::storeLittleEndian<uint8_t>(p + L::kChangeFlags + 1, tob.change_flags[1]);
+    std::memset(p + L::kChangeFlags + 2, 0, L::kSize - L::kChangeFlags - 2);
+    return L::kSize;
+}
+
+inline std::size_t encodeWire(const Trade& trade, std::span<std::byte> out) noexcept {
+    using L = detail::TradeLayout;
+    if (out.size() < L::kSize) {
+        return 0;
+    }
+    std::byte* p = out.data();
+    detail::storeWireHeader(p, L::kSize, L::kType, trade.symbol);
+    detail::storeLittleEndian<uint64_t>(p + L::kTimestamp, trade.timestamp);
+    detail::storeLittleEndian<int64_t>(p + L::kPrice, trade.price);
+    detail::storeLittleEndian<int64_t>(p + L::kQuantity, trade.quantity);
+    detail::storeLittleEndian<uint64_t>(p + L::kAggressiveOrderId, trade.aggressive_order_id);
+    detail::storeLittleEndian<uint64_t>(p + L::kPassiveOrderId, trade.passive_order_id);
+    detail::storeLittleEndian<uint8_t>(p + L::kAggressorSide, trade.aggressor_side);
+    detail::storeLittleEndian<uint8_t>(p + L::kChangeFlags, trade.change_flags);
+    std::memset(p + L::kChangeFlags + 1, 0, L::kSize - L::kChangeFlags - 1);
+    return L::kSize;
+}
+
+/// Read-only view of an encoded PriceLevelUpdate; fields are read from the buffer on access
+/// The view does not own the buffer, which must outlive it
+class PriceLevelUpdateView : public detail::WireView<detail::PriceLevelUpdateLayout> {
+    using L = detail::PriceLevelUpdateLayout;
+
+public:
+    /// View the message at the start of a buffer
+    /// @return View, or std::nullopt if the buffer does not start with a complete PriceLevelUpdate message
+    [[nodiscard]] static std::optional<PriceLevelUpdateView> decode(std::span<const std::byte> message) noexcept {
+        return matches(message) ? std::optional(PriceLevelUpdateView(message.data())) : std::nullopt;
+    }
+
+    [[nodiscard]] Timestamp timestamp() const noexcept { return field<uint64_t>(L::kTimestamp); }
+    [[nodiscard]] uint64_t seqNum() const noexcept { return field<uint64_t>(L::kSeqNum); }
+    [[nodiscard]] Price price() const noexcept { return field<int64_t>(L::kPrice); }
+    [[nodiscard]] Quantity quantity() const noexcept { return field<int64_t>(L::kQuantity); }
+    [[nodiscard]] uint16_t levelIndex() const noexcept { return field<uint16_t>(L::kLevelIndex); }
+    [[nodiscard]] uint32_t numOrders() const noexcept { return field<uint32_t>(L::kNumOrders); }
+    [[nodiscard]] Quantity maxOrderQuantity() const noexcept { return field<int64_t>(L::kMaxOrderQuantity); }
+    [[nodiscard]] Timestamp oldestTimestamp() const noexcept { return field<uint64_t>(L::kOldestTimestamp); }
+    [[nodiscard]] uint8_t changeFlags() const noexcept { return field<uint8_t>(L::kChangeFlags); }
+    [[nodiscard]] Side side() const noexcept { return static_cast<Side>(field<uint8_t>(L::kSide)); }
+
+    /// Copy the fields into an event
+    [[nodiscard]] PriceLevelUpdate event() const noexcept {
+        return PriceLevelUpdate(timestamp(), symbol(), side(), price(), quantity(), numOrders(), levelIndex(),
+                                changeFlags(), seqNum(), maxOrderQuantity(), oldestTimestamp());
+    }
+
+private:
+    using WireView::WireView;
+};
+
+/// Read-only view of an encoded OrderUpdate (see PriceLevelUpdateView)
+class OrderUpdateView : public detail::WireView<detail::OrderUpdateLayout> {
+    using L = detail::OrderUpdateLayout;
+
+public:
+    [[nodiscard]] static std::optional<OrderUpdateView> decode(std::span<const std::byte> message) noexcept {
+        return matches(message) ? std::optional(OrderUpdateView(message.data())) : std::nullopt;
+    }
+
+    [[nodiscard]] Timestamp timestamp() const noexcept { return field<uint64_t>(L::kTimestamp); }
+    [[nodiscard]] uint64_t seqNum() const noexcept { return field<uint64_t>(L::kSeqNum); }
+    [[nodiscard]] OrderId orderId() const noexcept { return field<uint64_t>(L::kOrderId); }
+    [[nodiscard]] Price price() const noexcept { return field<int64_t>(L::kPrice); }
+    [[nodiscard]] Quantity quantity() const noexcept { return field<int64_t>(L::kQuantity); }
+    [[nodiscard]] Price oldPrice() const noexcept { return field<int64_t>(L::kOldPrice); }
+    [[nodiscard]] Quantity oldQuantity() const noexcept { return field<int64_t>(L::kOldQuantity); }
+    [[nodiscard]] uint64_t priority() const noexcept { return field<uint64_t>(L::kPriority); }
+    [[nodiscard]] uint16_t priceLevelIndex() const noexcept { return field<uint16_t>(L::kPriceLevelIndex); }
+    [[nodiscard]] Side side() const noexcept { return static_cast<Side>(field<uint8_t>(L::kSide)); }
+    [[nodiscard]] uint8_t changeFlags() const noexcept { return field<uint8_t>(L::kChangeFlags); }
+
+    [[nodiscard]] OrderUpdate event() const noexcept {
+        return OrderUpdate(symbol(), orderId(), side(), price(), quantity(), oldPrice(), oldQuantity(), timestamp(),
+                           priceLevelIndex(), priority(), changeFlags(), seqNum());
+    }
+
+private:
+    using WireView::WireView;
+};
+
+/// Read-only view of an encoded TopOfBook (see PriceLevelUpdateView)
+class TopOfBookView : public detail::WireView<detail::TopOfBookLayout> {
+    using L = detail::TopOfBookLayout;
+
+public:
+    [[nodiscard]] static std::optional<TopOfBookView> decode(std::span<const std::byte> message) noexcept {
+        return matches(message) ? std::optional(TopOfBookView(message.data())) : std::nullopt;
+    }
+
+    [[nodiscard]] Timestamp timestamp() const noexcept { return field<uint64_t>(L::kTimestamp); }
+    [[nodiscard]] Price bestBid() const noexcept { return field<int64_t>(L::kBestBid); }
+    [[nodiscard]] Quantity bidQuantity() const noexcept { return field<int64_t>(L::kBidQuantity); }
+    [[nodiscard]] Price bestAsk() const noexcept { return field<int64_t>(L::kBestAsk); }
+    [[nodiscard]] Quantity askQuantity() const noexcept { return field<int64_t>(L::kAskQuantity); }
+    /// Change flags of the bid (side 0) or ask (side 1)
+    [[nodiscard]] uint8_t changeFlags(Side side) const noexcept { return field<uint8_t>(L::kChangeFlags + side); }
+
+    [[nodiscard]] TopOfBook event() const noexcept {
+        TopOfBook tob(symbol(), bestBid(), bidQuantity(), bestAsk(), askQuantity(), timestamp());
+        tob.change_flags = {changeFlags(Side::Buy), changeFlags(Side::Sell)};
+        return tob;
+    }
+
+private:
+    using WireView::WireView;
+};
+
+/// Read-only view of an encoded Trade (see PriceLevelUpdateView)
+class TradeView : public detail::WireView<detail::TradeLayout> {
+    using L = detail::TradeLayout;
+
+public:
+    [[nodiscard]] static std::optional<TradeView> decode(std::span<const std::byte> message) noexcept {
+        return matches(message) ? std::optional(TradeView(message.data())) : std::nullopt;
+    }
+
+    [[nodiscard]] Timestamp timestamp() const noexcept { return field<uint64_t>(L::kTimestamp); }
+    [[nodiscard]] Price price() const noexcept { return field<int64_t>(L::kPrice); }
+    [[nodiscard]] Quantity quantity() const noexcept { return field<int64_t>(L::kQuantity); }
+    [[nodiscard]] OrderId aggressiveOrderId() const noexcept { return field<uint64_t>(L::kAggressiveOrderId); }
+    [[nodiscard]] OrderId passiveOrderId() const noexcept { return field<uint64_t>(L::kPassiveOrderId); }
+    [[nodiscard]] Side aggressorSide() const noexcept { return static_cast<Side>(field<uint8_t>(L::kAggressorSide)); }
+    [[nodiscard]] uint8_t changeFlags() const noexcept { return field<uint8_t>(L::kChangeFlags); }
+
+    [[nodiscard]] Trade event() const noexcept {
+        return Trade(symbol(), price(), quantity(), timestamp(), aggressorSide(), passiveOrderId(), aggressiveOrderId(),
+                     changeFlags());
+    }
+
+private:
+    using WireView::WireView;
+};
+
+SLICK_NAMESPACE_END
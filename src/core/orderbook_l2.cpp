@@ -6,3 +6,13 @@
 #define SLICK_OB_INLINE
 #include <slick/orderbook/detail/impl/orderbook_l2_impl.hpp>
 #undef SLICK_OB_INLINE
+
+SLICK_NAMESPACE_BEGIN
+
+// Explicit template instantiations for compiled library mode
+template class BasicOrderBookL2<DefaultOrderBookL2Traits>;
+template class BasicOrderBookL2<LadderOrderBookL2Traits>;
+template class BasicOrderBookL2<SoaOrderBookL2Traits>;
+template class BasicOrderBookL2<FixedPointOrderBookL2Traits<FixedPoint<int32_t, int32_t>>>;
+
+SLICK_NAMESPACE_END
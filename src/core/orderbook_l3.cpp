@@ -6,3 +6,14 @@
 #define SLICK_OB_INLINE
 #include <slick/orderbook/detail/impl/orderbook_l3_impl.hpp>
 #undef SLICK_OB_INLINE
+
+SLICK_NAMESPACE_BEGIN
+
+// Explicit template instantiations for compiled library mode
+template class BasicOrderBookL3<DefaultOrderBookL3Traits>;
+template class BasicOrderBookL3<DirectIndexedOrderBookL3Traits<>>;
+template class BasicOrderBookL3<LadderOrderBookL3Traits>;
+template class BasicOrderBookL3<CompactOrderBookL3Traits>;
+template class BasicOrderBookL3<PooledLevelOrderBookL3Traits>;
+
+SLICK_NAMESPACE_END
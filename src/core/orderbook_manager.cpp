@@ -10,5 +10,7 @@ SLICK_NAMESPACE_BEGIN
 // Explicit template instantiations for compiled library mode
 template class OrderBookManager<OrderBookL2>;
 template class OrderBookManager<OrderBookL3>;
+template class OrderBookManager<OrderBookL2, SymbolLookup::DirectTable>;
+template class OrderBookManager<OrderBookL3, SymbolLookup::DirectTable>;
 
 SLICK_NAMESPACE_END
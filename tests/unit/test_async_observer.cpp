@@ -0,0 +1,274 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/async_observer.hpp>
+#include <slick/orderbook/orderbook_l2.hpp>
+#include <slick/orderbook/orderbook_l3.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace slick::orderbook;
+using namespace slick::orderbook::detail;
+
+// ============================================================================
+// SPSCRing
+// ============================================================================
+
+TEST(SPSCRingTest, CapacityRoundsUpToPowerOfTwo) {
+    SPSCRing<int> ring(100);
+    EXPECT_EQ(ring.capacity(), 128);
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(SPSCRingTest, PushPopFifo) {
+    SPSCRing<int> ring(4);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(ring.tryPush(i));
+    }
+    EXPECT_FALSE(ring.tryPush(4));  // Full
+    EXPECT_EQ(ring.size(), 4);
+
+    int value = -1;
+    ASSERT_TRUE(ring.tryPop(value));
+    EXPECT_EQ(value, 0);
+    ASSERT_TRUE(ring.tryPush(4));   // Wraps around
+
+    for (int expected = 1; expected <= 4; ++expected) {
+        ASSERT_TRUE(ring.tryPop(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_FALSE(ring.tryPop(value));
+}
+
+TEST(SPSCRingTest, PushOverwriteEvictsOldest) {
+    SPSCRing<int> ring(4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_FALSE(ring.pushOverwrite(i));
+    }
+    EXPECT_TRUE(ring.pushOverwrite(4));
+    EXPECT_TRUE(ring.pushOverwrite(5));
+    EXPECT_EQ(ring.size(), 4);
+
+    int value = -1;
+    for (int expected = 2; expected <= 5; ++expected) {
+        ASSERT_TRUE(ring.tryPop(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(SPSCRingTest, ConcurrentProducerConsumer) {
+    constexpr uint64_t kCount = 200000;
+    SPSCRing<uint64_t> ring(256);
+
+    std::thread producer([&ring]() {
+        for (uint64_t i = 0; i < kCount; ++i) {
+            while (!ring.tryPush(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint64_t expected = 0;
+    uint64_t value = 0;
+    while (expected < kCount) {
+        if (ring.tryPop(value)) {
+            ASSERT_EQ(value, expected);
+            ++expected;
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(SPSCRingTest, ConcurrentOverwriteKeepsOrder) {
+    constexpr uint64_t kCount = 200000;
+    SPSCRing<uint64_t> ring(64);
+    std::atomic<bool> done{false};
+
+    std::thread producer([&ring, &done]() {
+        for (uint64_t i = 1; i <= kCount; ++i) {
+            ring.pushOverwrite(i);
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    // Values may be skipped (evicted) but never reordered or duplicated
+    uint64_t last = 0;
+    uint64_t value = 0;
+    while (!done.load(std::memory_order_acquire) || !ring.empty()) {
+        if (ring.tryPop(value)) {
+            ASSERT_GT(value, last);
+            last = value;
+        }
+    }
+    producer.join();
+    EXPECT_EQ(last, kCount);
+}
+
+// ============================================================================
+// AsyncObserverBridge
+// ============================================================================
+
+namespace {
+
+class RecordingObserver : public IOrderBookObserver {
+public:
+    std::vector<PriceLevelUpdate> level_updates;
+    std::vector<OrderUpdate> order_updates;
+    std::vector<TopOfBook> tob_updates;
+    std::vector<int> sequence;  // 0 = level, 1 = order, 2 = tob, 3 = snapshot begin, 4 = snapshot end
+
+    void onPriceLevelUpdate(const PriceLevelUpdate& update) override {
+        level_updates.push_back(update);
+        sequence.push_back(0);
+    }
+
+    void onOrderUpdate(const OrderUpdate& update) override {
+        order_updates.push_back(update);
+        sequence.push_back(1);
+    }
+
+    void onTopOfBookUpdate(const TopOfBook& tob) override {
+        tob_updates.push_back(tob);
+        sequence.push_back(2);
+    }
+
+    void onSnapshotBegin(SymbolId, uint64_t, Timestamp) override { sequence.push_back(3); }
+    void onSnapshotEnd(SymbolId, uint64_t, Timestamp) override { sequence.push_back(4); }
+};
+
+}  // namespace
+
+TEST(AsyncObserverBridgeTest, DeliversOnPoll) {
+    OrderBookL2 book(1);
+    auto bridge = std::make_shared<AsyncObserverBridge>();
+    auto observer = std::make_shared<RecordingObserver>();
+    bridge->addObserver(observer);
+    book.addObserver(bridge);
+
+    book.updateLevel(Side::Buy, 10000, 100, 1);
+    book.updateLevel(Side::Buy, 9900, 50, 2);
+    book.updateLevel(Side::Sell, 10100, 75, 3);
+
+    // Nothing is delivered on the producer thread
+    EXPECT_TRUE(observer->sequence.empty());
+    EXPECT_EQ(bridge->pending(), 5);
+
+    EXPECT_EQ(bridge->poll(), 5);
+    EXPECT_EQ(observer->sequence, (std::vector<int>{0, 2, 0, 0, 2}));
+    EXPECT_EQ(observer->level_updates[1].price, 9900);
+    EXPECT_EQ(observer->level_updates[1].level_index, 1);
+    EXPECT_EQ(observer->tob_updates.back().best_ask, 10100);
+
+    const auto stats = bridge->stats();
+    EXPECT_EQ(stats.enqueued, 5);
+    EXPECT_EQ(stats.delivered, 5);
+    EXPECT_EQ(stats.dropped, 0);
+    EXPECT_GE(stats.max_latency_ns, 1u);
+    EXPECT_GE(stats.meanLatencyNs(), 0.0);
+}
+
+TEST(AsyncObserverBridgeTest, PollRespectsMaxEvents) {
+    OrderBookL3 book(1);
+    auto bridge = std::make_shared<AsyncObserverBridge>();
+    auto observer = std::make_shared<RecordingObserver>();
+    bridge->addObserver(observer, OrderEvents);
+    book.addObserver(bridge);
+
+    book.addOrder(1, Side::Buy, 10000, 100, 1);
+    book.addOrder(2, Side::Buy, 10000, 50, 2);
+
+    EXPECT_EQ(bridge->poll(2), 2);
+    EXPECT_EQ(bridge->poll(), 4);
+    ASSERT_EQ(observer->order_updates.size(), 2);  // Consumer-side mask filters the rest
+    EXPECT_EQ(observer->order_updates[1].order_id, 2);
+}
+
+TEST(AsyncObserverBridgeTest, DropOldestCountsOverflow) {
+    OrderBookL2 book(1);
+    auto bridge = std::make_shared<AsyncObserverBridge>(AsyncObserverConfig{.capacity = 8});
+    auto observer = std::make_shared<RecordingObserver>();
+    bridge->addObserver(observer);
+    book.addObserver(bridge, PriceLevelEvents);
+
+    for (Price price = 10000; price < 10020; ++price) {
+        book.updateLevel(Side::Sell, price, 10, 1);
+    }
+
+    const auto stats = bridge->stats();
+    EXPECT_EQ(stats.enqueued, 20);
+    EXPECT_EQ(stats.dropped, 12);
+    EXPECT_EQ(bridge->poll(), 8);
+    ASSERT_EQ(observer->level_updates.size(), 8);
+    EXPECT_EQ(observer->level_updates.front().price, 10012);
+    EXPECT_EQ(observer->level_updates.back().price, 10019);
+}
+
+TEST(AsyncObserverBridgeTest, BlockPolicyDeliversEverything) {
+    OrderBookL2 book(1);
+    auto bridge = std::make_shared<AsyncObserverBridge>(
+        AsyncObserverConfig{.capacity = 16, .overflow = AsyncOverflowPolicy::Block});
+    auto observer = std::make_shared<RecordingObserver>();
+    bridge->addObserver(observer, PriceLevelEvents);
+    book.addObserver(bridge, PriceLevelEvents);
+    bridge->start();
+    EXPECT_TRUE(bridge->running());
+
+    constexpr int kUpdates = 20000;
+    for (int i = 0; i < kUpdates; ++i) {
+        book.updateLevel(Side::Buy, 10000 - (i % 50), 1 + i, i + 1);
+    }
+    bridge->stop();
+    EXPECT_FALSE(bridge->running());
+
+    const auto stats = bridge->stats();
+    EXPECT_EQ(stats.dropped, 0);
+    EXPECT_EQ(stats.delivered, kUpdates);
+    ASSERT_EQ(observer->level_updates.size(), kUpdates);
+    for (int i = 0; i < kUpdates; ++i) {
+        ASSERT_EQ(observer->level_updates[i].timestamp, static_cast<Timestamp>(i + 1));
+    }
+}
+
+TEST(AsyncObserverBridgeTest, ConflateTopOfBook) {
+    OrderBookL2 book(1);
+    auto bridge = std::make_shared<AsyncObserverBridge>(AsyncObserverConfig{.conflate_top_of_book = true});
+    auto observer = std::make_shared<RecordingObserver>();
+    bridge->addObserver(observer);
+    book.addObserver(bridge, TopOfBookEvents);
+
+    book.updateLevel(Side::Buy, 10000, 100, 1);
+    book.updateLevel(Side::Buy, 10010, 100, 2);
+    book.updateLevel(Side::Sell, 10020, 30, 3);
+    EXPECT_EQ(bridge->pending(), 0);  // Top-of-book bypasses the ring
+
+    EXPECT_EQ(bridge->poll(), 1);
+    ASSERT_EQ(observer->tob_updates.size(), 1);
+    EXPECT_EQ(observer->tob_updates[0].best_bid, 10010);
+    EXPECT_EQ(observer->tob_updates[0].best_ask, 10020);
+    EXPECT_EQ(bridge->stats().conflated, 2);
+
+    EXPECT_EQ(bridge->poll(), 0);  // Nothing new
+    book.updateLevel(Side::Sell, 10020, 40, 4);
+    EXPECT_EQ(bridge->poll(), 1);
+    EXPECT_EQ(observer->tob_updates.back().ask_quantity, 40);
+}
+
+TEST(AsyncObserverBridgeTest, SnapshotMarkersStayOrdered) {
+    OrderBookL3 book(1);
+    book.addOrder(1, Side::Buy, 10000, 100, 1);
+    book.addOrder(2, Side::Sell, 10100, 100, 2);
+
+    auto bridge = std::make_shared<AsyncObserverBridge>();
+    auto observer = std::make_shared<RecordingObserver>();
+    bridge->addObserver(observer);
+    book.addObserver(bridge);
+
+    book.emitSnapshot(3);
+    bridge->poll();
+    EXPECT_EQ(observer->sequence, (std::vector<int>{3, 1, 1, 4}));
+}
@@ -0,0 +1,214 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/orderbook_l2.hpp>
+#include <slick/orderbook/orderbook_l3.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace slick::orderbook;
+
+namespace {
+
+constexpr SymbolId kSymbol = 1;
+
+/// Check analytics against a recomputation from a copy of the top levels
+void expectMatches(const BookAnalytics& analytics, const std::vector<detail::PriceLevelL2>& bids,
+                   const std::vector<detail::PriceLevelL2>& asks) {
+    const std::vector<detail::PriceLevelL2>* sides[2] = {&bids, &asks};
+    for (Side side : {Side::Buy, Side::Sell}) {
+        const auto& levels = *sides[side];
+        ASSERT_EQ(analytics.levelCount(side), levels.size());
+        Quantity quantity = 0;
+        double notional = 0.0;
+        for (std::size_t i = 0; i < levels.size(); ++i) {
+            quantity += levels[i].quantity;
+            notional += static_cast<double>(levels[i].price) * static_cast<double>(levels[i].quantity);
+            ASSERT_EQ(analytics.cumulativeQuantity(side, i + 1), quantity) << "side " << int(side) << " level " << i;
+            ASSERT_DOUBLE_EQ(analytics.vwap(side, i + 1), notional / static_cast<double>(quantity));
+        }
+    }
+}
+
+}  // namespace
+
+TEST(BookAnalyticsTest, DisabledByDefault) {
+    OrderBookL2 book(kSymbol);
+    book.updateLevel(Side::Buy, 100, 10, 1);
+
+    EXPECT_EQ(book.analytics().depth(), 0);
+    EXPECT_EQ(book.analytics().levelCount(Side::Buy), 0);
+    EXPECT_TRUE(std::isnan(book.analytics().microprice()));
+    EXPECT_EQ(book.analytics().imbalance(1), 0.0);
+}
+
+TEST(BookAnalyticsTest, KnownBook) {
+    OrderBookL2 book(kSymbol);
+    book.setAnalyticsDepth(3);
+    book.updateLevel(Side::Buy, 100, 30, 1);
+    book.updateLevel(Side::Buy, 99, 20, 1);
+    book.updateLevel(Side::Buy, 98, 50, 1);
+    book.updateLevel(Side::Buy, 97, 1000, 1);  // Below tracked depth
+    book.updateLevel(Side::Sell, 101, 10, 1);
+    book.updateLevel(Side::Sell, 102, 40, 1);
+
+    const BookAnalytics& analytics = book.analytics();
+    EXPECT_EQ(analytics.levelCount(Side::Buy), 3);
+    EXPECT_EQ(analytics.levelCount(Side::Sell), 2);
+    EXPECT_EQ(analytics.cumulativeQuantity(Side::Buy, 2), 50);
+    EXPECT_EQ(analytics.cumulativeQuantity(Side::Buy, 10), 100);
+    EXPECT_EQ(analytics.cumulativeQuantity(Side::Sell, 0), 0);
+    EXPECT_DOUBLE_EQ(analytics.vwap(Side::Buy, 2), (100.0 * 30 + 99.0 * 20) / 50);
+
+    // Microprice leans towards the thinner side: (100 * 10 + 101 * 30) / 40
+    EXPECT_DOUBLE_EQ(analytics.microprice(), 100.75);
+    EXPECT_DOUBLE_EQ(analytics.imbalance(1), (30.0 - 10.0) / 40.0);
+    EXPECT_DOUBLE_EQ(analytics.imbalance(3), (100.0 - 50.0) / 150.0);
+
+    const double bid_vwap = (100.0 * 30 + 99.0 * 20) / 50;
+    const double ask_vwap = (101.0 * 10 + 102.0 * 40) / 50;
+    EXPECT_DOUBLE_EQ(analytics.weightedMid(2), (bid_vwap * 50 + ask_vwap * 50) / 100);
+
+    // Deeper changes are picked up; the top level keeps its sums
+    book.updateLevel(Side::Buy, 99, 0, 2);
+    EXPECT_EQ(analytics.cumulativeQuantity(Side::Buy, 3), 30 + 50 + 1000);
+    EXPECT_DOUBLE_EQ(analytics.microprice(), 100.75);
+}
+
+TEST(BookAnalyticsTest, PriceToFill) {
+    OrderBookL2 book(kSymbol);
+    book.setAnalyticsDepth(4);
+    book.updateLevel(Side::Sell, 101, 10, 1);
+    book.updateLevel(Side::Sell, 102, 20, 1);
+    book.updateLevel(Side::Sell, 104, 30, 1);
+    book.updateLevel(Side::Buy, 100, 5, 1);
+
+    const BookAnalytics& analytics = book.analytics();
+
+    FillEstimate fill = analytics.priceToFill(Side::Buy, 10);
+    EXPECT_EQ(fill.worst_price, 101);
+    EXPECT_EQ(fill.filled, 10);
+    EXPECT_DOUBLE_EQ(fill.average_price, 101.0);
+
+    fill = analytics.priceToFill(Side::Buy, 25);
+    EXPECT_EQ(fill.worst_price, 102);
+    EXPECT_EQ(fill.filled, 25);
+    EXPECT_DOUBLE_EQ(fill.average_price, (101.0 * 10 + 102.0 * 15) / 25);
+
+    // Not enough depth: everything on the side
+    fill = analytics.priceToFill(Side::Buy, 100);
+    EXPECT_EQ(fill.worst_price, 104);
+    EXPECT_EQ(fill.filled, 60);
+    EXPECT_DOUBLE_EQ(fill.average_price, (101.0 * 10 + 102.0 * 20 + 104.0 * 30) / 60);
+
+    // Sells sweep the bids
+    fill = analytics.priceToFill(Side::Sell, 3);
+    EXPECT_EQ(fill.worst_price, 100);
+    EXPECT_EQ(fill.filled, 3);
+
+    book.clearSide(Side::Sell);
+    fill = analytics.priceToFill(Side::Buy, 10);
+    EXPECT_EQ(fill.filled, 0);
+    EXPECT_EQ(fill.worst_price, 0);
+    EXPECT_EQ(analytics.priceToFill(Side::Sell, 0).filled, 0);
+}
+
+TEST(BookAnalyticsTest, EnableOnPopulatedBookAndSnapshot) {
+    OrderBookL2 book(kSymbol);
+    book.updateLevel(Side::Buy, 100, 10, 1);
+    book.updateLevel(Side::Sell, 101, 30, 1);
+
+    book.setAnalyticsDepth(5);
+    EXPECT_DOUBLE_EQ(book.analytics().microprice(), (100.0 * 30 + 101.0 * 10) / 40);
+
+    const std::vector<detail::PriceLevelL2> bids{{95, 7, 2}, {96, 3, 2}};
+    const std::vector<detail::PriceLevelL2> asks{{97, 1, 2}};
+    book.loadSnapshot(bids, asks, 10, 2);
+    expectMatches(book.analytics(), book.getLevels(Side::Buy), book.getLevels(Side::Sell));
+    EXPECT_EQ(book.analytics().cumulativeQuantity(Side::Buy, 1), 3);
+
+    book.clear();
+    EXPECT_EQ(book.analytics().levelCount(Side::Buy), 0);
+    EXPECT_EQ(book.analytics().levelCount(Side::Sell), 0);
+
+    book.setAnalyticsDepth(0);
+    book.updateLevel(Side::Buy, 100, 10, 3);
+    EXPECT_EQ(book.analytics().levelCount(Side::Buy), 0);
+}
+
+template<typename Book>
+class BookAnalyticsL2RandomTest : public ::testing::Test {};
+
+using L2Books = ::testing::Types<OrderBookL2, LadderOrderBookL2>;
+TYPED_TEST_SUITE(BookAnalyticsL2RandomTest, L2Books);
+
+TYPED_TEST(BookAnalyticsL2RandomTest, MatchesRecomputation) {
+    constexpr std::size_t kDepth = 8;
+    TypeParam book(kSymbol);
+    book.setAnalyticsDepth(kDepth);
+
+    std::mt19937_64 rng(19);
+    std::uniform_int_distribution<int> offset(0, 24);
+    std::uniform_int_distribution<int> quantity(0, 5);
+    std::uniform_int_distribution<int> batch(1, 4);
+
+    for (int step = 0; step < 5000; ++step) {
+        // Packets of several updates exercise the batch-end refresh
+        const int updates = batch(rng);
+        for (int i = 0; i < updates; ++i) {
+            const Side side = rng() % 2 == 0 ? Side::Buy : Side::Sell;
+            const Price price = side == Side::Buy ? 1000 - offset(rng) : 1001 + offset(rng);
+            book.updateLevel(side, price, quantity(rng) * 10, step, 0, i + 1 == updates);
+        }
+        expectMatches(book.analytics(), book.getLevels(Side::Buy, kDepth), book.getLevels(Side::Sell, kDepth));
+    }
+}
+
+template<typename Book>
+class BookAnalyticsL3RandomTest : public ::testing::Test {};
+
+using L3Books = ::testing::Types<OrderBookL3, LadderOrderBookL3, CompactOrderBookL3>;
+TYPED_TEST_SUITE(BookAnalyticsL3RandomTest, L3Books);
+
+TYPED_TEST(BookAnalyticsL3RandomTest, MatchesRecomputation) {
+    constexpr std::size_t kDepth = 6;
+    TypeParam book(kSymbol);
+    book.setAnalyticsDepth(kDepth);
+
+    std::mt19937_64 rng(23);
+    std::uniform_int_distribution<int> offset(0, 15);
+    std::uniform_int_distribution<int> quantity(1, 50);
+    std::vector<OrderId> live;
+    OrderId next_id = 1;
+
+    for (int step = 0; step < 5000; ++step) {
+        const auto action = rng() % 4;
+        if (live.empty() || action == 0 || action == 1) {
+            const Side side = rng() % 2 == 0 ? Side::Buy : Side::Sell;
+            const Price price = side == Side::Buy ? 1000 - offset(rng) : 1001 + offset(rng);
+            ASSERT_TRUE(book.addOrder(next_id, side, price, quantity(rng), step));
+            live.push_back(next_id++);
+        } else {
+            const std::size_t index = rng() % live.size();
+            const OrderId id = live[index];
+            if (action == 2) {
+                ASSERT_TRUE(book.deleteOrder(id, step));
+                live[index] = live.back();
+                live.pop_back();
+            } else {
+                ASSERT_TRUE(book.executeOrder(id, 1, step));
+                if (book.findOrder(id) == nullptr) {
+                    live[index] = live.back();
+                    live.pop_back();
+                }
+            }
+        }
+        expectMatches(book.analytics(), book.getLevelsL2(Side::Buy, kDepth), book.getLevelsL2(Side::Sell, kDepth));
+    }
+
+    book.clear();
+    EXPECT_EQ(book.analytics().levelCount(Side::Buy), 0);
+    EXPECT_EQ(book.analytics().levelCount(Side::Sell), 0);
+}
@@ -0,0 +1,375 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/checkpoint.hpp>
+#include <slick/orderbook/orderbook_l2.hpp>
+#include <slick/orderbook/orderbook_l3.hpp>
+#include <slick/orderbook/orderbook_manager.hpp>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace slick::orderbook;
+
+namespace {
+
+class CheckpointTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        path_ = (std::filesystem::temp_directory_path() /
+                 (std::string("slick_checkpoint_") + info->name() + ".ckpt")).string();
+        std::filesystem::remove(path_);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path_);
+        std::filesystem::remove(path_ + ".tmp");
+    }
+
+    std::string path_;
+};
+
+/// Orders of a book in queue order, as (side, price, id, quantity, priority)
+template<typename Book>
+std::vector<SnapshotOrder> ordersOf(const Book& book) {
+    std::vector<SnapshotOrder> orders;
+    for (Side side : {Side::Buy, Side::Sell}) {
+        for (const auto& [price, level] : book.getLevelsL3(side)) {
+            for (const auto& order : level.orders) {
+                orders.push_back({order.order_id, side, price, order.quantity, 0, order.priority});
+            }
+        }
+    }
+    return orders;
+}
+
+template<typename Book>
+void expectSameOrders(const Book& actual, const Book& expected) {
+    const auto a = ordersOf(actual);
+    const auto e = ordersOf(expected);
+    ASSERT_EQ(a.size(), e.size());
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        EXPECT_EQ(a[i].order_id, e[i].order_id) << "order " << i;
+        EXPECT_EQ(a[i].side, e[i].side);
+        EXPECT_EQ(a[i].price, e[i].price);
+        EXPECT_EQ(a[i].quantity, e[i].quantity);
+        EXPECT_EQ(a[i].priority, e[i].priority);
+    }
+}
+
+}  // namespace
+
+TEST_F(CheckpointTest, L3RoundTripKeepsQueueOrder) {
+    OrderBookL3 book(7);
+    book.addOrder(1, Side::Buy, 100, 10, 1000);
+    book.addOrder(2, Side::Buy, 100, 20, 1001);
+    book.addOrder(3, Side::Buy, 99, 30, 1002);
+    book.addOrder(4, Side::Sell, 101, 40, 1003);
+    book.addOrder(5, Side::Sell, 101, 50, 1004);
+    // Re-prioritize order 1 behind order 2 (same price, later priority)
+    book.modifyOrder(1, 100, 15, 1005);
+    book.executeOrder(4, 5, 1006, 42);
+
+    CheckpointWriter writer(path_);
+    writer.capture(book);
+    ASSERT_TRUE(writer.flush());
+    EXPECT_EQ(writer.writeCount(), 1);
+
+    Checkpoint checkpoint;
+    ASSERT_TRUE(checkpoint.open(path_));
+    ASSERT_EQ(checkpoint.books().size(), 1);
+    const CheckpointBook* record = checkpoint.find(7);
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(record->kind, CheckpointBookKind::L3);
+    EXPECT_EQ(record->last_seq_num, 42);
+    EXPECT_EQ(record->orders.size(), 5);
+    EXPECT_EQ(checkpoint.find(8), nullptr);
+
+    OrderBookL3 restored(7);
+    ASSERT_TRUE(checkpoint.restore(7, restored));
+    expectSameOrders(restored, book);
+    EXPECT_EQ(restored.getLastSeqNum(), 42);
+    EXPECT_EQ(restored.orderCount(), book.orderCount());
+    EXPECT_EQ(restored.getBestBid()->getTotalQuantity(), 35);
+    ASSERT_NE(restored.findOrder(1), nullptr);
+
+    // The restored book keeps working: new orders join the back of the queue
+    EXPECT_TRUE(restored.addOrder(6, Side::Buy, 100, 1, 2000));
+    EXPECT_EQ(restored.getLevelsL3(Side::Buy).begin()->second.orders.back()->order_id, 6);
+
+    // Wrong kind of book
+    OrderBookL2 l2(7);
+    EXPECT_FALSE(checkpoint.restore(7, l2));
+}
+
+TEST_F(CheckpointTest, CompactL3RoundTrip) {
+    CompactOrderBookL3 book(3);
+    for (OrderId id = 1; id <= 50; ++id) {
+        const Side side = id % 2 == 0 ? Side::Buy : Side::Sell;
+        const Price price = side == Side::Buy ? 1000 - static_cast<Price>(id % 7) : 1001 + static_cast<Price>(id % 5);
+        book.addOrder(id, side, price, static_cast<Quantity>(id), 100 + id, 0, id);
+    }
+
+    CheckpointWriter writer(path_);
+    writer.capture(book);
+    ASSERT_TRUE(writer.flush());
+
+    Checkpoint checkpoint;
+    ASSERT_TRUE(checkpoint.open(path_));
+    CompactOrderBookL3 restored(3);
+    ASSERT_TRUE(checkpoint.restore(3, restored));
+    expectSameOrders(restored, book);
+    EXPECT_EQ(restored.getLastSeqNum(), 50);
+}
+
+TEST_F(CheckpointTest, L2RoundTrip) {
+    OrderBookL2 book(11);
+    book.updateLevel(Side::Buy, 100, 10, 1, 5);
+    book.updateLevel(Side::Buy, 98, 20, 2, 6);
+    book.updateLevel(Side::Sell, 102, 30, 3, 7);
+
+    CheckpointWriter writer(path_);
+    writer.capture(book);
+    ASSERT_TRUE(writer.flush());
+
+    Checkpoint checkpoint;
+    ASSERT_TRUE(checkpoint.open(path_));
+    const CheckpointBook* record = checkpoint.find(11);
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(record->kind, CheckpointBookKind::L2);
+    EXPECT_EQ(record->bids.size(), 2);
+    EXPECT_EQ(record->asks.size(), 1);
+
+    OrderBookL2 restored(11);
+    ASSERT_TRUE(checkpoint.restore(11, restored));
+    EXPECT_EQ(restored.getLevels(Side::Buy), book.getLevels(Side::Buy));
+    EXPECT_EQ(restored.getLevels(Side::Sell), book.getLevels(Side::Sell));
+    EXPECT_EQ(restored.getLastSeqNum(), 7);
+
+    OrderBookL3 l3(11);
+    EXPECT_FALSE(checkpoint.restore(11, l3));
+}
+
+TEST_F(CheckpointTest, ManagerRestoreAndIncrementalCapture) {
+    constexpr SymbolId kSymbols = 200;
+    OrderBookManager<OrderBookL3> manager;
+    CheckpointWriter writer(path_);
+    for (SymbolId symbol = kSymbols; symbol > 0; --symbol) {
+        auto* book = manager.getOrCreateOrderBook(symbol);
+        book->addOrder(1, Side::Buy, 100, symbol, 1, 0, symbol);
+        book->addOrder(2, Side::Sell, 101, symbol, 1, 0, symbol);
+        writer.capture(*book);
+    }
+    ASSERT_TRUE(writer.flush());
+
+    // Only the recaptured book changes in the next file
+    auto* changed = manager.getOrderBook(5);
+    changed->addOrder(3, Side::Buy, 99, 1, 2, 0, 1000);
+    writer.capture(*changed);
+    writer.remove(kSymbols);
+    ASSERT_TRUE(writer.flush());
+    EXPECT_EQ(writer.bookCount(), kSymbols - 1);
+
+    Checkpoint checkpoint;
+    ASSERT_TRUE(checkpoint.open(path_));
+    ASSERT_EQ(checkpoint.books().size(), kSymbols - 1);
+    EXPECT_EQ(checkpoint.books().front().symbol, 1);
+
+    OrderBookManager<OrderBookL3> restored;
+    EXPECT_EQ(checkpoint.restore(restored), kSymbols - 1);
+    EXPECT_EQ(restored.getOrderBook(kSymbols), nullptr);
+    for (SymbolId symbol = 1; symbol < kSymbols; ++symbol) {
+        const auto* book = restored.getOrderBook(symbol);
+        ASSERT_NE(book, nullptr);
+        EXPECT_EQ(book->getLastSeqNum(), symbol == 5 ? 1000 : symbol);
+        EXPECT_EQ(book->orderCount(), symbol == 5 ? 3 : 2);
+        EXPECT_EQ(book->getBestBid()->getTotalQuantity(), symbol);
+    }
+}
+
+TEST_F(CheckpointTest, TrackedL3BookFollowsUpdates) {
+    OrderBookL3 book(4);
+    book.addOrder(1, Side::Buy, 100, 10, 1000, 0, 1);
+
+    CheckpointWriter writer(path_);
+    writer.track(book);  // Seeds from the resting order
+    book.addOrder(2, Side::Buy, 100, 20, 1001, 0, 2);
+    book.addOrder(3, Side::Buy, 100, 30, 1002, 1001, 3);  // Ties with order 2, queues behind it
+    book.addOrder(4, Side::Sell, 101, 40, 1003, 0, 4);
+    book.addOrder(5, Side::Sell, 102, 50, 1004, 0, 5);
+    book.modifyOrder(1, 100, 15, 1005, 0, 6);             // Re-prioritized to the back
+    book.modifyOrder(2, 100, 5, 1006, 1001, 7);           // Quantity only: keeps its place
+    book.modifyOrder(5, 99, 50, 1007, 0, 8);              // Moves to a new level
+    book.executeOrder(4, 10, 1008, 9);
+    book.submitOrder(6, Side::Buy, 101, 30, 1009, OrderType::Limit, TimeInForce::Day, 10);
+    book.deleteOrder(3, 1010, 11);
+    book.addOrder(7, Side::Sell, 103, 70, 1011, 0, 12);
+    ASSERT_TRUE(writer.flush());
+
+    Checkpoint checkpoint;
+    ASSERT_TRUE(checkpoint.open(path_));
+    EXPECT_EQ(checkpoint.find(4)->last_seq_num, 12);
+    OrderBookL3 restored(4);
+    ASSERT_TRUE(checkpoint.restore(4, restored));
+    expectSameOrders(restored, book);
+    EXPECT_EQ(restored.getLastSeqNum(), 12);
+
+    // A reloaded book replaces the shadow
+    const std::vector<SnapshotOrder> snapshot{{8, Side::Sell, 105, 80, 2000, 0}, {9, Side::Buy, 95, 90, 2001, 0}};
+    book.loadSnapshot(snapshot, 20, 2002);
+    ASSERT_TRUE(writer.flush());
+    ASSERT_TRUE(checkpoint.open(path_));
+    OrderBookL3 reloaded(4);
+    ASSERT_TRUE(checkpoint.restore(4, reloaded));
+    expectSameOrders(reloaded, book);
+    EXPECT_EQ(reloaded.getLastSeqNum(), 20);
+}
+
+TEST_F(CheckpointTest, TrackedL2BookFollowsUpdates) {
+    OrderBookL2 book(12);
+    CheckpointWriter writer(path_);
+    writer.track(book);
+    book.updateLevel(Side::Buy, 100, 10, 1, 5);
+    book.updateLevel(Side::Buy, 98, 20, 2, 6);
+    book.updateLevel(Side::Buy, 99, 25, 3, 7);
+    book.updateLevel(Side::Sell, 102, 30, 4, 8);
+    book.updateLevel(Side::Sell, 101, 35, 5, 9);
+    book.updateLevel(Side::Buy, 98, 0, 6, 10);
+    ASSERT_TRUE(writer.flush());
+    EXPECT_EQ(writer.bookCount(), 1);
+
+    Checkpoint checkpoint;
+    ASSERT_TRUE(checkpoint.open(path_));
+    OrderBookL2 restored(12);
+    ASSERT_TRUE(checkpoint.restore(12, restored));
+    EXPECT_EQ(restored.getLevels(Side::Buy), book.getLevels(Side::Buy));
+    EXPECT_EQ(restored.getLevels(Side::Sell), book.getLevels(Side::Sell));
+    EXPECT_EQ(restored.getLastSeqNum(), 10);
+}
+
+TEST_F(CheckpointTest, TrackedBookResyncsAfterRingOverflow) {
+    OrderBookL3 book(6);
+    CheckpointWriter writer(path_);
+    writer.track(book, 4);
+    for (OrderId id = 1; id <= 10; ++id) {
+        book.addOrder(id, Side::Buy, 100, 10, id, 0, id);
+    }
+    EXPECT_TRUE(writer.stale(6));
+
+    // The checkpoint holds the updates that fit in the ring, with their sequence number
+    ASSERT_TRUE(writer.flush());
+    Checkpoint checkpoint;
+    ASSERT_TRUE(checkpoint.open(path_));
+    EXPECT_EQ(checkpoint.find(6)->orders.size(), 4);
+    EXPECT_EQ(checkpoint.find(6)->last_seq_num, 4);
+
+    // capture() reseeds the shadow and recording resumes
+    writer.capture(book);
+    EXPECT_FALSE(writer.stale(6));
+    book.deleteOrder(1, 11, 11);
+    ASSERT_TRUE(writer.flush());
+    ASSERT_TRUE(checkpoint.open(path_));
+    OrderBookL3 restored(6);
+    ASSERT_TRUE(checkpoint.restore(6, restored));
+    expectSameOrders(restored, book);
+    EXPECT_EQ(restored.getLastSeqNum(), 11);
+
+    // Removed books stop recording
+    writer.remove(6);
+    for (OrderId id = 20; id < 30; ++id) {
+        book.addOrder(id, Side::Sell, 101, 10, id);
+    }
+    EXPECT_FALSE(writer.stale(6));
+    EXPECT_EQ(writer.bookCount(), 0);
+}
+
+TEST_F(CheckpointTest, RejectsMalformedFiles) {
+    Checkpoint checkpoint;
+    EXPECT_FALSE(checkpoint.open(path_));  // Missing
+
+    OrderBookL3 book(1);
+    book.addOrder(1, Side::Buy, 100, 10, 1);
+    book.addOrder(2, Side::Sell, 101, 10, 1);
+    CheckpointWriter writer(path_);
+    writer.capture(book);
+    ASSERT_TRUE(writer.flush());
+    const auto size = std::filesystem::file_size(path_);
+
+    // Truncated
+    std::filesystem::resize_file(path_, size - 8);
+    EXPECT_FALSE(checkpoint.open(path_));
+    EXPECT_FALSE(checkpoint.isOpen());
+
+    // Bad magic
+    {
+        std::ofstream out(path_, std::ios::binary | std::ios::trunc);
+        const std::string garbage(size, 'x');
+        out.write(garbage.data(), static_cast<std::streamsize>(garbage.size()));
+    }
+    EXPECT_FALSE(checkpoint.open(path_));
+}
+
+TEST_F(CheckpointTest, BackgroundWriter) {
+    OrderBookL3 book(9);
+    CheckpointWriter writer(path_);
+    writer.start(std::chrono::milliseconds(1));
+
+    for (OrderId id = 1; id <= 20; ++id) {
+        book.addOrder(id, Side::Buy, 100 - static_cast<Price>(id % 4), 10, id, 0, id);
+        writer.capture(book);
+    }
+    writer.stop();  // Final write picks up the last capture
+    EXPECT_GE(writer.writeCount(), 1);
+    EXPECT_EQ(writer.failedWrites(), 0);
+
+    Checkpoint checkpoint;
+    ASSERT_TRUE(checkpoint.open(path_));
+    OrderBookL3 restored(9);
+    ASSERT_TRUE(checkpoint.restore(9, restored));
+    expectSameOrders(restored, book);
+    EXPECT_EQ(restored.getLastSeqNum(), 20);
+}
+
+TEST_F(CheckpointTest, BackgroundWriterDrainsTrackedBooks) {
+    OrderBookL3 book(10);
+    CheckpointWriter writer(path_);
+    writer.track(book, 1024);
+    writer.start(std::chrono::milliseconds(5));
+
+    // More updates than the ring holds, so the writer thread must drain while the book updates
+    std::mt19937_64 rng(3);
+    for (OrderId id = 1; id <= 2000; ++id) {
+        book.addOrder(id, rng() % 2 ? Side::Buy : Side::Sell, 1000 + static_cast<Price>(rng() % 5) * (id % 2 ? 1 : -1),
+                      10, id, 0, id);
+        if (id > 10 && rng() % 3 == 0) {
+            book.deleteOrder(id - 10, id, id);
+        }
+        if (id % 256 == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+    }
+    writer.stop();
+    ASSERT_FALSE(writer.stale(10));
+
+    Checkpoint checkpoint;
+    ASSERT_TRUE(checkpoint.open(path_));
+    OrderBookL3 restored(10);
+    ASSERT_TRUE(checkpoint.restore(10, restored));
+    expectSameOrders(restored, book);
+}
+
+TEST_F(CheckpointTest, FailedWriteKeepsPreviousFile) {
+    CheckpointWriter writer((std::filesystem::temp_directory_path() / "slick_missing_dir" / "books.ckpt").string());
+    OrderBookL3 book(1);
+    writer.capture(book);
+    EXPECT_FALSE(writer.flush());
+    EXPECT_EQ(writer.failedWrites(), 1);
+    EXPECT_EQ(writer.writeCount(), 0);
+}
@@ -0,0 +1,216 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/consolidated_book.hpp>
+#include <slick/orderbook/orderbook_l2.hpp>
+#include <slick/orderbook/orderbook_l3.hpp>
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace slick::orderbook;
+
+namespace {
+
+constexpr SymbolId kSymbol = 7;
+
+/// Merge of venue books by hand, as ConsolidatedBook replaces
+std::vector<ConsolidatedLevel> mergeByHand(const std::vector<OrderBookL2*>& books, Side side) {
+    std::map<Price, ConsolidatedLevel> merged;
+    for (std::size_t venue = 0; venue < books.size(); ++venue) {
+        for (const auto& level : books[venue]->getLevels(side)) {
+            ConsolidatedLevel& out = merged[level.price];
+            out.price = level.price;
+            out.quantity += level.quantity;
+            out.venues |= 1u << venue;
+        }
+    }
+    std::vector<ConsolidatedLevel> levels;
+    for (const auto& [price, level] : merged) {
+        levels.push_back(level);
+    }
+    if (side == Side::Buy) {
+        std::reverse(levels.begin(), levels.end());
+    }
+    return levels;
+}
+
+void expectLevels(std::span<const ConsolidatedLevel> actual, const std::vector<ConsolidatedLevel>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(actual[i].price, expected[i].price) << "level " << i;
+        EXPECT_EQ(actual[i].quantity, expected[i].quantity) << "level " << i;
+        EXPECT_EQ(actual[i].venues, expected[i].venues) << "level " << i;
+    }
+}
+
+}  // namespace
+
+TEST(ConsolidatedBookTest, MergesVenueLevels) {
+    OrderBookL2 venue0(kSymbol);
+    OrderBookL2 venue1(kSymbol);
+    ConsolidatedBook book(kSymbol, 4);
+    ASSERT_TRUE(book.attach(0, venue0));
+    ASSERT_TRUE(book.attach(1, venue1));
+
+    venue0.updateLevel(Side::Buy, 100, 10, 1);
+    venue1.updateLevel(Side::Buy, 100, 5, 2);
+    venue1.updateLevel(Side::Buy, 101, 7, 3);
+    venue0.updateLevel(Side::Sell, 103, 4, 4);
+    venue1.updateLevel(Side::Sell, 102, 6, 5);
+
+    expectLevels(book.levels(Side::Buy), {{101, 7, 0b10}, {100, 15, 0b11}});
+    expectLevels(book.levels(Side::Sell), {{102, 6, 0b10}, {103, 4, 0b01}});
+    EXPECT_EQ(book.venueQuantity(0, Side::Buy, 100), 10);
+    EXPECT_EQ(book.venueQuantity(1, Side::Buy, 100), 5);
+    EXPECT_EQ(book.venueQuantity(0, Side::Buy, 101), 0);
+
+    ConsolidatedTopOfBook tob = book.getTopOfBook();
+    EXPECT_EQ(tob.top.symbol, kSymbol);
+    EXPECT_EQ(tob.top.best_bid, 101);
+    EXPECT_EQ(tob.top.bid_quantity, 7);
+    EXPECT_EQ(tob.bid_venues, 0b10);
+    EXPECT_EQ(tob.top.best_ask, 102);
+    EXPECT_EQ(tob.top.ask_quantity, 6);
+    EXPECT_EQ(tob.top.timestamp, 5);
+
+    // Venue 1 leaves 101 and reduces 100: the best bid is shared again
+    venue1.updateLevel(Side::Buy, 101, 0, 6);
+    venue1.updateLevel(Side::Buy, 100, 2, 7);
+    tob = book.getTopOfBook();
+    EXPECT_EQ(tob.top.best_bid, 100);
+    EXPECT_EQ(tob.top.bid_quantity, 12);
+    EXPECT_EQ(tob.bid_venues, 0b11);
+    EXPECT_EQ(book.levelCount(Side::Buy), 1);
+
+    // Venue quotes may cross
+    venue0.updateLevel(Side::Buy, 102, 1, 8);
+    EXPECT_TRUE(book.getTopOfBook().top.isCrossed());
+}
+
+TEST(ConsolidatedBookTest, AttachSeedsAndDetachRemoves) {
+    OrderBookL2 venue0(kSymbol);
+    OrderBookL2 venue2(kSymbol);
+    venue0.updateLevel(Side::Buy, 100, 10, 1);
+    venue0.updateLevel(Side::Sell, 105, 3, 1);
+    venue2.updateLevel(Side::Buy, 100, 4, 1);
+
+    ConsolidatedBook book(kSymbol, 3);
+    EXPECT_FALSE(book.attach(3, venue0));
+    ASSERT_TRUE(book.attach(0, venue0));
+    EXPECT_FALSE(book.attach(0, venue2));
+    ASSERT_TRUE(book.attach(2, venue2));
+    EXPECT_TRUE(book.isAttached(2));
+    EXPECT_FALSE(book.isAttached(1));
+
+    expectLevels(book.levels(Side::Buy), {{100, 14, 0b101}});
+    EXPECT_EQ(book.getTopOfBook().top.best_ask, 105);
+
+    ASSERT_TRUE(book.detach(0));
+    EXPECT_FALSE(book.detach(0));
+    expectLevels(book.levels(Side::Buy), {{100, 4, 0b100}});
+    EXPECT_EQ(book.levelCount(Side::Sell), 0);
+    EXPECT_EQ(book.getTopOfBook().top.best_ask, 0);
+
+    // A detached book no longer feeds the merge
+    venue0.updateLevel(Side::Buy, 101, 1, 2);
+    EXPECT_EQ(book.getTopOfBook().top.best_bid, 100);
+    EXPECT_EQ(venue0.getLevels(Side::Buy).size(), 2);
+}
+
+TEST(ConsolidatedBookTest, L3VenueAndSnapshots) {
+    OrderBookL3 l3(kSymbol, 0);
+    OrderBookL2 l2(kSymbol);
+    ConsolidatedBook book(kSymbol);
+    ASSERT_TRUE(book.attach(0, l3));
+    ASSERT_TRUE(book.attach(1, l2));
+
+    l3.addOrder(1, Side::Sell, 101, 10, 1);
+    l3.addOrder(2, Side::Sell, 101, 5, 2);
+    l2.updateLevel(Side::Sell, 101, 20, 3);
+    l2.updateLevel(Side::Sell, 102, 8, 4);
+    expectLevels(book.levels(Side::Sell), {{101, 35, 0b11}, {102, 8, 0b10}});
+
+    l3.executeOrder(1, 10, 5);
+    expectLevels(book.levels(Side::Sell), {{101, 25, 0b11}, {102, 8, 0b10}});
+
+    // An L2 snapshot replaces only that venue's levels
+    const std::vector<detail::PriceLevelL2> bids{{99, 3, 6}};
+    const std::vector<detail::PriceLevelL2> asks{{103, 2, 6}};
+    l2.loadSnapshot(bids, asks, 0, 6);
+    expectLevels(book.levels(Side::Buy), {{99, 3, 0b10}});
+    expectLevels(book.levels(Side::Sell), {{101, 5, 0b01}, {103, 2, 0b10}});
+
+    // So does an L3 snapshot, which reports orders rather than levels
+    const std::vector<SnapshotOrder> orders{{10, Side::Buy, 100, 4, 7}, {11, Side::Sell, 103, 6, 7}};
+    l3.loadSnapshot(orders, 0, 7);
+    expectLevels(book.levels(Side::Buy), {{100, 4, 0b01}, {99, 3, 0b10}});
+    expectLevels(book.levels(Side::Sell), {{103, 8, 0b11}});
+    const ConsolidatedTopOfBook tob = book.getTopOfBook();
+    EXPECT_EQ(tob.top.best_bid, 100);
+    EXPECT_EQ(tob.top.best_ask, 103);
+    EXPECT_EQ(tob.ask_venues, 0b11);
+    EXPECT_EQ(tob.top.timestamp, 7);
+}
+
+TEST(ConsolidatedBookTest, TopOfBookPublishedAtEndOfBatch) {
+    OrderBookL2 venue(kSymbol);
+    ConsolidatedBook book(kSymbol);
+    ASSERT_TRUE(book.attach(0, venue));
+
+    venue.updateLevel(Side::Buy, 100, 10, 1, 0, false);
+    venue.updateLevel(Side::Buy, 101, 5, 1, 0, false);
+    EXPECT_EQ(book.getTopOfBook().top.best_bid, 0);
+    EXPECT_EQ(book.best(Side::Buy)->price, 101);
+
+    venue.updateLevel(Side::Sell, 102, 5, 2, 0, true);
+    const ConsolidatedTopOfBook tob = book.getTopOfBook();
+    EXPECT_EQ(tob.top.best_bid, 101);
+    EXPECT_EQ(tob.top.best_ask, 102);
+    EXPECT_EQ(tob.top.timestamp, 2);
+
+    // Direct feeds publish like attached books
+    book.updateLevel(1, Side::Buy, 101, 3, 3);
+    EXPECT_EQ(book.getTopOfBook().top.bid_quantity, 8);
+    EXPECT_EQ(book.getTopOfBook().bid_venues, 0b11);
+    book.clearVenue(1, 4);
+    EXPECT_EQ(book.getTopOfBook().top.bid_quantity, 5);
+}
+
+TEST(ConsolidatedBookTest, MatchesMergeByHand) {
+    constexpr std::size_t kVenues = 5;
+    std::vector<OrderBookL2> venues;
+    for (std::size_t i = 0; i < kVenues; ++i) {
+        venues.emplace_back(kSymbol);
+    }
+    std::vector<OrderBookL2*> books;
+    ConsolidatedBook book(kSymbol, kVenues, 4);
+    for (std::size_t i = 0; i < kVenues; ++i) {
+        books.push_back(&venues[i]);
+        ASSERT_TRUE(book.attach(static_cast<VenueId>(i), venues[i]));
+    }
+
+    std::mt19937 rng(2026);
+    std::uniform_int_distribution<std::size_t> venue_dist(0, kVenues - 1);
+    std::uniform_int_distribution<Price> price_dist(0, 30);
+    std::uniform_int_distribution<Quantity> quantity_dist(0, 3);
+    for (Timestamp ts = 1; ts <= 5000; ++ts) {
+        const Side side = (ts & 1) ? Side::Buy : Side::Sell;
+        const Price price = side == Side::Buy ? 1000 - price_dist(rng) : 1001 + price_dist(rng);
+        venues[venue_dist(rng)].updateLevel(side, price, quantity_dist(rng) * 10, ts);
+
+        if (ts % 500 == 0) {
+            for (Side s : {Side::Buy, Side::Sell}) {
+                expectLevels(book.levels(s), mergeByHand(books, s));
+            }
+            const auto bids = mergeByHand(books, Side::Buy);
+            const auto asks = mergeByHand(books, Side::Sell);
+            const ConsolidatedTopOfBook tob = book.getTopOfBook();
+            EXPECT_EQ(tob.top.best_bid, bids.empty() ? 0 : bids.front().price);
+            EXPECT_EQ(tob.top.bid_quantity, bids.empty() ? 0 : bids.front().quantity);
+            EXPECT_EQ(tob.top.best_ask, asks.empty() ? 0 : asks.front().price);
+            EXPECT_EQ(tob.ask_venues, asks.empty() ? 0u : asks.front().venues);
+        }
+    }
+}
@@ -0,0 +1,214 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/detail/direct_order_map.hpp>
+#include <slick/orderbook/orderbook_l3.hpp>
+#include <gtest/gtest.h>
+#include <deque>
+#include <random>
+#include <unordered_map>
+
+using namespace slick::orderbook;
+using namespace slick::orderbook::detail;
+
+class DirectOrderMapTest : public ::testing::Test {
+protected:
+    static constexpr std::size_t kWindow = 64;
+    using Map = DirectOrderMap<kWindow>;
+
+    Order* makeOrder(OrderId id) {
+        return &orders_.emplace_back(id, 10000, 100, Side::Buy, 1);
+    }
+
+    std::deque<Order> orders_;  // Stable addresses
+};
+
+TEST_F(DirectOrderMapTest, InitialState) {
+    Map map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_EQ(map.find(1), nullptr);
+    EXPECT_FALSE(map.contains(0));
+    EXPECT_EQ(Map::windowSize(), kWindow);
+}
+
+TEST_F(DirectOrderMapTest, SequentialIdsStayInWindow) {
+    Map map;
+    for (OrderId id = 1000; id < 1000 + kWindow; ++id) {
+        ASSERT_TRUE(map.insert(makeOrder(id)));
+    }
+    EXPECT_EQ(map.size(), kWindow);
+    EXPECT_EQ(map.fallbackSize(), 0);
+    EXPECT_EQ(map.windowBase(), 1000);
+
+    for (OrderId id = 1000; id < 1000 + kWindow; ++id) {
+        ASSERT_NE(map.find(id), nullptr);
+        EXPECT_EQ(map.find(id)->order_id, id);
+    }
+    EXPECT_EQ(map.find(999), nullptr);
+    EXPECT_EQ(map.find(1000 + kWindow), nullptr);
+}
+
+TEST_F(DirectOrderMapTest, DuplicateInsertFails) {
+    Map map;
+    Order* order = makeOrder(5);
+    EXPECT_TRUE(map.insert(order));
+    EXPECT_FALSE(map.insert(makeOrder(5)));
+    EXPECT_EQ(map.find(5), order);
+    EXPECT_EQ(map.size(), 1);
+}
+
+TEST_F(DirectOrderMapTest, WindowSlidesAndMigratesRestingOrders) {
+    Map map;
+    ASSERT_TRUE(map.insert(makeOrder(100)));   // base = 100, stays resting
+    for (OrderId id = 101; id < 100 + kWindow; ++id) {
+        ASSERT_TRUE(map.insert(makeOrder(id)));
+        ASSERT_TRUE(map.erase(id));
+    }
+
+    // Slide forward by 10: id 100 falls off the back and moves to the fallback map
+    ASSERT_TRUE(map.insert(makeOrder(100 + kWindow + 9)));
+    EXPECT_EQ(map.windowBase(), 110);
+    EXPECT_EQ(map.fallbackSize(), 1);
+    EXPECT_EQ(map.size(), 2);
+
+    ASSERT_NE(map.find(100), nullptr);
+    EXPECT_EQ(map.find(100)->order_id, 100);
+    EXPECT_TRUE(map.erase(100));
+    EXPECT_EQ(map.fallbackSize(), 0);
+    EXPECT_TRUE(map.contains(100 + kWindow + 9));
+}
+
+TEST_F(DirectOrderMapTest, OutliersUseFallback) {
+    Map map;
+    ASSERT_TRUE(map.insert(makeOrder(1000)));
+
+    // Late id below the window, and a far-ahead id more than one window past its end
+    ASSERT_TRUE(map.insert(makeOrder(10)));
+    ASSERT_TRUE(map.insert(makeOrder(1000 + 5 * kWindow)));
+    EXPECT_EQ(map.fallbackSize(), 2);
+    EXPECT_EQ(map.windowBase(), 1000);
+
+    EXPECT_NE(map.find(10), nullptr);
+    EXPECT_NE(map.find(1000 + 5 * kWindow), nullptr);
+    EXPECT_FALSE(map.insert(makeOrder(10)));
+    EXPECT_EQ(map.size(), 3);
+}
+
+TEST_F(DirectOrderMapTest, EmptyWindowRecentersOnNextId) {
+    Map map;
+    ASSERT_TRUE(map.insert(makeOrder(1000)));
+    ASSERT_TRUE(map.insert(makeOrder(1000 + 5 * kWindow)));  // Outlier -> fallback
+    ASSERT_TRUE(map.erase(1000));
+
+    // Window is now empty, so a new far id re-centers it instead of using the fallback
+    ASSERT_TRUE(map.insert(makeOrder(1000 + 5 * kWindow - 3)));
+    EXPECT_EQ(map.windowBase(), 1000 + 5 * kWindow - 3);
+    EXPECT_EQ(map.fallbackSize(), 1);
+
+    // The earlier outlier is now inside the window range but still found in the fallback
+    EXPECT_NE(map.find(1000 + 5 * kWindow), nullptr);
+    EXPECT_FALSE(map.insert(makeOrder(1000 + 5 * kWindow)));
+    EXPECT_TRUE(map.erase(1000 + 5 * kWindow));
+    EXPECT_EQ(map.size(), 1);
+}
+
+TEST_F(DirectOrderMapTest, Clear) {
+    Map map;
+    for (OrderId id = 1; id <= 10; ++id) {
+        map.insert(makeOrder(id));
+    }
+    map.insert(makeOrder(100000));
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_FALSE(map.contains(100000));
+
+    ASSERT_TRUE(map.insert(makeOrder(500)));
+    EXPECT_EQ(map.windowBase(), 500);
+}
+
+TEST_F(DirectOrderMapTest, RandomizedAgainstUnorderedMap) {
+    Map map;
+    std::unordered_map<OrderId, Order*> reference;
+    std::mt19937_64 rng(12345);
+
+    // Mostly monotonic ids with occasional late and far-ahead outliers
+    OrderId next_id = 1;
+    for (int i = 0; i < 20000; ++i) {
+        const auto kind = rng() % 10;
+        OrderId id;
+        if (kind < 6) {
+            id = next_id++;
+        } else if (kind < 8) {
+            id = next_id > kWindow * 2 ? next_id - 1 - rng() % (kWindow * 2) : next_id;
+        } else if (kind < 9) {
+            id = next_id + rng() % (kWindow * 4);
+        } else {
+            id = 1 + rng() % next_id;
+        }
+
+        if (rng() % 2 == 0) {
+            Order* order = makeOrder(id);
+            ASSERT_EQ(map.insert(order), reference.try_emplace(id, order).second) << i;
+        } else {
+            ASSERT_EQ(map.erase(id), reference.erase(id) > 0) << i;
+        }
+        ASSERT_EQ(map.size(), reference.size());
+    }
+
+    for (const auto& [id, order] : reference) {
+        EXPECT_EQ(map.find(id), order) << id;
+    }
+}
+
+// ============================================================================
+// OrderBookL3 with direct-indexed order lookup
+// ============================================================================
+
+TEST(DirectIndexedOrderBookL3Test, BasicOperations) {
+    DirectIndexedOrderBookL3 book(1);
+
+    EXPECT_TRUE(book.addOrder(1, Side::Buy, 10000, 100, 1));
+    EXPECT_TRUE(book.addOrder(2, Side::Buy, 10000, 50, 2));
+    EXPECT_TRUE(book.addOrder(3, Side::Sell, 10100, 75, 3));
+    EXPECT_FALSE(book.addOrder(2, Side::Buy, 9900, 10, 4));
+
+    EXPECT_EQ(book.orderCount(), 3);
+    ASSERT_NE(book.findOrder(2), nullptr);
+    EXPECT_EQ(book.findOrder(2)->quantity, 50);
+
+    EXPECT_TRUE(book.modifyOrder(2, 9900, 60, 5));
+    EXPECT_EQ(book.findOrder(2)->price, 9900);
+    EXPECT_TRUE(book.executeOrder(1, 40, 6));
+    EXPECT_EQ(book.findOrder(1)->quantity, 60);
+
+    EXPECT_TRUE(book.deleteOrder(3, 7));
+    EXPECT_EQ(book.findOrder(3), nullptr);
+    EXPECT_TRUE(book.isEmpty(Side::Sell));
+
+    auto tob = book.getTopOfBook();
+    EXPECT_EQ(tob.best_bid, 10000);
+    EXPECT_EQ(tob.bid_quantity, 60);
+}
+
+TEST(DirectIndexedOrderBookL3Test, OutlierOrderIds) {
+    DirectIndexedOrderBookL3 book(1);
+    constexpr OrderId kFar = 1ULL << 40;
+
+    EXPECT_TRUE(book.addOrder(100, Side::Buy, 10000, 100, 1));
+    EXPECT_TRUE(book.addOrder(kFar, Side::Buy, 9900, 100, 2));
+    EXPECT_TRUE(book.addOrder(5, Side::Sell, 10100, 100, 3));
+
+    EXPECT_EQ(book.orderCount(), 3);
+    EXPECT_NE(book.findOrder(kFar), nullptr);
+    EXPECT_NE(book.findOrder(5), nullptr);
+
+    EXPECT_TRUE(book.deleteOrder(kFar, 4));
+    EXPECT_TRUE(book.deleteOrder(5, 5));
+    EXPECT_EQ(book.orderCount(), 1);
+
+    book.clear();
+    EXPECT_EQ(book.findOrder(100), nullptr);
+    EXPECT_TRUE(book.isEmpty());
+}
@@ -0,0 +1,290 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/feed_pipeline.hpp>
+#include <gtest/gtest.h>
+#include <charconv>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace slick::orderbook;
+using namespace slick::orderbook::detail;
+
+// ============================================================================
+// FrameRing
+// ============================================================================
+
+namespace {
+
+std::span<const std::byte> asBytes(std::string_view text) {
+    return std::as_bytes(std::span(text.data(), text.size()));
+}
+
+std::string_view asText(std::span<const std::byte> frame) {
+    return {reinterpret_cast<const char*>(frame.data()), frame.size()};
+}
+
+}  // namespace
+
+TEST(FrameRingTest, FramesComeOutInOrderAcrossTheWrap) {
+    FrameRing ring(64);
+    EXPECT_EQ(ring.capacity(), 64);
+    EXPECT_EQ(ring.maxFrameSize(), 24);
+    EXPECT_FALSE(ring.tryPush(asBytes(std::string(25, 'x'))));
+
+    std::span<const std::byte> frame;
+    EXPECT_FALSE(ring.front(frame));
+
+    // Records of 24 bytes (8 header + 13 payload padded to 16): the third one wraps
+    for (int round = 0; round < 10; ++round) {
+        const std::string first = "first-" + std::to_string(1000000 + round);
+        const std::string second = "other-" + std::to_string(1000000 + round);
+        ASSERT_TRUE(ring.tryPush(asBytes(first)));
+        ASSERT_TRUE(ring.tryPush(asBytes(second)));
+        ASSERT_TRUE(ring.front(frame));
+        EXPECT_EQ(asText(frame), first);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(frame.data()) % 8, 0);
+        ring.popFront();
+        ASSERT_TRUE(ring.front(frame));
+        EXPECT_EQ(asText(frame), second);
+        ring.popFront();
+        EXPECT_TRUE(ring.empty());
+    }
+}
+
+TEST(FrameRingTest, FullRingRejectsUntilConsumed) {
+    FrameRing ring(64);
+    ASSERT_TRUE(ring.tryPush(asBytes("aaaaaaaaaaaaaaaa")));    // 24 bytes
+    ASSERT_TRUE(ring.tryPush(asBytes("bbbbbbbbbbbbbbbb")));    // 48
+    EXPECT_FALSE(ring.tryPush(asBytes("cccccccccccccccc")));   // Would need 72
+    ASSERT_TRUE(ring.tryPush(asBytes("")));                    // Empty frame: header only, 56
+    EXPECT_EQ(ring.size(), 56);
+
+    std::span<const std::byte> frame;
+    ASSERT_TRUE(ring.front(frame));
+    ring.popFront();
+    // 24 bytes free at the start, 8 at the end: the record wraps
+    ASSERT_TRUE(ring.tryPush(asBytes("cccccccccccccccc")));
+    for (std::string_view expected : {"bbbbbbbbbbbbbbbb", "", "cccccccccccccccc"}) {
+        ASSERT_TRUE(ring.front(frame));
+        EXPECT_EQ(asText(frame), expected);
+        ring.popFront();
+    }
+    EXPECT_FALSE(ring.front(frame));
+}
+
+TEST(FrameRingTest, ConcurrentProducerAndConsumer) {
+    FrameRing ring(256);
+    constexpr int kFrames = 100000;
+    std::thread producer([&ring] {
+        for (int i = 0; i < kFrames; ++i) {
+            // Sizes from 1 to 40 bytes, so records wrap at varying offsets
+            const std::string frame = std::to_string(i) + std::string(static_cast<std::size_t>(i % 32), '.');
+            while (!ring.tryPush(asBytes(frame))) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    std::span<const std::byte> frame;
+    for (int i = 0; i < kFrames;) {
+        if (!ring.front(frame)) {
+            std::this_thread::yield();
+            continue;
+        }
+        const std::string expected = std::to_string(i) + std::string(static_cast<std::size_t>(i % 32), '.');
+        ASSERT_EQ(asText(frame), expected);
+        ring.popFront();
+        ++i;
+    }
+    producer.join();
+    EXPECT_TRUE(ring.empty());
+}
+
+// ============================================================================
+// SymbolRegistry
+// ============================================================================
+
+TEST(SymbolRegistryTest, AssignsIdsInOrderOfFirstSight) {
+    SymbolRegistry registry;
+    EXPECT_FALSE(registry.find("BTC-USD").has_value());
+    EXPECT_EQ(registry.getOrAdd("BTC-USD"), 0);
+    EXPECT_EQ(registry.getOrAdd("ETH-USD"), 1);
+    EXPECT_EQ(registry.getOrAdd(std::string("BTC-USD")), 0);
+    EXPECT_EQ(registry.find("ETH-USD"), 1);
+    EXPECT_EQ(registry.name(1), "ETH-USD");
+    EXPECT_EQ(registry.name(2), "");
+    EXPECT_EQ(registry.size(), 2);
+}
+
+// ============================================================================
+// FeedPipeline
+// ============================================================================
+
+namespace {
+
+/// Text frames shaped like an exchange L2 message: "PRODUCT SEQ\n" then one "B|S PRICE QTY\n" per level
+class TextL2Decoder {
+public:
+    bool operator()(std::span<const std::byte> frame, FeedSink<OrderBookL2>& sink) {
+        std::string_view text = asText(frame);
+        std::string_view line = nextLine(text);
+        const std::size_t space = line.find(' ');
+        if (space == std::string_view::npos) {
+            return false;
+        }
+        const auto symbol = registry.getOrAdd(line.substr(0, space));
+        uint64_t seq_num = 0;
+        if (!symbol || !parse(line.substr(space + 1), seq_num)) {
+            return false;
+        }
+        while (!text.empty()) {
+            line = nextLine(text);
+            if (line.size() < 5 || (line[0] != 'B' && line[0] != 'S')) {
+                return false;
+            }
+            line.remove_prefix(2);
+            const std::size_t split = line.find(' ');
+            Price price = 0;
+            Quantity quantity = 0;
+            if (split == std::string_view::npos || !parse(line.substr(0, split), price) ||
+                !parse(line.substr(split + 1), quantity)) {
+                return false;
+            }
+            sink(L2Update{.timestamp = seq_num, .seq_num = seq_num, .price = price, .quantity = quantity,
+                          .symbol = *symbol, .side = line.data()[-2] == 'B' ? Side::Buy : Side::Sell});
+        }
+        return true;
+    }
+
+    SymbolRegistry registry;
+
+private:
+    static std::string_view nextLine(std::string_view& text) {
+        const std::size_t end = text.find('\n');
+        const std::string_view line = text.substr(0, end);
+        text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+        return line;
+    }
+
+    template<typename T>
+    static bool parse(std::string_view text, T& value) {
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return error == std::errc() && end == text.data() + text.size();
+    }
+};
+
+std::string productName(std::size_t product) {
+    return std::string("P").append(std::to_string(product)).append("-USD");
+}
+
+/// Random feed over many products; the reference books get the same level changes directly
+std::vector<std::string> makeFeed(std::size_t products, std::size_t messages, std::vector<OrderBookL2>& reference) {
+    std::mt19937_64 rng(5);
+    std::vector<uint64_t> seq(products, 0);
+    std::vector<std::string> frames;
+    for (std::size_t p = 0; p < products; ++p) {
+        reference.emplace_back(static_cast<SymbolId>(p));
+    }
+    for (std::size_t m = 0; m < messages; ++m) {
+        const std::size_t product = rng() % products;
+        const uint64_t seq_num = ++seq[product];
+        std::string frame = productName(product);
+        frame.append(" ").append(std::to_string(seq_num)).append("\n");
+        const std::size_t levels = 1 + rng() % 4;
+        for (std::size_t i = 0; i < levels; ++i) {
+            const Side side = rng() % 2 ? Side::Buy : Side::Sell;
+            const Price price = side == Side::Buy ? 1000 - static_cast<Price>(rng() % 20)
+                                                  : 1001 + static_cast<Price>(rng() % 20);
+            const Quantity quantity = rng() % 3 == 0 ? 0 : static_cast<Quantity>(1 + rng() % 100);
+            frame.append(side == Side::Buy ? "B " : "S ").append(std::to_string(price)).append(" ");
+            frame.append(std::to_string(quantity)).append("\n");
+            reference[product].updateLevel(side, price, quantity, seq_num, seq_num, i + 1 == levels);
+        }
+        frames.push_back(std::move(frame));
+    }
+    return frames;
+}
+
+template<typename Pipeline>
+void expectBooksMatch(Pipeline& pipeline, const std::vector<OrderBookL2>& reference) {
+    const SymbolRegistry& registry = pipeline.decoder().registry;
+    ASSERT_EQ(registry.size(), reference.size());
+    for (std::size_t p = 0; p < reference.size(); ++p) {
+        const auto symbol = registry.find(productName(p));
+        ASSERT_TRUE(symbol.has_value());
+        const OrderBookL2* book = pipeline.engine().manager().getOrderBook(*symbol);
+        ASSERT_NE(book, nullptr);
+        for (Side side : {Side::Buy, Side::Sell}) {
+            const auto expected = reference[p].getLevels(side);
+            const auto actual = book->getLevels(side);
+            ASSERT_EQ(actual.size(), expected.size());
+            for (std::size_t i = 0; i < expected.size(); ++i) {
+                EXPECT_EQ(actual[i].price, expected[i].price);
+                EXPECT_EQ(actual[i].quantity, expected[i].quantity);
+            }
+        }
+        EXPECT_EQ(book->getLastSeqNum(), reference[p].getLastSeqNum());
+    }
+}
+
+}  // namespace
+
+TEST(FeedPipelineTest, ThreadedPipelineMatchesDirectUpdates) {
+    std::vector<OrderBookL2> reference;
+    const std::vector<std::string> frames = makeFeed(200, 20000, reference);
+
+    FeedPipeline<OrderBookL2, TextL2Decoder> pipeline(
+        TextL2Decoder{}, {.engine = {.num_shards = 4, .queue_capacity = 256}, .frame_buffer_bytes = 4096});
+    pipeline.start();
+    EXPECT_TRUE(pipeline.running());
+    std::size_t bytes = 0;
+    for (const std::string& frame : frames) {
+        ASSERT_TRUE(pipeline.push(asBytes(frame)));
+        bytes += frame.size();
+    }
+    pipeline.waitIdle();
+
+    const FeedPipelineStats stats = pipeline.stats();
+    EXPECT_EQ(stats.frames, frames.size());
+    EXPECT_EQ(stats.bytes, bytes);
+    EXPECT_EQ(stats.decode_errors, 0);
+    EXPECT_EQ(stats.updates, pipeline.engine().stats().messages);
+    EXPECT_EQ(pipeline.engine().stats().rejected, 0);
+    EXPECT_EQ(pipeline.engine().stats().books, 200);
+    expectBooksMatch(pipeline, reference);
+
+    pipeline.stop();
+    EXPECT_FALSE(pipeline.running());
+}
+
+TEST(FeedPipelineTest, PollModeAndDecodeErrors) {
+    std::vector<OrderBookL2> reference;
+    const std::vector<std::string> frames = makeFeed(3, 50, reference);
+
+    FeedPipeline<OrderBookL2, TextL2Decoder> pipeline(TextL2Decoder{}, {.engine = {.num_shards = 2}});
+    for (const std::string& frame : frames) {
+        ASSERT_TRUE(pipeline.tryPush(asBytes(frame)));
+    }
+    ASSERT_TRUE(pipeline.tryPush(asBytes("no-sequence-number")));
+    ASSERT_TRUE(pipeline.tryPush(asBytes("P0-USD 1000\nX 1 1\n")));
+    const std::string oversized(pipeline.maxFrameSize() + 1, 'x');
+    EXPECT_FALSE(pipeline.tryPush(asBytes(oversized)));
+    EXPECT_FALSE(pipeline.push(asBytes(oversized)));
+
+    EXPECT_EQ(pipeline.poll(10), 10);
+    EXPECT_EQ(pipeline.poll(), frames.size() - 10 + 2);
+    EXPECT_EQ(pipeline.poll(), 0);
+    for (std::size_t shard = 0; shard < pipeline.engine().shardCount(); ++shard) {
+        pipeline.engine().poll(shard);
+    }
+
+    const FeedPipelineStats stats = pipeline.stats();
+    EXPECT_EQ(stats.frames, frames.size() + 2);
+    EXPECT_EQ(stats.decode_errors, 2);
+    EXPECT_EQ(stats.buffer_full, 1);
+    expectBooksMatch(pipeline, reference);
+}
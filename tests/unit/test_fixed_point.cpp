@@ -0,0 +1,146 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/orderbook_l2.hpp>
+#include <gtest/gtest.h>
+#include <limits>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace slick::orderbook;
+
+namespace {
+
+using Cents = FixedPoint<int32_t, int32_t, 100, 1000>;
+
+class LevelRecorder : public IOrderBookObserver {
+public:
+    void onPriceLevelUpdate(const PriceLevelUpdate& update) override { updates.push_back(update); }
+    void onTopOfBookUpdate(const TopOfBook& tob) override { last_tob = tob; }
+
+    std::vector<PriceLevelUpdate> updates;
+    TopOfBook last_tob;
+};
+
+}  // namespace
+
+TEST(FixedPointTest, ConvertsAtCompileTime) {
+    static_assert(Cents::toDouble(12345) == 123.45);
+    static_assert(Cents::fromDouble(123.45) == 12345);
+    static_assert(Cents::fromDouble(-0.015) == -2);  // Rounds half away from zero
+    static_assert(Cents::quantityToDouble(1500) == 1.5);
+    static_assert(Cents::quantityFromDouble(2.25) == 2250);
+    static_assert(FixedPoint<>::toDouble(7) == 7.0);
+
+    static_assert(Cents::fits(std::numeric_limits<int32_t>::max(), 1));
+    static_assert(!Cents::fits(Price{std::numeric_limits<int32_t>::max()} + 1, 1));
+    static_assert(!Cents::fits(100, Quantity{std::numeric_limits<int32_t>::min()} - 1));
+    static_assert(FixedPoint<>::fits(std::numeric_limits<Price>::max(), std::numeric_limits<Quantity>::max()));
+}
+
+TEST(FixedPointTest, CompactLevelsAreNarrower) {
+    EXPECT_EQ(sizeof(OrderBookL2::Level), 24);
+    EXPECT_EQ(sizeof(CompactOrderBookL2::Level), 16);
+    EXPECT_TRUE((std::is_same_v<CompactOrderBookL2::Level::price_type, int32_t>));
+    EXPECT_TRUE((std::is_same_v<CompactOrderBookL2::Level::quantity_type, int32_t>));
+}
+
+TEST(FixedPointTest, CompactBookMatchesDefaultBook) {
+    OrderBookL2 wide(1);
+    CompactOrderBookL2 compact(1);
+
+    std::mt19937_64 rng(11);
+    for (uint64_t i = 1; i <= 5000; ++i) {
+        const Side side = rng() % 2 ? Side::Buy : Side::Sell;
+        const Price price = side == Side::Buy ? 10000 - static_cast<Price>(rng() % 200)
+                                              : 10001 + static_cast<Price>(rng() % 200);
+        const Quantity quantity = rng() % 4 == 0 ? 0 : static_cast<Quantity>(rng() % 100000);
+        wide.updateLevel(side, price, quantity, i, i);
+        compact.updateLevel(side, price, quantity, i, i);
+    }
+
+    for (const Side side : {Side::Buy, Side::Sell}) {
+        const auto expected = wide.getLevels(side);
+        const auto actual = compact.getLevels(side);
+        ASSERT_EQ(actual.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(actual[i].price, expected[i].price);
+            EXPECT_EQ(actual[i].quantity, expected[i].quantity);
+            EXPECT_EQ(actual[i].timestamp, expected[i].timestamp);
+        }
+    }
+    const TopOfBook expected_tob = wide.getTopOfBook();
+    const TopOfBook actual_tob = compact.getTopOfBook();
+    EXPECT_EQ(actual_tob.best_bid, expected_tob.best_bid);
+    EXPECT_EQ(actual_tob.bid_quantity, expected_tob.bid_quantity);
+    EXPECT_EQ(actual_tob.best_ask, expected_tob.best_ask);
+    EXPECT_EQ(actual_tob.ask_quantity, expected_tob.ask_quantity);
+    EXPECT_EQ(compact.getLastSeqNum(), wide.getLastSeqNum());
+}
+
+TEST(FixedPointTest, IgnoresValuesTooWideForStoredTypes) {
+    constexpr Price kTooHigh = Price{std::numeric_limits<int32_t>::max()} + 1;
+    constexpr Quantity kTooLarge = Quantity{std::numeric_limits<int32_t>::max()} + 1;
+
+    CompactOrderBookL2 book(1);
+    auto recorder = std::make_shared<LevelRecorder>();
+    book.addObserver(recorder);
+
+    book.updateLevel(Side::Sell, 1000, 10, 1);
+    book.updateLevel(Side::Sell, kTooHigh, 10, 2);
+    book.updateLevel(Side::Sell, 1001, kTooLarge, 3);
+    book.updateLevel(Side::Sell, kTooHigh, 0, 4);  // Delete of a price that cannot rest: no-op
+    EXPECT_EQ(book.levelCount(Side::Sell), 1);
+    EXPECT_EQ(book.getBestAsk()->quantity, 10);
+    EXPECT_EQ(recorder->updates.size(), 1);
+
+    // An update that would overflow an existing level leaves it as it was
+    book.updateLevel(Side::Sell, 1000, kTooLarge, 5);
+    EXPECT_EQ(book.getBestAsk()->quantity, 10);
+
+    const std::vector<L2Update> updates{
+        {.timestamp = 6, .seq_num = 0, .price = 999, .quantity = 20, .symbol = 1, .side = Side::Sell},
+        {.timestamp = 6, .seq_num = 0, .price = -kTooHigh - 1, .quantity = 30, .symbol = 1, .side = Side::Buy},
+        {.timestamp = 6, .seq_num = 0, .price = 990, .quantity = 40, .symbol = 1, .side = Side::Buy},
+    };
+    EXPECT_EQ(book.applyBatch(updates), 2);
+    EXPECT_EQ(book.levelCount(Side::Buy), 1);
+    EXPECT_EQ(book.getBestAsk()->price, 999);
+
+    const std::vector<detail::PriceLevelL2> bids{{990, 5, 7}, {980, kTooLarge, 7}};
+    const std::vector<detail::PriceLevelL2> asks{{kTooHigh, 5, 7}, {1000, 6, 7}};
+    book.loadSnapshot(bids, asks, 0, 7);
+    EXPECT_EQ(book.levelCount(Side::Buy), 1);
+    EXPECT_EQ(book.levelCount(Side::Sell), 1);
+    EXPECT_EQ(book.getBestAsk()->price, 1000);
+}
+
+TEST(FixedPointTest, EventsReportWidePrices) {
+    CompactOrderBookL2 book(3);
+    auto recorder = std::make_shared<LevelRecorder>();
+    book.addObserver(recorder);
+
+    constexpr Price kHigh = std::numeric_limits<int32_t>::max();
+    constexpr Quantity kLarge = std::numeric_limits<int32_t>::max();
+    book.updateLevel(Side::Sell, kHigh, kLarge, 1);
+    book.updateLevel(Side::Buy, -kHigh, kLarge, 2);
+
+    ASSERT_EQ(recorder->updates.size(), 2);
+    EXPECT_EQ(recorder->updates[0].price, kHigh);
+    EXPECT_EQ(recorder->updates[0].quantity, kLarge);
+    EXPECT_EQ(recorder->updates[1].price, -kHigh);
+    EXPECT_EQ(recorder->last_tob.best_ask, kHigh);
+    EXPECT_EQ(recorder->last_tob.best_bid, -kHigh);
+    EXPECT_EQ(recorder->last_tob.ask_quantity, kLarge);
+
+    // A depth snapshot widens the stored levels
+    book.setPublishedDepth(2);
+    book.updateLevel(Side::Sell, kHigh - 1, 5, 3);
+    DepthSnapshot<2> depth;
+    book.readDepth(depth);
+    ASSERT_EQ(depth.ask_count, 2);
+    EXPECT_EQ(depth.asks[0].price, kHigh - 1);
+    EXPECT_EQ(depth.asks[1].quantity, kLarge);
+}
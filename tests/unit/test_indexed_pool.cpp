@@ -0,0 +1,270 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/detail/indexed_pool.hpp>
+#include <slick/orderbook/detail/indexed_list.hpp>
+#include <slick/orderbook/detail/order.hpp>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <vector>
+
+using namespace slick::orderbook;
+using namespace slick::orderbook::detail;
+
+// Index-linked node (31-bit prev shares a word with a flag, as in CompactOrder)
+struct IndexedNode {
+    uint64_t value;
+    uint32_t prev : 31;
+    uint32_t flag : 1;
+    uint32_t next;
+
+    explicit IndexedNode(uint64_t v = 0) : value(v), prev(kNullPoolIndex), flag(0), next(kNullPoolIndex) {}
+};
+
+using NodePool = IndexedObjectPool<IndexedNode>;
+using NodeList = IndexedList<IndexedNode>;
+
+// ============================================================================
+// IndexedObjectPool
+// ============================================================================
+
+TEST(IndexedObjectPoolTest, InitialState) {
+    NodePool pool(10);
+    EXPECT_GE(pool.capacity(), 10);
+    EXPECT_EQ(pool.capacity() % NodePool::kSlotsPerChunk, 0);
+    EXPECT_EQ(pool.size(), 0);
+    EXPECT_TRUE(pool.empty());
+}
+
+TEST(IndexedObjectPoolTest, IndexRoundTrip) {
+    NodePool pool(0);
+    std::vector<IndexedNode*> nodes;
+    for (uint64_t i = 0; i < 3 * NodePool::kSlotsPerChunk + 7; ++i) {
+        nodes.push_back(pool.construct(i));
+        ASSERT_NE(nodes.back(), nullptr);
+    }
+    EXPECT_GE(pool.capacity(), nodes.size());
+
+    for (IndexedNode* node : nodes) {
+        const uint32_t index = NodePool::indexOf(node);
+        EXPECT_LT(index, kNullPoolIndex);
+        EXPECT_EQ(pool.at(index), node);
+        EXPECT_EQ(NodePool::resolve(nodes.front(), index), node);
+        EXPECT_EQ(NodePool::resolve(nodes.back(), index), node);
+    }
+}
+
+TEST(IndexedObjectPoolTest, ReuseAndClear) {
+    NodePool pool(16);
+    IndexedNode* a = pool.construct(1);
+    pool.destroy(a);
+    EXPECT_EQ(pool.construct(2), a);
+    EXPECT_EQ(pool.size(), 1);
+
+    pool.destroy(a);
+    pool.clear();
+    EXPECT_TRUE(pool.empty());
+    EXPECT_EQ(pool.available(), pool.capacity());
+}
+
+TEST(IndexedObjectPoolTest, MoveKeepsIndexes) {
+    NodePool pool(16);
+    IndexedNode* a = pool.construct(1);
+    IndexedNode* b = pool.construct(2);
+    const uint32_t b_index = NodePool::indexOf(b);
+
+    NodePool moved(std::move(pool));
+    EXPECT_EQ(moved.size(), 2);
+    EXPECT_EQ(NodePool::resolve(a, b_index), b);
+    EXPECT_EQ(moved.at(b_index), b);
+
+    // Moved-from pool is still usable
+    IndexedNode* c = pool.construct(3);
+    ASSERT_NE(c, nullptr);
+    EXPECT_EQ(pool.at(NodePool::indexOf(c)), c);
+    pool.destroy(c);
+}
+
+TEST(IndexedObjectPoolTest, TrimReleasesOnlyTrailingFreeSlabs) {
+    NodePool pool(NodePool::kSlotsPerChunk);
+    std::vector<IndexedNode*> nodes;
+    for (uint64_t i = 0; i <= NodePool::kSlotsPerChunk; ++i) {
+        nodes.push_back(pool.construct(i));   // The last one grows a second slab
+    }
+    const std::size_t grown = pool.capacity();
+    const std::size_t grown_bytes = pool.memoryUsage();
+    ASSERT_GT(grown, NodePool::kSlotsPerChunk);
+
+    // A free leading slab stays: live indexes name chunks by position
+    for (std::size_t i = 0; i < NodePool::kSlotsPerChunk; ++i) {
+        pool.destroy(nodes[i]);
+    }
+    EXPECT_EQ(pool.trim(), 0u);
+    EXPECT_EQ(pool.capacity(), grown);
+    for (std::size_t i = 0; i < NodePool::kSlotsPerChunk; ++i) {
+        nodes[i] = pool.construct(i);
+    }
+
+    const uint32_t kept_index = NodePool::indexOf(nodes.front());
+    pool.destroy(nodes.back());
+    EXPECT_EQ(pool.trim(), grown - NodePool::kSlotsPerChunk);
+    EXPECT_EQ(pool.capacity(), NodePool::kSlotsPerChunk);
+    EXPECT_LT(pool.memoryUsage(), grown_bytes);
+    EXPECT_EQ(pool.at(kept_index), nodes.front());
+    EXPECT_EQ(pool.available(), 0u);
+
+    // Grows again on demand with valid indexes
+    IndexedNode* node = pool.construct(99);
+    ASSERT_NE(node, nullptr);
+    EXPECT_EQ(pool.at(NodePool::indexOf(node)), node);
+}
+
+TEST(IndexedObjectPoolTest, MappedChunksAreUsable) {
+    NodePool pool(NodePool::kSlotsPerChunk * 2, MemoryConfig{.page_size = PageSize::Huge, .prefault = true});
+    EXPECT_EQ(pool.allocator().config().page_size, PageSize::Huge);
+    std::vector<IndexedNode*> nodes;
+    for (uint64_t i = 0; i < pool.capacity(); ++i) {
+        nodes.push_back(pool.construct(i));
+    }
+    for (uint64_t i = 0; i < nodes.size(); ++i) {
+        EXPECT_EQ(pool.at(NodePool::indexOf(nodes[i]))->value, i);
+    }
+}
+
+// ============================================================================
+// IndexedList
+// ============================================================================
+
+class IndexedListTest : public ::testing::Test {
+protected:
+    std::vector<uint64_t> values(const NodeList& list) const {
+        std::vector<uint64_t> out;
+        for (const IndexedNode& node : list) {
+            out.push_back(node.value);
+        }
+        return out;
+    }
+
+    NodePool pool_{64};
+    NodeList list_;
+};
+
+TEST_F(IndexedListTest, PushAndPop) {
+    EXPECT_TRUE(list_.empty());
+    IndexedNode* a = pool_.construct(1);
+    IndexedNode* b = pool_.construct(2);
+    IndexedNode* c = pool_.construct(3);
+    list_.push_back(b);
+    list_.push_back(c);
+    list_.push_front(a);
+
+    EXPECT_EQ(list_.size(), 3);
+    EXPECT_EQ(list_.front(), a);
+    EXPECT_EQ(list_.back(), c);
+    EXPECT_EQ(values(list_), (std::vector<uint64_t>{1, 2, 3}));
+
+    EXPECT_EQ(list_.pop_front(), a);
+    EXPECT_EQ(list_.pop_back(), c);
+    EXPECT_EQ(list_.front(), b);
+    EXPECT_EQ(list_.back(), b);
+    EXPECT_EQ(NodeList::nextOf(b), nullptr);
+    EXPECT_EQ(NodeList::prevOf(b), nullptr);
+}
+
+TEST_F(IndexedListTest, EraseAndInsert) {
+    IndexedNode* a = pool_.construct(1);
+    IndexedNode* b = pool_.construct(2);
+    IndexedNode* c = pool_.construct(3);
+    IndexedNode* d = pool_.construct(4);
+    list_.push_back(a);
+    list_.push_back(c);
+    list_.insert_before(c, b);
+    list_.insert_after(c, d);
+    EXPECT_EQ(values(list_), (std::vector<uint64_t>{1, 2, 3, 4}));
+
+    list_.erase(b);
+    EXPECT_EQ(values(list_), (std::vector<uint64_t>{1, 3, 4}));
+    EXPECT_EQ(NodeList::prevOf(c), a);
+    list_.erase(a);
+    list_.erase(d);
+    EXPECT_EQ(list_.front(), c);
+    EXPECT_EQ(list_.back(), c);
+
+    list_.insert_after(c, a);
+    list_.insert_before(c, b);
+    EXPECT_EQ(values(list_), (std::vector<uint64_t>{2, 3, 1}));
+}
+
+TEST_F(IndexedListTest, LinksDoNotDisturbPackedBits) {
+    IndexedNode* a = pool_.construct(1);
+    IndexedNode* b = pool_.construct(2);
+    a->flag = 1;
+    b->flag = 1;
+    list_.push_back(a);
+    list_.push_back(b);
+    list_.erase(a);
+    list_.push_back(a);
+    EXPECT_EQ(a->flag, 1u);
+    EXPECT_EQ(b->flag, 1u);
+    EXPECT_EQ(values(list_), (std::vector<uint64_t>{2, 1}));
+}
+
+TEST_F(IndexedListTest, BidirectionalIteration) {
+    for (uint64_t i = 1; i <= 5; ++i) {
+        list_.push_back(pool_.construct(i));
+    }
+    auto it = list_.end();
+    --it;
+    EXPECT_EQ(it->value, 5);
+    std::advance(it, -4);
+    EXPECT_EQ(it, list_.begin());
+    EXPECT_EQ(std::distance(list_.cbegin(), list_.cend()), 5);
+
+    NodeList moved(std::move(list_));
+    EXPECT_TRUE(list_.empty());
+    EXPECT_EQ(values(moved), (std::vector<uint64_t>{1, 2, 3, 4, 5}));
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+}
+
+TEST_F(IndexedListTest, ListsSpanChunks) {
+    NodePool pool(0);
+    NodeList list;
+    const uint64_t count = NodePool::kSlotsPerChunk * 3;
+    for (uint64_t i = 0; i < count; ++i) {
+        list.push_back(pool.construct(i));
+    }
+    uint64_t expected = 0;
+    for (const IndexedNode& node : list) {
+        ASSERT_EQ(node.value, expected++);
+    }
+    EXPECT_EQ(expected, count);
+}
+
+// ============================================================================
+// CompactOrder
+// ============================================================================
+
+TEST(CompactOrderTest, LayoutAndFields) {
+    static_assert(sizeof(CompactOrder) == 48);
+    CompactOrder order(7, 10000, 25, Side::Sell, 123, 456);
+    EXPECT_EQ(order.order_id, 7);
+    EXPECT_EQ(order.price, 10000);
+    EXPECT_EQ(order.quantity, 25);
+    EXPECT_EQ(order.side(), Side::Sell);
+    EXPECT_EQ(order.priority, 456);
+    EXPECT_EQ(timestampOf(order), 123);
+    EXPECT_EQ(order.prev, kNullPoolIndex);
+    EXPECT_EQ(order.next, kNullPoolIndex);
+
+    // Without an explicit priority, the timestamp orders the queue
+    CompactOrder buy(8, 10000, 25, Side::Buy, 789);
+    EXPECT_EQ(buy.side(), Side::Buy);
+    EXPECT_EQ(buy.priority, 789);
+    EXPECT_EQ(timestampOf(buy), 789);
+
+    // The timestamp moves independently of the priority
+    setTimestamp(order, 999);
+    EXPECT_EQ(timestampOf(order), 999);
+    EXPECT_EQ(order.priority, 456);
+}
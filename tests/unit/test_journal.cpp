@@ -0,0 +1,239 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/journal.hpp>
+#include <slick/orderbook/orderbook_l2.hpp>
+#include <slick/orderbook/orderbook_l3.hpp>
+#include <slick/orderbook/orderbook_manager.hpp>
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace slick::orderbook;
+
+namespace {
+
+class JournalTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        path_ = (std::filesystem::temp_directory_path() /
+                 (std::string("slick_journal_") + info->name() + ".jrnl")).string();
+        std::filesystem::remove(path_);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path_);
+    }
+
+    std::string path_;
+};
+
+/// Orders of a book in queue order, as (id, quantity) per level
+template<typename Book>
+std::vector<std::pair<OrderId, Quantity>> ordersOf(const Book& book) {
+    std::vector<std::pair<OrderId, Quantity>> orders;
+    for (Side side : {Side::Buy, Side::Sell}) {
+        for (const auto& [price, level] : book.getLevelsL3(side)) {
+            for (const auto& order : level.orders) {
+                orders.emplace_back(order.order_id, order.quantity);
+            }
+        }
+    }
+    return orders;
+}
+
+}  // namespace
+
+TEST_F(JournalTest, RecordsRoundTrip) {
+    JournalWriter writer;
+    ASSERT_TRUE(writer.open(path_));
+    writer.updateLevel(1, Side::Sell, 101, 50, 10, 7, false);
+    writer.addOrder(2, 42, Side::Buy, 100, 30, 11, 5, 8);
+    writer.modifyOrder(2, 42, 99, 20, 12, 0, 9);
+    writer.executeOrder(2, 42, 5, 13, 10);
+    writer.deleteOrder(2, 42, 14, 11);
+    EXPECT_EQ(writer.recordCount(), 5);
+    ASSERT_TRUE(writer.close());
+
+    JournalReader reader;
+    ASSERT_TRUE(reader.open(path_));
+    ASSERT_EQ(reader.size(), 5);
+    const auto records = reader.records();
+
+    EXPECT_EQ(records[0].op, JournalOp::UpdateLevel);
+    EXPECT_FALSE(records[0].isLastInBatch());
+    const L2Update level = records[0].toL2Update();
+    EXPECT_EQ(level.symbol, 1);
+    EXPECT_EQ(level.side, Side::Sell);
+    EXPECT_EQ(level.price, 101);
+    EXPECT_EQ(level.quantity, 50);
+    EXPECT_EQ(level.seq_num, 7);
+
+    const L3Update add = records[1].toL3Update();
+    EXPECT_EQ(add.type, L3UpdateType::Add);
+    EXPECT_EQ(add.order_id, 42);
+    EXPECT_EQ(add.priority, 5);
+    EXPECT_EQ(add.seq_num, 8);
+    EXPECT_TRUE(records[1].isLastInBatch());
+    EXPECT_EQ(records[2].toL3Update().type, L3UpdateType::Modify);
+    EXPECT_EQ(records[3].toL3Update().type, L3UpdateType::Execute);
+    EXPECT_EQ(records[3].quantity, 5);
+    EXPECT_EQ(records[4].toL3Update().type, L3UpdateType::Delete);
+
+    std::size_t visited = 0;
+    reader.forEach([&](const JournalRecord&) { ++visited; });
+    EXPECT_EQ(visited, 5);
+}
+
+TEST_F(JournalTest, ReplayMatchesLiveL3Book) {
+    constexpr SymbolId kSymbol = 3;
+    OrderBookL3 live(kSymbol);
+    JournalWriter writer(64);  // Small buffer: exercise block writes
+    ASSERT_TRUE(writer.open(path_));
+
+    std::mt19937_64 rng(31);
+    std::vector<OrderId> resting;
+    OrderId next_id = 1;
+    for (uint64_t seq = 1; seq <= 5000; ++seq) {
+        const auto action = rng() % 5;
+        if (resting.empty() || action < 2) {
+            const Side side = rng() % 2 == 0 ? Side::Buy : Side::Sell;
+            const Price price = side == Side::Buy ? 1000 - static_cast<Price>(rng() % 10)
+                                                  : 1001 + static_cast<Price>(rng() % 10);
+            const Quantity quantity = 1 + static_cast<Quantity>(rng() % 100);
+            writer.addOrder(kSymbol, next_id, side, price, quantity, seq, 0, seq);
+            live.addOrder(next_id, side, price, quantity, seq, 0, seq);
+            resting.push_back(next_id++);
+            continue;
+        }
+        const std::size_t index = rng() % resting.size();
+        const OrderId id = resting[index];
+        if (action == 2) {
+            writer.deleteOrder(kSymbol, id, seq, seq);
+            live.deleteOrder(id, seq, seq);
+            resting[index] = resting.back();
+            resting.pop_back();
+        } else if (action == 3) {
+            writer.executeOrder(kSymbol, id, 1, seq, seq);
+            live.executeOrder(id, 1, seq, seq);
+            if (live.findOrder(id) == nullptr) {
+                resting[index] = resting.back();
+                resting.pop_back();
+            }
+        } else {
+            const auto* order = live.findOrder(id);
+            const Quantity quantity = order->quantity + 1;
+            writer.modifyOrder(kSymbol, id, order->price, quantity, seq, 0, seq);
+            live.modifyOrder(id, order->price, quantity, seq, 0, seq);
+        }
+    }
+    // Another symbol's records are skipped by the single-book replay
+    writer.addOrder(kSymbol + 1, 1, Side::Buy, 100, 1, 1);
+    // A stale sequence number is rejected
+    writer.addOrder(kSymbol, next_id, Side::Buy, 100, 1, 1, 0, 1);
+    ASSERT_TRUE(writer.close());
+
+    JournalReader reader;
+    ASSERT_TRUE(reader.open(path_));
+    OrderBookL3 replayed(kSymbol);
+    const JournalReplayStats stats = reader.replay(replayed);
+    EXPECT_EQ(stats.records + stats.rejected + stats.skipped, reader.size());
+    EXPECT_EQ(stats.skipped, 1);
+    EXPECT_EQ(stats.rejected, 1);
+    EXPECT_EQ(ordersOf(replayed), ordersOf(live));
+    EXPECT_EQ(replayed.getLastSeqNum(), live.getLastSeqNum());
+
+    // Replay is deterministic
+    OrderBookL3 again(kSymbol);
+    reader.replay(again);
+    EXPECT_EQ(ordersOf(again), ordersOf(replayed));
+
+    // L2 books skip order records
+    OrderBookL2 l2(kSymbol);
+    EXPECT_EQ(reader.replay(l2).records, 0);
+}
+
+TEST_F(JournalTest, ReplayIntoManagerAndBatches) {
+    JournalWriter writer;
+    ASSERT_TRUE(writer.open(path_));
+    const std::vector<L2Update> packet{
+        {.timestamp = 1, .seq_num = 1, .price = 100, .quantity = 10, .symbol = 1, .side = Side::Buy},
+        {.timestamp = 1, .seq_num = 2, .price = 101, .quantity = 20, .symbol = 1, .side = Side::Sell},
+        {.timestamp = 1, .seq_num = 3, .price = 99, .quantity = 30, .symbol = 1, .side = Side::Buy},
+    };
+    writer.appendBatch(std::span<const L2Update>(packet));
+    writer.updateLevel(2, Side::Buy, 50, 5, 2, 1);
+    writer.updateLevel(1, Side::Buy, 100, 0, 3, 4);
+    ASSERT_TRUE(writer.close());
+
+    JournalReader reader;
+    ASSERT_TRUE(reader.open(path_));
+    EXPECT_FALSE(reader.records()[0].isLastInBatch());
+    EXPECT_FALSE(reader.records()[1].isLastInBatch());
+    EXPECT_TRUE(reader.records()[2].isLastInBatch());
+
+    OrderBookManager<OrderBookL2> manager;
+    const JournalReplayStats stats = reader.replay(manager);
+    EXPECT_EQ(stats.records, 5);
+    EXPECT_EQ(stats.rejected, 0);
+    ASSERT_NE(manager.getOrderBook(1), nullptr);
+    ASSERT_NE(manager.getOrderBook(2), nullptr);
+    EXPECT_EQ(manager.getOrderBook(1)->getBestBid()->price, 99);
+    EXPECT_EQ(manager.getOrderBook(1)->getBestAsk()->quantity, 20);
+    EXPECT_EQ(manager.getOrderBook(1)->getLastSeqNum(), 4);
+    EXPECT_EQ(manager.getOrderBook(2)->getBestBid()->quantity, 5);
+}
+
+TEST_F(JournalTest, AppendDropsTornRecord) {
+    {
+        JournalWriter writer;
+        ASSERT_TRUE(writer.open(path_));
+        writer.updateLevel(1, Side::Buy, 100, 10, 1);
+        writer.updateLevel(1, Side::Buy, 99, 10, 2);
+    }
+    // Simulate a crash in the middle of a record
+    {
+        std::ofstream out(path_, std::ios::binary | std::ios::app);
+        out.write("torn", 4);
+    }
+    JournalReader reader;
+    ASSERT_TRUE(reader.open(path_));
+    EXPECT_EQ(reader.size(), 2);
+    reader.close();
+
+    {
+        JournalWriter writer;
+        ASSERT_TRUE(writer.open(path_, true));
+        writer.updateLevel(1, Side::Buy, 98, 10, 3);
+    }
+    ASSERT_TRUE(reader.open(path_));
+    ASSERT_EQ(reader.size(), 3);
+    EXPECT_EQ(reader.records()[2].price, 98);
+
+    // Reopening without append starts a new journal
+    {
+        JournalWriter writer;
+        ASSERT_TRUE(writer.open(path_));
+    }
+    ASSERT_TRUE(reader.open(path_));
+    EXPECT_EQ(reader.size(), 0);
+}
+
+TEST_F(JournalTest, RejectsOtherFiles) {
+    JournalReader reader;
+    EXPECT_FALSE(reader.open(path_));  // Missing
+    {
+        std::ofstream out(path_, std::ios::binary);
+        out << "not a journal, just some text";
+    }
+    EXPECT_FALSE(reader.open(path_));
+    EXPECT_FALSE(reader.isOpen());
+
+    JournalWriter writer;
+    EXPECT_FALSE(writer.open(path_, true));
+    EXPECT_FALSE(writer.append(JournalRecord{}));
+}
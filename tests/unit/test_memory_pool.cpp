@@ -275,3 +275,136 @@ TEST_F(ObjectPoolTest, LifetimeTracking) {
     EXPECT_EQ(TrackedObject::construct_count, 3);
     EXPECT_EQ(TrackedObject::destruct_count, 3);
 }
+
+TEST_F(ObjectPoolTest, DefaultMemoryUsesHeap) {
+    ObjectPool<SimpleObject> pool(10);
+    EXPECT_FALSE(pool.allocator().mapped());
+    EXPECT_EQ(pool.allocator().granularity(), 1);
+    EXPECT_EQ(pool.capacity(), 64);  // Minimum block size
+}
+
+TEST_F(ObjectPoolTest, TrimReleasesOnlyWhollyFreeBlocks) {
+    ObjectPool<SimpleObject> pool(64);
+    std::vector<SimpleObject*> objects;
+    for (int i = 0; i < 64; ++i) {
+        objects.push_back(pool.construct(i));
+    }
+    SimpleObject* extra = pool.construct(64);   // Grows a second block
+    const std::size_t grown = pool.capacity();
+    ASSERT_GT(grown, 64u);
+    EXPECT_EQ(pool.memoryUsage(), grown * sizeof(SimpleObject));
+
+    // The second block still holds an object
+    EXPECT_EQ(pool.trim(), 0u);
+    EXPECT_EQ(pool.capacity(), grown);
+
+    // A high watermark above the first block keeps the second one
+    pool.destroy(extra);
+    EXPECT_EQ(pool.trim(grown), 0u);
+
+    EXPECT_EQ(pool.trim(), grown - 64);
+    EXPECT_EQ(pool.capacity(), 64u);
+    EXPECT_EQ(pool.memoryUsage(), 64 * sizeof(SimpleObject));
+    EXPECT_EQ(pool.available(), 0u);
+    for (int i = 0; i < 64; ++i) {
+        EXPECT_EQ(objects[i]->value, i);
+    }
+
+    // The free list no longer hands out released memory, and the pool grows again on demand
+    pool.destroy(objects[10]);
+    EXPECT_EQ(pool.construct(10), objects[10]);
+    EXPECT_NE(pool.construct(65), nullptr);
+    EXPECT_GT(pool.capacity(), 64u);
+}
+
+TEST_F(ObjectPoolTest, ShrinkToFitReleasesEmptyPool) {
+    ObjectPool<SimpleObject> pool(10);
+    std::vector<SimpleObject*> objects;
+    for (int i = 0; i < 500; ++i) {
+        objects.push_back(pool.construct(i));
+    }
+    for (SimpleObject* obj : objects) {
+        pool.destroy(obj);
+    }
+    const std::size_t capacity = pool.capacity();
+    EXPECT_EQ(pool.shrink_to_fit(), capacity);
+    EXPECT_EQ(pool.capacity(), 0u);
+    EXPECT_EQ(pool.memoryUsage(), 0u);
+
+    SimpleObject* obj = pool.construct(3);
+    ASSERT_NE(obj, nullptr);
+    EXPECT_EQ(obj->value, 3);
+    pool.destroy(obj);
+}
+
+#if defined(__linux__)
+TEST_F(ObjectPoolTest, MappedBlocksFillWholePages) {
+    ObjectPool<SimpleObject> pool(10, slick::orderbook::MemoryConfig{.prefault = true});
+    EXPECT_TRUE(pool.allocator().mapped());
+    EXPECT_EQ(pool.capacity(), PageAllocator::kPageSize / sizeof(SimpleObject));
+
+    // Growth maps further whole-page blocks
+    std::vector<SimpleObject*> objects;
+    for (std::size_t i = 0; i <= PageAllocator::kPageSize / sizeof(SimpleObject); ++i) {
+        objects.push_back(pool.construct(static_cast<int>(i)));
+        ASSERT_NE(objects.back(), nullptr);
+    }
+    EXPECT_EQ(pool.capacity() * sizeof(SimpleObject) % PageAllocator::kPageSize, 0);
+    for (std::size_t i = 0; i < objects.size(); ++i) {
+        EXPECT_EQ(objects[i]->value, static_cast<int>(i));
+        pool.destroy(objects[i]);
+    }
+    EXPECT_TRUE(pool.empty());
+}
+
+TEST_F(ObjectPoolTest, TransparentHugePageBlocksAreAligned) {
+    PageAllocator allocator(slick::orderbook::MemoryConfig{.page_size = slick::orderbook::PageSize::Transparent});
+    EXPECT_EQ(allocator.granularity(), PageAllocator::kHugePageSize);
+
+    void* memory = allocator.allocate(PageAllocator::kHugePageSize + 1, 64);
+    ASSERT_NE(memory, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(memory) % PageAllocator::kHugePageSize, 0);
+    static_cast<char*>(memory)[2 * PageAllocator::kHugePageSize - 1] = 1;  // Rounded up to two huge pages
+    allocator.deallocate(memory, PageAllocator::kHugePageSize + 1, 64);
+}
+
+TEST_F(ObjectPoolTest, HugePagesFallBackWhenPoolIsEmpty) {
+    // Works with or without reserved huge pages (vm.nr_hugepages)
+    ObjectPool<SimpleObject> pool(10, slick::orderbook::MemoryConfig{
+        .page_size = slick::orderbook::PageSize::Huge, .prefault = true});
+    EXPECT_EQ(pool.capacity(), PageAllocator::kHugePageSize / sizeof(SimpleObject));
+    EXPECT_LE(pool.allocator().hugePageFallbacks(), 1);
+
+    SimpleObject* obj = pool.construct(42);
+    ASSERT_NE(obj, nullptr);
+    EXPECT_EQ(obj->value, 42);
+    pool.destroy(obj);
+}
+
+TEST_F(ObjectPoolTest, NumaBoundPoolIsUsable) {
+    // Node 0 always exists; binding may still be refused in restricted containers (counted, not fatal)
+    ObjectPool<SimpleObject> pool(10, slick::orderbook::MemoryConfig{.numa_node = 0, .prefault = true});
+    EXPECT_LE(pool.allocator().bindFailures(), 1);
+
+    SimpleObject* obj = pool.construct(7);
+    ASSERT_NE(obj, nullptr);
+    EXPECT_EQ(obj->value, 7);
+    pool.destroy(obj);
+}
+
+TEST_F(ObjectPoolTest, MoveKeepsMappedBlocks) {
+    ObjectPool<SimpleObject> source(10, slick::orderbook::MemoryConfig{.prefault = true});
+    SimpleObject* obj = source.construct(5);
+
+    ObjectPool<SimpleObject> target(std::move(source));
+    EXPECT_TRUE(target.allocator().mapped());
+    EXPECT_EQ(target.size(), 1);
+    EXPECT_EQ(obj->value, 5);
+    target.destroy(obj);
+
+    ObjectPool<SimpleObject> assigned(4);
+    assigned = std::move(target);
+    EXPECT_TRUE(assigned.allocator().mapped());
+    EXPECT_NE(assigned.construct(6), nullptr);
+}
+#endif
@@ -0,0 +1,223 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/metrics.hpp>
+#include <slick/orderbook/orderbook_manager.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace slick::orderbook;
+
+TEST(LatencyHistogramTest, BucketsCoverEveryValue) {
+    // Small values are exact, larger ones land in a bucket whose bounds hold them
+    for (uint64_t nanos = 0; nanos < 8; ++nanos) {
+        EXPECT_EQ(LatencySnapshot::bucketOf(nanos), nanos);
+        EXPECT_EQ(LatencySnapshot::bucketUpperBound(nanos), nanos);
+    }
+    std::size_t previous = 0;
+    for (uint64_t nanos = 8; nanos < (uint64_t{1} << 32); nanos = nanos * 9 / 8 + 1) {
+        const std::size_t bucket = LatencySnapshot::bucketOf(nanos);
+        ASSERT_LT(bucket, LatencySnapshot::kBucketCount);
+        EXPECT_GE(bucket, previous);
+        EXPECT_GE(LatencySnapshot::bucketUpperBound(bucket), nanos);
+        EXPECT_LT(LatencySnapshot::bucketUpperBound(bucket - 1), nanos);
+        // Relative bucket width stays within 12.5%
+        EXPECT_LE(LatencySnapshot::bucketUpperBound(bucket) - nanos, nanos / 8);
+        previous = bucket;
+    }
+    EXPECT_EQ(LatencySnapshot::bucketOf(uint64_t{1} << 32), LatencySnapshot::kBucketCount - 1);
+    EXPECT_EQ(LatencySnapshot::bucketOf(~uint64_t{0}), LatencySnapshot::kBucketCount - 1);
+}
+
+TEST(LatencyHistogramTest, Percentiles) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.snapshot().percentile(0.5), 0);
+
+    for (uint64_t nanos = 1; nanos <= 1000; ++nanos) {
+        histogram.record(nanos);
+    }
+    const LatencySnapshot snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.count, 1000);
+    EXPECT_EQ(snapshot.max_nanos, 1000);
+    EXPECT_DOUBLE_EQ(snapshot.mean(), 500.5);
+    EXPECT_EQ(snapshot.percentile(0.0), 1);
+    EXPECT_EQ(snapshot.percentile(1.0), 1000);
+    EXPECT_NEAR(static_cast<double>(snapshot.percentile(0.5)), 500.0, 500.0 / 8);
+    EXPECT_NEAR(static_cast<double>(snapshot.percentile(0.99)), 990.0, 990.0 / 8);
+    EXPECT_LE(snapshot.percentile(0.999), snapshot.max_nanos);
+
+    LatencySnapshot merged = snapshot;
+    merged.merge(snapshot);
+    EXPECT_EQ(merged.count, 2000);
+    EXPECT_EQ(merged.total_nanos, 2 * snapshot.total_nanos);
+    EXPECT_EQ(merged.percentile(0.5), snapshot.percentile(0.5));
+}
+
+TEST(BookMetricsTest, CountersAndPoolGrowth) {
+    BookMetrics metrics;
+    metrics.count(BookCounter::LevelInserted);
+    metrics.count(BookCounter::LevelInserted, 2);
+    metrics.notePoolCapacity(1024);  // Baseline, not a growth
+    metrics.notePoolCapacity(1024);
+    metrics.notePoolCapacity(2048);
+    {
+        [[maybe_unused]] const auto timer = metrics.time(BookOperation::AddOrder);
+    }
+
+    const BookMetricsSnapshot snapshot = metrics.snapshot();
+    EXPECT_EQ(snapshot[BookCounter::LevelInserted], 3);
+    EXPECT_EQ(snapshot[BookCounter::PoolGrowth], 1);
+    EXPECT_EQ(snapshot[BookOperation::AddOrder].count, 1);
+    EXPECT_EQ(snapshot[BookOperation::DeleteOrder].count, 0);
+    EXPECT_STREQ(toString(BookOperation::Notify), "Notify");
+    EXPECT_STREQ(toString(BookCounter::OrderNotFound), "OrderNotFound");
+}
+
+TEST(BookMetricsTest, SnapshotWhileRecording) {
+    BookMetrics metrics;
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        for (uint64_t i = 0; i < 200000; ++i) {
+            metrics.record(BookOperation::UpdateLevel, i % 5000);
+            metrics.count(BookCounter::LevelErased);
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    // Totals a monitor sees never go backwards
+    uint64_t last_count = 0;
+    uint64_t last_erased = 0;
+    while (!done.load(std::memory_order_acquire)) {
+        const BookMetricsSnapshot snapshot = metrics.snapshot();
+        EXPECT_GE(snapshot[BookOperation::UpdateLevel].count, last_count);
+        EXPECT_GE(snapshot[BookCounter::LevelErased], last_erased);
+        last_count = snapshot[BookOperation::UpdateLevel].count;
+        last_erased = snapshot[BookCounter::LevelErased];
+    }
+    writer.join();
+    EXPECT_EQ(metrics.snapshot()[BookOperation::UpdateLevel].count, 200000);
+    EXPECT_EQ(metrics.counter(BookCounter::LevelErased), 200000);
+}
+
+#if SLICK_ORDERBOOK_METRICS
+
+namespace {
+
+class CountingObserver : public IOrderBookObserver {
+public:
+    void onPriceLevelUpdate(const PriceLevelUpdate&) override { ++updates; }
+    std::size_t updates = 0;
+};
+
+}  // namespace
+
+TEST(BookMetricsTest, OrderBookL2RecordsOperations) {
+    OrderBookL2 book(1);
+    book.updateLevel(Side::Buy, 100, 10, 1, 1);
+    book.updateLevel(Side::Buy, 99, 10, 2, 2);
+    book.updateLevel(Side::Buy, 100, 20, 3, 3);
+    book.updateLevel(Side::Buy, 99, 0, 4, 4);
+    book.updateLevel(Side::Buy, 98, 5, 5, 1);  // Out of order
+
+    const std::vector<L2Update> batch{
+        {.timestamp = 6, .seq_num = 6, .price = 101, .quantity = 5, .symbol = 1, .side = Side::Sell},
+        {.timestamp = 6, .seq_num = 6, .price = 100, .quantity = 0, .symbol = 1, .side = Side::Buy},
+    };
+    EXPECT_EQ(book.applyBatch(batch), 2);
+    EXPECT_EQ(book.applyBatch(batch), 2);  // Same seq_num is accepted again; no level changes
+    EXPECT_TRUE(book.deleteLevel(Side::Sell, 101));
+
+    const BookMetricsSnapshot snapshot = book.metrics().snapshot();
+    EXPECT_EQ(snapshot[BookOperation::UpdateLevel].count, 5);
+    EXPECT_EQ(snapshot[BookOperation::ApplyBatch].count, 2);
+    EXPECT_EQ(snapshot[BookCounter::RejectedSeqNum], 1);
+    EXPECT_EQ(snapshot[BookCounter::LevelInserted], 3);
+    EXPECT_EQ(snapshot[BookCounter::LevelErased], 3);
+    EXPECT_EQ(snapshot[BookOperation::Notify].count, 0);  // No observers, nothing timed
+}
+
+TEST(BookMetricsTest, OrderBookL2TimesObserverFanOut) {
+    OrderBookL2 book(1);
+    auto observer = std::make_shared<CountingObserver>();
+    book.addObserver(observer);
+    book.updateLevel(Side::Buy, 100, 10, 1);
+
+    // Moving the book keeps its metrics and the dispatch still records into them
+    OrderBookL2 moved(std::move(book));
+    moved.updateLevel(Side::Buy, 100, 20, 2);
+
+    const BookMetricsSnapshot snapshot = moved.metrics().snapshot();
+    EXPECT_EQ(snapshot[BookOperation::UpdateLevel].count, 2);
+    EXPECT_EQ(snapshot[BookOperation::Notify].count, observer->updates + 2);  // Plus two top-of-book fan-outs
+}
+
+TEST(BookMetricsTest, OrderBookL3RecordsOperations) {
+    OrderBookL3 book(1, 10, 4);
+    for (OrderId id = 1; id <= 500; ++id) {
+        EXPECT_TRUE(book.addOrder(id, Side::Buy, 100 - static_cast<Price>(id % 4), 10, id));
+    }
+    EXPECT_TRUE(book.modifyOrder(1, 100, 5, 600));
+    EXPECT_TRUE(book.executeOrder(2, 10, 601));
+    EXPECT_FALSE(book.deleteOrder(1000, 602));
+    EXPECT_FALSE(book.executeOrder(1000, 1, 603));
+    EXPECT_TRUE(book.addOrder(501, Side::Buy, 100, 10, 604, 0, 5));
+    EXPECT_FALSE(book.addOrder(502, Side::Buy, 100, 10, 605, 0, 1));  // Out of order
+
+    const std::vector<L3Update> batch{
+        {.timestamp = 606, .seq_num = 6, .order_id = 2000, .symbol = 1, .type = L3UpdateType::Delete},
+    };
+    EXPECT_EQ(book.applyBatch(batch), 0);
+
+    // Sweep the book so every level goes
+    const SubmitResult result = book.submitOrder(3000, Side::Sell, 0, 100000, 607, OrderType::Market);
+    EXPECT_GT(result.trade_count, 0);
+
+    const BookMetricsSnapshot snapshot = book.metrics().snapshot();
+    EXPECT_EQ(snapshot[BookOperation::AddOrder].count, 502);
+    EXPECT_EQ(snapshot[BookOperation::ModifyOrder].count, 1);
+    EXPECT_EQ(snapshot[BookOperation::ExecuteOrder].count, 2);
+    EXPECT_EQ(snapshot[BookOperation::DeleteOrder].count, 1);
+    EXPECT_EQ(snapshot[BookOperation::ApplyBatch].count, 1);
+    EXPECT_EQ(snapshot[BookOperation::SubmitOrder].count, 1);
+    EXPECT_EQ(snapshot[BookCounter::RejectedSeqNum], 1);
+    EXPECT_EQ(snapshot[BookCounter::OrderNotFound], 3);
+    EXPECT_EQ(snapshot[BookCounter::LevelInserted], 4);
+    EXPECT_EQ(snapshot[BookCounter::LevelErased], 4);
+    EXPECT_GE(snapshot[BookCounter::PoolGrowth], 1);
+}
+
+TEST(BookMetricsTest, ManagerSumsBooks) {
+    OrderBookManager<OrderBookL2> manager;
+    manager.getOrCreateOrderBook(1)->updateLevel(Side::Buy, 100, 10, 1);
+    manager.getOrCreateOrderBook(2)->updateLevel(Side::Sell, 101, 10, 1);
+    manager.getOrCreateOrderBook(3)->updateLevel(Side::Sell, 102, 10, 1);
+    EXPECT_EQ(manager.metricsSnapshot()[BookOperation::UpdateLevel].count, 3);
+
+    // Removed books stay in the totals
+    EXPECT_TRUE(manager.removeOrderBook(2));
+    EXPECT_EQ(manager.metricsSnapshot()[BookOperation::UpdateLevel].count, 3);
+    manager.clear();
+    const BookMetricsSnapshot snapshot = manager.metricsSnapshot();
+    EXPECT_EQ(snapshot[BookOperation::UpdateLevel].count, 3);
+    EXPECT_EQ(snapshot[BookCounter::LevelInserted], 3);
+
+    DirectOrderBookManager<OrderBookL2> direct;
+    direct.getOrCreateOrderBook(1)->updateLevel(Side::Buy, 100, 10, 1);
+    EXPECT_TRUE(direct.removeOrderBook(1));
+    EXPECT_EQ(direct.metricsSnapshot()[BookOperation::UpdateLevel].count, 1);
+    EXPECT_EQ(direct.reclaimRetired(), 1);
+    EXPECT_EQ(direct.metricsSnapshot()[BookOperation::UpdateLevel].count, 1);
+}
+
+#else
+
+TEST(BookMetricsTest, CompiledOutWhenDisabled) {
+    static_assert(std::is_empty_v<detail::BookMetricsSlot>);
+    static_assert(std::is_same_v<detail::ObserverDispatchOf<ObserverManager>, ObserverManager>);
+}
+
+#endif
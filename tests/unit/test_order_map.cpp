@@ -0,0 +1,217 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/detail/order_map.hpp>
+#include <gtest/gtest.h>
+#include <deque>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace slick::orderbook;
+using namespace slick::orderbook::detail;
+
+// Degenerate hash that maps every id to the same slot, forcing long probe chains
+struct ConstantHash {
+    constexpr std::size_t operator()(OrderId) const noexcept { return 7; }
+};
+
+// Identity hash, so tests can place keys at known home slots
+struct IdentityHash {
+    constexpr std::size_t operator()(OrderId id) const noexcept { return static_cast<std::size_t>(id); }
+};
+
+class OrderMapTest : public ::testing::Test {
+protected:
+    Order* makeOrder(OrderId id) {
+        return &orders_.emplace_back(id, 10000, 100, Side::Buy, 1);
+    }
+
+    std::deque<Order> orders_;  // Stable addresses
+};
+
+TEST_F(OrderMapTest, InitialState) {
+    OrderMap map(100);
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_GE(map.capacity(), 100);
+    EXPECT_TRUE(std::has_single_bit(map.slotCount()));
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST_F(OrderMapTest, InsertFindErase) {
+    OrderMap map(16);
+    Order* order = makeOrder(42);
+
+    EXPECT_TRUE(map.insert(order));
+    EXPECT_EQ(map.size(), 1);
+    EXPECT_TRUE(map.contains(42));
+    EXPECT_EQ(map.find(42), order);
+    EXPECT_EQ(map.find(43), nullptr);
+
+    // Duplicate insert fails
+    EXPECT_FALSE(map.insert(makeOrder(42)));
+    EXPECT_EQ(map.size(), 1);
+    EXPECT_EQ(map.find(42), order);
+
+    EXPECT_TRUE(map.erase(42));
+    EXPECT_FALSE(map.erase(42));
+    EXPECT_FALSE(map.contains(42));
+    EXPECT_TRUE(map.empty());
+}
+
+TEST_F(OrderMapTest, OrderIdZeroIsValidKey) {
+    OrderMap map(16);
+    Order* order = makeOrder(0);
+    EXPECT_TRUE(map.insert(order));
+    EXPECT_EQ(map.find(0), order);
+    EXPECT_FALSE(map.contains(1));
+}
+
+TEST_F(OrderMapTest, NoGrowthWithinReservedCapacity) {
+    OrderMap map(1000);
+    const std::size_t slots = map.slotCount();
+    for (OrderId id = 1; id <= 1000; ++id) {
+        ASSERT_TRUE(map.insert(makeOrder(id)));
+    }
+    EXPECT_EQ(map.slotCount(), slots);
+    EXPECT_EQ(map.size(), 1000);
+}
+
+TEST_F(OrderMapTest, GrowsBeyondCapacity) {
+    OrderMap map(16);
+    const std::size_t initial_slots = map.slotCount();
+    for (OrderId id = 1; id <= 10000; ++id) {
+        ASSERT_TRUE(map.insert(makeOrder(id)));
+    }
+    EXPECT_GT(map.slotCount(), initial_slots);
+    EXPECT_EQ(map.size(), 10000);
+    for (OrderId id = 1; id <= 10000; ++id) {
+        ASSERT_NE(map.find(id), nullptr) << id;
+        EXPECT_EQ(map.find(id)->order_id, id);
+    }
+}
+
+TEST_F(OrderMapTest, ReserveAndClear) {
+    OrderMap map(16);
+    map.reserve(5000);
+    EXPECT_GE(map.capacity(), 5000);
+    for (OrderId id = 1; id <= 100; ++id) {
+        map.insert(makeOrder(id));
+    }
+    const std::size_t slots = map.slotCount();
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.slotCount(), slots);  // Capacity retained
+    EXPECT_FALSE(map.contains(1));
+}
+
+TEST_F(OrderMapTest, TrimShrinksToHighWatermark) {
+    OrderMap map(16);
+    for (OrderId id = 1; id <= 10000; ++id) {
+        map.insert(makeOrder(id));
+    }
+    for (OrderId id = 101; id <= 10000; ++id) {
+        map.erase(id);
+    }
+    const std::size_t grown_bytes = map.memoryUsage();
+    EXPECT_EQ(grown_bytes, map.slotCount() * sizeof(OrderMap::value_type));
+
+    map.trim(1000);
+    EXPECT_GE(map.capacity(), 1000);
+    EXPECT_LT(map.memoryUsage(), grown_bytes);
+    const std::size_t kept_slots = map.slotCount();
+
+    map.shrink_to_fit();
+    EXPECT_LT(map.slotCount(), kept_slots);
+    EXPECT_GE(map.capacity(), 100);
+    EXPECT_EQ(map.size(), 100);
+    for (OrderId id = 1; id <= 100; ++id) {
+        ASSERT_NE(map.find(id), nullptr) << id;
+        EXPECT_EQ(map.find(id)->order_id, id);
+    }
+    EXPECT_FALSE(map.contains(101));
+
+    // Trimming never grows
+    const std::size_t slots = map.slotCount();
+    map.trim(0);
+    EXPECT_EQ(map.slotCount(), slots);
+}
+
+TEST_F(OrderMapTest, BackwardShiftKeepsCollidingKeysReachable) {
+    BasicOrderMap<ConstantHash> map(16);
+    for (OrderId id = 1; id <= 10; ++id) {
+        ASSERT_TRUE(map.insert(makeOrder(id)));
+    }
+
+    // Remove from the middle of the probe chain, then verify the rest is intact
+    EXPECT_TRUE(map.erase(3));
+    EXPECT_TRUE(map.erase(7));
+    EXPECT_TRUE(map.erase(1));
+    for (OrderId id = 1; id <= 10; ++id) {
+        const bool erased = (id == 1 || id == 3 || id == 7);
+        EXPECT_EQ(map.contains(id), !erased) << id;
+    }
+    EXPECT_EQ(map.size(), 7);
+}
+
+TEST_F(OrderMapTest, BackwardShiftAcrossWrapAround) {
+    BasicOrderMap<IdentityHash> map(8);
+    const std::size_t slots = map.slotCount();
+    const OrderId last = slots - 1;
+
+    // Two keys homed at the last slot: the second wraps to slot 0,
+    // and a key homed at slot 0 is displaced to slot 1
+    ASSERT_TRUE(map.insert(makeOrder(last)));
+    ASSERT_TRUE(map.insert(makeOrder(last + slots)));
+    ASSERT_TRUE(map.insert(makeOrder(slots)));
+
+    EXPECT_TRUE(map.erase(last));
+    EXPECT_TRUE(map.contains(last + slots));
+    EXPECT_TRUE(map.contains(slots));
+
+    EXPECT_TRUE(map.erase(last + slots));
+    EXPECT_TRUE(map.contains(slots));
+    EXPECT_EQ(map.size(), 1);
+}
+
+TEST_F(OrderMapTest, IterationVisitsAllEntries) {
+    OrderMap map(64);
+    for (OrderId id = 1; id <= 50; ++id) {
+        map.insert(makeOrder(id * 3));
+    }
+    map.erase(9);
+
+    std::size_t count = 0;
+    OrderId sum = 0;
+    for (const auto& [order_id, order] : map) {
+        EXPECT_EQ(order->order_id, order_id);
+        sum += order_id;
+        ++count;
+    }
+    EXPECT_EQ(count, 49);
+    EXPECT_EQ(sum, 3 * (50 * 51 / 2) - 9);
+}
+
+TEST_F(OrderMapTest, RandomizedAgainstUnorderedMap) {
+    OrderMap map(256);
+    std::unordered_map<OrderId, Order*> reference;
+    std::mt19937_64 rng(12345);
+    std::uniform_int_distribution<OrderId> id_dist(1, 2000);
+
+    for (int i = 0; i < 20000; ++i) {
+        const OrderId id = id_dist(rng);
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(map.erase(id), reference.erase(id) > 0);
+        } else {
+            Order* order = makeOrder(id);
+            EXPECT_EQ(map.insert(order), reference.try_emplace(id, order).second);
+        }
+        ASSERT_EQ(map.size(), reference.size());
+    }
+
+    for (OrderId id = 1; id <= 2000; ++id) {
+        auto it = reference.find(id);
+        EXPECT_EQ(map.find(id), it == reference.end() ? nullptr : it->second) << id;
+    }
+}
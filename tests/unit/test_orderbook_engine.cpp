@@ -0,0 +1,274 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/orderbook_engine.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace slick::orderbook;
+using namespace slick::orderbook::detail;
+
+// ============================================================================
+// MPSCRing
+// ============================================================================
+
+TEST(MPSCRingTest, PushPopFifo) {
+    MPSCRing<int> ring(3);
+    EXPECT_EQ(ring.capacity(), 4);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(ring.tryPush(i));
+    }
+    EXPECT_FALSE(ring.tryPush(4));  // Full
+    EXPECT_EQ(ring.size(), 4);
+    EXPECT_EQ(ring.pushed(), 4);
+
+    int value = -1;
+    ASSERT_TRUE(ring.tryPop(value));
+    EXPECT_EQ(value, 0);
+    ASSERT_TRUE(ring.tryPush(4));   // Wraps around
+
+    for (int expected = 1; expected <= 4; ++expected) {
+        ASSERT_TRUE(ring.tryPop(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_FALSE(ring.tryPop(value));
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(MPSCRingTest, ConcurrentProducersKeepPerProducerOrder) {
+    constexpr int kProducers = 4;
+    constexpr uint64_t kCount = 50000;
+    MPSCRing<uint64_t> ring(128);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&ring, p]() {
+            for (uint64_t i = 0; i < kCount; ++i) {
+                const uint64_t value = (static_cast<uint64_t>(p) << 32) | i;
+                while (!ring.tryPush(value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<uint64_t> next(kProducers, 0);
+    uint64_t received = 0;
+    uint64_t value = 0;
+    while (received < kProducers * kCount) {
+        if (ring.tryPop(value)) {
+            const auto producer = static_cast<std::size_t>(value >> 32);
+            ASSERT_EQ(value & 0xFFFFFFFF, next[producer]);
+            ++next[producer];
+            ++received;
+        }
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_TRUE(ring.empty());
+}
+
+// ============================================================================
+// OrderBookEngine
+// ============================================================================
+
+namespace {
+
+class TopOfBookCounter : public IOrderBookObserver {
+public:
+    std::size_t tob_updates = 0;
+    std::size_t level_updates = 0;
+
+    void onPriceLevelUpdate(const PriceLevelUpdate&) override { ++level_updates; }
+    void onTopOfBookUpdate(const TopOfBook&) override { ++tob_updates; }
+};
+
+L2Update level(SymbolId symbol, Side side, Price price, Quantity quantity, uint64_t seq_num = 0) {
+    return L2Update{.timestamp = seq_num + 1, .seq_num = seq_num, .price = price,
+                    .quantity = quantity, .symbol = symbol, .side = side};
+}
+
+}  // namespace
+
+TEST(OrderBookEngineTest, PollAppliesL2UpdatesPerShard) {
+    OrderBookEngine<OrderBookL2> engine({.num_shards = 2});
+    EXPECT_EQ(engine.shardCount(), 2);
+    EXPECT_EQ(engine.shardOf(4), 0);
+    EXPECT_EQ(engine.shardOf(7), 1);
+
+    ASSERT_TRUE(engine.trySubmit(level(4, Side::Buy, 10000, 100)));
+    ASSERT_TRUE(engine.trySubmit(level(7, Side::Sell, 20100, 30)));
+    ASSERT_TRUE(engine.trySubmit(level(4, Side::Sell, 10100, 50)));
+    EXPECT_EQ(engine.pending(0), 2);
+    EXPECT_EQ(engine.pending(1), 1);
+    EXPECT_EQ(engine.manager().symbolCount(), 0);  // Nothing applied before a drain
+
+    EXPECT_EQ(engine.poll(0), 2);
+    EXPECT_EQ(engine.poll(1), 1);
+
+    const auto* book4 = engine.manager().getOrderBook(4);
+    const auto* book7 = engine.manager().getOrderBook(7);
+    ASSERT_NE(book4, nullptr);
+    ASSERT_NE(book7, nullptr);
+    EXPECT_EQ(book4->getBestBid()->price, 10000);
+    EXPECT_EQ(book4->getBestAsk()->quantity, 50);
+    EXPECT_EQ(book7->getBestAsk()->price, 20100);
+
+    const auto stats = engine.stats();
+    EXPECT_EQ(stats.messages, 3);
+    EXPECT_EQ(stats.batches, 2);
+    EXPECT_EQ(stats.max_batch, 2);
+    EXPECT_EQ(stats.books, 2);
+    EXPECT_EQ(engine.stats(0).messages, 2);
+}
+
+TEST(OrderBookEngineTest, PollRespectsMaxMessages) {
+    OrderBookEngine<OrderBookL2> engine({.max_batch = 4});
+    for (Price price = 10000; price < 10010; ++price) {
+        ASSERT_TRUE(engine.trySubmit(level(1, Side::Buy, price, 10)));
+    }
+    EXPECT_EQ(engine.poll(0, 3), 3);
+    EXPECT_EQ(engine.poll(0), 7);
+    EXPECT_EQ(engine.stats(0).batches, 3);      // 3, then 4 + 3
+    EXPECT_EQ(engine.stats(0).max_batch, 4);
+    EXPECT_EQ(engine.manager().getOrderBook(1)->levelCount(Side::Buy), 10);
+}
+
+TEST(OrderBookEngineTest, TrySubmitReportsFullRing) {
+    OrderBookEngine<OrderBookL2> engine({.queue_capacity = 2});
+    EXPECT_TRUE(engine.trySubmit(level(1, Side::Buy, 10000, 10)));
+    EXPECT_TRUE(engine.trySubmit(level(1, Side::Buy, 10001, 10)));
+    EXPECT_FALSE(engine.trySubmit(level(1, Side::Buy, 10002, 10)));
+    EXPECT_EQ(engine.stats().queue_full, 1);
+    EXPECT_EQ(engine.poll(0), 2);
+}
+
+TEST(OrderBookEngineTest, SameSymbolRunsBatchTopOfBook) {
+    OrderBookEngine<OrderBookL2> engine;
+    auto observer = std::make_shared<TopOfBookCounter>();
+    engine.onBookCreated([&observer](OrderBookL2& book) { book.addObserver(observer); });
+
+    // Two runs for symbol 1 separated by symbol 2: one top-of-book per run
+    ASSERT_TRUE(engine.trySubmit(level(1, Side::Buy, 10000, 10)));
+    ASSERT_TRUE(engine.trySubmit(level(1, Side::Buy, 10001, 10)));
+    ASSERT_TRUE(engine.trySubmit(level(1, Side::Sell, 10005, 10)));
+    ASSERT_TRUE(engine.trySubmit(level(2, Side::Buy, 500, 10)));
+    ASSERT_TRUE(engine.trySubmit(level(1, Side::Buy, 10002, 10)));
+    EXPECT_EQ(engine.poll(0), 5);
+
+    EXPECT_EQ(observer->level_updates, 5);
+    EXPECT_EQ(observer->tob_updates, 3);
+    EXPECT_EQ(engine.manager().getOrderBook(1)->getBestBid()->price, 10002);
+}
+
+TEST(OrderBookEngineTest, CountsRejectedMessages) {
+    OrderBookEngine<OrderBookL2> engine;
+    ASSERT_TRUE(engine.trySubmit(level(1, Side::Buy, 10000, 10, 5)));
+    ASSERT_TRUE(engine.trySubmit(level(1, Side::Buy, 10001, 10, 3)));   // Out of order
+    ASSERT_TRUE(engine.trySubmit(level(1, Side::Buy, 10002, 10, 6)));
+    EXPECT_EQ(engine.poll(0), 3);
+
+    EXPECT_EQ(engine.stats().rejected, 1);
+    EXPECT_EQ(engine.manager().getOrderBook(1)->levelCount(Side::Buy), 2);
+}
+
+TEST(OrderBookEngineTest, AppliesL3Updates) {
+    OrderBookEngine<OrderBookL3> engine({.num_shards = 2});
+    const SymbolId symbol = 3;
+    const L3Update updates[] = {
+        {.timestamp = 1, .order_id = 1, .price = 10000, .quantity = 100, .symbol = symbol, .side = Side::Buy, .type = L3UpdateType::Add},
+        {.timestamp = 2, .order_id = 2, .price = 10000, .quantity = 50, .symbol = symbol, .side = Side::Buy, .type = L3UpdateType::Add},
+        {.timestamp = 3, .order_id = 3, .price = 10100, .quantity = 70, .symbol = symbol, .side = Side::Sell, .type = L3UpdateType::Add},
+        {.timestamp = 4, .order_id = 1, .quantity = 40, .symbol = symbol, .type = L3UpdateType::Execute},
+        {.timestamp = 5, .order_id = 3, .price = 10200, .quantity = 70, .symbol = symbol, .type = L3UpdateType::Modify},
+        {.timestamp = 6, .order_id = 2, .symbol = symbol, .type = L3UpdateType::Delete},
+        {.timestamp = 7, .order_id = 99, .symbol = symbol, .type = L3UpdateType::Delete},  // Unknown order
+    };
+    for (const auto& update : updates) {
+        ASSERT_TRUE(engine.trySubmit(update));
+    }
+    EXPECT_EQ(engine.poll(engine.shardOf(symbol)), 7);
+
+    const auto* book = engine.manager().getOrderBook(symbol);
+    ASSERT_NE(book, nullptr);
+    EXPECT_EQ(book->orderCount(), 2);
+    EXPECT_EQ(book->findOrder(1)->quantity, 60);
+    EXPECT_EQ(book->getBestAsk()->price, 10200);
+    EXPECT_EQ(engine.stats().rejected, 1);
+}
+
+TEST(OrderBookEngineTest, ShardMemoryPlacesBooks) {
+    OrderBookEngine<OrderBookL3> engine({.num_shards = 2, .shard_memory = {MemoryConfig{.prefault = true}}});
+    for (SymbolId symbol : {SymbolId{2}, SymbolId{3}}) {
+        ASSERT_TRUE(engine.trySubmit({.timestamp = 1, .order_id = 1, .price = 10000, .quantity = 100, .symbol = symbol,
+                                      .side = Side::Buy, .type = L3UpdateType::Add}));
+        engine.poll(engine.shardOf(symbol));
+    }
+
+    // Shard 0 has a placement, shard 1 falls back to the heap
+    EXPECT_TRUE(engine.manager().getOrderBook(2)->orderPoolAllocator().config().prefault);
+    EXPECT_FALSE(engine.manager().getOrderBook(3)->orderPoolAllocator().config().prefault);
+    EXPECT_EQ(engine.manager().getOrderBook(2)->orderCount(), 1);
+}
+
+TEST(OrderBookEngineTest, WorkersApplyConcurrentSubmissions) {
+    constexpr int kProducers = 3;
+    constexpr SymbolId kSymbols = 16;
+    constexpr int kUpdatesPerSymbol = 2000;
+
+    OrderBookEngine<OrderBookL2> engine({.num_shards = 4, .queue_capacity = 256, .max_batch = 32});
+    engine.onBookCreated([](OrderBookL2& book) { book.setPublishedDepth(5); });
+    engine.start();
+    EXPECT_TRUE(engine.running());
+
+    // Producer p owns symbols p, p + kProducers, ...: per-symbol order is the producer's order
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&engine, p]() {
+            for (int i = 0; i < kUpdatesPerSymbol; ++i) {
+                for (SymbolId symbol = static_cast<SymbolId>(p); symbol < kSymbols; symbol += kProducers) {
+                    const auto seq = static_cast<uint64_t>(i + 1);
+                    engine.submit(level(symbol, Side::Buy, 10000 + (i % 20), i + 1, seq));
+                }
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    engine.waitIdle();
+
+    const auto stats = engine.stats();
+    EXPECT_EQ(stats.messages, static_cast<uint64_t>(kSymbols) * kUpdatesPerSymbol);
+    EXPECT_EQ(stats.rejected, 0);
+    EXPECT_EQ(stats.books, kSymbols);
+    for (SymbolId symbol = 0; symbol < kSymbols; ++symbol) {
+        const auto* book = engine.manager().getOrderBook(symbol);
+        ASSERT_NE(book, nullptr);
+        EXPECT_EQ(book->getLastSeqNum(), static_cast<uint64_t>(kUpdatesPerSymbol));
+        EXPECT_EQ(book->levelCount(Side::Buy), 20);
+
+        DepthSnapshot<5> depth;
+        book->readDepth(depth);
+        EXPECT_EQ(depth.bid_count, 5);
+        EXPECT_EQ(depth.seq_num, static_cast<uint64_t>(kUpdatesPerSymbol));
+    }
+
+    engine.stop();
+    EXPECT_FALSE(engine.running());
+}
+
+TEST(OrderBookEngineTest, StopAppliesQueuedMessages) {
+    OrderBookEngine<OrderBookL2> engine({.num_shards = 2});
+    engine.start();
+    for (Price price = 10000; price < 10100; ++price) {
+        engine.submit(level(static_cast<SymbolId>(price % 4), Side::Sell, price, 1));
+    }
+    engine.stop();
+    EXPECT_EQ(engine.stats().messages, 100);
+    EXPECT_EQ(engine.pending(0) + engine.pending(1), 0);
+}
@@ -3,7 +3,10 @@
 
 #include <slick/orderbook/orderbook_l2.hpp>
 #include <gtest/gtest.h>
+#include <array>
+#include <atomic>
 #include <memory>
+#include <thread>
 
 using namespace slick::orderbook;
 
@@ -206,6 +209,53 @@ TEST_F(OrderBookL2Test, GetLevelsWithDepth) {
     EXPECT_EQ(levels.size(), 3);
 }
 
+template<typename Book>
+concept HasLevelsView = requires(const Book& book) { book.getLevelsView(Side::Buy); };
+
+TEST_F(OrderBookL2Test, GetLevelsViewAndBuffer) {
+    OrderBookL2 book(kSymbol);
+
+    book.updateLevel(Side::Buy, kPrice100, kQty10, kTs1);
+    book.updateLevel(Side::Buy, kPrice99, kQty20, kTs1);
+    book.updateLevel(Side::Buy, kPrice98, kQty30, kTs1);
+
+    // In-place view over the container
+    auto view = book.getLevelsView(Side::Buy, 2);
+    ASSERT_EQ(view.size(), 2);
+    EXPECT_EQ(view[0].price, kPrice100);
+    EXPECT_EQ(view[1].price, kPrice99);
+    EXPECT_EQ(view.data(), book.getLevelByIndex(Side::Buy, 0));  // No copy
+    EXPECT_EQ(book.getLevelsView(Side::Buy).size(), 3);
+    EXPECT_EQ(book.getLevelsView(Side::Buy, 10).size(), 3);
+    EXPECT_TRUE(book.getLevelsView(Side::Sell).empty());
+
+    // Caller buffer
+    std::array<detail::PriceLevelL2, 2> small;
+    ASSERT_EQ(book.getLevels(Side::Buy, small), 2);
+    EXPECT_EQ(small[0].price, kPrice100);
+    EXPECT_EQ(small[1].quantity, kQty20);
+
+    std::array<detail::PriceLevelL2, 8> large;
+    ASSERT_EQ(book.getLevels(Side::Buy, large), 3);
+    EXPECT_EQ(large[2].price, kPrice98);
+    EXPECT_EQ(book.getLevels(Side::Sell, large), 0);
+}
+
+TEST_F(OrderBookL2Test, LadderGetLevelsBuffer) {
+    LadderOrderBookL2 book(kSymbol, PriceLadderConfig{100, 16});
+    static_assert(!HasLevelsView<LadderOrderBookL2>);
+    static_assert(HasLevelsView<OrderBookL2>);
+
+    book.updateLevel(Side::Sell, kPrice102, kQty20, kTs1);
+    book.updateLevel(Side::Sell, kPrice101, kQty10, kTs1);
+
+    std::array<detail::PriceLevelL2, 4> out;
+    ASSERT_EQ(book.getLevels(Side::Sell, out), 2);
+    EXPECT_EQ(out[0].price, kPrice101);
+    EXPECT_EQ(out[1].price, kPrice102);
+    EXPECT_EQ(out[1].quantity, kQty20);
+}
+
 TEST_F(OrderBookL2Test, ClearSide) {
     OrderBookL2 book(kSymbol);
 
@@ -569,3 +619,421 @@ TEST_F(OrderBookL2Test, SequenceNumberMultipleSides) {
     auto bid_levels = book.getLevels(Side::Buy);
     EXPECT_EQ(bid_levels.size(), 1);  // Only first bid exists
 }
+
+// ============================================================================
+// Snapshot Loading Tests
+// ============================================================================
+
+class SnapshotObserverL2 : public BatchObserverL2 {
+public:
+    int snapshot_begin_count = 0;
+    int snapshot_end_count = 0;
+    uint64_t snapshot_seq_num = 0;
+
+    void onSnapshotBegin([[maybe_unused]] SymbolId symbol, uint64_t seq_num, [[maybe_unused]] Timestamp timestamp) override {
+        ++snapshot_begin_count;
+        snapshot_seq_num = seq_num;
+    }
+
+    void onSnapshotEnd([[maybe_unused]] SymbolId symbol, [[maybe_unused]] uint64_t seq_num, [[maybe_unused]] Timestamp timestamp) override {
+        ++snapshot_end_count;
+    }
+};
+
+TEST_F(OrderBookL2Test, LoadSnapshotUnsorted) {
+    OrderBookL2 book(kSymbol);
+    book.updateLevel(Side::Buy, 5000, kQty10, kTs1, 10);  // Stale level, replaced by the snapshot
+
+    const std::vector<detail::PriceLevelL2> bids{{kPrice98, kQty30, kTs1}, {kPrice100, kQty10, kTs1}, {kPrice99, kQty20, kTs1}};
+    const std::vector<detail::PriceLevelL2> asks{{kPrice102, kQty20, kTs1}, {kPrice101, kQty10, kTs1}};
+    book.loadSnapshot(bids, asks, 5, kTs2);
+
+    EXPECT_EQ(book.getLastSeqNum(), 5);  // Snapshot resets the sequence, even backwards
+    auto bid_levels = book.getLevels(Side::Buy);
+    ASSERT_EQ(bid_levels.size(), 3);
+    EXPECT_EQ(bid_levels[0].price, kPrice100);
+    EXPECT_EQ(bid_levels[1].price, kPrice99);
+    EXPECT_EQ(bid_levels[2].price, kPrice98);
+    auto ask_levels = book.getLevels(Side::Sell);
+    ASSERT_EQ(ask_levels.size(), 2);
+    EXPECT_EQ(ask_levels[0].price, kPrice101);
+    EXPECT_EQ(ask_levels[1].price, kPrice102);
+
+    auto tob = book.getTopOfBook();
+    EXPECT_EQ(tob.best_bid, kPrice100);
+    EXPECT_EQ(tob.best_ask, kPrice101);
+    EXPECT_EQ(tob.ask_quantity, kQty10);
+
+    // Updates continue from the snapshot sequence number
+    book.updateLevel(Side::Buy, kPrice100, kQty40, kTs2, 6);
+    EXPECT_EQ(book.getBestBid()->quantity, kQty40);
+}
+
+TEST_F(OrderBookL2Test, LoadSnapshotSkipsEmptyAndKeepsLastDuplicate) {
+    OrderBookL2 book(kSymbol);
+    const std::vector<detail::PriceLevelL2> bids{{kPrice100, kQty10, kTs1}, {kPrice99, 0, kTs1}, {kPrice100, kQty30, kTs2}};
+    book.loadSnapshot(bids, {});
+
+    auto bid_levels = book.getLevels(Side::Buy);
+    ASSERT_EQ(bid_levels.size(), 1);
+    EXPECT_EQ(bid_levels[0].price, kPrice100);
+    EXPECT_EQ(bid_levels[0].quantity, kQty30);
+    EXPECT_TRUE(book.isEmpty(Side::Sell));
+}
+
+TEST_F(OrderBookL2Test, LoadSnapshotNotifiesOnce) {
+    OrderBookL2 book(kSymbol);
+    auto observer = std::make_shared<SnapshotObserverL2>();
+    book.addObserver(observer);
+
+    const std::vector<detail::PriceLevelL2> bids{{kPrice100, kQty10, kTs1}, {kPrice99, kQty20, kTs1}};
+    const std::vector<detail::PriceLevelL2> asks{{kPrice101, kQty10, kTs1}};
+    book.loadSnapshot(bids, asks, 42, kTs2);
+
+    EXPECT_EQ(observer->snapshot_begin_count, 1);
+    EXPECT_EQ(observer->snapshot_end_count, 1);
+    EXPECT_EQ(observer->snapshot_seq_num, 42);
+    ASSERT_EQ(observer->level_updates.size(), 3);
+    EXPECT_EQ(observer->level_updates[0].price, kPrice100);
+    EXPECT_EQ(observer->level_updates[1].level_index, 1);
+    ASSERT_EQ(observer->tob_updates.size(), 1);
+    EXPECT_EQ(observer->tob_updates[0].best_bid, kPrice100);
+    EXPECT_EQ(observer->tob_updates[0].best_ask, kPrice101);
+
+    // Loading the same snapshot again leaves the top of book unchanged
+    observer->reset();
+    book.loadSnapshot(bids, asks, 43, kTs2);
+    EXPECT_EQ(observer->level_updates.size(), 3);
+    EXPECT_TRUE(observer->tob_updates.empty());
+}
+
+TEST_F(OrderBookL2Test, LoadSnapshotLadderBook) {
+    LadderOrderBookL2 book(kSymbol, PriceLadderConfig{100, 16});
+    std::vector<detail::PriceLevelL2> bids;
+    for (Price price = kPrice100; price > kPrice100 - 100 * 50; price -= 100) {
+        bids.emplace_back(price, kQty10, kTs1);
+    }
+    book.loadSnapshot(bids, {});
+
+    EXPECT_EQ(book.levelCount(Side::Buy), 50);
+    EXPECT_EQ(book.getBestBid()->price, kPrice100);
+    EXPECT_EQ(book.getLevelByIndex(Side::Buy, 49)->price, kPrice100 - 100 * 49);
+}
+
+// ============================================================================
+// Observer Subscription Tests
+// ============================================================================
+
+TEST_F(OrderBookL2Test, ObserverEventMask) {
+    OrderBookL2 book(kSymbol);
+    auto tob_observer = std::make_shared<SnapshotObserverL2>();
+    auto snapshot_observer = std::make_shared<SnapshotObserverL2>();
+    book.addObserver(tob_observer, TopOfBookEvents);
+    book.addObserver(snapshot_observer, SnapshotEvents);
+
+    book.updateLevel(Side::Buy, kPrice100, kQty10, kTs1);
+    book.updateLevel(Side::Buy, kPrice99, kQty20, kTs1);
+    book.updateLevel(Side::Sell, kPrice101, kQty10, kTs1);
+    book.updateLevel(Side::Buy, kPrice100, 0, kTs2);
+    book.emitSnapshot(kTs2);
+
+    EXPECT_TRUE(tob_observer->level_updates.empty());
+    EXPECT_EQ(tob_observer->snapshot_begin_count, 0);
+    ASSERT_EQ(tob_observer->tob_updates.size(), 3);
+    EXPECT_EQ(tob_observer->tob_updates.back().best_bid, kPrice99);
+    EXPECT_EQ(tob_observer->tob_updates.back().bid_quantity, kQty20);
+
+    EXPECT_TRUE(snapshot_observer->level_updates.empty());
+    EXPECT_TRUE(snapshot_observer->tob_updates.empty());
+    EXPECT_EQ(snapshot_observer->snapshot_begin_count, 1);
+    EXPECT_EQ(snapshot_observer->snapshot_end_count, 1);
+}
+
+TEST_F(OrderBookL2Test, ObserverDepthFilter) {
+    OrderBookL2 book(kSymbol);
+    auto top2_observer = std::make_shared<BatchObserverL2>();
+    auto all_observer = std::make_shared<BatchObserverL2>();
+    book.addObserver(top2_observer, AllEvents, 2);
+    book.addObserver(all_observer);
+
+    book.updateLevel(Side::Buy, kPrice100, kQty10, kTs1);
+    book.updateLevel(Side::Buy, kPrice99, kQty20, kTs1);
+    book.updateLevel(Side::Buy, kPrice98, kQty30, kTs1);    // Level 2
+    book.updateLevel(Side::Buy, kPrice98, kQty40, kTs1);
+    book.updateLevel(Side::Sell, kPrice101, kQty10, kTs1);
+
+    ASSERT_EQ(top2_observer->level_updates.size(), 3);
+    EXPECT_EQ(top2_observer->level_updates[2].price, kPrice101);
+    EXPECT_EQ(all_observer->level_updates.size(), 5);
+    EXPECT_EQ(all_observer->level_updates[3].level_index, 2);
+    EXPECT_EQ(top2_observer->tob_updates.size(), all_observer->tob_updates.size());
+
+    // Snapshots are filtered the same way
+    top2_observer->reset();
+    book.emitSnapshot(kTs2);
+    EXPECT_EQ(top2_observer->level_updates.size(), 3);
+}
+
+TEST_F(OrderBookL2Test, TopOfBookOnlyObserverTracksBestLevel) {
+    OrderBookL2 book(kSymbol);
+    auto observer = std::make_shared<BatchObserverL2>();
+    book.addObserver(observer, TopOfBookEvents);
+
+    book.updateLevel(Side::Buy, kPrice98, kQty10, kTs1);
+    book.updateLevel(Side::Buy, kPrice99, kQty10, kTs1);
+    book.updateLevel(Side::Buy, kPrice98, kQty20, kTs1);    // Not top of book
+    ASSERT_EQ(observer->tob_updates.size(), 2);
+
+    book.updateLevel(Side::Buy, kPrice99, 0, kTs2);
+    ASSERT_EQ(observer->tob_updates.size(), 3);
+    EXPECT_EQ(observer->tob_updates.back().best_bid, kPrice98);
+    EXPECT_EQ(observer->tob_updates.back().bid_quantity, kQty20);
+}
+
+TEST_F(OrderBookL2Test, PublishedDepthDisabledByDefault) {
+    OrderBookL2 book(kSymbol);
+    book.updateLevel(Side::Buy, kPrice100, kQty10, kTs1);
+
+    DepthSnapshot<5> depth;
+    book.readDepth(depth);
+    EXPECT_EQ(book.publishedDepth(), 0);
+    EXPECT_EQ(depth.bid_count, 0);
+    EXPECT_EQ(depth.version, 0);
+}
+
+TEST_F(OrderBookL2Test, PublishedDepthTracksTopLevels) {
+    OrderBookL2 book(kSymbol);
+    book.updateLevel(Side::Buy, kPrice100, kQty10, kTs1);
+    book.setPublishedDepth(2);    // Publishes the current book
+    EXPECT_EQ(book.publishedDepth(), 2);
+
+    DepthSnapshot<4> depth;
+    book.readDepth(depth);
+    EXPECT_EQ(depth.version, 1);
+    ASSERT_EQ(depth.bid_count, 1);
+    EXPECT_EQ(depth.bids[0].price, kPrice100);
+
+    book.updateLevel(Side::Buy, kPrice99, kQty20, kTs1, 7);
+    book.updateLevel(Side::Buy, kPrice98, kQty30, kTs1, 8);  // Third level: not published
+    book.updateLevel(Side::Sell, kPrice101, kQty40, kTs2, 9);
+    book.readDepth(depth);
+    EXPECT_EQ(depth.version, 3);
+    ASSERT_EQ(depth.bid_count, 2);   // Capped at published depth
+    EXPECT_EQ(depth.bids[1].price, kPrice99);
+    EXPECT_EQ(depth.bids[1].quantity, kQty20);
+    ASSERT_EQ(depth.ask_count, 1);
+    EXPECT_EQ(depth.asks[0].price, kPrice101);
+    EXPECT_EQ(depth.timestamp, kTs2);
+    EXPECT_EQ(depth.seq_num, 9);
+
+    // Intermediate batch updates publish once, at the end of the batch
+    book.updateLevel(Side::Buy, kPrice100, 0, kTs2, 10, false);
+    book.updateLevel(Side::Buy, kPrice99, kQty10, kTs2, 11, true);
+    book.readDepth(depth);
+    EXPECT_EQ(depth.version, 4);
+    ASSERT_EQ(depth.bid_count, 2);
+    EXPECT_EQ(depth.bids[0].price, kPrice99);
+    EXPECT_EQ(depth.bids[0].quantity, kQty10);
+    EXPECT_EQ(depth.bids[1].price, kPrice98);
+
+    // A smaller snapshot only copies what fits
+    DepthSnapshot<1> top;
+    book.readDepth(top);
+    EXPECT_EQ(top.bid_count, 1);
+    EXPECT_EQ(top.bids[0].price, kPrice99);
+}
+
+TEST_F(OrderBookL2Test, PublishedDepthLadderBookAndSnapshot) {
+    LadderOrderBookL2 book(kSymbol, PriceLadderConfig{1, 64});
+    book.setPublishedDepth(3);
+
+    std::vector<detail::PriceLevelL2> bids{{kPrice98, kQty30, kTs1}, {kPrice100, kQty10, kTs1}, {kPrice99, kQty20, kTs1}};
+    std::vector<detail::PriceLevelL2> asks{{kPrice101, kQty40, kTs1}};
+    book.loadSnapshot(bids, asks, 42, kTs2);
+
+    DepthSnapshot<3> depth;
+    book.readDepth(depth);
+    ASSERT_EQ(depth.bid_count, 3);
+    EXPECT_EQ(depth.bids[0].price, kPrice100);
+    EXPECT_EQ(depth.bids[2].price, kPrice98);
+    EXPECT_EQ(depth.ask_count, 1);
+    EXPECT_EQ(depth.seq_num, 42);
+}
+
+TEST_F(OrderBookL2Test, PublishedDepthConsistentAcrossThreads) {
+#if SLICK_TSAN_ENABLED
+    GTEST_SKIP() << "Disabled under TSAN (seqlock read path is not TSAN-friendly).";
+#endif
+    constexpr std::size_t kDepth = 10;
+    constexpr int kUpdates = 20000;
+    OrderBookL2 book(kSymbol);
+    book.setPublishedDepth(kDepth);
+
+    // Every batch rewrites all published levels with the same quantity, so a torn read would mix values
+    std::atomic<bool> done{false};
+    std::thread reader([&book, &done]() {
+        DepthSnapshot<kDepth> depth;
+        while (!done.load(std::memory_order_acquire)) {
+            book.readDepth(depth);
+            for (std::size_t i = 1; i < depth.bid_count; ++i) {
+                ASSERT_EQ(depth.bids[i].quantity, depth.bids[0].quantity);
+                ASSERT_LT(depth.bids[i].price, depth.bids[i - 1].price);
+            }
+            for (std::size_t i = 0; i < depth.ask_count; ++i) {
+                ASSERT_EQ(depth.asks[i].quantity, depth.bids[0].quantity);
+            }
+        }
+    });
+
+    for (int n = 1; n <= kUpdates; ++n) {
+        for (std::size_t i = 0; i < kDepth; ++i) {
+            const bool last = (i + 1 == kDepth);
+            book.updateLevel(Side::Buy, kPrice100 - static_cast<Price>(i), n, kTs1, 0, false);
+            book.updateLevel(Side::Sell, kPrice101 + static_cast<Price>(i), n, kTs1, 0, last);
+        }
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    DepthSnapshot<kDepth> depth;
+    book.readDepth(depth);
+    EXPECT_EQ(depth.bid_count, kDepth);
+    EXPECT_EQ(depth.asks[kDepth - 1].quantity, kUpdates);
+}
+
+TEST_F(OrderBookL2Test, ApplyBatchCoalescesLevelUpdates) {
+    OrderBookL2 book(kSymbol);
+    book.updateLevel(Side::Buy, kPrice100, kQty10, kTs1);
+    book.updateLevel(Side::Sell, kPrice101, kQty10, kTs1);
+
+    auto observer = std::make_shared<BatchObserverL2>();
+    book.addObserver(observer);
+
+    const L2Update updates[] = {
+        {.timestamp = kTs2, .price = kPrice100, .quantity = kQty20, .symbol = kSymbol, .side = Side::Buy},
+        {.timestamp = kTs2, .price = kPrice99, .quantity = kQty10, .symbol = kSymbol, .side = Side::Buy},
+        {.timestamp = kTs2, .price = kPrice100, .quantity = kQty30, .symbol = kSymbol, .side = Side::Buy},
+        {.timestamp = kTs2, .price = kPrice98, .quantity = kQty10, .symbol = kSymbol, .side = Side::Buy},
+        {.timestamp = kTs2, .price = kPrice98, .quantity = 0, .symbol = kSymbol, .side = Side::Buy},   // Added and removed
+        {.timestamp = kTs2, .price = kPrice101, .quantity = 0, .symbol = kSymbol, .side = Side::Sell},
+        {.timestamp = kTs2 + 1, .price = kPrice102, .quantity = kQty40, .symbol = kSymbol, .side = Side::Sell},
+    };
+    EXPECT_EQ(book.applyBatch(updates), 7);
+
+    // One update per level with net change, in first-touch order
+    ASSERT_EQ(observer->level_updates.size(), 4);
+    const auto& bid100 = observer->level_updates[0];
+    EXPECT_EQ(bid100.price, kPrice100);
+    EXPECT_EQ(bid100.quantity, kQty30);
+    EXPECT_EQ(bid100.level_index, 0);
+    EXPECT_FALSE(bid100.priceChanged());
+    EXPECT_FALSE(bid100.isLastInBatch());
+
+    const auto& bid99 = observer->level_updates[1];
+    EXPECT_EQ(bid99.price, kPrice99);
+    EXPECT_EQ(bid99.level_index, 1);
+    EXPECT_TRUE(bid99.priceChanged());
+
+    const auto& ask101 = observer->level_updates[2];
+    EXPECT_EQ(ask101.price, kPrice101);
+    EXPECT_EQ(ask101.quantity, 0);
+    EXPECT_EQ(ask101.level_index, 0);
+    EXPECT_TRUE(ask101.priceChanged());
+
+    const auto& ask102 = observer->level_updates[3];
+    EXPECT_EQ(ask102.price, kPrice102);
+    EXPECT_EQ(ask102.level_index, 0);
+    EXPECT_EQ(ask102.timestamp, kTs2 + 1);
+    EXPECT_TRUE(ask102.isLastInBatch());
+
+    // One top-of-book for the whole batch
+    ASSERT_EQ(observer->tob_updates.size(), 1);
+    EXPECT_EQ(observer->tob_updates[0].bid_quantity, kQty30);
+    EXPECT_EQ(observer->tob_updates[0].best_ask, kPrice102);
+    EXPECT_EQ(observer->tob_updates[0].timestamp, kTs2 + 1);
+
+    EXPECT_EQ(book.levelCount(Side::Buy), 2);
+    EXPECT_EQ(book.levelCount(Side::Sell), 1);
+}
+
+TEST_F(OrderBookL2Test, ApplyBatchChecksSequenceOnce) {
+    OrderBookL2 book(kSymbol);
+    book.updateLevel(Side::Buy, kPrice100, kQty10, kTs1, 10);
+
+    const L2Update stale[] = {
+        {.timestamp = kTs2, .seq_num = 9, .price = kPrice99, .quantity = kQty10, .symbol = kSymbol, .side = Side::Buy},
+        {.timestamp = kTs2, .seq_num = 11, .price = kPrice98, .quantity = kQty10, .symbol = kSymbol, .side = Side::Buy},
+    };
+    EXPECT_EQ(book.applyBatch(stale), 0);
+    EXPECT_EQ(book.levelCount(Side::Buy), 1);
+    EXPECT_EQ(book.getLastSeqNum(), 10);
+
+    // Unsequenced updates around the sequenced ones do not count for the check
+    const L2Update fresh[] = {
+        {.timestamp = kTs2, .price = kPrice99, .quantity = kQty10, .symbol = kSymbol, .side = Side::Buy},
+        {.timestamp = kTs2, .seq_num = 11, .price = kPrice98, .quantity = kQty10, .symbol = kSymbol, .side = Side::Buy},
+        {.timestamp = kTs2, .seq_num = 12, .price = kPrice101, .quantity = kQty10, .symbol = kSymbol, .side = Side::Sell},
+        {.timestamp = kTs2, .price = kPrice102, .quantity = kQty10, .symbol = kSymbol, .side = Side::Sell},
+    };
+    EXPECT_EQ(book.applyBatch(fresh), 4);
+    EXPECT_EQ(book.getLastSeqNum(), 12);
+    EXPECT_EQ(book.levelCount(Side::Buy), 3);
+    EXPECT_EQ(book.applyBatch({}), 0);
+
+    // A batch whose sequence numbers go back within it is rejected as a whole
+    const L2Update backwards[] = {
+        {.timestamp = kTs2, .seq_num = 14, .price = kPrice100, .quantity = 0, .symbol = kSymbol, .side = Side::Buy},
+        {.timestamp = kTs2, .seq_num = 13, .price = kPrice99, .quantity = 0, .symbol = kSymbol, .side = Side::Buy},
+    };
+    EXPECT_EQ(book.applyBatch(backwards), 0);
+    EXPECT_EQ(book.levelCount(Side::Buy), 3);
+    EXPECT_EQ(book.getLastSeqNum(), 12);
+}
+
+TEST_F(OrderBookL2Test, ApplyBatchMatchesSequentialUpdates) {
+    auto run = [](auto& batched, auto& sequential) {
+        batched.setPublishedDepth(5);
+        std::vector<L2Update> updates;
+        uint64_t seq = 0;
+        for (int packet = 0; packet < 200; ++packet) {
+            updates.clear();
+            for (int i = 0; i < 30; ++i) {
+                const int n = packet * 31 + i * 7;
+                const Side side = (n % 2) ? Side::Buy : Side::Sell;
+                const Price price = side == Side::Buy ? 10000 - (n % 13) : 10010 + (n % 11);
+                const Quantity quantity = (n % 5 == 0) ? 0 : 1 + n % 97;
+                updates.push_back({.timestamp = static_cast<Timestamp>(n), .seq_num = ++seq,
+                                   .price = price, .quantity = quantity, .symbol = kSymbol, .side = side});
+                sequential.updateLevel(side, price, quantity, n, seq);
+            }
+            ASSERT_EQ(batched.applyBatch(updates), updates.size());
+        }
+        for (Side side : {Side::Buy, Side::Sell}) {
+            const auto expected = sequential.getLevels(side);
+            const auto actual = batched.getLevels(side);
+            ASSERT_EQ(actual.size(), expected.size());
+            for (std::size_t i = 0; i < expected.size(); ++i) {
+                EXPECT_EQ(actual[i].price, expected[i].price);
+                EXPECT_EQ(actual[i].quantity, expected[i].quantity);
+            }
+        }
+        EXPECT_EQ(batched.getTopOfBook().best_bid, sequential.getTopOfBook().best_bid);
+        EXPECT_EQ(batched.getTopOfBook().ask_quantity, sequential.getTopOfBook().ask_quantity);
+        EXPECT_EQ(batched.getLastSeqNum(), sequential.getLastSeqNum());
+
+        DepthSnapshot<5> depth;
+        batched.readDepth(depth);
+        const auto bids = sequential.getLevels(Side::Buy, 5);
+        ASSERT_EQ(depth.bid_count, bids.size());
+        for (std::size_t i = 0; i < bids.size(); ++i) {
+            EXPECT_EQ(depth.bids[i].quantity, bids[i].quantity);
+        }
+    };
+
+    OrderBookL2 batched(kSymbol), sequential(kSymbol);
+    run(batched, sequential);
+
+    LadderOrderBookL2 ladder_batched(kSymbol, PriceLadderConfig{1, 64});
+    LadderOrderBookL2 ladder_sequential(kSymbol, PriceLadderConfig{1, 64});
+    run(ladder_batched, ladder_sequential);
+}
@@ -3,6 +3,13 @@
 
 #include <slick/orderbook/orderbook_l3.hpp>
 #include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <random>
+#include <thread>
+#include <tuple>
+#include <vector>
 
 using namespace slick::orderbook;
 
@@ -532,6 +539,25 @@ TEST_F(OrderBookL3Test, GetLevelsL2AsksAscending) {
     EXPECT_EQ(levels[2].quantity, kQty20);
 }
 
+TEST_F(OrderBookL3Test, GetLevelsL2Buffer) {
+    OrderBookL3 book(kSymbol);
+
+    EXPECT_TRUE(book.addOrder(kOrder1, Side::Buy, kPrice101, kQty10, kTs1));
+    EXPECT_TRUE(book.addOrder(kOrder2, Side::Buy, kPrice100, kQty20, kTs2));
+    EXPECT_TRUE(book.addOrder(kOrder3, Side::Buy, kPrice100, kQty30, kTs3));
+
+    std::array<detail::PriceLevelL2, 1> top;
+    ASSERT_EQ(book.getLevelsL2(Side::Buy, top), 1);
+    EXPECT_EQ(top[0].price, kPrice101);
+
+    std::array<detail::PriceLevelL2, 4> out;
+    ASSERT_EQ(book.getLevelsL2(Side::Buy, out), 2);
+    EXPECT_EQ(out[1].price, kPrice100);
+    EXPECT_EQ(out[1].quantity, kQty20 + kQty30);
+    EXPECT_EQ(out[1].timestamp, kTs2);
+    EXPECT_EQ(book.getLevelsL2(Side::Sell, out), 0);
+}
+
 // ============================================================================
 // L3 Level Access Tests
 // ============================================================================
@@ -760,12 +786,192 @@ TEST_F(OrderBookL3Test, OrderUpdateLevelIndexBestBidIsZero) {
     EXPECT_EQ(observer->last_order_update.price_level_index, 0);
 }
 
+TEST_F(OrderBookL3Test, OrderUpdateLevelIndexBeyondInterestedIsExactByDefault) {
+    OrderBookL3 book(kSymbol, 2);
+    auto observer = std::make_shared<TestObserver>();
+    book.addObserver(observer);
+    EXPECT_FALSE(book.skipsLevelIndexBeyondInterested());
+
+    EXPECT_TRUE(book.addOrder(kOrder1, Side::Buy, kPrice100, kQty10, kTs1));
+    EXPECT_TRUE(book.addOrder(kOrder2, Side::Buy, kPrice99, kQty20, kTs2));
+    EXPECT_TRUE(book.addOrder(kOrder3, Side::Buy, kPrice98, kQty30, kTs3));
+
+    EXPECT_EQ(observer->last_order_update.price_level_index, 2);
+    EXPECT_EQ(observer->price_level_update_count, 2);  // Level 2 is beyond the interested range
+}
+
+TEST_F(OrderBookL3Test, SkipLevelIndexBeyondInterested) {
+    OrderBookL3 book(kSymbol, 2);
+    book.setSkipLevelIndexBeyondInterested(true);
+    EXPECT_TRUE(book.skipsLevelIndexBeyondInterested());
+    auto observer = std::make_shared<TestObserver>();
+    book.addObserver(observer);
+
+    EXPECT_TRUE(book.addOrder(kOrder1, Side::Buy, kPrice100, kQty10, kTs1));
+    EXPECT_TRUE(book.addOrder(kOrder2, Side::Buy, kPrice99, kQty20, kTs2));
+    EXPECT_EQ(observer->last_order_update.price_level_index, 1);
+
+    // Deeper than interested_num_levels: index is not computed
+    EXPECT_TRUE(book.addOrder(kOrder3, Side::Buy, kPrice98, kQty30, kTs3));
+    EXPECT_EQ(observer->last_order_update.price_level_index, INVALID_INDEX);
+    EXPECT_FALSE(observer->last_order_update.isTopN(2));
+    EXPECT_EQ(observer->price_level_update_count, 2);
+
+    EXPECT_TRUE(book.modifyOrder(kOrder3, kPrice98, kQty40, kTs4));
+    EXPECT_EQ(observer->last_order_update.price_level_index, INVALID_INDEX);
+    EXPECT_TRUE(book.deleteOrder(kOrder3, kTs4));
+    EXPECT_EQ(observer->last_order_update.price_level_index, INVALID_INDEX);
+    EXPECT_EQ(observer->price_level_update_count, 2);
+
+    // Top-of-book tracking is unaffected
+    const int tob_updates = observer->tob_update_count;
+    EXPECT_TRUE(book.addOrder(kOrder4, Side::Buy, kPrice101, kQty10, kTs4));
+    EXPECT_EQ(observer->last_order_update.price_level_index, 0);
+    EXPECT_EQ(observer->tob_update_count, tob_updates + 1);
+    EXPECT_EQ(observer->last_tob.best_bid, kPrice101);
+
+    book.setSkipLevelIndexBeyondInterested(false);
+    EXPECT_TRUE(book.modifyOrder(kOrder1, kPrice100, kQty20, kTs4));
+    EXPECT_EQ(observer->last_order_update.price_level_index, 1);
+    EXPECT_TRUE(book.modifyOrder(kOrder2, kPrice99, kQty30, kTs4));
+    EXPECT_EQ(observer->last_order_update.price_level_index, 2);
+}
+
+TEST_F(OrderBookL3Test, SkipLevelIndexHasNoEffectWhenAllLevelsInterested) {
+    OrderBookL3 book(kSymbol, 0);
+    book.setSkipLevelIndexBeyondInterested(true);
+    EXPECT_FALSE(book.skipsLevelIndexBeyondInterested());
+}
+
+TEST_F(OrderBookL3Test, ObserverEventMask) {
+    OrderBookL3 book(kSymbol);
+    auto tob_observer = std::make_shared<TestObserver>();
+    auto all_observer = std::make_shared<TestObserver>();
+    book.addObserver(tob_observer, TopOfBookEvents);
+    book.addObserver(all_observer);
+
+    EXPECT_TRUE(book.addOrder(kOrder1, Side::Buy, kPrice100, kQty10, kTs1));
+    EXPECT_TRUE(book.addOrder(kOrder2, Side::Sell, kPrice101, kQty20, kTs2));
+    EXPECT_TRUE(book.executeOrder(kOrder2, kQty10, kTs3));
+    EXPECT_TRUE(book.deleteOrder(kOrder1, kTs4));
+
+    EXPECT_EQ(tob_observer->order_update_count, 0);
+    EXPECT_EQ(tob_observer->price_level_update_count, 0);
+    EXPECT_EQ(tob_observer->tob_update_count, all_observer->tob_update_count);
+    EXPECT_EQ(tob_observer->tob_update_count, 4);
+    EXPECT_EQ(tob_observer->last_tob.best_bid, 0);
+
+    EXPECT_EQ(all_observer->order_update_count, 4);
+    EXPECT_EQ(all_observer->price_level_update_count, 4);
+}
+
+TEST_F(OrderBookL3Test, ObserverManagerSubscriptions) {
+    ObserverManager manager;
+    EXPECT_FALSE(manager.wantsOrderUpdates());
+    EXPECT_EQ(manager.levelIndexLimit(), 0);
+
+    auto trade_observer = std::make_shared<TestObserver>();
+    auto level_observer = std::make_shared<TestObserver>();
+    manager.addObserver(trade_observer, TradeEvents);
+    manager.addObserver(level_observer, PriceLevelEvents | SnapshotEvents, 5);
+    EXPECT_TRUE(manager.wantsTrades());
+    EXPECT_TRUE(manager.wantsPriceLevelUpdates());
+    EXPECT_FALSE(manager.wantsOrderUpdates());
+    EXPECT_FALSE(manager.wantsTopOfBookUpdates());
+    EXPECT_EQ(manager.levelIndexLimit(), 5);
+
+    manager.notifyTrade(Trade{kSymbol, kPrice100, kQty10, kTs1, Side::Buy, kOrder1, kOrder2});
+    manager.notifyPriceLevelUpdate(PriceLevelUpdate{kTs1, kSymbol, Side::Buy, kPrice100, kQty10, 1, 4});
+    manager.notifyPriceLevelUpdate(PriceLevelUpdate{kTs1, kSymbol, Side::Buy, kPrice99, kQty10, 1, 5});
+    EXPECT_EQ(trade_observer->trade_count, 1);
+    EXPECT_EQ(trade_observer->price_level_update_count, 0);
+    EXPECT_EQ(level_observer->trade_count, 0);
+    EXPECT_EQ(level_observer->price_level_update_count, 1);
+    EXPECT_EQ(level_observer->last_level_update.level_index, 4);
+
+    EXPECT_TRUE(manager.removeObserver(level_observer));
+    EXPECT_FALSE(manager.wantsPriceLevelUpdates());
+    EXPECT_EQ(manager.levelIndexLimit(), 0);
+    manager.clearObservers();
+    EXPECT_FALSE(manager.wantsTrades());
+}
+
+TEST_F(OrderBookL3Test, TopOfBookOnlyObserverTracksBestLevel) {
+    OrderBookL3 book(kSymbol);
+    auto observer = std::make_shared<TestObserver>();
+    book.addObserver(observer, TopOfBookEvents);
+
+    // Level indexes are not needed, but changes at the best level must still be detected
+    EXPECT_TRUE(book.addOrder(kOrder1, Side::Buy, kPrice100, kQty10, kTs1));
+    EXPECT_TRUE(book.addOrder(kOrder2, Side::Buy, kPrice98, kQty10, kTs1));
+    EXPECT_TRUE(book.addOrder(kOrder3, Side::Buy, kPrice99, kQty10, kTs1));
+    EXPECT_EQ(observer->tob_update_count, 1);
+
+    EXPECT_TRUE(book.deleteOrder(kOrder1, kTs2));
+    EXPECT_EQ(observer->tob_update_count, 2);
+    EXPECT_EQ(observer->last_tob.best_bid, kPrice99);
+
+    EXPECT_TRUE(book.modifyOrder(kOrder2, kPrice101, kQty20, kTs3));
+    EXPECT_EQ(observer->tob_update_count, 3);
+    EXPECT_EQ(observer->last_tob.best_bid, kPrice101);
+    EXPECT_EQ(observer->last_tob.bid_quantity, kQty20);
+}
+
+TEST_F(OrderBookL3Test, ObserverDepthFilter) {
+    OrderBookL3 book(kSymbol);
+    auto top2_observer = std::make_shared<TestObserver>();
+    auto all_observer = std::make_shared<TestObserver>();
+    book.addObserver(top2_observer, AllEvents, 2);
+    book.addObserver(all_observer);
+
+    EXPECT_TRUE(book.addOrder(kOrder1, Side::Buy, kPrice100, kQty10, kTs1));
+    EXPECT_TRUE(book.addOrder(kOrder2, Side::Buy, kPrice99, kQty20, kTs2));
+    EXPECT_TRUE(book.addOrder(kOrder3, Side::Buy, kPrice98, kQty30, kTs3));   // Level 2
+    EXPECT_TRUE(book.modifyOrder(kOrder3, kPrice98, kQty40, kTs4));
+
+    EXPECT_EQ(top2_observer->order_update_count, 2);
+    EXPECT_EQ(top2_observer->price_level_update_count, 2);
+    EXPECT_EQ(top2_observer->last_order_update.order_id, kOrder2);
+    EXPECT_EQ(all_observer->order_update_count, 4);
+    EXPECT_EQ(all_observer->last_order_update.price_level_index, 2);
+
+    // Deleting the level 2 order is still filtered, deleting best is not
+    EXPECT_TRUE(book.deleteOrder(kOrder3, kTs4));
+    EXPECT_EQ(top2_observer->order_update_count, 2);
+    EXPECT_TRUE(book.deleteOrder(kOrder1, kTs4));
+    EXPECT_EQ(top2_observer->order_update_count, 3);
+    EXPECT_EQ(top2_observer->last_order_update.price_level_index, 0);
+}
+
+TEST_F(OrderBookL3Test, DepthLimitedObserversBoundLevelIndex) {
+    OrderBookL3 book(kSymbol);
+    auto observer = std::make_shared<TestObserver>();
+    book.addObserver(observer, OrderEvents, 2);
+
+    EXPECT_TRUE(book.addOrder(kOrder1, Side::Buy, kPrice100, kQty10, kTs1));
+    EXPECT_TRUE(book.addOrder(kOrder2, Side::Buy, kPrice99, kQty20, kTs2));
+    EXPECT_TRUE(book.addOrder(kOrder3, Side::Buy, kPrice98, kQty30, kTs3));
+    EXPECT_EQ(observer->order_update_count, 2);
+
+    // Once an all-levels observer subscribes, exact indexes are reported again
+    auto all_observer = std::make_shared<TestObserver>();
+    book.addObserver(all_observer, OrderEvents);
+    EXPECT_TRUE(book.modifyOrder(kOrder3, kPrice98, kQty40, kTs4));
+    EXPECT_EQ(all_observer->last_order_update.price_level_index, 2);
+
+    EXPECT_TRUE(book.removeObserver(all_observer));
+    EXPECT_TRUE(book.modifyOrder(kOrder3, kPrice98, kQty30, kTs4));
+    EXPECT_EQ(all_observer->order_update_count, 1);
+    EXPECT_EQ(observer->order_update_count, 2);
+}
+
 // Batch flag tests
 class BatchObserverL3 : public IOrderBookObserver {
 public:
     std::vector<OrderUpdate> order_updates;
     std::vector<PriceLevelUpdate> level_updates;
     std::vector<TopOfBook> tob_updates;
+    std::vector<Trade> trades;
 
     void onOrderUpdate(const OrderUpdate& update) override {
         order_updates.push_back(update);
@@ -779,10 +985,15 @@ public:
         tob_updates.push_back(tob);
     }
 
+    void onTrade(const Trade& trade) override {
+        trades.push_back(trade);
+    }
+
     void reset() {
         order_updates.clear();
         level_updates.clear();
         tob_updates.clear();
+        trades.clear();
     }
 };
 
@@ -1823,3 +2034,1413 @@ TEST_F(OrderBookL3Test, EmitSnapshotWithSeqNum) {
     EXPECT_EQ(observer->snapshot_end_count, 1);
     EXPECT_EQ(observer->order_update_count, 3);
 }
+
+// ============================================================================
+// Snapshot Loading Tests
+// ============================================================================
+
+TEST_F(OrderBookL3Test, LoadSnapshotBuildsBook) {
+    OrderBookL3 book(kSymbol);
+    EXPECT_TRUE(book.addOrder(kOrder5, Side::Buy, 5000, kQty10, kTs1));  // Stale, replaced by the snapshot
+
+    const std::vector<SnapshotOrder> orders{
+        {kOrder1, Side::Buy, kPrice99, kQty10, kTs1},
+        {kOrder2, Side::Sell, kPrice101, kQty20, kTs1},
+        {kOrder3, Side::Buy, kPrice100, kQty30, kTs3},
+        {kOrder4, Side::Buy, kPrice100, kQty40, kTs2},
+    };
+    book.loadSnapshot(orders, 7, kTs4);
+
+    EXPECT_EQ(book.getLastSeqNum(), 7);
+    EXPECT_EQ(book.orderCount(), 4);
+    EXPECT_EQ(book.findOrder(kOrder5), nullptr);
+    EXPECT_EQ(book.levelCount(Side::Buy), 2);
+    EXPECT_EQ(book.levelCount(Side::Sell), 1);
+
+    // Queue at 100 is ordered by priority (timestamp), not input order
+    const auto* best_bid = book.getBestBid();
+    ASSERT_NE(best_bid, nullptr);
+    EXPECT_EQ(best_bid->price, kPrice100);
+    EXPECT_EQ(best_bid->getTotalQuantity(), kQty30 + kQty40);
+    EXPECT_EQ(best_bid->getBestOrder()->order_id, kOrder4);
+
+    auto tob = book.getTopOfBook();
+    EXPECT_EQ(tob.best_bid, kPrice100);
+    EXPECT_EQ(tob.best_ask, kPrice101);
+
+    // Book is fully usable afterwards
+    EXPECT_TRUE(book.modifyOrder(kOrder4, kPrice99, kQty40, kTs4, 0, 8));
+    EXPECT_EQ(book.getBestBid()->getBestOrder()->order_id, kOrder3);
+    EXPECT_TRUE(book.deleteOrder(kOrder1, kTs4, 9));
+    EXPECT_EQ(book.orderCount(), 3);
+}
+
+TEST_F(OrderBookL3Test, LoadSnapshotKeepsStopOrders) {
+    OrderBookL3 book(kSymbol);
+    book.addOrder(kOrder1, Side::Sell, kPrice101, kQty20, kTs1);
+    book.submitOrder(30, Side::Buy, kPrice101, 5, kTs2);
+    ASSERT_EQ(book.submitStopOrder(20, Side::Buy, kPrice102, kQty10, kTs2).status, SubmitStatus::Pending);
+    ASSERT_EQ(book.submitStopOrder(21, Side::Sell, kPrice99, kQty10, kTs2).status, SubmitStatus::Pending);
+
+    // A resync replaces the resting orders only
+    const std::vector<SnapshotOrder> orders{
+        {kOrder2, Side::Sell, kPrice102, kQty10, kTs3},
+        {kOrder3, Side::Buy, kPrice100, kQty10, kTs3},
+    };
+    book.loadSnapshot(orders, 7, kTs3);
+    EXPECT_EQ(book.findOrder(kOrder1), nullptr);
+    EXPECT_EQ(book.orderCount(), 2);
+    EXPECT_EQ(book.stopOrderCount(), 2);
+    ASSERT_NE(book.findStopOrder(20), nullptr);
+    EXPECT_EQ(book.findStopOrder(20)->stop_price, kPrice102);
+    EXPECT_EQ(book.lastTradePrice(), kPrice101);
+
+    // The kept stop still triggers on the next trade
+    const SubmitResult result = book.submitOrder(31, Side::Buy, kPrice102, 5, kTs4);
+    EXPECT_EQ(result.triggered_stops, 1);
+    EXPECT_EQ(book.findStopOrder(20), nullptr);
+    EXPECT_EQ(book.stopOrderCount(), 1);
+}
+
+TEST_F(OrderBookL3Test, LoadSnapshotPriorityAndDuplicates) {
+    OrderBookL3 book(kSymbol);
+    const std::vector<SnapshotOrder> orders{
+        {kOrder1, Side::Sell, kPrice101, kQty10, kTs1, kPriority3},
+        {kOrder2, Side::Sell, kPrice101, kQty20, kTs1, kPriority1},
+        {kOrder3, Side::Sell, kPrice101, kQty30, kTs1, kPriority1},   // Same priority: input order kept
+        {kOrder2, Side::Sell, kPrice102, kQty40, kTs1},               // Duplicate id: dropped
+        {kOrder4, Side::Sell, kPrice102, 0, kTs1},                    // Empty: skipped
+    };
+    book.loadSnapshot(orders);
+
+    EXPECT_EQ(book.orderCount(), 3);
+    EXPECT_EQ(book.levelCount(Side::Sell), 1);
+    EXPECT_EQ(book.findOrder(kOrder4), nullptr);
+
+    const auto* level = book.getBestAsk();
+    ASSERT_NE(level, nullptr);
+    std::vector<OrderId> queue;
+    for (const auto& order : level->orders) {
+        queue.push_back(order.order_id);
+    }
+    EXPECT_EQ(queue, (std::vector<OrderId>{kOrder2, kOrder3, kOrder1}));
+}
+
+TEST_F(OrderBookL3Test, LoadSnapshotNotifiesOnce) {
+    OrderBookL3 book(kSymbol);
+    auto snapshot_observer = std::make_shared<SnapshotObserver>();
+    auto observer = std::make_shared<TestObserver>();
+    book.addObserver(snapshot_observer);
+    book.addObserver(observer);
+
+    const std::vector<SnapshotOrder> orders{
+        {kOrder1, Side::Buy, kPrice100, kQty10, kTs1},
+        {kOrder2, Side::Buy, kPrice99, kQty20, kTs1},
+        {kOrder3, Side::Sell, kPrice101, kQty30, kTs1},
+    };
+    book.loadSnapshot(orders, 1, kTs2);
+
+    EXPECT_EQ(snapshot_observer->snapshot_begin_count, 1);
+    EXPECT_EQ(snapshot_observer->snapshot_end_count, 1);
+    EXPECT_EQ(snapshot_observer->order_update_count, 3);
+    EXPECT_EQ(observer->price_level_update_count, 0);
+    EXPECT_EQ(observer->tob_update_count, 1);
+    EXPECT_EQ(observer->last_tob.best_bid, kPrice100);
+    EXPECT_EQ(observer->last_tob.best_ask, kPrice101);
+}
+
+TEST_F(OrderBookL3Test, LoadSnapshotLadderBook) {
+    LadderOrderBookL3 book(kSymbol, PriceLadderConfig{1, 16});
+    std::vector<SnapshotOrder> orders;
+    for (OrderId id = 1; id <= 200; ++id) {
+        orders.push_back({id, (id % 2) ? Side::Buy : Side::Sell,
+                          (id % 2) ? kPrice100 - static_cast<Price>(id) : kPrice101 + static_cast<Price>(id),
+                          kQty10, id});
+    }
+    book.loadSnapshot(orders);
+
+    EXPECT_EQ(book.orderCount(), 200);
+    EXPECT_EQ(book.levelCount(Side::Buy), 100);
+    EXPECT_EQ(book.getBestBid()->price, kPrice100 - 1);
+    EXPECT_EQ(book.getBestAsk()->price, kPrice101 + 2);
+}
+
+TEST_F(OrderBookL3Test, PublishedDepthMatchesLevelsL2) {
+    OrderBookL3 book(kSymbol);
+    book.setPublishedDepth(2);
+
+    book.addOrder(kOrder1, Side::Buy, kPrice100, kQty10, kTs1);
+    book.addOrder(kOrder2, Side::Buy, kPrice100, kQty20, kTs2);
+    book.addOrder(kOrder3, Side::Buy, kPrice99, kQty30, kTs2);
+    book.addOrder(kOrder4, Side::Sell, kPrice101, kQty40, kTs3, 0, 5);
+
+    DepthSnapshot<2> depth;
+    book.readDepth(depth);
+    const auto bids = book.getLevelsL2(Side::Buy, 2);
+    ASSERT_EQ(depth.bid_count, bids.size());
+    for (std::size_t i = 0; i < bids.size(); ++i) {
+        EXPECT_EQ(depth.bids[i].price, bids[i].price);
+        EXPECT_EQ(depth.bids[i].quantity, bids[i].quantity);
+        EXPECT_EQ(depth.bids[i].timestamp, bids[i].timestamp);
+    }
+    EXPECT_EQ(depth.bids[0].quantity, kQty10 + kQty20);
+    ASSERT_EQ(depth.ask_count, 1);
+    EXPECT_EQ(depth.seq_num, 5);
+
+    // Changes past the published depth do not republish
+    const uint64_t version = depth.version;
+    book.addOrder(kOrder5, Side::Buy, kPrice98, kQty50, kTs4);
+    book.readDepth(depth);
+    EXPECT_EQ(depth.version, version);
+
+    // Executions and deletes inside it do
+    book.executeOrder(kOrder1, kQty10, kTs4);
+    book.readDepth(depth);
+    EXPECT_EQ(depth.bids[0].quantity, kQty20);
+    book.deleteOrder(kOrder3, kTs4);
+    book.readDepth(depth);
+    ASSERT_EQ(depth.bid_count, 2);
+    EXPECT_EQ(depth.bids[1].price, kPrice98);
+}
+
+TEST_F(OrderBookL3Test, PublishedDepthBeyondSkippedLevelIndexes) {
+    // Published levels keep exact indexes even when level indexes are bounded to the interested levels
+    LadderOrderBookL3 book(kSymbol, PriceLadderConfig{1, 64}, 1);
+    book.setSkipLevelIndexBeyondInterested(true);
+    book.setPublishedDepth(3);
+
+    book.addOrder(kOrder1, Side::Sell, kPrice101, kQty10, kTs1);
+    book.addOrder(kOrder2, Side::Sell, kPrice101 + 1, kQty20, kTs1);
+    book.addOrder(kOrder3, Side::Sell, kPrice101 + 2, kQty30, kTs1);
+    book.modifyOrder(kOrder3, kPrice101 + 2, kQty40, kTs2);
+
+    DepthSnapshot<3> depth;
+    book.readDepth(depth);
+    ASSERT_EQ(depth.ask_count, 3);
+    EXPECT_EQ(depth.asks[2].quantity, kQty40);
+}
+
+TEST_F(OrderBookL3Test, PublishedDepthConsistentAcrossThreads) {
+#if SLICK_TSAN_ENABLED
+    GTEST_SKIP() << "Disabled under TSAN (seqlock read path is not TSAN-friendly).";
+#endif
+    constexpr std::size_t kDepth = 10;
+    constexpr int kRounds = 5000;
+    OrderBookL3 book(kSymbol, 0);
+    book.setPublishedDepth(kDepth);
+
+    std::atomic<bool> done{false};
+    std::thread reader([&book, &done]() {
+        DepthSnapshot<kDepth> depth;
+        while (!done.load(std::memory_order_acquire)) {
+            book.readDepth(depth);
+            for (std::size_t i = 1; i < depth.bid_count; ++i) {
+                ASSERT_EQ(depth.bids[i].quantity, depth.bids[0].quantity);
+            }
+        }
+    });
+
+    // Each round resizes every published level in one batch
+    for (std::size_t i = 0; i < kDepth; ++i) {
+        book.addOrder(static_cast<OrderId>(i + 1), Side::Buy, kPrice100 - static_cast<Price>(i), 1, kTs1);
+    }
+    for (int n = 2; n <= kRounds; ++n) {
+        for (std::size_t i = 0; i < kDepth; ++i) {
+            book.modifyOrder(static_cast<OrderId>(i + 1), kPrice100 - static_cast<Price>(i), n, kTs2, kPriority1,
+                             0, i + 1 == kDepth);
+        }
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    DepthSnapshot<kDepth> depth;
+    book.readDepth(depth);
+    ASSERT_EQ(depth.bid_count, kDepth);
+    EXPECT_EQ(depth.bids[kDepth - 1].quantity, kRounds);
+}
+
+TEST_F(OrderBookL3Test, ApplyBatchCoalescesLevelUpdates) {
+    OrderBookL3 book(kSymbol);
+    book.addOrder(kOrder1, Side::Sell, kPrice101, kQty10, kTs1);
+
+    auto observer = std::make_shared<BatchObserverL3>();
+    book.addObserver(observer);
+
+    const L3Update updates[] = {
+        {.timestamp = kTs2, .order_id = kOrder2, .price = kPrice100, .quantity = kQty10, .symbol = kSymbol, .side = Side::Buy, .type = L3UpdateType::Add},
+        {.timestamp = kTs2, .order_id = kOrder3, .price = kPrice100, .quantity = kQty20, .symbol = kSymbol, .side = Side::Buy, .type = L3UpdateType::Add},
+        {.timestamp = kTs2, .order_id = kOrder4, .price = kPrice99, .quantity = kQty30, .symbol = kSymbol, .side = Side::Buy, .type = L3UpdateType::Add},
+        {.timestamp = kTs3, .order_id = kOrder4, .symbol = kSymbol, .type = L3UpdateType::Delete},       // Added and removed
+        {.timestamp = kTs3, .order_id = kOrder2, .quantity = 5, .symbol = kSymbol, .type = L3UpdateType::Execute},
+        {.timestamp = kTs3, .order_id = kOrder1, .price = kPrice102, .quantity = kQty10, .symbol = kSymbol, .type = L3UpdateType::Modify},
+        {.timestamp = kTs4, .order_id = kOrder5, .symbol = kSymbol, .type = L3UpdateType::Delete},                          // Unknown order
+    };
+    EXPECT_EQ(book.applyBatch(updates), 6);
+
+    // Order updates per operation; only the last one flagged
+    ASSERT_EQ(observer->order_updates.size(), 6);
+    EXPECT_FALSE(observer->order_updates[4].isLastInBatch());
+
+    // One level update per level with net change: bid 100, ask 101 (removed), ask 102
+    ASSERT_EQ(observer->level_updates.size(), 3);
+    EXPECT_EQ(observer->level_updates[0].price, kPrice100);
+    EXPECT_EQ(observer->level_updates[0].quantity, kQty10 - 5 + kQty20);
+    EXPECT_TRUE(observer->level_updates[0].priceChanged());
+    EXPECT_EQ(observer->level_updates[1].price, kPrice101);
+    EXPECT_EQ(observer->level_updates[1].quantity, 0);
+    EXPECT_EQ(observer->level_updates[1].level_index, 0);
+    EXPECT_EQ(observer->level_updates[2].price, kPrice102);
+    EXPECT_EQ(observer->level_updates[2].level_index, 0);
+    EXPECT_FALSE(observer->level_updates[1].isLastInBatch());
+    EXPECT_TRUE(observer->level_updates[2].isLastInBatch());
+
+    ASSERT_EQ(observer->tob_updates.size(), 1);
+    EXPECT_EQ(observer->tob_updates[0].best_bid, kPrice100);
+    EXPECT_EQ(observer->tob_updates[0].best_ask, kPrice102);
+    EXPECT_EQ(observer->tob_updates[0].timestamp, kTs4);
+}
+
+TEST_F(OrderBookL3Test, ApplyBatchChecksSequenceOnce) {
+    OrderBookL3 book(kSymbol);
+    book.setPublishedDepth(2);
+    book.addOrder(kOrder1, Side::Buy, kPrice100, kQty10, kTs1, 0, 10);
+
+    const L3Update stale[] = {
+        {.timestamp = kTs2, .seq_num = 9, .order_id = kOrder2, .price = kPrice99, .quantity = kQty10, .symbol = kSymbol, .side = Side::Buy, .type = L3UpdateType::Add},
+    };
+    EXPECT_EQ(book.applyBatch(stale), 0);
+    EXPECT_EQ(book.orderCount(), 1);
+
+    const L3Update fresh[] = {
+        {.timestamp = kTs2, .seq_num = 11, .order_id = kOrder2, .price = kPrice99, .quantity = kQty10, .symbol = kSymbol, .side = Side::Buy, .type = L3UpdateType::Add},
+        {.timestamp = kTs2, .seq_num = 12, .order_id = kOrder1, .symbol = kSymbol, .type = L3UpdateType::Delete},
+    };
+    EXPECT_EQ(book.applyBatch(fresh), 2);
+    EXPECT_EQ(book.getLastSeqNum(), 12);
+
+    // Depth is published once at the end of the batch
+    DepthSnapshot<2> depth;
+    book.readDepth(depth);
+    ASSERT_EQ(depth.bid_count, 1);
+    EXPECT_EQ(depth.bids[0].price, kPrice99);
+    EXPECT_EQ(depth.seq_num, 12);
+
+    // A batch whose sequence numbers go back within it is rejected as a whole
+    const L3Update backwards[] = {
+        {.timestamp = kTs3, .seq_num = 14, .order_id = kOrder3, .price = kPrice98, .quantity = kQty10, .symbol = kSymbol, .side = Side::Buy, .type = L3UpdateType::Add},
+        {.timestamp = kTs3, .seq_num = 13, .order_id = kOrder2, .symbol = kSymbol, .type = L3UpdateType::Delete},
+    };
+    EXPECT_EQ(book.applyBatch(backwards), 0);
+    EXPECT_EQ(book.orderCount(), 1);
+    EXPECT_EQ(book.getLastSeqNum(), 12);
+}
+
+TEST_F(OrderBookL3Test, ApplyBatchManyPriceMoves) {
+    // Every modify touches two levels, more than the batch size the coalescing index starts with
+    OrderBookL3 batched(kSymbol), sequential(kSymbol);
+    std::vector<L3Update> updates;
+    for (OrderId id = 1; id <= 20; ++id) {
+        const Price price = kPrice100 - static_cast<Price>(id);
+        updates.push_back({.timestamp = kTs1, .order_id = id, .price = price, .quantity = kQty10, .symbol = kSymbol, .side = Side::Buy, .type = L3UpdateType::Add});
+        sequential.addOrder(id, Side::Buy, price, kQty10, kTs1);
+    }
+    for (OrderId id = 1; id <= 20; ++id) {
+        const Price price = kPrice98 - static_cast<Price>(id);
+        updates.push_back({.timestamp = kTs2, .order_id = id, .price = price, .quantity = kQty20, .symbol = kSymbol, .type = L3UpdateType::Modify});
+        sequential.modifyOrder(id, price, kQty20, kTs2);
+    }
+
+    auto observer = std::make_shared<BatchObserverL3>();
+    batched.addObserver(observer);
+    EXPECT_EQ(batched.applyBatch(updates), 40);
+
+    // Levels added and moved away within the batch are not reported; the rest within the interested 10
+    EXPECT_EQ(observer->level_updates.size(), 10);
+    EXPECT_EQ(observer->order_updates.size(), 40);
+    EXPECT_EQ(batched.levelCount(Side::Buy), sequential.levelCount(Side::Buy));
+    EXPECT_EQ(batched.getBestBid()->price, sequential.getBestBid()->price);
+    for (const auto& update : observer->level_updates) {
+        EXPECT_EQ(update.quantity, kQty20);
+    }
+}
+
+TEST_F(OrderBookL3Test, ExecuteOrderPartiallyKeepsQueuePosition) {
+    OrderBookL3 book(kSymbol);
+    auto observer = std::make_shared<BatchObserverL3>();
+
+    // Priority 0 at timestamp 0: a partial fill at a later timestamp must not re-queue the order
+    EXPECT_TRUE(book.addOrder(kOrder1, Side::Buy, kPrice100, kQty30, 0));
+    EXPECT_TRUE(book.addOrder(kOrder2, Side::Buy, kPrice100, kQty30, 0));
+    EXPECT_TRUE(book.addOrder(kOrder3, Side::Buy, kPrice99, kQty30, kTs1));
+    book.addObserver(observer);
+    EXPECT_TRUE(book.executeOrder(kOrder1, kQty10, kTs2));
+    ASSERT_EQ(book.getBestBid()->getBestOrder()->order_id, kOrder1);
+    EXPECT_EQ(book.findOrder(kOrder1)->priority, 0u);
+    EXPECT_EQ(book.findOrder(kOrder1)->timestamp, kTs2);
+
+    // Below the best level the update reports the level's index
+    EXPECT_TRUE(book.executeOrder(kOrder3, kQty10, kTs3));
+    ASSERT_EQ(observer->level_updates.size(), 2);
+    EXPECT_EQ(observer->level_updates[0].level_index, 0);
+    EXPECT_EQ(observer->level_updates[0].quantity, kQty20 + kQty30);
+    EXPECT_EQ(observer->level_updates[1].level_index, 1);
+    EXPECT_EQ(observer->level_updates[1].quantity, kQty20);
+    ASSERT_EQ(observer->order_updates.size(), 2);
+    EXPECT_EQ(observer->order_updates[1].quantity, kQty20);
+    EXPECT_EQ(observer->order_updates[1].price_level_index, 1);
+}
+
+TEST_F(OrderBookL3Test, ApplyBatchMatchesSequentialCallsAcrossPrefetchDistance) {
+    // Long batches with updates to orders added, filled or deleted earlier in the same batch
+    OrderBookL3 batched(kSymbol), sequential(kSymbol);
+    std::mt19937_64 rng(39);
+    std::vector<L3Update> updates;
+    std::vector<Quantity> remaining(1, 0);  // Model of each order's open quantity, indexed by id
+    for (Timestamp ts = 1; ts <= 600; ++ts) {
+        const auto roll = rng() % 4;
+        const OrderId id = remaining.size() > 1 ? 1 + rng() % (remaining.size() - 1) : 0;
+        if (roll == 0 || id == 0) {
+            const Price price = kPrice100 - static_cast<Price>(rng() % 8);
+            updates.push_back({.timestamp = ts, .order_id = remaining.size(), .price = price, .quantity = kQty30, .symbol = kSymbol, .side = Side::Buy, .type = L3UpdateType::Add});
+            remaining.push_back(kQty30);
+        } else if (roll == 1 && remaining[id] > 0) {
+            const Quantity quantity = std::min<Quantity>(remaining[id], 1 + static_cast<Quantity>(rng() % kQty10));
+            updates.push_back({.timestamp = ts, .order_id = id, .quantity = quantity, .symbol = kSymbol, .type = L3UpdateType::Execute});
+            remaining[id] -= quantity;
+        } else if (roll == 2) {
+            updates.push_back({.timestamp = ts, .order_id = id, .symbol = kSymbol, .type = L3UpdateType::Delete});
+            remaining[id] = 0;
+        } else {
+            const Price price = kPrice100 - static_cast<Price>(rng() % 8);
+            updates.push_back({.timestamp = ts, .order_id = id, .price = price, .quantity = kQty20, .symbol = kSymbol, .type = L3UpdateType::Modify});
+            remaining[id] = remaining[id] > 0 ? kQty20 : 0;
+        }
+    }
+
+    std::size_t applied = 0;
+    for (const L3Update& update : updates) {
+        switch (update.type) {
+            case L3UpdateType::Add:
+                applied += sequential.addOrder(update.order_id, update.side, update.price, update.quantity, update.timestamp);
+                break;
+            case L3UpdateType::Modify:
+                applied += sequential.modifyOrder(update.order_id, update.price, update.quantity, update.timestamp);
+                break;
+            case L3UpdateType::Delete:
+                applied += sequential.deleteOrder(update.order_id, update.timestamp);
+                break;
+            case L3UpdateType::Execute:
+                applied += sequential.executeOrder(update.order_id, update.quantity, update.timestamp);
+                break;
+        }
+    }
+    EXPECT_EQ(batched.applyBatch(updates), applied);
+    ASSERT_EQ(batched.orderCount(), sequential.orderCount());
+    for (OrderId id = 1; id < remaining.size(); ++id) {
+        const auto* expected = sequential.findOrder(id);
+        const auto* actual = batched.findOrder(id);
+        ASSERT_EQ(actual == nullptr, expected == nullptr) << "order " << id;
+        if (expected != nullptr) {
+            EXPECT_EQ(actual->price, expected->price) << "order " << id;
+            EXPECT_EQ(actual->quantity, expected->quantity) << "order " << id;
+        }
+    }
+    EXPECT_EQ(batched.getLevelsL2(Side::Buy), sequential.getLevelsL2(Side::Buy));
+}
+
+TEST_F(OrderBookL3Test, ConflatedSweepNotifiesLevelOnce) {
+    OrderBookL3 book(kSymbol);
+    book.setConflateLevelUpdates(true);
+    EXPECT_TRUE(book.conflatesLevelUpdates());
+    for (OrderId id = 1; id <= 40; ++id) {
+        book.addOrder(id, Side::Sell, kPrice101, kQty10, kTs1);
+    }
+    book.addOrder(41, Side::Sell, kPrice102, kQty10, kTs1);
+
+    auto observer = std::make_shared<BatchObserverL3>();
+    book.addObserver(observer);
+
+    // Aggressive order sweeps 39 orders and part of the 40th at one price
+    for (OrderId id = 1; id <= 39; ++id) {
+        book.executeOrder(id, kQty10, kTs2, 0, false);
+    }
+    EXPECT_TRUE(observer->level_updates.empty());
+    EXPECT_TRUE(observer->tob_updates.empty());
+    book.executeOrder(40, 4, kTs2, 0, true);
+
+    EXPECT_EQ(observer->order_updates.size(), 40);
+    ASSERT_EQ(observer->level_updates.size(), 1);
+    EXPECT_EQ(observer->level_updates[0].price, kPrice101);
+    EXPECT_EQ(observer->level_updates[0].quantity, kQty10 - 4);
+    EXPECT_EQ(observer->level_updates[0].num_orders, 1);
+    EXPECT_FALSE(observer->level_updates[0].priceChanged());
+    EXPECT_TRUE(observer->level_updates[0].isLastInBatch());
+    ASSERT_EQ(observer->tob_updates.size(), 1);
+    EXPECT_EQ(observer->tob_updates[0].ask_quantity, kQty10 - 4);
+}
+
+TEST_F(OrderBookL3Test, ConflatedBatchReportsRemovedLevels) {
+    OrderBookL3 book(kSymbol);
+    book.setConflateLevelUpdates(true);
+    book.addOrder(kOrder1, Side::Sell, kPrice101, kQty10, kTs1);
+    book.addOrder(kOrder2, Side::Sell, kPrice102, kQty20, kTs1);
+
+    auto observer = std::make_shared<BatchObserverL3>();
+    book.addObserver(observer);
+
+    book.executeOrder(kOrder1, kQty10, kTs2, 0, false);
+    book.addOrder(kOrder3, Side::Buy, kPrice99, kQty30, kTs2, 0, 0, false);
+    book.deleteOrder(kOrder3, kTs2, 0, false);                                 // Added and removed
+    book.modifyOrder(kOrder2, kPrice102, kQty10, kTs3, 0, 0, true);
+
+    ASSERT_EQ(observer->level_updates.size(), 2);
+    EXPECT_EQ(observer->level_updates[0].price, kPrice101);
+    EXPECT_EQ(observer->level_updates[0].quantity, 0);
+    EXPECT_EQ(observer->level_updates[0].num_orders, 0);
+    EXPECT_TRUE(observer->level_updates[0].priceChanged());
+    EXPECT_EQ(observer->level_updates[1].price, kPrice102);
+    EXPECT_EQ(observer->level_updates[1].quantity, kQty10);
+    EXPECT_EQ(observer->level_updates[1].level_index, 0);
+    EXPECT_EQ(observer->level_updates[1].timestamp, kTs3);
+    EXPECT_TRUE(observer->level_updates[1].isLastInBatch());
+
+    // Single operations (is_last_in_batch defaults to true) are notified as before
+    book.addOrder(kOrder4, Side::Buy, kPrice100, kQty10, kTs4);
+    ASSERT_EQ(observer->level_updates.size(), 3);
+    EXPECT_EQ(observer->level_updates[2].num_orders, 1);
+    EXPECT_TRUE(observer->level_updates[2].isLastInBatch());
+}
+
+TEST_F(OrderBookL3Test, LevelUpdateCarriesLevelOrderCount) {
+    OrderBookL3 book(kSymbol);
+    auto observer = std::make_shared<BatchObserverL3>();
+    book.addObserver(observer);
+
+    book.addOrder(kOrder1, Side::Buy, kPrice100, kQty10, kTs1);
+    book.addOrder(kOrder2, Side::Buy, kPrice100, kQty20, kTs1);
+    book.addOrder(kOrder3, Side::Buy, kPrice99, kQty30, kTs1);
+    book.deleteOrder(kOrder1, kTs2);
+
+    ASSERT_EQ(observer->level_updates.size(), 4);
+    EXPECT_EQ(observer->level_updates[1].num_orders, 2);
+    EXPECT_EQ(observer->level_updates[2].num_orders, 1);
+    EXPECT_EQ(observer->level_updates[3].num_orders, 1);
+}
+
+TEST_F(OrderBookL3Test, LevelSummaryTracksLargestAndOldestOrder) {
+    OrderBookL3 book(kSymbol);
+    auto observer = std::make_shared<BatchObserverL3>();
+    book.addObserver(observer);
+    EXPECT_FALSE(book.getLevelSummary(Side::Buy, kPrice100).has_value());
+
+    book.addOrder(kOrder1, Side::Buy, kPrice100, kQty20, kTs2);
+    book.addOrder(kOrder2, Side::Buy, kPrice100, kQty50, kTs3);
+    book.addOrder(kOrder3, Side::Buy, kPrice100, kQty10, kTs1, 1);     // Oldest, queued first by priority
+    auto summary = book.getLevelSummary(Side::Buy, kPrice100);
+    ASSERT_TRUE(summary.has_value());
+    EXPECT_EQ(summary->total_quantity, kQty20 + kQty50 + kQty10);
+    EXPECT_EQ(summary->order_count, 3);
+    EXPECT_EQ(summary->max_order_quantity, kQty50);
+    EXPECT_EQ(summary->oldest_timestamp, kTs1);
+    EXPECT_EQ(observer->level_updates.back().max_order_quantity, kQty50);
+    EXPECT_EQ(observer->level_updates.back().oldest_timestamp, kTs1);
+
+    // The largest order shrinks, then the oldest one leaves
+    book.modifyOrder(kOrder2, kPrice100, kQty10, kTs3, kTs3);
+    EXPECT_EQ(book.getLevelSummary(Side::Buy, kPrice100)->max_order_quantity, kQty20);
+    EXPECT_EQ(observer->level_updates.back().max_order_quantity, kQty20);
+    book.deleteOrder(kOrder3, kTs4);
+    summary = book.getLevelSummary(Side::Buy, kPrice100);
+    EXPECT_EQ(summary->order_count, 2);
+    EXPECT_EQ(summary->oldest_timestamp, kTs2);
+    EXPECT_EQ(observer->level_updates.back().oldest_timestamp, kTs2);
+
+    // A partial execution re-stamps the order; a larger order raises the maximum without a rescan
+    book.executeOrder(kOrder1, 5, kTs4);
+    summary = book.getLevelSummary(Side::Buy, kPrice100);
+    EXPECT_EQ(summary->max_order_quantity, kQty20 - 5);
+    EXPECT_EQ(summary->oldest_timestamp, kTs3);
+    book.addOrder(kOrder4, Side::Buy, kPrice100, kQty50, kTs4);
+    EXPECT_EQ(book.getLevelSummary(Side::Buy, kPrice100)->max_order_quantity, kQty50);
+
+    // A removed level reports zeros
+    book.deleteOrder(kOrder1, kTs4);
+    book.deleteOrder(kOrder2, kTs4);
+    book.deleteOrder(kOrder4, kTs4);
+    EXPECT_FALSE(book.getLevelSummary(Side::Buy, kPrice100).has_value());
+    EXPECT_EQ(observer->level_updates.back().num_orders, 0);
+    EXPECT_EQ(observer->level_updates.back().max_order_quantity, 0);
+    EXPECT_EQ(observer->level_updates.back().oldest_timestamp, 0);
+}
+
+template<typename Book>
+static void checkLevelSummariesUnderChurn(Book& book, bool explicit_priorities) {
+    auto observer = std::make_shared<BatchObserverL3>();
+    book.addObserver(observer);
+    std::mt19937_64 rng(37);
+    std::vector<OrderId> live;
+    OrderId next_id = 1;
+    Timestamp ts = 1;
+    for (int step = 0; step < 3000; ++step) {
+        const auto roll = rng() % 20;
+        if (roll < 8 || live.size() < 10) {
+            const Side side = rng() % 2 ? Side::Buy : Side::Sell;
+            const Price price = side == Side::Buy ? 1000 - static_cast<Price>(rng() % 10) : 1001 + static_cast<Price>(rng() % 10);
+            // Explicit priorities make queue order and timestamps disagree; by default they agree until a
+            // modify or partial fill re-stamps an order
+            const uint64_t priority = explicit_priorities ? rng() % 1000 + 1 : 0;
+            book.addOrder(next_id, side, price, 1 + static_cast<Quantity>(rng() % 50), ++ts, priority);
+            live.push_back(next_id++);
+        } else if (roll < 17) {
+            const std::size_t i = rng() % live.size();
+            const auto* order = book.findOrder(live[i]);
+            if (roll < 11) {
+                book.deleteOrder(live[i], ++ts);
+                live[i] = live.back();
+                live.pop_back();
+            } else if (roll < 14) {
+                book.modifyOrder(live[i], order->price, 1 + static_cast<Quantity>(rng() % 50), ++ts, order->priority);
+            } else if (order->quantity > 1) {
+                book.executeOrder(live[i], 1, ++ts);
+            }
+        } else {
+            const Side side = rng() % 2 ? Side::Buy : Side::Sell;
+            const Price price = side == Side::Buy ? 1001 + static_cast<Price>(rng() % 3) : 1000 - static_cast<Price>(rng() % 3);
+            book.submitOrder(next_id++, side, price, 1 + static_cast<Quantity>(rng() % 80), ++ts, OrderType::Limit, TimeInForce::IOC);
+            std::erase_if(live, [&book](OrderId id) { return book.findOrder(id) == nullptr; });
+        }
+
+        // Every level against a walk of its orders, and the last update against the level it reports
+        for (Side side : {Side::Buy, Side::Sell}) {
+            for (const auto& [price, level] : book.getLevelsL3(side)) {
+                LevelSummary expected;
+                expected.oldest_timestamp = std::numeric_limits<Timestamp>::max();
+                for (const auto& order : level.orders) {
+                    expected.total_quantity += order.quantity;
+                    ++expected.order_count;
+                    expected.max_order_quantity = std::max(expected.max_order_quantity, order.quantity);
+                    expected.oldest_timestamp = std::min(expected.oldest_timestamp, order.timestamp);
+                }
+                const auto summary = book.getLevelSummary(side, price);
+                ASSERT_TRUE(summary.has_value()) << "step " << step;
+                ASSERT_EQ(summary->total_quantity, expected.total_quantity) << "step " << step;
+                ASSERT_EQ(summary->order_count, expected.order_count) << "step " << step;
+                ASSERT_EQ(summary->max_order_quantity, expected.max_order_quantity) << "step " << step;
+                ASSERT_EQ(summary->oldest_timestamp, expected.oldest_timestamp) << "step " << step;
+            }
+        }
+        if (!observer->level_updates.empty()) {
+            const PriceLevelUpdate& update = observer->level_updates.back();
+            const auto summary = book.getLevelSummary(update.side, update.price).value_or(LevelSummary{});
+            ASSERT_EQ(update.num_orders, summary.order_count) << "step " << step;
+            ASSERT_EQ(update.max_order_quantity, summary.max_order_quantity) << "step " << step;
+            ASSERT_EQ(update.oldest_timestamp, summary.oldest_timestamp) << "step " << step;
+        }
+    }
+}
+
+TEST_F(OrderBookL3Test, LevelSummariesMatchOrdersUnderChurn) {
+    for (bool explicit_priorities : {false, true}) {
+        OrderBookL3 book(kSymbol);
+        checkLevelSummariesUnderChurn(book, explicit_priorities);
+        CompactOrderBookL3 compact(kSymbol);
+        checkLevelSummariesUnderChurn(compact, explicit_priorities);
+        PooledLevelOrderBookL3 pooled(kSymbol);
+        checkLevelSummariesUnderChurn(pooled, explicit_priorities);
+        LadderOrderBookL3 ladder(kSymbol, PriceLadderConfig{1, 64});
+        checkLevelSummariesUnderChurn(ladder, explicit_priorities);
+    }
+}
+
+TEST_F(OrderBookL3Test, MemoryConfigPlacesOrderPool) {
+    OrderBookL3 book(kSymbol, MemoryConfig{.page_size = PageSize::Huge, .prefault = true}, 10, 4096);
+    EXPECT_EQ(book.orderPoolAllocator().config().page_size, PageSize::Huge);
+
+    for (OrderId id = 1; id <= 5000; ++id) {
+        ASSERT_TRUE(book.addOrder(id, Side::Buy, kPrice100 - static_cast<Price>(id % 20), kQty10, kTs1));
+    }
+    EXPECT_EQ(book.orderCount(), 5000);
+    EXPECT_TRUE(book.deleteOrder(1, kTs2));
+    EXPECT_EQ(book.findOrder(2)->quantity, kQty10);
+}
+
+TEST_F(OrderBookL3Test, CompactOrderBookMatchesDefaultLayout) {
+    OrderBookL3 book(kSymbol);
+    CompactOrderBookL3 compact(kSymbol);
+    auto observer = std::make_shared<BatchObserverL3>();
+    auto compact_observer = std::make_shared<BatchObserverL3>();
+    book.addObserver(observer);
+    compact.addObserver(compact_observer);
+
+    auto apply = [&](auto& b) {
+        b.addOrder(kOrder1, Side::Buy, kPrice100, kQty10, kTs1);
+        b.addOrder(kOrder2, Side::Buy, kPrice100, kQty20, kTs2);
+        b.addOrder(kOrder3, Side::Buy, kPrice99, kQty30, kTs2);
+        b.addOrder(kOrder4, Side::Sell, kPrice101, kQty40, kTs3);
+        b.addOrder(kOrder5, Side::Sell, kPrice102, kQty50, kTs3);
+        b.modifyOrder(kOrder2, kPrice100, kQty10, kTs3, kPriority1);   // Jumps ahead of kOrder1
+        b.executeOrder(kOrder4, kQty10, kTs4);
+        b.deleteOrder(kOrder3, kTs4);
+        b.modifyOrder(kOrder5, kPrice101, kQty50, kTs4);               // Joins kOrder4's level
+    };
+    apply(book);
+    apply(compact);
+
+    EXPECT_EQ(compact.orderCount(), book.orderCount());
+    for (Side side : {Side::Buy, Side::Sell}) {
+        const auto levels = book.getLevelsL2(side, 0);
+        const auto compact_levels = compact.getLevelsL2(side, 0);
+        ASSERT_EQ(compact_levels.size(), levels.size());
+        for (std::size_t i = 0; i < levels.size(); ++i) {
+            EXPECT_EQ(compact_levels[i].price, levels[i].price);
+            EXPECT_EQ(compact_levels[i].quantity, levels[i].quantity);
+        }
+    }
+    EXPECT_EQ(compact.getTopOfBook().ask_quantity, book.getTopOfBook().ask_quantity);
+    EXPECT_EQ(compact_observer->level_updates.size(), observer->level_updates.size());
+    EXPECT_EQ(compact_observer->order_updates.size(), observer->order_updates.size());
+
+    // Queue order at a level is preserved
+    const auto* level = compact.getLevel(Side::Buy, kPrice100).first;
+    ASSERT_NE(level, nullptr);
+    ASSERT_EQ(level->orderCount(), 2);
+    EXPECT_EQ(level->orders.front()->order_id, kOrder2);
+    EXPECT_EQ(level->orders.back()->order_id, kOrder1);
+
+    const auto* order = compact.findOrder(kOrder5);
+    ASSERT_NE(order, nullptr);
+    EXPECT_EQ(order->side(), Side::Sell);
+    EXPECT_EQ(order->price, kPrice101);
+    EXPECT_EQ(order->timestamp, kTs4);
+
+    // An explicit priority leaves the timestamp intact
+    const auto* jumped = compact.findOrder(kOrder2);
+    ASSERT_NE(jumped, nullptr);
+    EXPECT_EQ(jumped->timestamp, book.findOrder(kOrder2)->timestamp);
+    EXPECT_EQ(jumped->priority, kPriority1);
+}
+
+TEST_F(OrderBookL3Test, CompactOrderBookDeepQueue) {
+    static_assert(sizeof(CompactOrderBookL3::Order) < sizeof(OrderBookL3::Order));
+    CompactOrderBookL3 book(kSymbol, MemoryConfig{.page_size = PageSize::Huge}, 10, 1024);
+
+    constexpr OrderId kCount = 20000;
+    for (OrderId id = 1; id <= kCount; ++id) {
+        ASSERT_TRUE(book.addOrder(id, id % 2 ? Side::Buy : Side::Sell, id % 2 ? kPrice100 : kPrice101, kQty10, id));
+    }
+    EXPECT_GE(book.orderPoolCapacity(), kCount);
+    for (OrderId id = 1; id <= kCount; id += 3) {
+        ASSERT_TRUE(book.deleteOrder(id, kTs1));
+    }
+
+    const auto* level = book.getLevel(Side::Buy, kPrice100).first;
+    ASSERT_NE(level, nullptr);
+    OrderId previous = 0;
+    Quantity total = 0;
+    for (const auto& order : level->orders) {
+        EXPECT_GT(order.order_id, previous);
+        EXPECT_EQ(order.side(), Side::Buy);
+        previous = order.order_id;
+        total += order.quantity;
+    }
+    EXPECT_EQ(total, level->getTotalQuantity());
+    EXPECT_EQ(book.orderCount(), kCount - (kCount + 2) / 3);
+}
+
+// ============================================================================
+// Queue Position Tests
+// ============================================================================
+
+TEST_F(OrderBookL3Test, QueuePositionTracksCancelsAndFills) {
+    OrderBookL3 book(kSymbol);
+    book.addOrder(kOrder1, Side::Buy, kPrice100, kQty10, kTs1);
+    book.addOrder(kOrder2, Side::Buy, kPrice100, kQty20, kTs2);
+    book.addOrder(kOrder3, Side::Buy, kPrice100, kQty30, kTs3);
+    book.addOrder(kOrder4, Side::Buy, kPrice99, kQty40, kTs1);
+
+    EXPECT_FALSE(book.queuePosition(kOrder5).has_value());
+    auto position = book.queuePosition(kOrder3);
+    ASSERT_TRUE(position.has_value());
+    EXPECT_EQ(position->orders_ahead, 2);
+    EXPECT_EQ(position->quantity_ahead, kQty10 + kQty20);
+    EXPECT_EQ(book.queuePosition(kOrder1)->orders_ahead, 0);
+    EXPECT_EQ(book.queuePosition(kOrder4)->quantity_ahead, 0);
+
+    // Partial fill and quantity reduction ahead, then a cancel
+    book.executeOrder(kOrder1, 4, kTs4);
+    book.modifyOrder(kOrder2, kPrice100, 5, kTs4, kTs2);
+    EXPECT_EQ(book.queuePosition(kOrder3)->quantity_ahead, 6 + 5);
+    book.deleteOrder(kOrder1, kTs4);
+    position = book.queuePosition(kOrder3);
+    EXPECT_EQ(position->orders_ahead, 1);
+    EXPECT_EQ(position->quantity_ahead, 5);
+
+    // Tail append and re-prioritization to the tail
+    book.addOrder(kOrder5, Side::Buy, kPrice100, kQty50, kTs4);
+    EXPECT_EQ(book.queuePosition(kOrder5)->quantity_ahead, 5 + kQty30);
+    book.modifyOrder(kOrder2, kPrice100, 5, kTs4, kTs4 + 1);
+    EXPECT_EQ(book.queuePosition(kOrder3)->orders_ahead, 0);
+    EXPECT_EQ(book.queuePosition(kOrder2)->quantity_ahead, kQty30 + kQty50);
+}
+
+TEST_F(OrderBookL3Test, QueuePositionAfterPriorityInsert) {
+    OrderBookL3 book(kSymbol);
+    book.addOrder(kOrder1, Side::Sell, kPrice101, kQty10, kTs1, kPriority1);
+    book.addOrder(kOrder2, Side::Sell, kPrice101, kQty20, kTs1, kPriority3);
+    EXPECT_EQ(book.queuePosition(kOrder2)->quantity_ahead, kQty10);
+
+    // Lands between the two resting orders, and at the head
+    book.addOrder(kOrder3, Side::Sell, kPrice101, kQty30, kTs2, kPriority2);
+    book.addOrder(kOrder4, Side::Sell, kPrice101, kQty40, kTs2, 1);
+    EXPECT_EQ(book.queuePosition(kOrder2)->orders_ahead, 3);
+    EXPECT_EQ(book.queuePosition(kOrder2)->quantity_ahead, kQty10 + kQty30 + kQty40);
+    EXPECT_EQ(book.queuePosition(kOrder3)->quantity_ahead, kQty10 + kQty40);
+
+    // Order moved to another level
+    book.modifyOrder(kOrder4, kPrice102, kQty40, kTs3);
+    EXPECT_EQ(book.queuePosition(kOrder4)->orders_ahead, 0);
+    EXPECT_EQ(book.queuePosition(kOrder3)->quantity_ahead, kQty10);
+}
+
+template<typename Book>
+static void checkQueuePositionsUnderChurn(uint64_t priority_inserts_per_20 = 1) {
+    Book book(1);
+    std::mt19937_64 rng(99);
+    std::vector<OrderId> live;
+    OrderId next_id = 1;
+    Timestamp ts = 1;
+
+    auto walk = [&](OrderId id) {
+        const auto* order = book.findOrder(id);
+        const auto* level = book.getLevel(detail::sideOf(*order), order->price).first;
+        QueuePosition expected;
+        for (const auto& resting : level->orders) {
+            if (resting.order_id == id) {
+                break;
+            }
+            ++expected.orders_ahead;
+            expected.quantity_ahead += resting.quantity;
+        }
+        return expected;
+    };
+
+    for (int step = 0; step < 6000; ++step) {
+        const auto roll = rng() % 20;
+        if (roll < 8 || live.size() < 10) {
+            // Mostly tail adds at two prices, some ahead of the tail
+            const uint64_t priority = roll < priority_inserts_per_20 ? 1 + rng() % ts : 0;
+            book.addOrder(next_id, Side::Buy, 10000 + static_cast<Price>(rng() % 2), 1 + static_cast<Quantity>(rng() % 50),
+                          ++ts, priority);
+            live.push_back(next_id++);
+        } else {
+            const std::size_t i = rng() % live.size();
+            const OrderId id = live[i];
+            const Quantity quantity = book.findOrder(id)->quantity;
+            if (roll < 13 || quantity == 1) {
+                book.deleteOrder(id, ++ts);
+                live[i] = live.back();
+                live.pop_back();
+            } else {
+                book.executeOrder(id, 1 + static_cast<Quantity>(rng() % (quantity - 1)), ++ts);
+            }
+        }
+        if (step % 7 == 0) {
+            const OrderId id = live[rng() % live.size()];
+            const auto position = book.queuePosition(id);
+            const auto expected = walk(id);
+            ASSERT_TRUE(position.has_value());
+            ASSERT_EQ(position->orders_ahead, expected.orders_ahead) << "step " << step;
+            ASSERT_EQ(position->quantity_ahead, expected.quantity_ahead) << "step " << step;
+        }
+    }
+}
+
+TEST_F(OrderBookL3Test, QueuePositionMatchesWalkUnderChurn) {
+    checkQueuePositionsUnderChurn<OrderBookL3>();
+    checkQueuePositionsUnderChurn<CompactOrderBookL3>();
+    checkQueuePositionsUnderChurn<PooledLevelOrderBookL3>();
+}
+
+TEST_F(OrderBookL3Test, QueuePositionMatchesWalkUnderPriorityInserts) {
+    // Adds land at random places in the queue while the index is live
+    checkQueuePositionsUnderChurn<OrderBookL3>(8);
+}
+
+// ============================================================================
+// Matching Tests
+// ============================================================================
+
+TEST_F(OrderBookL3Test, SubmitOrderSweepsInPriceTimePriority) {
+    OrderBookL3 book(kSymbol);
+    book.addOrder(kOrder1, Side::Sell, kPrice101, kQty10, kTs1);
+    book.addOrder(kOrder2, Side::Sell, kPrice101, kQty20, kTs2);
+    book.addOrder(kOrder3, Side::Sell, kPrice102, kQty30, kTs1);
+    book.addOrder(kOrder4, Side::Buy, kPrice99, kQty10, kTs1);
+
+    auto observer = std::make_shared<BatchObserverL3>();
+    book.addObserver(observer);
+
+    const SubmitResult result = book.submitOrder(kOrder5, Side::Buy, kPrice102, 45, kTs3);
+    EXPECT_EQ(result.status, SubmitStatus::Filled);
+    EXPECT_EQ(result.filled_quantity, 45);
+    EXPECT_EQ(result.remaining_quantity, 0);
+    EXPECT_EQ(result.trade_count, 3);
+
+    ASSERT_EQ(observer->trades.size(), 3);
+    EXPECT_EQ(observer->trades[0].passive_order_id, kOrder1);
+    EXPECT_EQ(observer->trades[0].price, kPrice101);
+    EXPECT_EQ(observer->trades[0].quantity, kQty10);
+    EXPECT_EQ(observer->trades[1].passive_order_id, kOrder2);
+    EXPECT_EQ(observer->trades[1].quantity, kQty20);
+    EXPECT_EQ(observer->trades[2].passive_order_id, kOrder3);
+    EXPECT_EQ(observer->trades[2].price, kPrice102);
+    EXPECT_EQ(observer->trades[2].quantity, 15);
+    for (const Trade& trade : observer->trades) {
+        EXPECT_EQ(trade.aggressive_order_id, kOrder5);
+        EXPECT_EQ(trade.aggressor_side, Side::Buy);
+        EXPECT_EQ(trade.timestamp, kTs3);
+    }
+
+    // Two deletes and a partial fill, the last one closing the batch
+    ASSERT_EQ(observer->order_updates.size(), 3);
+    EXPECT_EQ(observer->order_updates[0].quantity, 0);
+    EXPECT_EQ(observer->order_updates[1].quantity, 0);
+    EXPECT_EQ(observer->order_updates[2].order_id, kOrder3);
+    EXPECT_EQ(observer->order_updates[2].quantity, 15);
+    EXPECT_EQ(observer->order_updates[2].old_qty, kQty30);
+    EXPECT_FALSE(observer->order_updates[1].isLastInBatch());
+    EXPECT_TRUE(observer->order_updates[2].isLastInBatch());
+
+    // One update per swept level, one top-of-book update
+    ASSERT_EQ(observer->level_updates.size(), 2);
+    EXPECT_EQ(observer->level_updates[0].price, kPrice101);
+    EXPECT_EQ(observer->level_updates[0].quantity, 0);
+    EXPECT_TRUE(observer->level_updates[0].priceChanged());
+    EXPECT_FALSE(observer->level_updates[0].isLastInBatch());
+    EXPECT_EQ(observer->level_updates[1].price, kPrice102);
+    EXPECT_EQ(observer->level_updates[1].quantity, 15);
+    EXPECT_TRUE(observer->level_updates[1].isLastInBatch());
+    ASSERT_EQ(observer->tob_updates.size(), 1);
+    EXPECT_EQ(observer->tob_updates[0].best_ask, kPrice102);
+    EXPECT_EQ(observer->tob_updates[0].ask_quantity, 15);
+
+    EXPECT_EQ(book.findOrder(kOrder1), nullptr);
+    EXPECT_EQ(book.findOrder(kOrder2), nullptr);
+    EXPECT_EQ(book.findOrder(kOrder3)->quantity, 15);
+    EXPECT_EQ(book.findOrder(kOrder5), nullptr);
+    EXPECT_EQ(book.levelCount(Side::Sell), 1);
+    EXPECT_EQ(book.orderCount(), 2);
+}
+
+TEST_F(OrderBookL3Test, SubmitOrderRestsRemainder) {
+    OrderBookL3 book(kSymbol);
+    book.addOrder(kOrder1, Side::Sell, kPrice101, kQty10, kTs1);
+    book.addOrder(kOrder2, Side::Sell, kPrice102, kQty20, kTs1);
+    auto observer = std::make_shared<BatchObserverL3>();
+    book.addObserver(observer);
+
+    // Crosses 101 only, the remainder rests as the best bid
+    SubmitResult result = book.submitOrder(kOrder3, Side::Buy, kPrice101, kQty30, kTs2);
+    EXPECT_EQ(result.status, SubmitStatus::PartiallyFilled);
+    EXPECT_EQ(result.filled_quantity, kQty10);
+    EXPECT_EQ(result.remaining_quantity, kQty20);
+    ASSERT_NE(book.getBestBid(), nullptr);
+    EXPECT_EQ(book.getBestBid()->price, kPrice101);
+    EXPECT_EQ(book.getBestBid()->getTotalQuantity(), kQty20);
+    EXPECT_EQ(book.getBestAsk()->price, kPrice102);
+    EXPECT_EQ(book.findOrder(kOrder3)->priority, kTs2);
+
+    // The sweep leaves LastInBatch to the resting order, and the book notifies one top-of-book update
+    ASSERT_EQ(observer->order_updates.size(), 2);
+    EXPECT_FALSE(observer->order_updates[0].isLastInBatch());
+    EXPECT_EQ(observer->order_updates[1].order_id, kOrder3);
+    EXPECT_TRUE(observer->order_updates[1].isLastInBatch());
+    ASSERT_EQ(observer->level_updates.size(), 2);
+    EXPECT_FALSE(observer->level_updates[0].isLastInBatch());
+    EXPECT_EQ(observer->level_updates[1].side, Side::Buy);
+    ASSERT_EQ(observer->tob_updates.size(), 1);
+    EXPECT_EQ(observer->tob_updates[0].best_bid, kPrice101);
+    EXPECT_EQ(observer->tob_updates[0].best_ask, kPrice102);
+
+    // Nothing crosses
+    result = book.submitOrder(kOrder4, Side::Sell, kPrice102, kQty10, kTs3);
+    EXPECT_EQ(result.status, SubmitStatus::Resting);
+    EXPECT_EQ(result.trade_count, 0);
+    EXPECT_EQ(book.getBestAsk()->getTotalQuantity(), kQty30);
+}
+
+TEST_F(OrderBookL3Test, SubmitIocAndMarketOrdersNeverRest) {
+    OrderBookL3 book(kSymbol);
+    book.addOrder(kOrder1, Side::Buy, kPrice100, kQty10, kTs1);
+    book.addOrder(kOrder2, Side::Buy, kPrice99, kQty20, kTs1);
+    book.addOrder(kOrder3, Side::Buy, kPrice98, kQty30, kTs1);
+    auto observer = std::make_shared<BatchObserverL3>();
+    book.addObserver(observer);
+
+    SubmitResult result = book.submitOrder(10, Side::Sell, kPrice99, kQty40, kTs2, OrderType::Limit, TimeInForce::IOC);
+    EXPECT_EQ(result.status, SubmitStatus::Cancelled);
+    EXPECT_EQ(result.filled_quantity, kQty30);
+    EXPECT_EQ(result.remaining_quantity, kQty10);
+    EXPECT_EQ(book.findOrder(10), nullptr);
+    EXPECT_EQ(book.isEmpty(Side::Sell), true);
+    EXPECT_EQ(book.getBestBid()->price, kPrice98);
+    // The sweep closes the batch when the remainder is cancelled
+    ASSERT_FALSE(observer->level_updates.empty());
+    EXPECT_TRUE(observer->level_updates.back().isLastInBatch());
+    EXPECT_TRUE(observer->order_updates.back().isLastInBatch());
+    EXPECT_EQ(observer->tob_updates.size(), 1);
+
+    // Market orders ignore the price and cancel what the book cannot fill
+    result = book.submitOrder(11, Side::Sell, 0, kQty50, kTs3, OrderType::Market);
+    EXPECT_EQ(result.status, SubmitStatus::Cancelled);
+    EXPECT_EQ(result.filled_quantity, kQty30);
+    EXPECT_EQ(result.remaining_quantity, kQty20);
+    EXPECT_TRUE(book.isEmpty());
+
+    // IOC that does not cross does nothing
+    book.addOrder(kOrder4, Side::Sell, kPrice102, kQty10, kTs3);
+    result = book.submitOrder(12, Side::Buy, kPrice101, kQty10, kTs4, OrderType::Limit, TimeInForce::IOC);
+    EXPECT_EQ(result.status, SubmitStatus::Cancelled);
+    EXPECT_EQ(result.trade_count, 0);
+    EXPECT_EQ(book.orderCount(), 1);
+}
+
+TEST_F(OrderBookL3Test, SubmitFillOrKill) {
+    OrderBookL3 book(kSymbol);
+    book.addOrder(kOrder1, Side::Sell, kPrice101, kQty10, kTs1);
+    book.addOrder(kOrder2, Side::Sell, kPrice102, kQty20, kTs1);
+    book.addOrder(kOrder3, Side::Sell, 10300, kQty30, kTs1);
+    auto observer = std::make_shared<BatchObserverL3>();
+    book.addObserver(observer);
+
+    // 30 available up to 102: not enough, nothing happens
+    SubmitResult result = book.submitOrder(10, Side::Buy, kPrice102, 31, kTs2, OrderType::Limit, TimeInForce::FOK);
+    EXPECT_EQ(result.status, SubmitStatus::Rejected);
+    EXPECT_EQ(result.filled_quantity, 0);
+    EXPECT_TRUE(observer->trades.empty());
+    EXPECT_TRUE(observer->order_updates.empty());
+    EXPECT_EQ(book.orderCount(), 3);
+
+    result = book.submitOrder(11, Side::Buy, kPrice102, kQty30, kTs2, OrderType::Limit, TimeInForce::FOK);
+    EXPECT_EQ(result.status, SubmitStatus::Filled);
+    EXPECT_EQ(result.trade_count, 2);
+    EXPECT_EQ(book.getBestAsk()->price, 10300);
+
+    // Market FOK is bounded by the whole side
+    result = book.submitOrder(12, Side::Buy, 0, 31, kTs3, OrderType::Market, TimeInForce::FOK);
+    EXPECT_EQ(result.status, SubmitStatus::Rejected);
+    result = book.submitOrder(13, Side::Buy, 0, kQty30, kTs3, OrderType::Market, TimeInForce::FOK);
+    EXPECT_EQ(result.status, SubmitStatus::Filled);
+    EXPECT_TRUE(book.isEmpty());
+}
+
+TEST_F(OrderBookL3Test, SubmitOrderRejects) {
+    OrderBookL3 book(kSymbol);
+    book.addOrder(kOrder1, Side::Sell, kPrice101, kQty10, kTs1, 0, 5);
+
+    EXPECT_EQ(book.submitOrder(kOrder2, Side::Buy, kPrice101, 0, kTs2).status, SubmitStatus::Rejected);
+    EXPECT_EQ(book.submitOrder(kOrder2, Side::Buy, kPrice101, kQty10, kTs2, OrderType::Stop).status,
+              SubmitStatus::Rejected);
+    EXPECT_EQ(book.submitOrder(kOrder2, Side::Buy, kPrice101, kQty10, kTs2, OrderType::StopLimit).status,
+              SubmitStatus::Rejected);
+    // Duplicate order id
+    EXPECT_EQ(book.submitOrder(kOrder1, Side::Buy, kPrice101, kQty10, kTs2).status, SubmitStatus::Rejected);
+    // Out of sequence
+    EXPECT_EQ(book.submitOrder(kOrder2, Side::Buy, kPrice101, kQty10, kTs2, OrderType::Limit, TimeInForce::Day, 4).status,
+              SubmitStatus::Rejected);
+    EXPECT_EQ(book.findOrder(kOrder1)->quantity, kQty10);
+
+    const SubmitResult result =
+        book.submitOrder(kOrder2, Side::Buy, kPrice101, kQty10, kTs2, OrderType::Limit, TimeInForce::Day, 6);
+    EXPECT_EQ(result.status, SubmitStatus::Filled);
+    EXPECT_EQ(book.getLastSeqNum(), 6);
+}
+
+template<typename Book>
+static std::vector<std::tuple<OrderId, Price, Quantity>> restingOrders(const Book& book) {
+    std::vector<std::tuple<OrderId, Price, Quantity>> orders;
+    for (Side side : {Side::Buy, Side::Sell}) {
+        for (const auto& [price, level] : book.getLevelsL3(side)) {
+            for (const auto& order : level.orders) {
+                orders.emplace_back(order.order_id, order.price, order.quantity);
+            }
+        }
+    }
+    return orders;
+}
+
+TEST_F(OrderBookL3Test, SubmitOrderSameAcrossLayouts) {
+    OrderBookL3 book(kSymbol);
+    CompactOrderBookL3 compact(kSymbol);
+    LadderOrderBookL3 ladder(kSymbol, PriceLadderConfig{1, 64});
+    PooledLevelOrderBookL3 pooled(kSymbol);
+
+    std::mt19937_64 rng(24);
+    for (OrderId id = 1; id <= 20000; ++id) {
+        const Side side = rng() % 2 == 0 ? Side::Buy : Side::Sell;
+        const Price price = 1000 + static_cast<Price>(rng() % 21) - 10;
+        const Quantity quantity = 1 + static_cast<Quantity>(rng() % 50);
+        const auto kind = rng() % 8;
+        const OrderType type = kind == 0 ? OrderType::Market : OrderType::Limit;
+        const TimeInForce tif = kind == 1 ? TimeInForce::IOC : kind == 2 ? TimeInForce::FOK : TimeInForce::Day;
+
+        const SubmitResult result = book.submitOrder(id, side, price, quantity, id, type, tif);
+        const SubmitResult compact_result = compact.submitOrder(id, side, price, quantity, id, type, tif);
+        const SubmitResult ladder_result = ladder.submitOrder(id, side, price, quantity, id, type, tif);
+        const SubmitResult pooled_result = pooled.submitOrder(id, side, price, quantity, id, type, tif);
+        ASSERT_EQ(result.status, compact_result.status);
+        ASSERT_EQ(result.status, ladder_result.status);
+        ASSERT_EQ(result.status, pooled_result.status);
+        ASSERT_EQ(result.trade_count, pooled_result.trade_count);
+        ASSERT_EQ(result.filled_quantity, ladder_result.filled_quantity);
+        ASSERT_EQ(result.trade_count, ladder_result.trade_count);
+        ASSERT_EQ(result.filled_quantity + result.remaining_quantity, quantity);
+
+        // Never crossed
+        if (book.getBestBid() != nullptr && book.getBestAsk() != nullptr) {
+            ASSERT_LT(book.getBestBid()->price, book.getBestAsk()->price);
+        }
+    }
+    EXPECT_EQ(restingOrders(book), restingOrders(compact));
+    EXPECT_EQ(restingOrders(book), restingOrders(ladder));
+    EXPECT_EQ(restingOrders(book), restingOrders(pooled));
+}
+
+TEST_F(OrderBookL3Test, StopOrderTriggersOnTradePrice) {
+    OrderBookL3 book(kSymbol);
+    book.addOrder(kOrder1, Side::Sell, kPrice101, kQty10, kTs1);
+    book.addOrder(kOrder2, Side::Sell, kPrice102, kQty10, kTs1);
+    book.addOrder(kOrder3, Side::Sell, 10300, kQty50, kTs1);
+    book.addOrder(kOrder4, Side::Buy, kPrice99, kQty50, kTs1);
+    auto observer = std::make_shared<BatchObserverL3>();
+    book.addObserver(observer);
+
+    EXPECT_EQ(book.submitStopOrder(20, Side::Buy, kPrice101, 15, kTs2).status, SubmitStatus::Pending);
+    EXPECT_EQ(book.submitStopOrder(21, Side::Sell, kPrice98, kQty10, kTs2).status, SubmitStatus::Pending);
+    EXPECT_EQ(book.stopOrderCount(), 2);
+    EXPECT_EQ(book.stopOrderCount(Side::Buy), 1);
+    ASSERT_NE(book.findStopOrder(20), nullptr);
+    EXPECT_EQ(book.findStopOrder(20)->stop_price, kPrice101);
+    EXPECT_FALSE(book.lastTradePrice().has_value());
+    EXPECT_TRUE(observer->order_updates.empty());  // Pending stops are not in the book
+
+    // A trade at 101 triggers the buy stop, which sweeps 102 and part of 103 as a market order
+    const SubmitResult result = book.submitOrder(30, Side::Buy, kPrice101, kQty10, kTs3);
+    EXPECT_EQ(result.status, SubmitStatus::Filled);
+    EXPECT_EQ(result.trade_count, 1);
+    EXPECT_EQ(result.triggered_stops, 1);
+    EXPECT_EQ(book.findStopOrder(20), nullptr);
+    EXPECT_EQ(book.stopOrderCount(), 1);
+    EXPECT_EQ(book.lastTradePrice(), 10300);
+
+    ASSERT_EQ(observer->trades.size(), 3);
+    EXPECT_EQ(observer->trades[0].aggressive_order_id, 30);
+    EXPECT_EQ(observer->trades[1].aggressive_order_id, 20);
+    EXPECT_EQ(observer->trades[1].price, kPrice102);
+    EXPECT_EQ(observer->trades[1].timestamp, kTs3);
+    EXPECT_EQ(observer->trades[2].price, 10300);
+    EXPECT_EQ(observer->trades[2].quantity, 5);
+    // The triggered order is its own batch
+    EXPECT_EQ(observer->tob_updates.size(), 2);
+    EXPECT_EQ(book.getBestAsk()->getTotalQuantity(), 45);
+
+    // Exchange-reported fills do not move the last trade price
+    book.executeOrder(kOrder4, kQty10, kTs4);
+    EXPECT_EQ(book.stopOrderCount(Side::Sell), 1);
+
+    // A sell at 99 reaches the sell stop at 98 only once a trade prints at or below it
+    EXPECT_EQ(book.submitOrder(31, Side::Sell, kPrice99, kQty10, kTs4).triggered_stops, 0);
+    EXPECT_EQ(book.stopOrderCount(Side::Sell), 1);
+    book.addOrder(32, Side::Buy, kPrice98, kQty10, kTs4);
+    const SubmitResult sell = book.submitOrder(33, Side::Sell, kPrice98, 40, kTs4);
+    EXPECT_EQ(sell.filled_quantity, 40);
+    EXPECT_EQ(sell.triggered_stops, 1);
+    EXPECT_EQ(book.stopOrderCount(), 0);
+    // The triggered market sell found nothing left to fill
+    EXPECT_TRUE(book.isEmpty(Side::Buy));
+}
+
+TEST_F(OrderBookL3Test, StopOrdersCascade) {
+    OrderBookL3 book(kSymbol);
+    book.addOrder(kOrder1, Side::Sell, kPrice100, kQty10, kTs1);
+    book.addOrder(kOrder2, Side::Sell, kPrice101, kQty10, kTs1);
+    book.addOrder(kOrder3, Side::Sell, kPrice102, kQty10, kTs1);
+
+    // Stop-limit at 101 buys through 101, which triggers the stop at 101; the stop at 102 triggers next
+    book.submitStopOrder(20, Side::Buy, kPrice100, kQty20, kTs1, OrderType::StopLimit, kPrice101);
+    book.submitStopOrder(21, Side::Buy, kPrice101, kQty20, kTs1, OrderType::StopLimit, kPrice102);
+    book.submitStopOrder(22, Side::Buy, kPrice102, kQty10, kTs1, OrderType::StopLimit, kPrice99, TimeInForce::IOC);
+    book.submitStopOrder(23, Side::Buy, 10500, kQty10, kTs1);
+
+    const SubmitResult result = book.submitOrder(30, Side::Buy, kPrice100, 5, kTs2);
+    EXPECT_EQ(result.triggered_stops, 3);
+    EXPECT_EQ(book.stopOrderCount(), 1);
+    ASSERT_NE(book.findStopOrder(23), nullptr);
+    EXPECT_EQ(book.lastTradePrice(), kPrice102);
+    EXPECT_TRUE(book.isEmpty(Side::Sell));
+
+    // 20 filled 5 at 100 and 10 at 101, rests 5 at 101; 21 filled 10 at 102, rests 10 at 102;
+    // 22 (IOC at 99) found nothing to cross
+    ASSERT_NE(book.findOrder(20), nullptr);
+    EXPECT_EQ(book.findOrder(20)->quantity, 5);
+    EXPECT_EQ(book.findOrder(20)->price, kPrice101);
+    ASSERT_NE(book.findOrder(21), nullptr);
+    EXPECT_EQ(book.findOrder(21)->quantity, kQty10);
+    EXPECT_EQ(book.findOrder(22), nullptr);
+    EXPECT_EQ(book.getBestBid()->price, kPrice102);
+}
+
+TEST_F(OrderBookL3Test, StopOrderSubmitRules) {
+    OrderBookL3 book(kSymbol);
+    book.addOrder(kOrder1, Side::Sell, kPrice101, kQty20, kTs1);
+
+    EXPECT_EQ(book.submitStopOrder(20, Side::Buy, kPrice101, 0, kTs1).status, SubmitStatus::Rejected);
+    EXPECT_EQ(book.submitStopOrder(20, Side::Buy, kPrice101, kQty10, kTs1, OrderType::Limit).status,
+              SubmitStatus::Rejected);
+    EXPECT_EQ(book.submitStopOrder(kOrder1, Side::Buy, kPrice101, kQty10, kTs1).status, SubmitStatus::Rejected);
+    EXPECT_EQ(book.submitStopOrder(20, Side::Buy, kPrice102, kQty10, kTs1).status, SubmitStatus::Pending);
+    EXPECT_EQ(book.submitStopOrder(20, Side::Buy, kPrice102, kQty10, kTs1).status, SubmitStatus::Rejected);
+
+    EXPECT_TRUE(book.cancelStopOrder(20));
+    EXPECT_FALSE(book.cancelStopOrder(20));
+    EXPECT_EQ(book.stopOrderCount(), 0);
+
+    // Once a trade printed at 101, a buy stop at or below 101 triggers on submission
+    book.submitOrder(30, Side::Buy, kPrice101, 5, kTs2);
+    const SubmitResult immediate = book.submitStopOrder(21, Side::Buy, kPrice100, 5, kTs3);
+    EXPECT_EQ(immediate.status, SubmitStatus::Filled);
+    EXPECT_EQ(immediate.filled_quantity, 5);
+    EXPECT_EQ(book.findOrder(kOrder1)->quantity, kQty10);
+
+    // clear() drops pending stops
+    book.submitStopOrder(22, Side::Sell, kPrice99, 5, kTs3);
+    book.clear();
+    EXPECT_EQ(book.stopOrderCount(), 0);
+    EXPECT_FALSE(book.lastTradePrice().has_value());
+}
+
+template<typename Book>
+static void expectLevelsL2ViewMatches(const Book& book, std::size_t depth, int step) {
+    for (Side side : {Side::Buy, Side::Sell}) {
+        const auto view = book.getLevelsL2View(side, depth);
+        const auto expected = book.getLevelsL2(side, depth);
+        ASSERT_EQ(view.size(), expected.size()) << "step " << step;
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(view[i].price, expected[i].price) << "step " << step;
+            ASSERT_EQ(view[i].quantity, expected[i].quantity) << "step " << step;
+            ASSERT_EQ(view[i].timestamp, expected[i].timestamp) << "step " << step;
+        }
+    }
+}
+
+template<typename Book>
+static void checkLevelsL2ViewUnderChurn(Book& book) {
+    std::mt19937_64 rng(34);
+    std::vector<OrderId> live;
+    OrderId next_id = 1;
+    Timestamp ts = 1;
+    for (int step = 0; step < 4000; ++step) {
+        const auto roll = rng() % 20;
+        if (roll < 8 || live.size() < 10) {
+            const Side side = rng() % 2 ? Side::Buy : Side::Sell;
+            const Price price = side == Side::Buy ? 1000 - static_cast<Price>(rng() % 30) : 1001 + static_cast<Price>(rng() % 30);
+            book.addOrder(next_id, side, price, 1 + static_cast<Quantity>(rng() % 50), ++ts);
+            live.push_back(next_id++);
+        } else if (roll < 16) {
+            const std::size_t i = rng() % live.size();
+            const auto* order = book.findOrder(live[i]);
+            if (roll < 11) {
+                book.deleteOrder(live[i], ++ts);
+                live[i] = live.back();
+                live.pop_back();
+            } else if (roll < 14) {
+                const Price shift = static_cast<Price>(rng() % 5);
+                const Price price = detail::sideOf(*order) == Side::Buy ? order->price - shift : order->price + shift;
+                book.modifyOrder(live[i], price, 1 + static_cast<Quantity>(rng() % 50), ++ts);
+            } else if (order->quantity > 1) {
+                book.executeOrder(live[i], 1, ++ts);
+            }
+        } else if (roll < 19) {
+            // Crossing orders sweep the best levels (ids of filled orders stay in live; lookups skip them)
+            const Side side = rng() % 2 ? Side::Buy : Side::Sell;
+            const Price price = side == Side::Buy ? 1001 + static_cast<Price>(rng() % 3) : 1000 - static_cast<Price>(rng() % 3);
+            book.submitOrder(next_id++, side, price, 1 + static_cast<Quantity>(rng() % 80), ++ts, OrderType::Limit, TimeInForce::IOC);
+            std::erase_if(live, [&book](OrderId id) { return book.findOrder(id) == nullptr; });
+        } else {
+            book.clearSide(rng() % 2 ? Side::Buy : Side::Sell);
+            std::erase_if(live, [&book](OrderId id) { return book.findOrder(id) == nullptr; });
+        }
+        // Mix of shallow and full views, sometimes read twice between updates
+        if (step % 3 == 0) {
+            expectLevelsL2ViewMatches(book, 5, step);
+        }
+        if (step % 5 == 0) {
+            expectLevelsL2ViewMatches(book, 0, step);
+            expectLevelsL2ViewMatches(book, 0, step);
+        }
+    }
+}
+
+TEST_F(OrderBookL3Test, LevelsL2ViewMatchesLevelsL2UnderChurn) {
+    OrderBookL3 book(kSymbol);
+    checkLevelsL2ViewUnderChurn(book);
+    CompactOrderBookL3 compact(kSymbol);
+    checkLevelsL2ViewUnderChurn(compact);
+    PooledLevelOrderBookL3 pooled(kSymbol);
+    checkLevelsL2ViewUnderChurn(pooled);
+
+    // Level indexes bounded to the interested levels stay exact down to the viewed depth
+    LadderOrderBookL3 ladder(kSymbol, PriceLadderConfig{1, 64}, 1);
+    ladder.setSkipLevelIndexBeyondInterested(true);
+    checkLevelsL2ViewUnderChurn(ladder);
+}
+
+TEST_F(OrderBookL3Test, LevelsL2ViewRefreshesFromFirstChangedLevel) {
+    OrderBookL3 book(kSymbol);
+    book.addOrder(kOrder1, Side::Buy, kPrice100, kQty10, kTs1);
+    book.addOrder(kOrder2, Side::Buy, kPrice99, kQty20, kTs1);
+    book.addOrder(kOrder3, Side::Buy, kPrice98, kQty30, kTs1);
+
+    auto bids = book.getLevelsL2View(Side::Buy);
+    ASSERT_EQ(bids.size(), 3);
+    const auto* data = bids.data();
+    EXPECT_EQ(book.getLevelsL2View(Side::Buy).data(), data);    // Cached: same storage, nothing re-read
+    EXPECT_TRUE(book.getLevelsL2View(Side::Sell).empty());
+
+    // A change at level 2 leaves levels 0 and 1 as they were
+    book.modifyOrder(kOrder3, kPrice98, kQty40, kTs2);
+    bids = book.getLevelsL2View(Side::Buy, 2);
+    ASSERT_EQ(bids.size(), 2);
+    EXPECT_EQ(bids[1].quantity, kQty20);
+    bids = book.getLevelsL2View(Side::Buy);
+    ASSERT_EQ(bids.size(), 3);
+    EXPECT_EQ(bids.data(), data);
+    EXPECT_EQ(bids[2].quantity, kQty40);
+    EXPECT_EQ(bids[2].timestamp, kTs2);
+
+    // New best level shifts everything down
+    book.addOrder(kOrder4, Side::Buy, kPrice101, kQty10, kTs3);
+    bids = book.getLevelsL2View(Side::Buy);
+    ASSERT_EQ(bids.size(), 4);
+    EXPECT_EQ(bids[0].price, kPrice101);
+    EXPECT_EQ(bids[3].price, kPrice98);
+
+    // Snapshots and clears replace the whole view
+    const SnapshotOrder orders[] = {{kOrder5, Side::Buy, kPrice99, kQty50, kTs4}};
+    book.loadSnapshot(orders);
+    bids = book.getLevelsL2View(Side::Buy);
+    ASSERT_EQ(bids.size(), 1);
+    EXPECT_EQ(bids[0].quantity, kQty50);
+    book.clear();
+    EXPECT_TRUE(book.getLevelsL2View(Side::Buy).empty());
+}
+
+template<typename Book>
+static void checkTrimKeepsBookContents(Book& book) {
+    // A busy session: 4000 orders over 400 levels per side, then most of them cancelled
+    OrderId id = 1;
+    for (Price level = 0; level < 400; ++level) {
+        for (int i = 0; i < 5; ++i) {
+            book.addOrder(id++, Side::Buy, 1000 - level, 10, 1);
+            book.addOrder(id++, Side::Sell, 1001 + level, 10, 1);
+        }
+    }
+    for (OrderId cancel = 1; cancel < id; ++cancel) {
+        if (cancel % 100 != 0) {
+            book.deleteOrder(cancel, 2);
+        }
+    }
+    const auto bids = book.getLevelsL2(Side::Buy);
+    const auto asks = book.getLevelsL2(Side::Sell);
+    const std::size_t busy_bytes = book.memoryUsage();
+    EXPECT_GT(busy_bytes, sizeof(Book));
+
+    const std::size_t released = book.trim();
+    EXPECT_GT(released, 0u);
+    EXPECT_EQ(book.memoryUsage(), busy_bytes - released);
+    EXPECT_EQ(book.orderCount(), 40u);
+    EXPECT_EQ(book.getLevelsL2(Side::Buy), bids);
+    EXPECT_EQ(book.getLevelsL2(Side::Sell), asks);
+    for (OrderId kept = 100; kept < id; kept += 100) {
+        ASSERT_NE(book.findOrder(kept), nullptr) << kept;
+        EXPECT_EQ(book.findOrder(kept)->order_id, kept);
+    }
+
+    // The trimmed book keeps working and grows again on demand
+    EXPECT_TRUE(book.executeOrder(100, 1, 3));
+    EXPECT_TRUE(book.deleteOrder(200, 3));
+    for (OrderId more = id; more < id + 2000; ++more) {
+        ASSERT_TRUE(book.addOrder(more, Side::Buy, 500 + static_cast<Price>(more % 300), 10, 3));
+    }
+    EXPECT_EQ(book.orderCount(), 2039u);
+}
+
+TEST_F(OrderBookL3Test, TrimKeepsBookContents) {
+    OrderBookL3 book(kSymbol);
+    checkTrimKeepsBookContents(book);
+    CompactOrderBookL3 compact(kSymbol);
+    checkTrimKeepsBookContents(compact);
+    PooledLevelOrderBookL3 pooled(kSymbol);
+    checkTrimKeepsBookContents(pooled);
+    DirectIndexedOrderBookL3 direct(kSymbol);
+    checkTrimKeepsBookContents(direct);
+}
+
+TEST_F(OrderBookL3Test, TrimKeepsHighWatermark) {
+    OrderBookL3 book(kSymbol, 10, 16, 4);
+    for (OrderId id = 1; id <= 3000; ++id) {
+        book.addOrder(id, Side::Buy, 1000 - static_cast<Price>(id % 500), kQty10, kTs1);
+    }
+    for (OrderId id = 1; id <= 3000; ++id) {
+        book.deleteOrder(id, kTs2);
+    }
+    book.trim(2000, 300);
+    EXPECT_GE(book.orderPoolCapacity(), 2000u);
+    const std::size_t kept_bytes = book.memoryUsage();
+    EXPECT_GT(book.trim(), 0u);
+    EXPECT_LT(book.memoryUsage(), kept_bytes);
+    EXPECT_EQ(book.orderPoolCapacity(), 0u);
+    EXPECT_TRUE(book.addOrder(kOrder1, Side::Buy, kPrice100, kQty10, kTs3));
+    EXPECT_EQ(book.getTopOfBook().best_bid, kPrice100);
+}
+
+TEST_F(OrderBookL3Test, PooledLevelContainerKeepsLevelsInPlace) {
+    detail::PooledLevelContainerL3<Side::Buy> levels(4);
+    auto* first = &levels.findOrInsert(kPrice99).first->second;
+    EXPECT_TRUE(levels.findOrInsert(kPrice100).second);
+    EXPECT_FALSE(levels.findOrInsert(kPrice99).second);
+
+    // Better levels go in front without moving the existing ones
+    for (Price price = kPrice101; price < kPrice101 + 10; ++price) {
+        levels.findOrInsert(price);
+    }
+    ASSERT_EQ(levels.size(), 12);
+    EXPECT_EQ(&levels.find(kPrice99)->second, first);
+    EXPECT_EQ(levels.best()->first, kPrice101 + 9);
+    EXPECT_EQ(levels.indexOf(levels.find(kPrice100)), 10);
+    EXPECT_EQ(levels.atIndex(11)->second.price, kPrice99);
+    EXPECT_TRUE(levels.atIndex(12) == nullptr);
+
+    // Erased levels return their slots: churn at the top does not grow the pool
+    const std::size_t pool_capacity = levels.poolCapacity();
+    for (int round = 0; round < 1000; ++round) {
+        auto [it, inserted] = levels.findOrInsert(kPrice101 + 10 + round);
+        ASSERT_TRUE(inserted);
+        ASSERT_EQ(levels.indexOf(it), 0);
+        levels.erase(it);
+    }
+    EXPECT_EQ(levels.poolCapacity(), pool_capacity);
+    EXPECT_EQ(levels.size(), 12);
+
+    Price previous = std::numeric_limits<Price>::max();
+    for (const auto& [price, level] : levels.view()) {
+        EXPECT_LT(price, previous);
+        EXPECT_EQ(level.price, price);
+        previous = price;
+    }
+
+    detail::PooledLevelContainerL3<Side::Buy> moved(std::move(levels));
+    EXPECT_EQ(&moved.find(kPrice99)->second, first);
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+}
@@ -7,6 +7,8 @@
 #include <vector>
 #include <algorithm>
 #include <chrono>
+#include <atomic>
+#include <limits>
 #include <slick/orderbook/config.hpp>
 
 
@@ -284,6 +286,163 @@ TEST_F(OrderBookManagerL3Test, MultipleSymbolsIndependence) {
     EXPECT_EQ(order_book2->price, kPrice101);
 }
 
+TEST_F(OrderBookManagerL3Test, MemoryUsagePerSymbol) {
+    OrderBookManager<OrderBookL3> manager;
+    EXPECT_TRUE(manager.memoryUsage().empty());
+
+    auto* busy = manager.getOrCreateOrderBook(kSymbol2);
+    auto* quiet = manager.getOrCreateOrderBook(kSymbol1);
+    for (OrderId id = 1; id <= 5000; ++id) {
+        busy->addOrder(id, Side::Buy, kPrice100 - static_cast<Price>(id % 50), kQty10, kTs1);
+    }
+    EXPECT_TRUE(quiet->addOrder(kOrder1, Side::Sell, kPrice101, kQty20, kTs1));
+
+    const auto usage = manager.memoryUsage();
+    ASSERT_EQ(usage.size(), 2);
+    EXPECT_EQ(usage[0].symbol, kSymbol1);
+    EXPECT_EQ(usage[1].symbol, kSymbol2);
+    EXPECT_EQ(usage[0].bytes, quiet->memoryUsage());
+    EXPECT_EQ(usage[1].bytes, busy->memoryUsage());
+    EXPECT_GT(usage[1].bytes, usage[0].bytes);
+}
+
+TEST_F(OrderBookManagerL3Test, TrimBooksCompactsSelectedBooks) {
+    OrderBookManager<OrderBookL3> manager;
+    auto* idle = manager.getOrCreateOrderBook(kSymbol1);
+    auto* active = manager.getOrCreateOrderBook(kSymbol2);
+    for (OrderId id = 1; id <= 5000; ++id) {
+        idle->addOrder(id, Side::Buy, kPrice100 - static_cast<Price>(id % 500), kQty10, kTs1);
+        active->addOrder(id, Side::Buy, kPrice100 - static_cast<Price>(id % 500), kQty10, kTs1);
+    }
+    for (OrderId id = 2; id <= 5000; ++id) {
+        idle->deleteOrder(id, kTs2);
+        active->deleteOrder(id, kTs2);
+    }
+    const std::size_t idle_bytes = idle->memoryUsage();
+    const std::size_t active_bytes = active->memoryUsage();
+
+    // Only books the predicate picks are compacted
+    const std::size_t released = manager.trimBooks([](SymbolId symbol, const OrderBookL3&) {
+        return symbol == kSymbol1;
+    });
+    EXPECT_GT(released, 0u);
+    EXPECT_EQ(idle->memoryUsage(), idle_bytes - released);
+    EXPECT_EQ(active->memoryUsage(), active_bytes);
+    EXPECT_EQ(idle->orderCount(), 1);
+    EXPECT_EQ(idle->getTopOfBook().best_bid, kPrice100 - 1);
+    EXPECT_TRUE(idle->addOrder(kOrder1, Side::Sell, kPrice101, kQty20, kTs2));
+
+    EXPECT_GT(manager.trimBooks(), 0u);
+    EXPECT_LT(active->memoryUsage(), active_bytes);
+    EXPECT_EQ(active->orderCount(), 1);
+}
+
+TEST_F(OrderBookManagerL3Test, ForEachBookVisitsEveryBookOnStableWorkers) {
+    OrderBookManager<OrderBookL3> manager;
+    constexpr SymbolId kNumSymbols = 100;
+    for (SymbolId symbol = 1; symbol <= kNumSymbols; ++symbol) {
+        manager.getOrCreateOrderBook(symbol)->addOrder(kOrder1, Side::Buy, kPrice100, symbol, kTs1);
+    }
+
+    // Each symbol is visited once, and by the same worker range on every sweep of the same symbols
+    auto sweep = [&manager](std::size_t workers) {
+        std::vector<std::atomic<int>> visits(kNumSymbols + 1);
+        std::vector<std::thread::id> visitor(kNumSymbols + 1);
+        std::atomic<Quantity> total{0};
+        manager.forEachBook(SweepPolicy{workers}, [&](SymbolId symbol, const OrderBookL3& book) {
+            visits[symbol].fetch_add(1);
+            visitor[symbol] = std::this_thread::get_id();
+            total.fetch_add(book.getTopOfBook().bid_quantity);
+        });
+        for (SymbolId symbol = 1; symbol <= kNumSymbols; ++symbol) {
+            EXPECT_EQ(visits[symbol].load(), 1) << "symbol " << symbol;
+        }
+        EXPECT_EQ(total.load(), Quantity{kNumSymbols * (kNumSymbols + 1) / 2});
+        return visitor;
+    };
+    const auto serial = sweep(1);
+    EXPECT_TRUE(std::all_of(serial.begin() + 1, serial.end(),
+                            [](std::thread::id id) { return id == std::this_thread::get_id(); }));
+
+    const auto parallel = sweep(4);
+    for (SymbolId symbol = 2; symbol <= kNumSymbols; ++symbol) {
+        // Contiguous ranges of 25 symbols per worker, the first one on the calling thread
+        EXPECT_EQ(parallel[symbol] == parallel[symbol - 1], (symbol - 1) % 25 != 0) << "symbol " << symbol;
+    }
+    EXPECT_EQ(parallel[1], std::this_thread::get_id());
+
+    // More workers than books, and hardware concurrency
+    sweep(kNumSymbols * 2);
+    sweep(0);
+    OrderBookManager<OrderBookL3> empty;
+    empty.forEachBook(SweepPolicy{4}, [](SymbolId, const OrderBookL3&) { FAIL(); });
+}
+
+TEST_F(OrderBookManagerL2Test, ParallelSnapshotCopiesPublishedDepth) {
+    DirectOrderBookManager<OrderBookL2> manager;
+    constexpr SymbolId kNumSymbols = 64;
+    for (SymbolId symbol = 1; symbol <= kNumSymbols; ++symbol) {
+        auto* book = manager.getOrCreateOrderBook(symbol);
+        if (symbol != kNumSymbols) {
+            book->setPublishedDepth(4);
+        }
+        for (Price offset = 0; offset < 6; ++offset) {
+            book->updateLevel(Side::Buy, kPrice100 - offset, symbol, kTs1);
+            book->updateLevel(Side::Sell, kPrice100 + 1 + offset, symbol, kTs1);
+        }
+    }
+
+    // A writer keeps updating the first book while the sweep copies every book through its sequence lock
+    std::atomic<bool> stop{false};
+    std::thread writer([&manager, &stop] {
+        auto* book = manager.getOrderBook(kSymbol1);
+        for (Timestamp ts = kTs1 + 1; !stop.load(); ++ts) {
+            book->updateLevel(Side::Buy, kPrice100, 1 + static_cast<Quantity>(ts % 2), ts);
+        }
+    });
+    const auto snapshots = manager.parallelSnapshot<8>(SweepPolicy{4});
+    stop.store(true);
+    writer.join();
+
+    ASSERT_EQ(snapshots.size(), kNumSymbols);
+    for (SymbolId symbol = 1; symbol <= kNumSymbols; ++symbol) {
+        const auto& snapshot = snapshots[symbol - 1];
+        EXPECT_EQ(snapshot.symbol, symbol);
+        if (symbol == kNumSymbols) {
+            // Not published
+            EXPECT_EQ(snapshot.depth.version, 0u);
+            EXPECT_EQ(snapshot.depth.bid_count, 0u);
+            continue;
+        }
+        ASSERT_EQ(snapshot.depth.bid_count, 4u) << "symbol " << symbol;
+        ASSERT_EQ(snapshot.depth.ask_count, 4u) << "symbol " << symbol;
+        EXPECT_EQ(snapshot.depth.bids[0].price, kPrice100);
+        EXPECT_EQ(snapshot.depth.asks[3].price, kPrice100 + 4);
+        if (symbol != kSymbol1) {
+            EXPECT_EQ(snapshot.depth.bids[3].quantity, Quantity{symbol});
+        }
+    }
+}
+
+TEST_F(OrderBookManagerL2Test, TrimBooksReleasesLevels) {
+    DirectOrderBookManager<OrderBookL2> manager;
+    auto* book = manager.getOrCreateOrderBook(kSymbol1);
+    for (Price price = 1; price <= 1000; ++price) {
+        book->updateLevel(Side::Buy, price, kQty10, kTs1);
+    }
+    for (Price price = 2; price <= 1000; ++price) {
+        book->updateLevel(Side::Buy, price, 0, kTs1);
+    }
+    const auto usage = manager.memoryUsage();
+    ASSERT_EQ(usage.size(), 1);
+    EXPECT_EQ(usage[0].bytes, book->memoryUsage());
+
+    EXPECT_GT(manager.trimBooks(), 0u);
+    EXPECT_LT(book->memoryUsage(), usage[0].bytes);
+    EXPECT_EQ(book->getBestBid()->price, 1);
+    EXPECT_EQ(manager.trimBooks(), 0u);
+}
+
 // ============================================================================
 // Concurrent Access Tests
 // ============================================================================
@@ -483,3 +642,137 @@ TEST_F(OrderBookManagerL2Test, ConcurrentRemoveAndAccess) {
     // Half the symbols should remain
     EXPECT_EQ(manager.symbolCount(), kNumSymbols / 2);
 }
+
+// ============================================================================
+// Direct Table Lookup Tests
+// ============================================================================
+
+TEST_F(OrderBookManagerL2Test, DirectTableBasicOperations) {
+    DirectOrderBookManager<OrderBookL2> manager;
+    EXPECT_EQ(manager.symbolCount(), 0);
+    EXPECT_EQ(manager.getOrderBook(kSymbol1), nullptr);
+
+    auto* book1 = manager.getOrCreateOrderBook(kSymbol1);
+    auto* book_max = manager.getOrCreateOrderBook(std::numeric_limits<SymbolId>::max());
+    ASSERT_NE(book1, nullptr);
+    ASSERT_NE(book_max, nullptr);
+    EXPECT_EQ(manager.getOrCreateOrderBook(kSymbol1), book1);
+    EXPECT_EQ(manager.getOrderBook(kSymbol1), book1);
+    EXPECT_EQ(book_max->symbol(), std::numeric_limits<SymbolId>::max());
+    EXPECT_TRUE(manager.hasSymbol(kSymbol1));
+    EXPECT_FALSE(manager.hasSymbol(kSymbol2));
+    EXPECT_EQ(manager.symbolCount(), 2);
+
+    book1->updateLevel(Side::Buy, kPrice100, kQty10, kTs1);
+    const auto& const_manager = manager;
+    EXPECT_EQ(const_manager.getOrderBook(kSymbol1)->getBestBid()->price, kPrice100);
+}
+
+TEST_F(OrderBookManagerL2Test, DirectTableRemoveRetiresBook) {
+    DirectOrderBookManager<OrderBookL2> manager;
+    auto* book1 = manager.getOrCreateOrderBook(kSymbol1);
+    book1->updateLevel(Side::Buy, kPrice100, kQty10, kTs1);
+    [[maybe_unused]] auto* book2 = manager.getOrCreateOrderBook(kSymbol2);
+
+    EXPECT_TRUE(manager.removeOrderBook(kSymbol1));
+    EXPECT_FALSE(manager.removeOrderBook(kSymbol1));
+    EXPECT_FALSE(manager.hasSymbol(kSymbol1));
+    EXPECT_EQ(manager.getOrderBook(kSymbol1), nullptr);
+    EXPECT_EQ(manager.symbolCount(), 1);
+
+    // A pointer obtained before removal stays valid until reclaimed
+    EXPECT_EQ(manager.retiredCount(), 1);
+    EXPECT_EQ(book1->getBestBid()->quantity, kQty10);
+
+    // Re-creating the symbol gives a fresh book
+    auto* recreated = manager.getOrCreateOrderBook(kSymbol1);
+    EXPECT_NE(recreated, nullptr);
+    EXPECT_TRUE(recreated->isEmpty());
+
+    manager.clear();
+    EXPECT_EQ(manager.symbolCount(), 0);
+    EXPECT_EQ(manager.getOrderBook(kSymbol2), nullptr);
+    EXPECT_EQ(manager.retiredCount(), 3);
+    EXPECT_EQ(manager.reclaimRetired(), 3);
+    EXPECT_EQ(manager.retiredCount(), 0);
+}
+
+TEST_F(OrderBookManagerL2Test, DirectTableConcurrentGetOrCreate) {
+    DirectOrderBookManager<OrderBookL2> manager;
+    constexpr int kNumThreads = 8;
+    constexpr int kNumSymbols = 100;
+
+    std::vector<std::thread> threads;
+    std::vector<std::vector<OrderBookL2*>> thread_results(kNumThreads);
+
+    for (int t = 0; t < kNumThreads; ++t) {
+        threads.emplace_back([&manager, &thread_results, t]() {
+            for (SymbolId symbol = 1; symbol <= kNumSymbols; ++symbol) {
+                thread_results[t].push_back(manager.getOrCreateOrderBook(symbol));
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(manager.symbolCount(), kNumSymbols);
+    for (SymbolId symbol = 1; symbol <= kNumSymbols; ++symbol) {
+        auto* expected = thread_results[0][symbol - 1];
+        EXPECT_EQ(manager.getOrderBook(symbol), expected);
+        for (int t = 1; t < kNumThreads; ++t) {
+            EXPECT_EQ(thread_results[t][symbol - 1], expected);
+        }
+    }
+}
+
+TEST_F(OrderBookManagerL3Test, DirectTableConcurrentRemoveAndAccess) {
+    DirectOrderBookManager<OrderBookL3> manager;
+    constexpr int kNumSymbols = 50;
+
+    for (SymbolId s = 1; s <= kNumSymbols; ++s) {
+        manager.getOrCreateOrderBook(s)->addOrder(kOrder1, Side::Buy, kPrice100, kQty10, kTs1);
+    }
+
+    // Readers keep using books while odd symbols are removed: retired books are never freed under them
+    std::atomic<bool> stop{false};
+    std::thread accessor([&manager, &stop]() {
+        while (!stop.load()) {
+            for (SymbolId s = 1; s <= kNumSymbols; ++s) {
+                if (const auto* book = manager.getOrderBook(s)) {
+                    EXPECT_EQ(book->symbol(), s);
+                }
+            }
+        }
+    });
+    std::thread remover([&manager, &stop]() {
+        for (SymbolId s = 1; s <= kNumSymbols; s += 2) {
+            manager.removeOrderBook(s);
+        }
+        stop.store(true);
+    });
+
+    remover.join();
+    accessor.join();
+
+    EXPECT_EQ(manager.symbolCount(), kNumSymbols / 2);
+    EXPECT_EQ(manager.reclaimRetired(), kNumSymbols / 2);
+    EXPECT_EQ(manager.getOrderBook(2)->orderCount(), 1);
+}
+
+TEST_F(OrderBookManagerL3Test, CreateWithMemoryConfig) {
+    OrderBookManager<OrderBookL3> manager;
+    const MemoryConfig memory{.page_size = PageSize::Transparent, .prefault = true};
+
+    auto* book = manager.getOrCreateOrderBook(kSymbol1, memory);
+    ASSERT_NE(book, nullptr);
+    EXPECT_EQ(book->orderPoolAllocator().config().page_size, PageSize::Transparent);
+    EXPECT_TRUE(book->addOrder(kOrder1, Side::Buy, kPrice100, kQty10, kTs1));
+
+    // Existing books are returned as they are; L2 books ignore the placement
+    EXPECT_EQ(manager.getOrCreateOrderBook(kSymbol1, MemoryConfig{}), book);
+    EXPECT_EQ(manager.getOrCreateOrderBook(kSymbol2)->orderPoolAllocator().config().page_size, PageSize::Default);
+    OrderBookManager<OrderBookL2> l2_manager;
+    EXPECT_NE(l2_manager.getOrCreateOrderBook(kSymbol1, memory), nullptr);
+}
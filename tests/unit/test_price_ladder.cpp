@@ -0,0 +1,356 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/detail/price_ladder.hpp>
+#include <slick/orderbook/orderbook_l2.hpp>
+#include <slick/orderbook/orderbook_l3.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace slick::orderbook;
+using namespace slick::orderbook::detail;
+
+class PriceLadderTest : public ::testing::Test {
+protected:
+    static constexpr PriceLadderConfig kConfig{5, 128};
+
+    template<typename Ladder>
+    static std::vector<Price> prices(const Ladder& ladder) {
+        std::vector<Price> result;
+        for (const auto& level : ladder) {
+            result.push_back(level.price);
+        }
+        return result;
+    }
+};
+
+TEST_F(PriceLadderTest, InitialState) {
+    PriceLadder<Side::Sell> ladder(kConfig);
+    EXPECT_TRUE(ladder.empty());
+    EXPECT_EQ(ladder.size(), 0);
+    EXPECT_EQ(ladder.best(), nullptr);
+    EXPECT_EQ(ladder.begin(), ladder.end());
+    EXPECT_EQ(ladder.find(100), ladder.end());
+    EXPECT_EQ(ladder.atIndex(0), nullptr);
+    EXPECT_EQ(ladder.tickSize(), 5);
+    EXPECT_EQ(ladder.capacity(), 128);
+}
+
+TEST_F(PriceLadderTest, AsksIterateAscending) {
+    PriceLadder<Side::Sell> ladder(kConfig);
+    ladder.insertOrUpdate(1010, 10, 1);
+    ladder.insertOrUpdate(1000, 20, 2);
+    ladder.insertOrUpdate(1050, 30, 3);
+
+    EXPECT_EQ(prices(ladder), (std::vector<Price>{1000, 1010, 1050}));
+    ASSERT_NE(ladder.best(), nullptr);
+    EXPECT_EQ(ladder.best()->price, 1000);
+    EXPECT_EQ(ladder.indexOf(ladder.find(1050)), 2);
+    EXPECT_EQ(ladder.atIndex(1)->price, 1010);
+    EXPECT_EQ(ladder.lowerBoundIndex(1005), 1);
+    EXPECT_EQ(ladder.lowerBoundIndex(995), 0);
+}
+
+TEST_F(PriceLadderTest, BidsIterateDescending) {
+    PriceLadder<Side::Buy> ladder(kConfig);
+    ladder.insertOrUpdate(1000, 10, 1);
+    ladder.insertOrUpdate(1010, 20, 2);
+    ladder.insertOrUpdate(990, 30, 3);
+
+    EXPECT_EQ(prices(ladder), (std::vector<Price>{1010, 1000, 990}));
+    EXPECT_EQ(ladder.best()->price, 1010);
+    EXPECT_EQ(ladder.indexOf(ladder.find(990)), 2);
+    EXPECT_EQ(ladder.atIndex(2)->price, 990);
+    EXPECT_EQ(ladder.lowerBoundIndex(995), 2);
+}
+
+TEST_F(PriceLadderTest, BoundedIndexOf) {
+    PriceLadder<Side::Sell> ladder(kConfig);
+    for (Price price = 1000; price < 1000 + 5 * 100; price += 5) {
+        ladder.insertOrUpdate(price, 10, 1);
+    }
+    EXPECT_EQ(ladder.indexOf(ladder.find(1000), 10), 0);
+    EXPECT_EQ(ladder.indexOf(ladder.find(1045), 10), 9);
+    EXPECT_EQ(ladder.indexOf(ladder.find(1050), 10), 10);
+    EXPECT_EQ(ladder.indexOf(ladder.find(1495), 10), 10);
+    EXPECT_EQ(ladder.indexOf(ladder.find(1495), 1000), 99);
+
+    LevelContainer<Side::Sell> sorted;
+    sorted.insertOrUpdate(1000, 10, 1);
+    sorted.insertOrUpdate(1005, 10, 1);
+    EXPECT_EQ(sorted.indexOf(sorted.find(1005), 1), 1);
+    EXPECT_EQ(sorted.indexOf(sorted.find(1005), 5), 1);
+}
+
+TEST_F(PriceLadderTest, UpdateExistingLevel) {
+    PriceLadder<Side::Sell> ladder(kConfig);
+    auto [it, inserted] = ladder.insertOrUpdate(1000, 10, 1);
+    EXPECT_TRUE(inserted);
+    std::tie(it, inserted) = ladder.insertOrUpdate(1000, 25, 2);
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(it->quantity, 25);
+    EXPECT_EQ(it->timestamp, 2);
+    EXPECT_EQ(ladder.size(), 1);
+}
+
+TEST_F(PriceLadderTest, EraseBestFindsNextBest) {
+    PriceLadder<Side::Sell> ladder(kConfig);
+    ladder.insertOrUpdate(1000, 10, 1);
+    ladder.insertOrUpdate(1200, 20, 2);   // Several bitmap words away
+
+    EXPECT_TRUE(ladder.erase(1000));
+    EXPECT_FALSE(ladder.erase(1000));
+    ASSERT_NE(ladder.best(), nullptr);
+    EXPECT_EQ(ladder.best()->price, 1200);
+    EXPECT_EQ(ladder.indexOf(ladder.find(1200)), 0);
+
+    EXPECT_TRUE(ladder.erase(1200));
+    EXPECT_TRUE(ladder.empty());
+    EXPECT_EQ(ladder.best(), nullptr);
+}
+
+TEST_F(PriceLadderTest, RecentersAndGrowsForOutOfRangePrices) {
+    PriceLadder<Side::Sell> ladder(kConfig);
+    ladder.insertOrUpdate(1000, 10, 1);
+
+    // Far below and far above the initial window: forces a move and a resize
+    ladder.insertOrUpdate(1000 - 5 * 200, 20, 2);
+    ladder.insertOrUpdate(1000 + 5 * 300, 30, 3);
+
+    EXPECT_GE(ladder.capacity(), 501);
+    EXPECT_EQ(prices(ladder), (std::vector<Price>{0, 1000, 2500}));
+    EXPECT_EQ(ladder.find(1000)->quantity, 10);
+    EXPECT_EQ(ladder.find(0)->quantity, 20);
+    EXPECT_EQ(ladder.indexOf(ladder.find(2500)), 2);
+}
+
+TEST_F(PriceLadderTest, ClearRecentersOnNextInsert) {
+    PriceLadder<Side::Buy> ladder(kConfig);
+    ladder.insertOrUpdate(1000, 10, 1);
+    ladder.clear();
+    EXPECT_TRUE(ladder.empty());
+    EXPECT_EQ(ladder.find(1000), ladder.end());
+
+    // A price that was outside the old window fits without growing
+    ladder.insertOrUpdate(1000000, 10, 1);
+    EXPECT_EQ(ladder.capacity(), 128);
+    EXPECT_EQ(ladder.best()->price, 1000000);
+}
+
+TEST_F(PriceLadderTest, RejectsOffGridPrices) {
+    PriceLadder<Side::Sell> ladder(kConfig);
+    ladder.insertOrUpdate(1000, 10, 1);
+
+    EXPECT_TRUE(ladder.accepts(1005));
+    EXPECT_FALSE(ladder.accepts(1003));
+    EXPECT_FALSE(ladder.accepts(1000 + 5 * 1000 + 3));  // Outside the window too
+    EXPECT_EQ(ladder.find(1003), ladder.end());
+    EXPECT_EQ(ladder.getLevel(1003), nullptr);
+    EXPECT_EQ(ladder.insertOrUpdate(1003, 20, 2).first, ladder.end());
+    EXPECT_EQ(prices(ladder), (std::vector<Price>{1000}));
+
+    // Off-grid prices rank between their neighbours
+    EXPECT_EQ(ladder.lowerBoundIndex(997), 0);
+    EXPECT_EQ(ladder.lowerBoundIndex(1003), 1);
+
+    // An empty ladder takes any price and re-anchors its grid on it
+    ladder.clear();
+    EXPECT_TRUE(ladder.accepts(1003));
+    ladder.insertOrUpdate(1003, 20, 2);
+    EXPECT_EQ(ladder.find(1003)->quantity, 20);
+}
+
+TEST_F(PriceLadderTest, GrowsUpToMaxTicks) {
+    PriceLadder<Side::Buy> ladder(PriceLadderConfig{1, 64, 256});
+    EXPECT_EQ(ladder.maxCapacity(), 256);
+    ladder.insertOrUpdate(1000, 10, 1);
+
+    EXPECT_TRUE(ladder.accepts(1000 - 255));
+    EXPECT_FALSE(ladder.accepts(1000 - 256));
+    EXPECT_FALSE(ladder.accepts(1000 + 256));
+    EXPECT_EQ(ladder.insertOrUpdate(1000 - 256, 20, 2).first, ladder.end());
+
+    ladder.insertOrUpdate(1000 - 255, 20, 2);
+    EXPECT_EQ(ladder.capacity(), 256);
+    EXPECT_EQ(prices(ladder), (std::vector<Price>{1000, 745}));
+
+    // Once the best level goes, the band can move
+    ladder.erase(1000);
+    EXPECT_TRUE(ladder.accepts(745 - 255));
+    ladder.insertOrUpdate(745 - 255, 30, 3);
+    EXPECT_EQ(ladder.capacity(), 256);
+    EXPECT_EQ(prices(ladder), (std::vector<Price>{745, 490}));
+}
+
+TEST_F(PriceLadderTest, L3LevelsKeepOrdersAcrossRecenter) {
+    PriceLadderL3<Side::Buy> ladder(kConfig);
+    Order order(1, 1000, 100, Side::Buy, 1);
+
+    auto [it, inserted] = ladder.findOrInsert(1000);
+    ASSERT_TRUE(inserted);
+    it->second.insertOrder(&order);
+
+    ladder.findOrInsert(1000 + 5 * 1000);  // Forces re-center
+    auto found = ladder.find(1000);
+    ASSERT_NE(found, ladder.end());
+    EXPECT_EQ(found->second.orderCount(), 1);
+    EXPECT_EQ(found->second.getBestOrder(), &order);
+    EXPECT_EQ(found->second.getTotalQuantity(), 100);
+}
+
+TEST_F(PriceLadderTest, RandomizedAgainstLevelContainer) {
+    PriceLadder<Side::Buy> ladder(PriceLadderConfig{1, 64});
+    LevelContainer<Side::Buy> reference;
+    std::mt19937_64 rng(99);
+
+    for (int i = 0; i < 20000; ++i) {
+        // Mostly near mid, with occasional far prices
+        const Price price = (rng() % 20 == 0) ? 10000 + static_cast<Price>(rng() % 2000) - 1000
+                                              : 10000 + static_cast<Price>(rng() % 100) - 50;
+        if (rng() % 3 == 0) {
+            ASSERT_EQ(ladder.erase(price), reference.erase(price));
+        } else {
+            const auto [it, inserted] = ladder.insertOrUpdate(price, i + 1, i);
+            const auto [ref_it, ref_inserted] = reference.insertOrUpdate(price, i + 1, i);
+            ASSERT_EQ(inserted, ref_inserted);
+            ASSERT_EQ(ladder.indexOf(it), reference.indexOf(ref_it));
+        }
+        ASSERT_EQ(ladder.size(), reference.size());
+        if (!reference.empty()) {
+            ASSERT_EQ(ladder.best()->price, reference.best()->price);
+        }
+    }
+
+    auto it = ladder.begin();
+    for (std::size_t index = 0; index < reference.size(); ++index, ++it) {
+        EXPECT_EQ(it->price, reference[index].price);
+        EXPECT_EQ(it->quantity, reference[index].quantity);
+        EXPECT_EQ(ladder.atIndex(index)->price, reference[index].price);
+    }
+    EXPECT_EQ(it, ladder.end());
+}
+
+// ============================================================================
+// Books with tick-indexed ladders behave like the default books
+// ============================================================================
+
+TEST(LadderOrderBookL2Test, MatchesDefaultBook) {
+    LadderOrderBookL2 ladder_book(1, PriceLadderConfig{25, 256});
+    OrderBookL2 book(1);
+    std::mt19937_64 rng(7);
+
+    for (int i = 0; i < 5000; ++i) {
+        const Side side = (rng() % 2) ? Side::Buy : Side::Sell;
+        const Price mid = 100000;
+        const Price offset = static_cast<Price>(rng() % 40) * 25;
+        const Price price = side == Side::Buy ? mid - 25 - offset : mid + offset;
+        const Quantity qty = (rng() % 4 == 0) ? 0 : static_cast<Quantity>(rng() % 1000 + 1);
+
+        ladder_book.updateLevel(side, price, qty, i);
+        book.updateLevel(side, price, qty, i);
+    }
+
+    for (Side side : {Side::Buy, Side::Sell}) {
+        const auto expected = book.getLevels(side);
+        const auto actual = ladder_book.getLevels(side);
+        ASSERT_EQ(actual.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(actual[i].price, expected[i].price);
+            EXPECT_EQ(actual[i].quantity, expected[i].quantity);
+            EXPECT_EQ(ladder_book.getLevelByIndex(side, static_cast<uint16_t>(i))->price, expected[i].price);
+        }
+        EXPECT_EQ(ladder_book.levelCount(side), book.levelCount(side));
+    }
+
+    const auto tob = ladder_book.getTopOfBook();
+    const auto expected_tob = book.getTopOfBook();
+    EXPECT_EQ(tob.best_bid, expected_tob.best_bid);
+    EXPECT_EQ(tob.best_ask, expected_tob.best_ask);
+    EXPECT_EQ(tob.bid_quantity, expected_tob.bid_quantity);
+    EXPECT_EQ(tob.ask_quantity, expected_tob.ask_quantity);
+}
+
+TEST(LadderOrderBookL3Test, MatchesDefaultBook) {
+    LadderOrderBookL3 ladder_book(1, PriceLadderConfig{1, 128});
+    OrderBookL3 book(1);
+    std::mt19937_64 rng(11);
+
+    OrderId next_id = 1;
+    std::vector<OrderId> live;
+    for (int i = 0; i < 5000; ++i) {
+        const auto action = rng() % 4;
+        if (action < 2 || live.empty()) {
+            const Side side = (rng() % 2) ? Side::Buy : Side::Sell;
+            const Price offset = static_cast<Price>(rng() % 300);
+            const Price price = side == Side::Buy ? 9999 - offset : 10000 + offset;
+            const Quantity qty = static_cast<Quantity>(rng() % 100 + 1);
+            ASSERT_EQ(ladder_book.addOrder(next_id, side, price, qty, i), book.addOrder(next_id, side, price, qty, i));
+            live.push_back(next_id++);
+        } else {
+            const std::size_t pick = rng() % live.size();
+            const OrderId id = live[pick];
+            if (action == 2) {
+                ASSERT_EQ(ladder_book.deleteOrder(id, i), book.deleteOrder(id, i));
+                live[pick] = live.back();
+                live.pop_back();
+            } else {
+                const Price price = book.findOrder(id)->price + ((rng() % 2) ? 1 : -1);
+                ASSERT_EQ(ladder_book.modifyOrder(id, price, 50, i), book.modifyOrder(id, price, 50, i));
+            }
+        }
+    }
+
+    EXPECT_EQ(ladder_book.orderCount(), book.orderCount());
+    for (Side side : {Side::Buy, Side::Sell}) {
+        const auto expected = book.getLevelsL2(side);
+        const auto actual = ladder_book.getLevelsL2(side);
+        ASSERT_EQ(actual.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(actual[i].price, expected[i].price);
+            EXPECT_EQ(actual[i].quantity, expected[i].quantity);
+        }
+        EXPECT_EQ(ladder_book.getLevelsL3(side).size(), book.getLevelsL3(side).size());
+        EXPECT_EQ(ladder_book.orderCount(side), book.orderCount(side));
+    }
+    EXPECT_EQ(ladder_book.getBestBid()->price, book.getBestBid()->price);
+    EXPECT_EQ(ladder_book.getBestAsk()->price, book.getBestAsk()->price);
+}
+
+TEST(LadderOrderBookL2Test, IgnoresPricesTheLadderRejects) {
+    LadderOrderBookL2 book(1, PriceLadderConfig{5, 64, 128});
+    book.updateLevel(Side::Buy, 1000, 10, 1);
+    book.updateLevel(Side::Buy, 1003, 20, 2);          // Off the tick grid
+    book.updateLevel(Side::Buy, 1000 - 5 * 128, 30, 3); // Beyond the ladder width
+    EXPECT_EQ(book.levelCount(Side::Buy), 1);
+    EXPECT_EQ(book.getBestBid()->quantity, 10);
+
+    const std::vector<L2Update> updates{
+        {.timestamp = 4, .seq_num = 0, .price = 995, .quantity = 40, .symbol = 1, .side = Side::Buy},
+        {.timestamp = 4, .seq_num = 0, .price = 997, .quantity = 50, .symbol = 1, .side = Side::Buy},
+    };
+    EXPECT_EQ(book.applyBatch(updates), 1);
+    EXPECT_EQ(book.levelCount(Side::Buy), 2);
+}
+
+TEST(LadderOrderBookL3Test, RejectsPricesTheLadderRejects) {
+    LadderOrderBookL3 book(1, PriceLadderConfig{5, 64, 128});
+    ASSERT_TRUE(book.addOrder(1, Side::Sell, 1000, 10, 1));
+    EXPECT_FALSE(book.addOrder(2, Side::Sell, 1003, 10, 2));
+    EXPECT_FALSE(book.addOrder(3, Side::Sell, 1000 + 5 * 128, 10, 3));
+    EXPECT_EQ(book.findOrder(2), nullptr);
+    EXPECT_EQ(book.orderCount(), 1);
+
+    // A modify to a rejected price leaves the order where it was
+    ASSERT_TRUE(book.addOrder(4, Side::Sell, 1005, 10, 4));
+    EXPECT_FALSE(book.modifyOrder(4, 1007, 10, 5));
+    EXPECT_EQ(book.findOrder(4)->price, 1005);
+    EXPECT_EQ(book.getLevelsL2(Side::Sell).size(), 2);
+
+    // A limit order whose remainder could not rest is rejected before it trades
+    ASSERT_TRUE(book.addOrder(5, Side::Buy, 990, 10, 6));
+    const auto result = book.submitOrder(6, Side::Buy, 1002, 30, 7);
+    EXPECT_EQ(result.status, SubmitStatus::Rejected);
+    EXPECT_EQ(book.orderCount(), 3);
+    EXPECT_EQ(book.getBestAsk()->getTotalQuantity(), 10);
+}
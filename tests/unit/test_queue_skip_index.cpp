@@ -0,0 +1,154 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/detail/price_level_l3.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace slick::orderbook;
+using namespace slick::orderbook::detail;
+
+template<typename OrderT>
+class QueueSkipIndexTest : public ::testing::Test {
+protected:
+    using Level = BasicPriceLevelL3<OrderT>;
+    using Pool = typename OrderStorage<OrderT>::Pool;
+
+    OrderT* make(OrderId id, uint64_t priority, Quantity quantity = 1) {
+        return pool_.construct(id, Price{100}, quantity, Side::Buy, Timestamp{priority}, priority);
+    }
+
+    /// Check queue order, FIFO among equal priorities (ids ascend when added in id order)
+    static void expectSorted(const Level& level) {
+        const OrderT* previous = nullptr;
+        Quantity total = 0;
+        std::size_t count = 0;
+        for (const OrderT& order : level.orders) {
+            if (previous != nullptr) {
+                ASSERT_TRUE(previous->priority < order.priority ||
+                            (previous->priority == order.priority && previous->order_id < order.order_id));
+            }
+            previous = &order;
+            total += order.quantity;
+            ++count;
+        }
+        EXPECT_EQ(count, level.orderCount());
+        EXPECT_EQ(total, level.getTotalQuantity());
+    }
+
+    Pool pool_{1024};
+};
+
+using OrderLayouts = ::testing::Types<Order, CompactOrder>;
+TYPED_TEST_SUITE(QueueSkipIndexTest, OrderLayouts);
+
+TYPED_TEST(QueueSkipIndexTest, AppendsAndHeadInsertsSkipTheIndex) {
+    typename TestFixture::Level level(100);
+    for (OrderId id = 1; id <= 200; ++id) {
+        level.insertOrder(this->make(id, 1000 + id));
+    }
+    level.insertOrder(this->make(201, 5));  // Ahead of everything
+    EXPECT_TRUE(level.skip_index.empty());
+    EXPECT_EQ(level.getBestOrder()->order_id, 201);
+    EXPECT_EQ(level.orders.back()->order_id, 200);
+    this->expectSorted(level);
+}
+
+TYPED_TEST(QueueSkipIndexTest, OutOfOrderInsertBuildsCheckpoints) {
+    using Index = QueueSkipIndex<TypeParam>;
+    typename TestFixture::Level level(100);
+    for (OrderId id = 1; id <= 1000; ++id) {
+        level.insertOrder(this->make(id, id * 10));
+    }
+    level.insertOrder(this->make(1001, 9995));  // Just ahead of the tail
+    EXPECT_GE(level.skip_index.size(), 1000 / Index::kStride - 1);
+    EXPECT_EQ(level.orders.back()->order_id, 1000);
+    using OrderList = typename TestFixture::Level::OrderList;
+    EXPECT_EQ(OrderList::prevOf(level.orders.back())->order_id, 1001);
+
+    // Equal priority queues behind the resting order
+    level.insertOrder(this->make(1002, 5000));
+    const TypeParam* behind = nullptr;
+    for (const TypeParam& order : level.orders) {
+        if (order.order_id == 1002) {
+            break;
+        }
+        behind = &order;
+    }
+    ASSERT_NE(behind, nullptr);
+    EXPECT_EQ(behind->order_id, 500);
+    this->expectSorted(level);
+}
+
+TYPED_TEST(QueueSkipIndexTest, RemovingCheckpointsKeepsIndexUsable) {
+    typename TestFixture::Level level(100);
+    std::vector<TypeParam*> orders;
+    for (OrderId id = 1; id <= 512; ++id) {
+        orders.push_back(this->make(id, id * 4));
+        level.insertOrder(orders.back());
+    }
+    level.insertOrder(this->make(513, 2046));
+    ASSERT_FALSE(level.skip_index.empty());
+
+    // Remove every other order, then a contiguous run, so checkpoints move and disappear
+    for (std::size_t i = 0; i < orders.size(); i += 2) {
+        level.removeOrder(orders[i]);
+    }
+    for (std::size_t i = 101; i < 301; i += 2) {
+        level.removeOrder(orders[i]);
+    }
+    this->expectSorted(level);
+
+    OrderId id = 1000;
+    for (uint64_t priority = 1; priority < 2100; priority += 37) {
+        level.insertOrder(this->make(id++, priority));
+    }
+    this->expectSorted(level);
+}
+
+TYPED_TEST(QueueSkipIndexTest, RandomizedMatchesStableSort) {
+    typename TestFixture::Level level(100);
+    std::vector<TypeParam*> resting;
+    std::mt19937_64 rng(2026);
+    OrderId next_id = 1;
+    uint64_t tail = 0;
+
+    for (int step = 0; step < 20000; ++step) {
+        const auto roll = rng() % 10;
+        if (roll < 4 || resting.empty()) {
+            // Mostly tail appends, some random priorities (with duplicates)
+            const uint64_t priority = roll < 2 ? (tail += rng() % 3) : rng() % (tail + 1);
+            resting.push_back(this->make(next_id++, priority, 1 + rng() % 5));
+            level.insertOrder(resting.back());
+        } else if (roll < 7) {
+            const std::size_t i = rng() % resting.size();
+            level.removeOrder(resting[i]);
+            this->pool_.destroy(resting[i]);
+            resting[i] = resting.back();
+            resting.pop_back();
+        } else {
+            // Re-prioritize: remove and insert with a new priority, as modifyOrder does
+            TypeParam* order = resting[rng() % resting.size()];
+            level.removeOrder(order);
+            order->priority = rng() % (tail + 1);
+            order->order_id = next_id++;
+            level.insertOrder(order);
+        }
+    }
+    ASSERT_GT(level.orderCount(), 1000);
+    EXPECT_FALSE(level.skip_index.empty());
+    this->expectSorted(level);
+
+    std::vector<OrderId> expected;
+    std::vector<TypeParam*> sorted = resting;
+    std::sort(sorted.begin(), sorted.end(), [](const TypeParam* a, const TypeParam* b) {
+        return a->priority != b->priority ? a->priority < b->priority : a->order_id < b->order_id;
+    });
+    auto it = level.orders.begin();
+    for (const TypeParam* order : sorted) {
+        ASSERT_EQ(&*it, order);
+        ++it;
+    }
+}
@@ -0,0 +1,170 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/sequenced_book.hpp>
+#include <slick/orderbook/orderbook_l2.hpp>
+#include <slick/orderbook/orderbook_l3.hpp>
+#include <gtest/gtest.h>
+#include <tuple>
+#include <vector>
+
+using namespace slick::orderbook;
+
+namespace {
+
+constexpr SymbolId kSymbol = 4;
+
+L2Update level(Side side, Price price, Quantity quantity, uint64_t seq_num) {
+    return {.timestamp = seq_num, .seq_num = seq_num, .price = price, .quantity = quantity, .symbol = kSymbol,
+            .side = side};
+}
+
+L3Update add(OrderId id, Side side, Price price, Quantity quantity, uint64_t seq_num) {
+    return {.timestamp = seq_num, .seq_num = seq_num, .order_id = id, .price = price, .quantity = quantity,
+            .symbol = kSymbol, .side = side, .type = L3UpdateType::Add};
+}
+
+L3Update remove(OrderId id, uint64_t seq_num) {
+    return {.timestamp = seq_num, .seq_num = seq_num, .order_id = id, .symbol = kSymbol,
+            .type = L3UpdateType::Delete};
+}
+
+}  // namespace
+
+TEST(SequencedBookTest, InSequenceAndStale) {
+    OrderBookL2 book(kSymbol);
+    SequencedBook sequenced(book);
+    int gaps = 0;
+    sequenced.onGap([&](SymbolId, uint64_t, uint64_t) { ++gaps; });
+
+    EXPECT_EQ(sequenced.apply(level(Side::Buy, 100, 10, 1)), SequenceResult::Applied);
+    EXPECT_EQ(sequenced.apply(level(Side::Buy, 99, 10, 2)), SequenceResult::Applied);
+    // Repeated sequence number (same packet) is in sequence
+    EXPECT_EQ(sequenced.apply(level(Side::Sell, 101, 10, 2)), SequenceResult::Applied);
+    EXPECT_EQ(sequenced.apply(level(Side::Buy, 98, 10, 1)), SequenceResult::Stale);
+    // Unsequenced updates are not checked
+    EXPECT_EQ(sequenced.apply(level(Side::Buy, 97, 10, 0)), SequenceResult::Applied);
+
+    EXPECT_EQ(gaps, 0);
+    EXPECT_FALSE(sequenced.isRecovering());
+    EXPECT_EQ(sequenced.stats().stale, 1);
+    EXPECT_EQ(book.levelCount(Side::Buy), 3);
+    EXPECT_EQ(book.getLastSeqNum(), 2);
+}
+
+TEST(SequencedBookTest, GapBuffersUntilSnapshot) {
+    OrderBookL3 book(kSymbol);
+    SequencedBook sequenced(book, 16);
+    std::vector<std::tuple<SymbolId, uint64_t, uint64_t>> gaps;
+    std::vector<std::pair<uint64_t, uint64_t>> recovered;
+    sequenced.onGap([&](SymbolId s, uint64_t expected, uint64_t received) { gaps.emplace_back(s, expected, received); });
+    sequenced.onRecovered([&](SymbolId, uint64_t seq_num, uint64_t ns) { recovered.emplace_back(seq_num, ns); });
+
+    ASSERT_EQ(sequenced.apply(add(1, Side::Buy, 100, 10, 1)), SequenceResult::Applied);
+    ASSERT_EQ(sequenced.apply(add(2, Side::Sell, 101, 10, 2)), SequenceResult::Applied);
+
+    // Sequence 3 and 4 are lost
+    EXPECT_EQ(sequenced.apply(add(5, Side::Buy, 99, 10, 5)), SequenceResult::Buffered);
+    ASSERT_EQ(gaps.size(), 1);
+    EXPECT_EQ(gaps[0], std::make_tuple(kSymbol, 3, 5));
+    EXPECT_TRUE(sequenced.isRecovering());
+    EXPECT_EQ(sequenced.apply(add(6, Side::Buy, 98, 10, 6)), SequenceResult::Buffered);
+    EXPECT_EQ(sequenced.apply(remove(2, 7)), SequenceResult::Buffered);
+    EXPECT_EQ(sequenced.bufferedCount(), 3);
+    // The book is untouched while recovering
+    EXPECT_EQ(book.orderCount(), 2);
+
+    // Snapshot as of sequence 5 (3 and 4 added order 3 and deleted order 1)
+    const std::vector<SnapshotOrder> snapshot{
+        {2, Side::Sell, 101, 10, 2},
+        {3, Side::Buy, 100, 20, 3},
+        {5, Side::Buy, 99, 10, 5},
+    };
+    EXPECT_TRUE(sequenced.loadSnapshot(snapshot, 5, 5));
+    EXPECT_FALSE(sequenced.isRecovering());
+    EXPECT_EQ(sequenced.bufferedCount(), 0);
+    EXPECT_EQ(book.getLastSeqNum(), 7);
+    EXPECT_EQ(book.findOrder(1), nullptr);
+    EXPECT_EQ(book.findOrder(2), nullptr);
+    EXPECT_NE(book.findOrder(3), nullptr);
+    EXPECT_NE(book.findOrder(6), nullptr);
+
+    const SequenceRecoveryStats& stats = sequenced.stats();
+    EXPECT_EQ(stats.gaps, 1);
+    EXPECT_EQ(stats.missed, 2);
+    EXPECT_EQ(stats.buffered, 3);
+    EXPECT_EQ(stats.superseded, 1);
+    EXPECT_EQ(stats.replayed, 2);
+    EXPECT_EQ(stats.recoveries, 1);
+    EXPECT_EQ(stats.max_recovery_ns, stats.last_recovery_ns);
+    ASSERT_EQ(recovered.size(), 1);
+    EXPECT_EQ(recovered[0].first, 7);
+
+    // Live again
+    EXPECT_EQ(sequenced.apply(add(8, Side::Sell, 102, 5, 8)), SequenceResult::Applied);
+}
+
+TEST(SequencedBookTest, StaleSnapshotKeepsRecovering) {
+    OrderBookL2 book(kSymbol);
+    SequencedBook sequenced(book, 16);
+    std::vector<uint64_t> expected_seqs;
+    sequenced.onGap([&](SymbolId, uint64_t expected, uint64_t) { expected_seqs.push_back(expected); });
+
+    sequenced.apply(level(Side::Buy, 100, 10, 1));
+    sequenced.apply(level(Side::Buy, 100, 20, 10));
+    sequenced.apply(level(Side::Buy, 100, 30, 11));
+
+    // A snapshot older than the buffer leaves a gap (2..9 were skipped, snapshot covers up to 5)
+    const std::vector<detail::PriceLevelL2> bids{{100, 15, 5}};
+    EXPECT_FALSE(sequenced.loadSnapshot(bids, {}, 5, 5));
+    EXPECT_TRUE(sequenced.isRecovering());
+    EXPECT_EQ(sequenced.bufferedCount(), 2);
+    ASSERT_EQ(expected_seqs.size(), 2);
+    EXPECT_EQ(expected_seqs[0], 2);
+    EXPECT_EQ(expected_seqs[1], 6);
+
+    const std::vector<detail::PriceLevelL2> newer{{100, 18, 9}};
+    EXPECT_TRUE(sequenced.loadSnapshot(newer, {}, 9, 9));
+    EXPECT_FALSE(sequenced.isRecovering());
+    EXPECT_EQ(book.getBestBid()->quantity, 30);
+    EXPECT_EQ(sequenced.stats().recoveries, 1);
+    EXPECT_EQ(sequenced.stats().gaps, 2);
+}
+
+TEST(SequencedBookTest, FullBufferOverwritesOldest) {
+    OrderBookL2 book(kSymbol);
+    SequencedBook sequenced(book, 4);
+    EXPECT_EQ(sequenced.bufferCapacity(), 4);
+
+    sequenced.apply(level(Side::Buy, 100, 10, 1));
+    for (uint64_t seq = 3; seq <= 12; ++seq) {
+        EXPECT_EQ(sequenced.apply(level(Side::Buy, 100, static_cast<Quantity>(seq), seq)), SequenceResult::Buffered);
+    }
+    EXPECT_EQ(sequenced.bufferedCount(), 4);
+    EXPECT_EQ(sequenced.stats().overwritten, 6);
+
+    // Updates 9..12 are kept, so a snapshot at 8 recovers
+    const std::vector<detail::PriceLevelL2> bids{{100, 8, 8}};
+    EXPECT_TRUE(sequenced.loadSnapshot(bids, {}, 8, 8));
+    EXPECT_EQ(book.getBestBid()->quantity, 12);
+    EXPECT_EQ(sequenced.stats().replayed, 4);
+}
+
+TEST(SequencedBookTest, RecoveryRequestedAtStartup) {
+    OrderBookL2 book(kSymbol);
+    SequencedBook sequenced(book);
+    sequenced.requestRecovery();
+    EXPECT_TRUE(sequenced.isRecovering());
+
+    const std::vector<L2Update> packet{level(Side::Buy, 100, 10, 41), level(Side::Sell, 101, 10, 41)};
+    EXPECT_EQ(sequenced.applyBatch(packet), 0);
+    EXPECT_EQ(sequenced.apply(level(Side::Buy, 99, 5, 42)), SequenceResult::Buffered);
+    EXPECT_EQ(book.levelCount(Side::Buy), 0);
+
+    EXPECT_TRUE(sequenced.loadSnapshot({}, {}, 40, 40));
+    EXPECT_EQ(book.levelCount(Side::Buy), 2);
+    EXPECT_EQ(book.levelCount(Side::Sell), 1);
+    EXPECT_EQ(book.getLastSeqNum(), 42);
+    EXPECT_EQ(sequenced.stats().gaps, 0);
+    EXPECT_EQ(sequenced.stats().recoveries, 1);
+}
@@ -0,0 +1,281 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/shared_book.hpp>
+#include <slick/orderbook/orderbook_l2.hpp>
+#include <slick/orderbook/orderbook_l3.hpp>
+#include <slick/orderbook/orderbook_manager.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+
+#if defined(__linux__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace slick::orderbook;
+
+#if defined(__linux__)
+
+namespace {
+
+class SharedBookTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        name_ = "/slick_shared_book_" + std::to_string(::getpid()) + "_" + info->name();
+    }
+
+    std::string name_;
+};
+
+}  // namespace
+
+TEST_F(SharedBookTest, PublishesL2DepthAndTopOfBook) {
+    SharedBookPublisher publisher;
+    ASSERT_TRUE(publisher.create(name_, 4, 3));
+    EXPECT_EQ(publisher.depth(), 3);
+    EXPECT_EQ(publisher.capacity(), 4);
+
+    SharedBookReader reader;
+    ASSERT_TRUE(reader.open(name_));
+    EXPECT_EQ(reader.depth(), 3);
+    EXPECT_FALSE(reader.hasSymbol(7));
+    EXPECT_FALSE(reader.readTopOfBook(7).has_value());
+    EXPECT_EQ(reader.version(7), 0);
+
+    OrderBookL2 book(7);
+    for (Price i = 0; i < 5; ++i) {
+        book.updateLevel(Side::Buy, 100 - i, 10 + i, 1, static_cast<uint64_t>(2 * i + 1));
+        book.updateLevel(Side::Sell, 101 + i, 20 + i, 2, static_cast<uint64_t>(2 * i + 2));
+    }
+    ASSERT_TRUE(publisher.publish(book));
+    EXPECT_EQ(reader.symbolCount(), 1);
+    EXPECT_EQ(reader.version(7), 1);
+
+    const auto tob = reader.readTopOfBook(7);
+    ASSERT_TRUE(tob.has_value());
+    EXPECT_EQ(tob->symbol, 7);
+    EXPECT_EQ(tob->best_bid, 100);
+    EXPECT_EQ(tob->bid_quantity, 10);
+    EXPECT_EQ(tob->best_ask, 101);
+    EXPECT_EQ(tob->ask_quantity, 20);
+
+    // Copies min(N, depth) levels per side
+    DepthSnapshot<8> depth;
+    TopOfBook top;
+    ASSERT_TRUE(reader.readDepth(7, depth, &top));
+    EXPECT_EQ(depth.version, 1);
+    EXPECT_EQ(depth.seq_num, 10);
+    ASSERT_EQ(depth.bid_count, 3);
+    ASSERT_EQ(depth.ask_count, 3);
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(depth.bids[i].price, 100 - static_cast<Price>(i));
+        EXPECT_EQ(depth.asks[i].price, 101 + static_cast<Price>(i));
+        EXPECT_EQ(depth.asks[i].quantity, 20 + static_cast<Quantity>(i));
+    }
+    EXPECT_EQ(top.best_ask, 101);
+
+    DepthSnapshot<2> shallow;
+    ASSERT_TRUE(reader.readDepth(7, shallow));
+    EXPECT_EQ(shallow.bid_count, 2);
+
+    // Later publications replace the slot's contents
+    book.updateLevel(Side::Buy, 100, 0, 3);
+    ASSERT_TRUE(publisher.publish(book));
+    EXPECT_EQ(reader.version(7), 2);
+    EXPECT_EQ(reader.readTopOfBook(7)->best_bid, 99);
+}
+
+TEST_F(SharedBookTest, PublishesL3AndCompactL2Books) {
+    SharedBookPublisher publisher;
+    ASSERT_TRUE(publisher.create(name_, 4, 2));
+    SharedBookReader reader;
+    ASSERT_TRUE(reader.open(name_));
+
+    OrderBookL3 l3(1);
+    l3.addOrder(1, Side::Buy, 100, 10, 1);
+    l3.addOrder(2, Side::Buy, 100, 15, 2);
+    l3.addOrder(3, Side::Sell, 102, 5, 3);
+    ASSERT_TRUE(publisher.publish(l3));
+
+    CompactOrderBookL2 compact(2);
+    compact.updateLevel(Side::Buy, 500, 7, 1);
+    compact.updateLevel(Side::Buy, 499, 8, 1);
+    compact.updateLevel(Side::Buy, 498, 9, 1);
+    ASSERT_TRUE(publisher.publish(compact));
+
+    DepthSnapshot<2> depth;
+    ASSERT_TRUE(reader.readDepth(1, depth));
+    ASSERT_EQ(depth.bid_count, 1);
+    EXPECT_EQ(depth.bids[0].quantity, 25);
+    EXPECT_EQ(depth.asks[0].price, 102);
+
+    ASSERT_TRUE(reader.readDepth(2, depth));
+    ASSERT_EQ(depth.bid_count, 2);
+    EXPECT_EQ(depth.ask_count, 0);
+    EXPECT_EQ(depth.bids[1].price, 499);
+    EXPECT_EQ(depth.bids[1].quantity, 8);
+}
+
+TEST_F(SharedBookTest, CapacityAndManagerPublication) {
+    SharedBookPublisher publisher;
+    ASSERT_TRUE(publisher.create(name_, 2, 1));
+
+    OrderBookManager<OrderBookL2> manager;
+    for (SymbolId symbol = 1; symbol <= 3; ++symbol) {
+        manager.getOrCreateOrderBook(symbol)->updateLevel(Side::Buy, 100 + symbol, 1, 1);
+    }
+    EXPECT_EQ(publisher.publishAll(manager), 2);    // Out of slots for the third
+    EXPECT_EQ(publisher.symbolCount(), 2);
+    // Symbols that already have a slot keep publishing
+    EXPECT_EQ(publisher.publishAll(manager), 2);
+
+    SharedBookReader reader;
+    ASSERT_TRUE(reader.open(name_));
+    std::size_t published = 0;
+    for (SymbolId symbol = 1; symbol <= 3; ++symbol) {
+        if (const auto tob = reader.readTopOfBook(symbol)) {
+            EXPECT_EQ(tob->best_bid, 100 + symbol);
+            EXPECT_EQ(reader.version(symbol), 2);
+            ++published;
+        }
+    }
+    EXPECT_EQ(published, 2);
+}
+
+TEST_F(SharedBookTest, ReservedSymbolReadsNothingUntilPublished) {
+    SharedBookPublisher publisher;
+    ASSERT_TRUE(publisher.create(name_, 2, 2));
+    SharedBookReader reader;
+    ASSERT_TRUE(reader.open(name_));
+
+    // The slot is in the directory but holds no publication yet
+    ASSERT_TRUE(publisher.reserve(5));
+    EXPECT_TRUE(publisher.reserve(5));
+    EXPECT_TRUE(reader.hasSymbol(5));
+    EXPECT_EQ(reader.symbolCount(), 1);
+    EXPECT_EQ(reader.version(5), 0);
+    EXPECT_FALSE(reader.readTopOfBook(5).has_value());
+    DepthSnapshot<2> depth;
+    EXPECT_FALSE(reader.readDepth(5, depth));
+
+    OrderBookL2 book(5);
+    book.updateLevel(Side::Buy, 100, 10, 1);
+    ASSERT_TRUE(publisher.publish(book));
+    EXPECT_EQ(reader.version(5), 1);
+    ASSERT_TRUE(reader.readTopOfBook(5).has_value());
+    EXPECT_EQ(reader.readTopOfBook(5)->best_bid, 100);
+    ASSERT_TRUE(reader.readDepth(5, depth));
+    EXPECT_EQ(depth.bid_count, 1);
+
+    // Reserving takes a slot like a publication does
+    EXPECT_TRUE(publisher.reserve(6));
+    EXPECT_FALSE(publisher.reserve(7));
+}
+
+TEST_F(SharedBookTest, OpenRejectsMissingOrReplacedRegions) {
+    SharedBookReader reader;
+    EXPECT_FALSE(reader.open(name_));
+    EXPECT_FALSE(reader.isOpen());
+
+    SharedBookPublisher publisher;
+    EXPECT_FALSE(publisher.create(name_, 0, 1));
+    EXPECT_FALSE(publisher.create(name_, 65536, 1));
+    ASSERT_TRUE(publisher.create(name_, 1, 1));
+    OrderBookL2 book(1);
+    book.updateLevel(Side::Buy, 100, 1, 1);
+    ASSERT_TRUE(publisher.publish(book));
+    ASSERT_TRUE(reader.open(name_));
+
+    // Re-creating replaces the region; the attached reader keeps the old one until it reopens
+    SharedBookPublisher replacement;
+    ASSERT_TRUE(replacement.create(name_, 1, 1));
+    EXPECT_EQ(reader.version(1), 1);
+    ASSERT_TRUE(reader.open(name_));
+    EXPECT_EQ(reader.version(1), 0);
+
+    // Closing the publisher removes the name
+    replacement.close();
+    EXPECT_FALSE(reader.open(name_));
+}
+
+TEST_F(SharedBookTest, ConcurrentReadsSeeWholePublications) {
+    SharedBookPublisher publisher;
+    ASSERT_TRUE(publisher.create(name_, 1, 4));
+    OrderBookL2 book(1);
+
+    // Every publication is a ladder around one mid with equal quantities; a torn read breaks the pattern
+    constexpr int kPublications = 20000;
+    std::atomic<bool> done{false};
+    std::thread reader_thread([&] {
+        SharedBookReader reader;
+        ASSERT_TRUE(reader.open(name_));
+        DepthSnapshot<4> depth;
+        TopOfBook top;
+        while (!done.load(std::memory_order_acquire)) {
+            if (!reader.readDepth(1, depth, &top) || depth.bid_count == 0) {
+                continue;
+            }
+            ASSERT_EQ(depth.bid_count, 4);
+            ASSERT_EQ(depth.ask_count, 4);
+            for (std::size_t i = 0; i < 4; ++i) {
+                ASSERT_EQ(depth.bids[i].price, top.best_bid - static_cast<Price>(i));
+                ASSERT_EQ(depth.asks[i].price, top.best_ask + static_cast<Price>(i));
+                ASSERT_EQ(depth.bids[i].quantity, top.bid_quantity);
+                ASSERT_EQ(depth.asks[i].quantity, top.bid_quantity);
+            }
+            ASSERT_EQ(top.best_ask, top.best_bid + 1);
+        }
+    });
+
+    for (int n = 1; n <= kPublications; ++n) {
+        const Price mid = 1000 + (n % 50);
+        const Quantity quantity = n;
+        book.clear();
+        for (Price i = 0; i < 4; ++i) {
+            book.updateLevel(Side::Buy, mid - i, quantity, static_cast<Timestamp>(n));
+            book.updateLevel(Side::Sell, mid + 1 + i, quantity, static_cast<Timestamp>(n));
+        }
+        publisher.publish(book);
+    }
+    done.store(true, std::memory_order_release);
+    reader_thread.join();
+}
+
+TEST_F(SharedBookTest, ReaderInAnotherProcess) {
+    SharedBookPublisher publisher;
+    ASSERT_TRUE(publisher.create(name_, 1, 2));
+    OrderBookL2 book(3);
+    book.updateLevel(Side::Buy, 250, 4, 1);
+    book.updateLevel(Side::Sell, 251, 6, 1);
+    ASSERT_TRUE(publisher.publish(book));
+
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        SharedBookReader reader;
+        DepthSnapshot<2> depth;
+        TopOfBook top;
+        const bool ok = reader.open(name_) && reader.readDepth(3, depth, &top) && depth.bid_count == 1 &&
+                        depth.bids[0].price == 250 && top.best_ask == 251 && top.ask_quantity == 6;
+        ::_exit(ok ? 0 : 1);
+    }
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
+
+#else
+
+TEST(SharedBookTest, UnavailableWithoutPosixSharedMemory) {
+    SharedBookPublisher publisher;
+    EXPECT_FALSE(publisher.create("/slick_shared_book", 1, 1));
+    SharedBookReader reader;
+    EXPECT_FALSE(reader.open("/slick_shared_book"));
+}
+
+#endif
@@ -0,0 +1,173 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/detail/soa_level_container.hpp>
+#include <slick/orderbook/detail/level_container.hpp>
+#include <slick/orderbook/orderbook_l2.hpp>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace slick::orderbook;
+using namespace slick::orderbook::detail;
+
+namespace {
+
+template<typename Container>
+std::vector<Price> pricesOf(const Container& levels) {
+    std::vector<Price> prices;
+    for (const auto& level : levels) {
+        prices.push_back(level.price);
+    }
+    return prices;
+}
+
+}  // namespace
+
+template<typename T>
+class SoaLevelContainerTest : public ::testing::Test {};
+
+using SoaContainers = ::testing::Types<SoaLevelContainer<Side::Buy>, SoaLevelContainer<Side::Sell>,
+                                       SoaLevelContainer<Side::Buy, BasicPriceLevelL2<int32_t, int32_t>>,
+                                       SoaLevelContainer<Side::Sell, BasicPriceLevelL2<int32_t, int32_t>>>;
+TYPED_TEST_SUITE(SoaLevelContainerTest, SoaContainers);
+
+TYPED_TEST(SoaLevelContainerTest, PriceColumnIsCacheAligned) {
+    TypeParam levels(4);
+    levels.insertOrUpdate(100, 1, 1);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(levels.prices().data()) % SLICK_CACHE_LINE_SIZE, 0);
+}
+
+TYPED_TEST(SoaLevelContainerTest, SearchesAcrossTheScanBoundary) {
+    constexpr Side kSide = TypeParam::side();
+    constexpr Price kStep = kSide == Side::Buy ? -2 : 2;
+    const std::size_t count = TypeParam::kScanWidth * 3 + 5;
+
+    // Every level count up to past the scan width, every price on and between the levels
+    for (std::size_t size = 0; size <= count; ++size) {
+        TypeParam levels;
+        for (std::size_t i = 0; i < size; ++i) {
+            levels.insertOrUpdate(1000 + static_cast<Price>(i) * kStep, 10, 0);
+        }
+        for (Price offset = -3; offset <= static_cast<Price>(size) * 2 + 3; ++offset) {
+            const Price price = 1000 + offset * (kStep / 2);
+            const std::size_t expected = offset <= 0 ? 0 : std::min<std::size_t>((offset + 1) / 2, size);
+            ASSERT_EQ(levels.lowerBoundIndex(price), expected) << "size " << size << " price " << price;
+            const bool on_level = offset >= 0 && offset % 2 == 0 && offset / 2 < static_cast<Price>(size);
+            EXPECT_EQ(levels.getLevel(price) != nullptr, on_level);
+        }
+    }
+}
+
+TYPED_TEST(SoaLevelContainerTest, MatchesSortedVector) {
+    constexpr Side kSide = TypeParam::side();
+    TypeParam soa;
+    LevelContainer<kSide, typename TypeParam::value_type> reference;
+
+    std::mt19937_64 rng(kSide == Side::Buy ? 5 : 6);
+    for (int i = 0; i < 20000; ++i) {
+        // Mostly near the touch, sometimes deep in the book
+        const Price price = rng() % 10 == 0 ? static_cast<Price>(rng() % 2000) : 1000 + static_cast<Price>(rng() % 40) - 20;
+        const auto op = rng() % 3;
+        if (op == 0) {
+            EXPECT_EQ(soa.erase(price), reference.erase(price));
+        } else {
+            const auto quantity = static_cast<Quantity>(rng() % 1000 + 1);
+            const auto [soa_it, soa_inserted] = soa.insertOrUpdate(price, quantity, static_cast<Timestamp>(i));
+            const auto [ref_it, ref_inserted] = reference.insertOrUpdate(price, quantity, static_cast<Timestamp>(i));
+            EXPECT_EQ(soa_inserted, ref_inserted);
+            EXPECT_EQ(soa.indexOf(soa_it), reference.indexOf(ref_it));
+        }
+        if (i % 1000 == 0) {
+            ASSERT_EQ(pricesOf(soa), pricesOf(reference));
+        }
+    }
+
+    ASSERT_EQ(soa.size(), reference.size());
+    const auto column = soa.prices();
+    for (std::size_t i = 0; i < soa.size(); ++i) {
+        EXPECT_EQ(column[i], soa[i].price);
+        EXPECT_EQ(soa[i].quantity, reference[i].quantity);
+        EXPECT_EQ(soa[i].timestamp, reference[i].timestamp);
+    }
+    for (Price price = -10; price < 2010; ++price) {
+        ASSERT_EQ(soa.lowerBoundIndex(price), reference.lowerBoundIndex(price));
+    }
+
+    soa.erase(soa.begin());
+    EXPECT_EQ(soa.prices().size(), soa.size());
+    EXPECT_EQ(soa.prices()[0], soa.best()->price);
+    soa.clear();
+    EXPECT_TRUE(soa.prices().empty());
+    EXPECT_EQ(soa.best(), nullptr);
+}
+
+TYPED_TEST(SoaLevelContainerTest, TrimKeepsLevelsAndAlignment) {
+    TypeParam levels(4);
+    for (Price price = 1; price <= 500; ++price) {
+        levels.insertOrUpdate(price, static_cast<Quantity>(price), 0);
+    }
+    for (Price price = 11; price <= 500; ++price) {
+        levels.erase(price);
+    }
+    const auto expected = pricesOf(levels);
+    const std::size_t grown_bytes = levels.memoryUsage();
+
+    levels.trim(100);
+    EXPECT_GE(levels.capacity(), 100);
+    levels.shrink_to_fit();
+    EXPECT_EQ(levels.capacity(), 10);
+    EXPECT_LT(levels.memoryUsage(), grown_bytes);
+    EXPECT_EQ(pricesOf(levels), expected);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(levels.prices().data()) % SLICK_CACHE_LINE_SIZE, 0);
+    for (Price price = 1; price <= 10; ++price) {
+        ASSERT_NE(levels.getLevel(price), nullptr);
+        EXPECT_EQ(levels.getLevel(price)->quantity, price);
+    }
+}
+
+TEST(SoaLevelContainerNarrowTest, PricesBeyondTheStoredWidth) {
+    SoaLevelContainer<Side::Buy, BasicPriceLevelL2<int32_t, int32_t>> bids;
+    SoaLevelContainer<Side::Sell, BasicPriceLevelL2<int32_t, int32_t>> asks;
+    for (Price price = 100; price < 140; ++price) {
+        bids.insertOrUpdate(price, 1, 0);
+        asks.insertOrUpdate(price, 1, 0);
+    }
+    constexpr Price kAbove = Price{std::numeric_limits<int32_t>::max()} + 1;
+    constexpr Price kBelow = Price{std::numeric_limits<int32_t>::min()} - 1;
+    EXPECT_EQ(bids.lowerBoundIndex(kAbove), 0);
+    EXPECT_EQ(bids.lowerBoundIndex(kBelow), 40);
+    EXPECT_EQ(asks.lowerBoundIndex(kAbove), 40);
+    EXPECT_EQ(asks.lowerBoundIndex(kBelow), 0);
+    EXPECT_EQ(bids.getLevel(kAbove), nullptr);
+    EXPECT_EQ(asks.getLevel(kBelow), nullptr);
+}
+
+TEST(SoaOrderBookL2Test, MatchesDefaultBook) {
+    OrderBookL2 reference(1);
+    SoaOrderBookL2 book(1);
+
+    std::mt19937_64 rng(21);
+    for (uint64_t i = 1; i <= 20000; ++i) {
+        const Side side = rng() % 2 ? Side::Buy : Side::Sell;
+        const Price offset = rng() % 8 == 0 ? static_cast<Price>(rng() % 500) : static_cast<Price>(rng() % 20);
+        const Price price = side == Side::Buy ? 10000 - offset : 10001 + offset;
+        const Quantity quantity = rng() % 3 == 0 ? 0 : static_cast<Quantity>(rng() % 1000 + 1);
+        reference.updateLevel(side, price, quantity, i, i);
+        book.updateLevel(side, price, quantity, i, i);
+    }
+
+    for (const Side side : {Side::Buy, Side::Sell}) {
+        const auto expected = reference.getLevels(side);
+        const auto actual = book.getLevels(side);
+        ASSERT_EQ(actual.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(actual[i].price, expected[i].price);
+            EXPECT_EQ(actual[i].quantity, expected[i].quantity);
+        }
+    }
+    EXPECT_EQ(book.getBestBid()->price, reference.getBestBid()->price);
+    EXPECT_EQ(book.getBestAsk()->price, reference.getBestAsk()->price);
+}
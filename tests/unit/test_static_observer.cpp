@@ -0,0 +1,169 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/orderbook_l2.hpp>
+#include <slick/orderbook/orderbook_l3.hpp>
+#include <slick/orderbook/detail/impl/orderbook_l2_impl.hpp>
+#include <slick/orderbook/detail/impl/orderbook_l3_impl.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace slick::orderbook;
+
+namespace {
+
+/// Observer that only cares about top-of-book (no base class, no virtuals)
+struct TopOfBookOnlyObserver {
+    std::vector<TopOfBook> tob_updates;
+
+    void onTopOfBookUpdate(const TopOfBook& tob) {
+        tob_updates.push_back(tob);
+    }
+};
+
+/// Observer implementing every callback, recording what it sees
+struct RecordingObserver {
+    std::vector<PriceLevelUpdate> level_updates;
+    std::vector<OrderUpdate> order_updates;
+    std::vector<TopOfBook> tob_updates;
+    int snapshot_begin_count = 0;
+    int snapshot_end_count = 0;
+
+    void onPriceLevelUpdate(const PriceLevelUpdate& update) { level_updates.push_back(update); }
+    void onOrderUpdate(const OrderUpdate& update) { order_updates.push_back(update); }
+    void onTrade([[maybe_unused]] const Trade& trade) {}
+    void onTopOfBookUpdate(const TopOfBook& tob) { tob_updates.push_back(tob); }
+    void onSnapshotBegin(SymbolId, uint64_t, Timestamp) { ++snapshot_begin_count; }
+    void onSnapshotEnd(SymbolId, uint64_t, Timestamp) { ++snapshot_end_count; }
+};
+
+/// Same recording through the virtual interface
+class VirtualRecordingObserver : public IOrderBookObserver {
+public:
+    RecordingObserver recorded;
+
+    void onPriceLevelUpdate(const PriceLevelUpdate& update) override { recorded.onPriceLevelUpdate(update); }
+    void onOrderUpdate(const OrderUpdate& update) override { recorded.onOrderUpdate(update); }
+    void onTopOfBookUpdate(const TopOfBook& tob) override { recorded.onTopOfBookUpdate(tob); }
+};
+
+}  // namespace
+
+// Callbacks an observer does not implement are known at compile time
+static_assert(!StaticObserverDispatch<TopOfBookOnlyObserver>::wantsPriceLevelUpdates());
+static_assert(!StaticObserverDispatch<TopOfBookOnlyObserver>::wantsOrderUpdates());
+static_assert(StaticObserverDispatch<TopOfBookOnlyObserver>::wantsTopOfBookUpdates());
+static_assert(StaticObserverDispatch<RecordingObserver>::wantsOrderUpdates());
+
+// The runtime observer list is only available with ObserverManager dispatch
+template<typename Book>
+concept HasObserverList = requires(Book& book) { book.addObserver(nullptr); };
+
+template<typename Book>
+concept HasStaticObserver = requires(Book& book) { book.observer(); };
+
+static_assert(!HasObserverList<StaticObserverOrderBookL2<RecordingObserver>>);
+static_assert(HasStaticObserver<StaticObserverOrderBookL2<RecordingObserver>>);
+static_assert(HasObserverList<OrderBookL2>);
+static_assert(!HasStaticObserver<OrderBookL3>);
+
+TEST(StaticObserverTest, L2TopOfBookOnlyObserver) {
+    StaticObserverOrderBookL2<TopOfBookOnlyObserver> book(1);
+
+    book.updateLevel(Side::Buy, 10000, 100, 1);
+    book.updateLevel(Side::Buy, 9900, 100, 2);     // Not top of book
+    book.updateLevel(Side::Sell, 10100, 50, 3);
+
+    const auto& tob = book.observer().tob_updates;
+    ASSERT_EQ(tob.size(), 2);
+    EXPECT_EQ(tob[0].best_bid, 10000);
+    EXPECT_EQ(tob[1].best_ask, 10100);
+    EXPECT_EQ(tob[1].ask_quantity, 50);
+}
+
+TEST(StaticObserverTest, L2MatchesVirtualDispatch) {
+    StaticObserverOrderBookL2<RecordingObserver> static_book(1);
+    OrderBookL2 virtual_book(1);
+    auto observer = std::make_shared<VirtualRecordingObserver>();
+    virtual_book.addObserver(observer);
+
+    auto apply = [](auto& book) {
+        book.updateLevel(Side::Buy, 10000, 100, 1, 1);
+        book.updateLevel(Side::Buy, 10010, 100, 2, 2, false);
+        book.updateLevel(Side::Sell, 10020, 100, 3, 3);
+        book.updateLevel(Side::Buy, 10010, 0, 4, 4);
+        book.updateLevel(Side::Sell, 10030, 70, 5, 5);
+    };
+    apply(static_book);
+    apply(virtual_book);
+
+    const auto& expected = observer->recorded;
+    const auto& actual = static_book.observer();
+    ASSERT_EQ(actual.level_updates.size(), expected.level_updates.size());
+    for (std::size_t i = 0; i < expected.level_updates.size(); ++i) {
+        EXPECT_EQ(actual.level_updates[i].price, expected.level_updates[i].price);
+        EXPECT_EQ(actual.level_updates[i].quantity, expected.level_updates[i].quantity);
+        EXPECT_EQ(actual.level_updates[i].level_index, expected.level_updates[i].level_index);
+        EXPECT_EQ(actual.level_updates[i].change_flags, expected.level_updates[i].change_flags);
+    }
+    ASSERT_EQ(actual.tob_updates.size(), expected.tob_updates.size());
+    for (std::size_t i = 0; i < expected.tob_updates.size(); ++i) {
+        EXPECT_EQ(actual.tob_updates[i].best_bid, expected.tob_updates[i].best_bid);
+        EXPECT_EQ(actual.tob_updates[i].best_ask, expected.tob_updates[i].best_ask);
+    }
+}
+
+TEST(StaticObserverTest, L2Snapshot) {
+    StaticObserverOrderBookL2<RecordingObserver> book(1);
+    book.updateLevel(Side::Buy, 10000, 100, 1);
+    book.updateLevel(Side::Sell, 10100, 100, 1);
+    book.observer().level_updates.clear();
+
+    book.emitSnapshot(2);
+    EXPECT_EQ(book.observer().snapshot_begin_count, 1);
+    EXPECT_EQ(book.observer().snapshot_end_count, 1);
+    EXPECT_EQ(book.observer().level_updates.size(), 2);
+}
+
+TEST(StaticObserverTest, L3MatchesVirtualDispatch) {
+    StaticObserverOrderBookL3<RecordingObserver> static_book(1);
+    OrderBookL3 virtual_book(1);
+    auto observer = std::make_shared<VirtualRecordingObserver>();
+    virtual_book.addObserver(observer);
+
+    auto apply = [](auto& book) {
+        book.addOrder(1, Side::Buy, 10000, 100, 1);
+        book.addOrder(2, Side::Buy, 10000, 50, 2);
+        book.addOrder(3, Side::Sell, 10100, 75, 3);
+        book.modifyOrder(2, 9900, 50, 4);
+        book.executeOrder(1, 40, 5);
+        book.deleteOrder(3, 6);
+    };
+    apply(static_book);
+    apply(virtual_book);
+
+    const auto& expected = observer->recorded;
+    const auto& actual = static_book.observer();
+    ASSERT_EQ(actual.order_updates.size(), expected.order_updates.size());
+    for (std::size_t i = 0; i < expected.order_updates.size(); ++i) {
+        EXPECT_EQ(actual.order_updates[i].order_id, expected.order_updates[i].order_id);
+        EXPECT_EQ(actual.order_updates[i].quantity, expected.order_updates[i].quantity);
+        EXPECT_EQ(actual.order_updates[i].price_level_index, expected.order_updates[i].price_level_index);
+    }
+    EXPECT_EQ(actual.level_updates.size(), expected.level_updates.size());
+    EXPECT_EQ(actual.tob_updates.size(), expected.tob_updates.size());
+    EXPECT_EQ(static_book.getTopOfBook().best_bid, virtual_book.getTopOfBook().best_bid);
+}
+
+TEST(StaticObserverTest, L3ComposesWithOtherTraits) {
+    using Book = BasicOrderBookL3<StaticObserverOrderBookL3Traits<TopOfBookOnlyObserver, LadderOrderBookL3Traits>>;
+    Book book(1, PriceLadderConfig{1, 64});
+
+    book.addOrder(1, Side::Buy, 10000, 100, 1);
+    book.addOrder(2, Side::Buy, 10001, 100, 2);
+    book.addOrder(3, Side::Buy, 9990, 100, 3);
+
+    ASSERT_EQ(book.observer().tob_updates.size(), 2);
+    EXPECT_EQ(book.observer().tob_updates.back().best_bid, 10001);
+}
@@ -0,0 +1,109 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/detail/stop_order_index.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace slick::orderbook;
+using namespace slick::orderbook::detail;
+
+namespace {
+
+StopOrder stop(OrderId id, Side side, Price stop_price, Quantity quantity = 10) {
+    return {id, stop_price, 0, quantity, id, side, OrderType::Stop, TimeInForce::Day};
+}
+
+/// Pop every stop of side triggered at last_price, returning their ids in trigger order
+std::vector<OrderId> popAll(StopOrderIndex& index, Side side, Price last_price) {
+    std::vector<OrderId> ids;
+    while (auto triggered = index.popTriggered(side, last_price)) {
+        ids.push_back(triggered->order_id);
+    }
+    return ids;
+}
+
+}  // namespace
+
+TEST(StopOrderIndexTest, BuyStopsTriggerLowestFirst) {
+    StopOrderIndex index;
+    EXPECT_TRUE(index.empty());
+    EXPECT_TRUE(index.insert(stop(1, Side::Buy, 105)));
+    EXPECT_TRUE(index.insert(stop(2, Side::Buy, 103)));
+    EXPECT_TRUE(index.insert(stop(3, Side::Buy, 103)));
+    EXPECT_TRUE(index.insert(stop(4, Side::Buy, 110)));
+    EXPECT_FALSE(index.insert(stop(2, Side::Buy, 120)));  // Duplicate id
+    EXPECT_EQ(index.size(), 4);
+    EXPECT_EQ(index.size(Side::Buy), 4);
+    EXPECT_EQ(index.size(Side::Sell), 0);
+
+    EXPECT_FALSE(index.triggers(Side::Buy, 102));
+    EXPECT_TRUE(popAll(index, Side::Buy, 102).empty());
+    // Equal stop prices trigger in arrival order
+    EXPECT_EQ(popAll(index, Side::Buy, 105), (std::vector<OrderId>{2, 3, 1}));
+    EXPECT_EQ(index.size(), 1);
+    EXPECT_EQ(index.find(2), nullptr);
+    ASSERT_NE(index.find(4), nullptr);
+    EXPECT_EQ(index.find(4)->stop_price, 110);
+}
+
+TEST(StopOrderIndexTest, SellStopsTriggerHighestFirst) {
+    StopOrderIndex index;
+    index.insert(stop(1, Side::Sell, 95));
+    index.insert(stop(2, Side::Sell, 97));
+    index.insert(stop(3, Side::Sell, 90));
+    index.insert(stop(4, Side::Sell, 97));
+
+    EXPECT_TRUE(popAll(index, Side::Sell, 98).empty());
+    EXPECT_FALSE(index.triggers(Side::Buy, 98));
+    EXPECT_EQ(popAll(index, Side::Sell, 95), (std::vector<OrderId>{2, 4, 1}));
+    EXPECT_EQ(popAll(index, Side::Sell, 0), (std::vector<OrderId>{3}));
+    EXPECT_TRUE(index.empty());
+}
+
+TEST(StopOrderIndexTest, EraseAndClear) {
+    StopOrderIndex index;
+    for (OrderId id = 1; id <= 6; ++id) {
+        index.insert(stop(id, Side::Buy, 100 + static_cast<Price>(id % 2)));
+    }
+    EXPECT_TRUE(index.erase(3));
+    EXPECT_FALSE(index.erase(3));
+    EXPECT_FALSE(index.erase(42));
+    EXPECT_EQ(index.size(Side::Buy), 5);
+    EXPECT_EQ(popAll(index, Side::Buy, 100), (std::vector<OrderId>{2, 4, 6}));
+    EXPECT_EQ(popAll(index, Side::Buy, 101), (std::vector<OrderId>{1, 5}));
+
+    index.insert(stop(7, Side::Buy, 100));
+    index.insert(stop(8, Side::Sell, 100));
+    index.clear();
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(index.size(Side::Sell), 0);
+    EXPECT_FALSE(index.contains(8));
+    // Ids are free again
+    EXPECT_TRUE(index.insert(stop(8, Side::Sell, 100)));
+}
+
+TEST(StopOrderIndexTest, MatchesStableSortUnderChurn) {
+    StopOrderIndex index;
+    std::vector<StopOrder> live;
+    std::mt19937_64 rng(25);
+    for (OrderId id = 1; id <= 3000; ++id) {
+        if (!live.empty() && rng() % 3 == 0) {
+            const std::size_t i = rng() % live.size();
+            ASSERT_TRUE(index.erase(live[i].order_id));
+            live.erase(live.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        live.push_back(stop(id, Side::Sell, static_cast<Price>(rng() % 50)));
+        ASSERT_TRUE(index.insert(live.back()));
+    }
+    // Highest stop price first, arrival order among equals
+    std::stable_sort(live.begin(), live.end(),
+                     [](const StopOrder& a, const StopOrder& b) { return a.stop_price > b.stop_price; });
+    std::vector<OrderId> expected;
+    for (const StopOrder& order : live) {
+        expected.push_back(order.order_id);
+    }
+    EXPECT_EQ(popAll(index, Side::Sell, 0), expected);
+}
@@ -0,0 +1,247 @@
+// Copyright 2026 Slick Quant
+// SPDX-License-Identifier: MIT
+
+#include <slick/orderbook/wire_format.hpp>
+#include <gtest/gtest.h>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+using namespace slick::orderbook;
+
+namespace {
+
+// 8-byte aligned like a shared memory slot or a receive buffer would be
+struct alignas(8) Buffer {
+    std::array<std::byte, 128> bytes{};
+    std::span<std::byte> span() noexcept { return bytes; }
+};
+
+uint8_t byteAt(const Buffer& buffer, std::size_t offset) {
+    return std::to_integer<uint8_t>(buffer.bytes[offset]);
+}
+
+}  // namespace
+
+TEST(WireFormatTest, Sizes) {
+    static_assert(kWireSize<PriceLevelUpdate> == 64);
+    static_assert(kWireSize<OrderUpdate> == 80);
+    static_assert(kWireSize<TopOfBook> == 56);
+    static_assert(kWireSize<Trade> == 56);
+    static_assert(WireHeader::kSize == 8);
+}
+
+TEST(WireFormatTest, PriceLevelUpdateLittleEndianLayout) {
+    const PriceLevelUpdate update(0x0102030405060708, 0x0A0B, Side::Sell, -2, 0x1122, 0x10007, 3,
+                                  PriceChanged | LastInBatch, 0x99, 0x3344, 0x55);
+    Buffer buffer;
+    buffer.bytes.fill(std::byte{0xFF});
+    ASSERT_EQ(encodeWire(update, buffer.span()), 64);
+
+    // Header
+    EXPECT_EQ(byteAt(buffer, 0), 64);
+    EXPECT_EQ(byteAt(buffer, 1), 0);
+    EXPECT_EQ(byteAt(buffer, 2), static_cast<uint8_t>(WireType::PriceLevelUpdate));
+    EXPECT_EQ(byteAt(buffer, 3), kWireVersion);
+    EXPECT_EQ(byteAt(buffer, 4), 0x0B);
+    EXPECT_EQ(byteAt(buffer, 5), 0x0A);
+    EXPECT_EQ(byteAt(buffer, 6), 0);
+    EXPECT_EQ(byteAt(buffer, 7), 0);
+
+    // Fields, least significant byte first
+    for (std::size_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(byteAt(buffer, 8 + i), 8 - i);
+    }
+    EXPECT_EQ(byteAt(buffer, 16), 0x99);
+    EXPECT_EQ(byteAt(buffer, 24), 0xFE);
+    EXPECT_EQ(byteAt(buffer, 31), 0xFF);    // Two's complement sign bits
+    EXPECT_EQ(byteAt(buffer, 32), 0x22);
+    EXPECT_EQ(byteAt(buffer, 33), 0x11);
+    EXPECT_EQ(byteAt(buffer, 40), 3);
+    EXPECT_EQ(byteAt(buffer, 42), PriceChanged | LastInBatch);
+    EXPECT_EQ(byteAt(buffer, 43), Side::Sell);
+    EXPECT_EQ(byteAt(buffer, 44), 7);       // Order count is 32 bits wide
+    EXPECT_EQ(byteAt(buffer, 46), 1);
+    EXPECT_EQ(byteAt(buffer, 48), 0x44);
+    EXPECT_EQ(byteAt(buffer, 49), 0x33);
+    EXPECT_EQ(byteAt(buffer, 56), 0x55);
+    EXPECT_EQ(byteAt(buffer, 63), 0);
+    EXPECT_EQ(byteAt(buffer, 64), 0xFF);    // Nothing written past the message
+}
+
+TEST(WireFormatTest, PriceLevelUpdateRoundTrip) {
+    const PriceLevelUpdate update(123456789, 42, Side::Buy, 10050, 300, 70000, 1, QuantityChanged, 77, 120, 123456);
+    Buffer buffer;
+    ASSERT_EQ(encodeWire(update, buffer.span()), kWireSize<PriceLevelUpdate>);
+
+    const auto view = PriceLevelUpdateView::decode(buffer.bytes);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->symbol(), 42);
+    EXPECT_EQ(view->price(), 10050);
+    EXPECT_EQ(view->numOrders(), 70000);
+    EXPECT_EQ(view->maxOrderQuantity(), 120);
+    EXPECT_EQ(view->oldestTimestamp(), 123456);
+    EXPECT_EQ(view->bytes().size(), kWireSize<PriceLevelUpdate>);
+
+    const PriceLevelUpdate decoded = view->event();
+    EXPECT_EQ(decoded.timestamp, update.timestamp);
+    EXPECT_EQ(decoded.seq_num, update.seq_num);
+    EXPECT_EQ(decoded.price, update.price);
+    EXPECT_EQ(decoded.quantity, update.quantity);
+    EXPECT_EQ(decoded.symbol, update.symbol);
+    EXPECT_EQ(decoded.level_index, update.level_index);
+    EXPECT_EQ(decoded.num_orders, update.num_orders);
+    EXPECT_EQ(decoded.max_order_quantity, update.max_order_quantity);
+    EXPECT_EQ(decoded.oldest_timestamp, update.oldest_timestamp);
+    EXPECT_EQ(decoded.change_flags, update.change_flags);
+    EXPECT_EQ(decoded.side, update.side);
+}
+
+TEST(WireFormatTest, OrderUpdateRoundTrip) {
+    const OrderUpdate update(7, 0xDEADBEEFCAFE, Side::Sell, 101, 25, 100, 30, 555, 2, 999,
+                             PriceChanged | QuantityChanged, 12);
+    Buffer buffer;
+    ASSERT_EQ(encodeWire(update, buffer.span()), kWireSize<OrderUpdate>);
+    EXPECT_EQ(byteAt(buffer, 74), Side::Sell);
+    EXPECT_EQ(byteAt(buffer, 76), 0);
+
+    const auto view = OrderUpdateView::decode(buffer.bytes);
+    ASSERT_TRUE(view.has_value());
+    const OrderUpdate decoded = view->event();
+    EXPECT_EQ(decoded.timestamp, 555);
+    EXPECT_EQ(decoded.seq_num, 12);
+    EXPECT_EQ(decoded.order_id, 0xDEADBEEFCAFE);
+    EXPECT_EQ(decoded.price, 101);
+    EXPECT_EQ(decoded.quantity, 25);
+    EXPECT_EQ(decoded.old_price, 100);
+    EXPECT_EQ(decoded.old_qty, 30);
+    EXPECT_EQ(decoded.symbol, 7);
+    EXPECT_EQ(decoded.price_level_index, 2);
+    EXPECT_EQ(decoded.priority, 999);
+    EXPECT_EQ(decoded.side, Side::Sell);
+    EXPECT_EQ(decoded.change_flags, PriceChanged | QuantityChanged);
+}
+
+TEST(WireFormatTest, TopOfBookRoundTrip) {
+    TopOfBook tob(3, 9990, 50, 10010, 60, 1000);
+    tob.change_flags = {PriceChanged, QuantityChanged};
+    Buffer buffer;
+    ASSERT_EQ(encodeWire(tob, buffer.span()), kWireSize<TopOfBook>);
+
+    const auto view = TopOfBookView::decode(buffer.bytes);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->changeFlags(Side::Buy), PriceChanged);
+    EXPECT_EQ(view->changeFlags(Side::Sell), QuantityChanged);
+    const TopOfBook decoded = view->event();
+    EXPECT_EQ(decoded.symbol, 3);
+    EXPECT_EQ(decoded.best_bid, 9990);
+    EXPECT_EQ(decoded.bid_quantity, 50);
+    EXPECT_EQ(decoded.best_ask, 10010);
+    EXPECT_EQ(decoded.ask_quantity, 60);
+    EXPECT_EQ(decoded.timestamp, 1000);
+    EXPECT_EQ(decoded.change_flags, tob.change_flags);
+}
+
+TEST(WireFormatTest, TradeRoundTrip) {
+    const Trade trade(5, 10000, 15, 2000, Side::Sell, 11, 22, LastInBatch);
+    Buffer buffer;
+    ASSERT_EQ(encodeWire(trade, buffer.span()), kWireSize<Trade>);
+
+    const auto view = TradeView::decode(buffer.bytes);
+    ASSERT_TRUE(view.has_value());
+    const Trade decoded = view->event();
+    EXPECT_EQ(decoded.symbol, 5);
+    EXPECT_EQ(decoded.price, 10000);
+    EXPECT_EQ(decoded.quantity, 15);
+    EXPECT_EQ(decoded.timestamp, 2000);
+    EXPECT_EQ(decoded.aggressor_side, Side::Sell);
+    EXPECT_EQ(decoded.passive_order_id, 11);
+    EXPECT_EQ(decoded.aggressive_order_id, 22);
+    EXPECT_EQ(decoded.change_flags, LastInBatch);
+}
+
+TEST(WireFormatTest, EncodeIntoShortBufferWritesNothing) {
+    Buffer buffer;
+    const OrderUpdate update(1, 1, Side::Buy, 100, 10, 0, 0, 1);
+    EXPECT_EQ(encodeWire(update, buffer.span().first(kWireSize<OrderUpdate> - 1)), 0);
+    for (const std::byte b : buffer.bytes) {
+        EXPECT_EQ(b, std::byte{0});
+    }
+}
+
+TEST(WireFormatTest, DecodeRejectsMalformedMessages) {
+    Buffer buffer;
+    ASSERT_EQ(encodeWire(PriceLevelUpdate(1, 1, Side::Buy, 100, 10), buffer.span()), 64);
+    const std::span<const std::byte> message(buffer.bytes.data(), 64);
+
+    // Truncated
+    EXPECT_FALSE(PriceLevelUpdateView::decode(message.first(63)).has_value());
+    EXPECT_FALSE(readWireHeader(message.first(7)).has_value());
+    // Wrong type
+    EXPECT_FALSE(OrderUpdateView::decode(buffer.bytes).has_value());
+    EXPECT_FALSE(TradeView::decode(message).has_value());
+
+    // Unknown version
+    buffer.bytes[3] = std::byte{kWireVersion + 1};
+    EXPECT_FALSE(PriceLevelUpdateView::decode(message).has_value());
+    EXPECT_FALSE(readWireHeader(message).has_value());
+    buffer.bytes[3] = std::byte{kWireVersion};
+
+    // Length shorter than the layout, or longer than the buffer
+    buffer.bytes[0] = std::byte{56};
+    EXPECT_FALSE(PriceLevelUpdateView::decode(message).has_value());
+    buffer.bytes[0] = std::byte{72};
+    EXPECT_FALSE(PriceLevelUpdateView::decode(message).has_value());
+    EXPECT_FALSE(readWireHeader(message).has_value());
+}
+
+TEST(WireFormatTest, DecodeAcceptsAppendedFields) {
+    // A newer encoder of the same version appended 8 bytes; older decoders read the known prefix
+    Buffer buffer;
+    ASSERT_EQ(encodeWire(Trade(9, 100, 1, 1, Side::Buy), buffer.span()), 56);
+    buffer.bytes[0] = std::byte{64};
+
+    const auto header = readWireHeader(buffer.bytes);
+    ASSERT_TRUE(header.has_value());
+    EXPECT_EQ(header->length, 64);
+    const auto view = TradeView::decode(buffer.bytes);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->price(), 100);
+    EXPECT_EQ(view->bytes().size(), 64);
+}
+
+TEST(WireFormatTest, MixedStream) {
+    // Messages back to back in one buffer, walked by header length
+    std::vector<std::byte> stream(1024);
+    std::size_t used = 0;
+    const auto append = [&](const auto& event) {
+        const std::size_t written = encodeWire(event, std::span(stream).subspan(used));
+        ASSERT_GT(written, 0);
+        used += written;
+    };
+    for (int i = 0; i < 3; ++i) {
+        append(PriceLevelUpdate(i, 1, Side::Buy, 100 + i, 10));
+        append(OrderUpdate(1, static_cast<OrderId>(i), Side::Sell, 200, 5, 0, 0, i));
+        append(TopOfBook(1, 100 + i, 10, 200, 5, i));
+        append(Trade(1, 200, 1, i, Side::Buy));
+    }
+    ASSERT_EQ(used, 3 * (64 + 80 + 56 + 56));
+
+    std::array<int, 5> seen{};
+    Price level_price_sum = 0;
+    std::span<const std::byte> rest(stream.data(), used);
+    while (!rest.empty()) {
+        const auto header = readWireHeader(rest);
+        ASSERT_TRUE(header.has_value());
+        ++seen[static_cast<uint8_t>(header->type)];
+        if (header->type == WireType::PriceLevelUpdate) {
+            level_price_sum += PriceLevelUpdateView::decode(rest)->price();
+        }
+        rest = rest.subspan(header->length);
+    }
+    EXPECT_EQ(seen[static_cast<uint8_t>(WireType::PriceLevelUpdate)], 3);
+    EXPECT_EQ(seen[static_cast<uint8_t>(WireType::OrderUpdate)], 3);
+    EXPECT_EQ(seen[static_cast<uint8_t>(WireType::TopOfBook)], 3);
+    EXPECT_EQ(seen[static_cast<uint8_t>(WireType::Trade)], 3);
+    EXPECT_EQ(level_price_sum, 303);
+}